@@ -194,8 +194,9 @@ public class ComprehensivePackageTester : MonoBehaviour
 
             foreach (string methodName in requiredMethods)
             {
-                MethodInfo method = systemType.GetMethod(methodName);
-                if (method == null)
+                // ExportState is overloaded, so match by name rather than GetMethod
+                MemberInfo[] methods = systemType.GetMember(methodName, MemberTypes.Method, BindingFlags.Public | BindingFlags.Instance);
+                if (methods.Length == 0)
                 {
                     errors.Add($"Missing method: {methodName}");
                     return false;
@@ -253,7 +254,7 @@ public class ComprehensivePackageTester : MonoBehaviour
             Component system = testGO.AddComponent(systemType);
 
             // Test ExportState method
-            MethodInfo exportMethod = systemType.GetMethod("ExportState");
+            MethodInfo exportMethod = systemType.GetMethod("ExportState", Type.EmptyTypes);
             if (exportMethod != null)
             {
                 string result = (string)exportMethod.Invoke(system, null);
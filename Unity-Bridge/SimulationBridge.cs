@@ -1,7 +1,11 @@
 using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
+using System.Text;
 using UnityEngine;
 using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Bridge
 {
@@ -10,12 +14,14 @@ namespace UnitySim.Bridge
         [Header("Bridge Settings")]
         public bool useWebGLBridge = true;
         public float updateInterval = 1f;
+        public int initialBatchCapacity = 16 * 1024;
 
         [Header("Available Simulations")]
         public bool enableWeather = true;
         public bool enableEconomy = true;
         public bool enablePhysics = true;
         public bool enableAI = true;
+        public SimulationId[] additionalSimulations = new SimulationId[0];
 
         // Events for different simulation types
         public System.Action<string> OnWeatherDataReceived;
@@ -23,8 +29,25 @@ namespace UnitySim.Bridge
         public System.Action<string> OnPhysicsDataReceived;
         public System.Action<string> OnAIDataReceived;
 
+        // Any simulation, as a decoded JSON string
+        public System.Action<SimulationId, string> OnSimulationDataReceived;
+
+        // Any simulation, as raw UTF-8 JSON; the segment is only valid during the callback
+        public System.Action<SimulationId, ArraySegment<byte>> OnSimulationBytesReceived;
+
         private float updateTimer;
 
+        // Batch layout: per record [int32 id][int32 byteLength][utf8 json], little-endian
+        private const int RecordHeaderSize = 8;
+
+        private byte[] batchBuffer;
+        private GCHandle batchHandle;
+        private int[] activeIds = new int[0];
+        private GCHandle idsHandle;
+        private int activeCount = 0;
+        private bool idsDirty = true;
+        private PooledBufferWriter localBatch;
+
         #if UNITY_WEBGL && !UNITY_EDITOR
         [DllImport("__Internal")]
         private static extern void InitializeSimulations();
@@ -34,6 +57,14 @@ namespace UnitySim.Bridge
 
         [DllImport("__Internal")]
         private static extern void UpdateSimulation(string simulationType, string parameters);
+
+        [DllImport("__Internal")]
+        private static extern void RegisterSimulation(int simulationId, string simulationType);
+
+        // Writes every requested simulation into buffer in one crossing. Returns the bytes
+        // written, or the negated size required when capacity is too small.
+        [DllImport("__Internal")]
+        private static extern int FetchSimulationBatch(IntPtr ids, int idCount, IntPtr buffer, int capacity);
         #endif
 
         void Start()
@@ -43,7 +74,7 @@ namespace UnitySim.Bridge
 
         void Update()
         {
-            updateTimer += Time.deltaTime;
+            updateTimer += UnityEngine.Time.deltaTime;
 
             if (updateTimer >= updateInterval)
             {
@@ -52,42 +83,87 @@ namespace UnitySim.Bridge
             }
         }
 
+        void OnValidate()
+        {
+            idsDirty = true;
+        }
+
+        void OnDestroy()
+        {
+            ReleaseBuffers();
+        }
+
         private void InitializeBridge()
         {
+            AllocateBatchBuffer(Mathf.Max(1024, initialBatchCapacity));
+
             #if UNITY_WEBGL && !UNITY_EDITOR
             if (useWebGLBridge)
             {
                 InitializeSimulations();
+
+                // Keys cross the boundary once here; every later call uses integer ids
+                for (int i = 0; i < SimulationIds.Count; i++)
+                {
+                    RegisterSimulation(i, SimulationIds.GetKey((SimulationId)i));
+                }
+
                 Debug.Log("🌐 WebGL Simulation Bridge initialized");
             }
             #else
-            Debug.Log("🔧 Using mock simulation data (Editor/Standalone)");
+            Debug.Log("🔧 Using local simulation data (Editor/Standalone)");
             #endif
         }
 
         private void RequestAllSimulationData()
         {
-            if (enableWeather) RequestSimulationData("weather");
-            if (enableEconomy) RequestSimulationData("economy");
-            if (enablePhysics) RequestSimulationData("physics");
-            if (enableAI) RequestSimulationData("ai");
+            if (idsDirty)
+                RebuildActiveIds();
+
+            if (activeCount == 0) return;
+
+            #if UNITY_WEBGL && !UNITY_EDITOR
+            if (useWebGLBridge)
+            {
+                FetchRemoteBatch();
+                return;
+            }
+            #endif
+
+            FetchLocalBatch();
+        }
+
+        // Call after changing the enable flags or additionalSimulations at runtime
+        public void RefreshEnabledSimulations()
+        {
+            idsDirty = true;
         }
 
         public void RequestSimulationData(string simulationType)
         {
-            #if UNITY_WEBGL && !UNITY_EDITOR
-            if (useWebGLBridge)
+            if (!SimulationIds.TryParse(simulationType, out var id))
             {
-                string data = GetSimulationData(simulationType);
-                ProcessSimulationData(simulationType, data);
+                Debug.LogWarning($"Unknown simulation type: {simulationType}");
+                return;
             }
-            else
+
+            RequestSimulationData(id);
+        }
+
+        public void RequestSimulationData(SimulationId id)
+        {
+            #if UNITY_WEBGL && !UNITY_EDITOR
+            if (useWebGLBridge)
             {
-                GenerateMockData(simulationType);
+                string data = GetSimulationData(SimulationIds.GetKey(id));
+                if (!string.IsNullOrEmpty(data))
+                    DispatchString(id, data);
+                return;
             }
-            #else
-            GenerateMockData(simulationType);
             #endif
+
+            if (!ExportLocal(id))
+                GenerateMockData(id);
         }
 
         public void UpdateSimulationParameters(string simulationType, string parameters)
@@ -100,42 +176,185 @@ namespace UnitySim.Bridge
             #endif
         }
 
-        private void ProcessSimulationData(string simulationType, string jsonData)
+        #region Batching
+
+        #if UNITY_WEBGL && !UNITY_EDITOR
+        private void FetchRemoteBatch()
         {
-            if (string.IsNullOrEmpty(jsonData)) return;
+            int written = FetchSimulationBatch(idsHandle.AddrOfPinnedObject(), activeCount, batchHandle.AddrOfPinnedObject(), batchBuffer.Length);
 
-            try
+            if (written < 0)
             {
-                switch (simulationType.ToLower())
+                // Grow once to the reported size; this tick's data is dropped rather than refetched
+                AllocateBatchBuffer(Mathf.NextPowerOfTwo(-written));
+                return;
+            }
+
+            ProcessBatch(batchBuffer, written);
+        }
+        #endif
+
+        private void FetchLocalBatch()
+        {
+            if (localBatch == null)
+                localBatch = new PooledBufferWriter(batchBuffer.Length);
+
+            localBatch.Clear();
+            for (int i = 0; i < activeCount; i++)
+            {
+                var id = (SimulationId)activeIds[i];
+                var system = SimulationRegistry.Get(SimulationIds.GetSystemName(id));
+                if (system == null)
                 {
-                    case "weather":
-                        OnWeatherDataReceived?.Invoke(jsonData);
-                        break;
-                    case "economy":
-                        OnEconomyDataReceived?.Invoke(jsonData);
-                        break;
-                    case "physics":
-                        OnPhysicsDataReceived?.Invoke(jsonData);
-                        break;
-                    case "ai":
-                        OnAIDataReceived?.Invoke(jsonData);
-                        break;
-                    default:
-                        Debug.LogWarning($"Unknown simulation type: {simulationType}");
-                        break;
+                    GenerateMockData(id);
+                    continue;
                 }
+
+                int start = localBatch.WrittenCount;
+                BinaryPrimitives.WriteInt32LittleEndian(localBatch.GetSpan(RecordHeaderSize), (int)id);
+                localBatch.Advance(RecordHeaderSize);
+
+                system.ExportState(localBatch);
+
+                var written = localBatch.WrittenSegment;
+                BinaryPrimitives.WriteInt32LittleEndian(new Span<byte>(written.Array, start + 4, 4), written.Count - start - RecordHeaderSize);
+            }
+
+            var batch = localBatch.WrittenSegment;
+            ProcessBatch(batch.Array, batch.Count);
+        }
+
+        private bool ExportLocal(SimulationId id)
+        {
+            var system = SimulationRegistry.Get(SimulationIds.GetSystemName(id));
+            if (system == null) return false;
+
+            DispatchString(id, system.ExportState());
+            return true;
+        }
+
+        private void ProcessBatch(byte[] buffer, int length)
+        {
+            int offset = 0;
+            while (offset + RecordHeaderSize <= length)
+            {
+                int id = BinaryPrimitives.ReadInt32LittleEndian(new ReadOnlySpan<byte>(buffer, offset, 4));
+                int size = BinaryPrimitives.ReadInt32LittleEndian(new ReadOnlySpan<byte>(buffer, offset + 4, 4));
+                offset += RecordHeaderSize;
+
+                if (size < 0 || offset + size > length)
+                {
+                    Debug.LogError("SimulationBridge: Malformed batch record");
+                    return;
+                }
+
+                if (size > 0 && SimulationIds.IsValid(id))
+                    DispatchBytes((SimulationId)id, new ArraySegment<byte>(buffer, offset, size));
+
+                offset += size;
+            }
+        }
+
+        private void DispatchBytes(SimulationId id, ArraySegment<byte> json)
+        {
+            try
+            {
+                OnSimulationBytesReceived?.Invoke(id, json);
+
+                // Strings are only materialized when someone listens for them
+                var stringHandler = GetLegacyHandler(id);
+                if (stringHandler == null && OnSimulationDataReceived == null) return;
+
+                string data = Encoding.UTF8.GetString(json.Array, json.Offset, json.Count);
+                stringHandler?.Invoke(data);
+                OnSimulationDataReceived?.Invoke(id, data);
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"Error processing {id} data: {e.Message}");
+            }
+        }
+
+        private void DispatchString(SimulationId id, string jsonData)
+        {
+            try
+            {
+                GetLegacyHandler(id)?.Invoke(jsonData);
+                OnSimulationDataReceived?.Invoke(id, jsonData);
             }
             catch (Exception e)
             {
-                Debug.LogError($"Error processing {simulationType} data: {e.Message}");
+                Debug.LogError($"Error processing {id} data: {e.Message}");
             }
         }
 
-        private void GenerateMockData(string simulationType)
+        private System.Action<string> GetLegacyHandler(SimulationId id)
         {
-            switch (simulationType.ToLower())
+            switch (id)
             {
-                case "weather":
+                case SimulationId.Weather: return OnWeatherDataReceived;
+                case SimulationId.Economy: return OnEconomyDataReceived;
+                case SimulationId.Physics: return OnPhysicsDataReceived;
+                case SimulationId.AI: return OnAIDataReceived;
+                default: return null;
+            }
+        }
+
+        private void RebuildActiveIds()
+        {
+            var ids = new List<int>(SimulationIds.Count);
+            if (enableWeather) ids.Add((int)SimulationId.Weather);
+            if (enableEconomy) ids.Add((int)SimulationId.Economy);
+            if (enablePhysics) ids.Add((int)SimulationId.Physics);
+            if (enableAI) ids.Add((int)SimulationId.AI);
+
+            if (additionalSimulations != null)
+            {
+                foreach (var id in additionalSimulations)
+                {
+                    if (SimulationIds.IsValid((int)id) && !ids.Contains((int)id))
+                        ids.Add((int)id);
+                }
+            }
+
+            if (activeIds.Length < ids.Count)
+            {
+                if (idsHandle.IsAllocated) idsHandle.Free();
+                activeIds = new int[SimulationIds.Count];
+                idsHandle = GCHandle.Alloc(activeIds, GCHandleType.Pinned);
+            }
+            else if (!idsHandle.IsAllocated)
+            {
+                idsHandle = GCHandle.Alloc(activeIds, GCHandleType.Pinned);
+            }
+
+            ids.CopyTo(activeIds);
+            activeCount = ids.Count;
+            idsDirty = false;
+        }
+
+        private void AllocateBatchBuffer(int capacity)
+        {
+            if (batchHandle.IsAllocated) batchHandle.Free();
+
+            // Pinned for the bridge's lifetime so JavaScript can write straight into it
+            batchBuffer = new byte[capacity];
+            batchHandle = GCHandle.Alloc(batchBuffer, GCHandleType.Pinned);
+        }
+
+        private void ReleaseBuffers()
+        {
+            if (batchHandle.IsAllocated) batchHandle.Free();
+            if (idsHandle.IsAllocated) idsHandle.Free();
+        }
+
+        #endregion
+
+        private bool GenerateMockData(SimulationId id)
+        {
+            switch (id)
+            {
+                case SimulationId.Weather:
                     var weatherData = new
                     {
                         timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds(),
@@ -151,9 +370,9 @@ namespace UnitySim.Bridge
                         }
                     };
                     OnWeatherDataReceived?.Invoke(JsonConvert.SerializeObject(weatherData));
-                    break;
+                    return true;
 
-                case "economy":
+                case SimulationId.Economy:
                     var economyData = new
                     {
                         timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds(),
@@ -168,9 +387,9 @@ namespace UnitySim.Bridge
                         }
                     };
                     OnEconomyDataReceived?.Invoke(JsonConvert.SerializeObject(economyData));
-                    break;
+                    return true;
 
-                case "physics":
+                case SimulationId.Physics:
                     var physicsData = new
                     {
                         timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds(),
@@ -185,9 +404,9 @@ namespace UnitySim.Bridge
                         }
                     };
                     OnPhysicsDataReceived?.Invoke(JsonConvert.SerializeObject(physicsData));
-                    break;
+                    return true;
 
-                case "ai":
+                case SimulationId.AI:
                     var aiData = new
                     {
                         timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds(),
@@ -202,21 +421,26 @@ namespace UnitySim.Bridge
                         }
                     };
                     OnAIDataReceived?.Invoke(JsonConvert.SerializeObject(aiData));
-                    break;
+                    return true;
             }
+
+            return false;
         }
 
         // Public methods for manual control
         [ContextMenu("Request Weather Data")]
-        public void RequestWeatherData() => RequestSimulationData("weather");
+        public void RequestWeatherData() => RequestSimulationData(SimulationId.Weather);
 
         [ContextMenu("Request Economy Data")]
-        public void RequestEconomyData() => RequestSimulationData("economy");
+        public void RequestEconomyData() => RequestSimulationData(SimulationId.Economy);
 
         [ContextMenu("Request Physics Data")]
-        public void RequestPhysicsData() => RequestSimulationData("physics");
+        public void RequestPhysicsData() => RequestSimulationData(SimulationId.Physics);
 
         [ContextMenu("Request AI Data")]
-        public void RequestAIData() => RequestSimulationData("ai");
+        public void RequestAIData() => RequestSimulationData(SimulationId.AI);
+
+        [ContextMenu("Request All Data")]
+        public void RequestAllData() => RequestAllSimulationData();
     }
 }
\ No newline at end of file
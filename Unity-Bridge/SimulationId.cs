@@ -0,0 +1,153 @@
+using System;
+using System.Collections.Generic;
+
+namespace UnitySim.Bridge
+{
+    // Stable integer ids used on both sides of the WebGL bridge. Values are part of the
+    // wire format: append new simulations, never renumber.
+    public enum SimulationId
+    {
+        Weather = 0,
+        Economy = 1,
+        Physics = 2,
+        AI = 3,
+        AdvancedEconomics = 4,
+        Agriculture = 5,
+        AIDecisionFramework = 6,
+        Analytics = 7,
+        DataVisualization = 8,
+        DisasterManagement = 9,
+        Ecosystem = 10,
+        ElectricalGrid = 11,
+        FluidDynamics = 12,
+        Manufacturing = 13,
+        MiningGeology = 14,
+        MLIntegration = 15,
+        Modding = 16,
+        NetworkMultiplayer = 17,
+        Performance = 18,
+        Population = 19,
+        Procedural = 20,
+        ProceduralGeneration = 21,
+        RealWorldDataAdapters = 22,
+        Resources = 23,
+        SimulationAlgorithms = 24,
+        SupplyChain = 25,
+        Time = 26,
+        UITemplates = 27,
+        UrbanPlanning = 28,
+        VehicleSimulation = 29,
+    }
+
+    public static class SimulationIds
+    {
+        public const int Count = 30;
+
+        // Package keys understood by the JavaScript bridge
+        private static readonly string[] keys =
+        {
+            "weather",
+            "economy",
+            "physics",
+            "ai",
+            "advanced-economics",
+            "agriculture",
+            "ai-decision-framework",
+            "analytics",
+            "data-visualization",
+            "disaster-management",
+            "ecosystem",
+            "electrical-grid",
+            "fluid-dynamics",
+            "manufacturing",
+            "mining-geology",
+            "ml-integration",
+            "modding",
+            "network-multiplayer",
+            "performance",
+            "population",
+            "procedural",
+            "procedural-generation",
+            "real-world-data-adapters",
+            "resources",
+            "simulation-algorithms",
+            "supply-chain",
+            "time",
+            "ui-templates",
+            "urban-planning",
+            "vehicle-simulation",
+        };
+
+        // SystemName of the matching Unity package, for in-process lookups
+        private static readonly string[] systemNames =
+        {
+            "WeatherSystem",
+            "EconomySystem",
+            "PhysicsSystem",
+            "AISystem",
+            "AdvancedEconomicsSystem",
+            "AgricultureSystem",
+            "AIDecisionFrameworkSystem",
+            "AnalyticsSystem",
+            "DataVisualizationSystem",
+            "DisasterManagementSystem",
+            "EcosystemSystem",
+            "ElectricalGridSystem",
+            "FluidDynamicsSystem",
+            "ManufacturingSystem",
+            "MiningGeologySystem",
+            "MLIntegrationSystem",
+            "ModdingSystem",
+            "NetworkMultiplayerSystem",
+            "PerformanceSystem",
+            "PopulationSystem",
+            "ProceduralSystem",
+            "ProceduralGenerationSystem",
+            "RealWorldDataAdaptersSystem",
+            "ResourcesSystem",
+            "SimulationAlgorithmsSystem",
+            "SupplyChainSystem",
+            "TimeSystem",
+            "UITemplatesSystem",
+            "UrbanPlanningSystem",
+            "VehicleSimulationSystem",
+        };
+
+        private static readonly Dictionary<string, SimulationId> lookup = BuildLookup();
+
+        public static string GetKey(SimulationId id)
+        {
+            return keys[(int)id];
+        }
+
+        public static string GetSystemName(SimulationId id)
+        {
+            return systemNames[(int)id];
+        }
+
+        public static bool IsValid(int id)
+        {
+            return id >= 0 && id < Count;
+        }
+
+        // Accepts either the package key ("weather") or the system name ("WeatherSystem"), case-insensitively
+        public static bool TryParse(string value, out SimulationId id)
+        {
+            if (value != null && lookup.TryGetValue(value, out id)) return true;
+
+            id = default;
+            return false;
+        }
+
+        private static Dictionary<string, SimulationId> BuildLookup()
+        {
+            var result = new Dictionary<string, SimulationId>(Count * 2, StringComparer.OrdinalIgnoreCase);
+            for (int i = 0; i < Count; i++)
+            {
+                result[keys[i]] = (SimulationId)i;
+                result[systemNames[i]] = (SimulationId)i;
+            }
+            return result;
+        }
+    }
+}
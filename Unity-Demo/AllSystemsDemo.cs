@@ -1,9 +1,9 @@
 using System.Collections;
 using System.Collections.Generic;
+using System.Text;
 using UnityEngine;
 using UnityEngine.UI;
-using System.Reflection;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Demo
 {
@@ -13,6 +13,7 @@ namespace UnitySim.Demo
         public bool autoStartSystems = true;
         public float dataRefreshRate = 2f;
         public bool enableRealTimeDisplay = true;
+        public bool compressExports = false;
 
         [Header("UI Components")]
         public Transform systemsParent;
@@ -26,27 +27,16 @@ namespace UnitySim.Demo
         public GameObject systemDisplayPrefab;
 
         // Dynamic system tracking
-        private Dictionary<string, MonoBehaviour> activeSystems = new Dictionary<string, MonoBehaviour>();
+        private Dictionary<string, ISimulationSystem> activeSystems = new Dictionary<string, ISimulationSystem>();
         private Dictionary<string, GameObject> systemDisplays = new Dictionary<string, GameObject>();
-        private Dictionary<string, string> systemData = new Dictionary<string, string>();
+        private Dictionary<string, Text> systemDataTexts = new Dictionary<string, Text>();
+        private readonly PreviewWriter previewWriter = new PreviewWriter(3);
 
         private bool allSystemsActive = true;
         private float refreshTimer = 0f;
         private int totalSystemsFound = 0;
         private int totalSystemsWorking = 0;
 
-        // Expected system types for comprehensive demo
-        private readonly string[] systemTypes = {
-            "AdvancedEconomicsSystem", "AgricultureSystem", "AISystem", "AIDecisionFrameworkSystem",
-            "AnalyticsSystem", "DataVisualizationSystem", "DisasterManagementSystem", "EconomySystem",
-            "EcosystemSystem", "ElectricalGridSystem", "FluidDynamicsSystem", "ManufacturingSystem",
-            "MiningGeologySystem", "MLIntegrationSystem", "ModdingSystem", "NetworkMultiplayerSystem",
-            "PerformanceSystem", "PhysicsSystem", "PopulationSystem", "ProceduralSystem",
-            "ProceduralGenerationSystem", "RealWorldDataAdaptersSystem", "ResourcesSystem",
-            "SimulationAlgorithmsSystem", "SupplyChainSystem", "TimeSystem", "UITemplatesSystem",
-            "UrbanPlanningSystem", "VehicleSimulationSystem", "WeatherSystem"
-        };
-
         #region Unity Lifecycle
 
         void Start()
@@ -62,7 +52,7 @@ namespace UnitySim.Demo
         {
             if (enableRealTimeDisplay)
             {
-                refreshTimer += Time.deltaTime;
+                refreshTimer += UnityEngine.Time.deltaTime;
                 if (refreshTimer >= dataRefreshRate)
                 {
                     RefreshAllSystemData();
@@ -71,6 +61,16 @@ namespace UnitySim.Demo
             }
         }
 
+        void OnDestroy()
+        {
+            SimulationRegistry.SystemRegistered -= AddSystem;
+
+            foreach (var kvp in activeSystems)
+            {
+                kvp.Value.SystemUpdated -= HandleSystemUpdate;
+            }
+        }
+
         #endregion
 
         #region Initialization
@@ -79,7 +79,6 @@ namespace UnitySim.Demo
         {
             SetupUI();
             ScanForSystems();
-            CreateSystemDisplays();
 
             Debug.Log($"🎮 All Systems Demo Initialized");
             Debug.Log($"📊 Found {totalSystemsFound} systems");
@@ -100,104 +99,48 @@ namespace UnitySim.Demo
         private void ScanForSystems()
         {
             activeSystems.Clear();
-            MonoBehaviour[] allBehaviours = FindObjectsOfType<MonoBehaviour>();
+            totalSystemsFound = 0;
 
-            foreach (string systemType in systemTypes)
+            // Systems register on enable, so everything already in the scene is here by Start
+            var systems = SimulationRegistry.Systems;
+            for (int i = 0; i < systems.Count; i++)
             {
-                foreach (var behaviour in allBehaviours)
-                {
-                    if (behaviour.GetType().Name == systemType)
-                    {
-                        activeSystems[systemType] = behaviour;
-                        totalSystemsFound++;
-
-                        // Subscribe to system events if available
-                        SubscribeToSystemEvents(systemType, behaviour);
-
-                        Debug.Log($"✅ Found and registered: {systemType}");
-                        break;
-                    }
-                }
+                AddSystem(systems[i]);
             }
 
+            // Systems enabled later (additive scenes, prefabs) are picked up as they register
+            SimulationRegistry.SystemRegistered -= AddSystem;
+            SimulationRegistry.SystemRegistered += AddSystem;
+
             totalSystemsWorking = totalSystemsFound; // Assume all found systems are working initially
         }
 
-        private void SubscribeToSystemEvents(string systemType, MonoBehaviour system)
+        private void AddSystem(ISimulationSystem system)
         {
-            try
-            {
-                // Use reflection to find and subscribe to events
-                var eventFields = system.GetType().GetFields()
-                    .Where(f => f.FieldType.IsGenericType &&
-                               f.FieldType.GetGenericTypeDefinition() == typeof(System.Action<>));
+            string systemType = system.SystemName;
+            if (activeSystems.ContainsKey(systemType)) return;
 
-                foreach (var eventField in eventFields)
-                {
-                    if (eventField.Name.Contains("Changed") || eventField.Name.Contains("Updated"))
-                    {
-                        // Create a dynamic event handler
-                        var eventHandler = CreateEventHandler(systemType, eventField.FieldType);
-                        if (eventHandler != null)
-                        {
-                            var currentValue = eventField.GetValue(system);
-                            if (currentValue == null)
-                            {
-                                eventField.SetValue(system, eventHandler);
-                            }
-                            else
-                            {
-                                // Combine with existing delegates
-                                var combinedHandler = System.Delegate.Combine((System.Delegate)currentValue, (System.Delegate)eventHandler);
-                                eventField.SetValue(system, combinedHandler);
-                            }
-                        }
-                    }
-                }
-            }
-            catch (System.Exception e)
-            {
-                Debug.LogWarning($"⚠️ Could not subscribe to events for {systemType}: {e.Message}");
-            }
-        }
+            activeSystems[systemType] = system;
+            totalSystemsFound++;
 
-        private System.Delegate CreateEventHandler(string systemType, System.Type actionType)
-        {
-            // Create a generic event handler that updates our display
-            var method = typeof(AllSystemsDemo).GetMethod("HandleSystemUpdate", BindingFlags.NonPublic | BindingFlags.Instance);
-            if (method != null)
-            {
-                return System.Delegate.CreateDelegate(actionType, this, method);
-            }
-            return null;
+            system.SystemUpdated += HandleSystemUpdate;
+
+            if (systemsParent != null && !systemDisplays.ContainsKey(systemType))
+                CreateSystemDisplay(systemType, system);
+
+            Debug.Log($"✅ Found and registered: {systemType}");
         }
 
-        private void HandleSystemUpdate(object data)
+        private void HandleSystemUpdate(ISimulationSystem system)
         {
-            // Generic handler for all system updates
-            string systemType = data?.GetType().Name ?? "Unknown";
-            if (systemDisplays.ContainsKey(systemType))
-            {
-                // Update the display for this system
-                UpdateSystemDisplay(systemType, data);
-            }
+            UpdateSystemStatus(system.SystemName);
         }
 
         #endregion
 
         #region System Displays
 
-        private void CreateSystemDisplays()
-        {
-            if (systemsParent == null) return;
-
-            foreach (var kvp in activeSystems)
-            {
-                CreateSystemDisplay(kvp.Key, kvp.Value);
-            }
-        }
-
-        private void CreateSystemDisplay(string systemType, MonoBehaviour system)
+        private void CreateSystemDisplay(string systemType, ISimulationSystem system)
         {
             GameObject display = new GameObject($"{systemType}_Display");
             display.transform.SetParent(systemsParent);
@@ -214,7 +157,7 @@ namespace UnitySim.Demo
             titleObj.transform.SetParent(display.transform);
             var titleText = titleObj.AddComponent<Text>();
             titleText.text = FormatSystemName(systemType);
-            titleText.font = Resources.GetBuiltinResource<Font>("Arial.ttf");
+            titleText.font = UnityEngine.Resources.GetBuiltinResource<Font>("Arial.ttf");
             titleText.fontSize = 14;
             titleText.fontStyle = FontStyle.Bold;
             titleText.color = Color.white;
@@ -230,7 +173,7 @@ namespace UnitySim.Demo
             statusObj.transform.SetParent(display.transform);
             var statusText = statusObj.AddComponent<Text>();
             statusText.text = "Initializing...";
-            statusText.font = Resources.GetBuiltinResource<Font>("Arial.ttf");
+            statusText.font = UnityEngine.Resources.GetBuiltinResource<Font>("Arial.ttf");
             statusText.fontSize = 10;
             statusText.color = Color.green;
 
@@ -245,7 +188,7 @@ namespace UnitySim.Demo
             dataObj.transform.SetParent(display.transform);
             var dataText = dataObj.AddComponent<Text>();
             dataText.text = "No data";
-            dataText.font = Resources.GetBuiltinResource<Font>("Arial.ttf");
+            dataText.font = UnityEngine.Resources.GetBuiltinResource<Font>("Arial.ttf");
             dataText.fontSize = 8;
             dataText.color = Color.cyan;
 
@@ -263,50 +206,16 @@ namespace UnitySim.Demo
             return systemType.Replace("System", "").Replace("Simulation", "");
         }
 
-        private void UpdateSystemDisplay(string systemType, object data)
+        private void UpdateSystemStatus(string systemType)
         {
-            if (!systemDisplays.ContainsKey(systemType)) return;
+            if (!systemDisplays.TryGetValue(systemType, out var display)) return;
 
-            GameObject display = systemDisplays[systemType];
             Text statusText = display.transform.Find("Status")?.GetComponent<Text>();
-            Text dataText = display.transform.Find("Data")?.GetComponent<Text>();
-
             if (statusText != null)
             {
                 statusText.text = "✅ Active & Running";
                 statusText.color = Color.green;
             }
-
-            if (dataText != null && data != null)
-            {
-                // Show abbreviated data
-                string dataPreview = GetDataPreview(data);
-                dataText.text = dataPreview;
-            }
-        }
-
-        private string GetDataPreview(object data)
-        {
-            try
-            {
-                string json = JsonConvert.SerializeObject(data);
-                var parsed = JsonConvert.DeserializeObject<Dictionary<string, object>>(json);
-
-                string preview = "";
-                int count = 0;
-                foreach (var kvp in parsed)
-                {
-                    if (count >= 2) break;
-                    preview += $"{kvp.Key}: {kvp.Value}\\n";
-                    count++;
-                }
-
-                return preview;
-            }
-            catch
-            {
-                return data.ToString();
-            }
         }
 
         #endregion
@@ -317,10 +226,11 @@ namespace UnitySim.Demo
         {
             foreach (var kvp in activeSystems)
             {
-                if (kvp.Value != null)
+                var behaviour = kvp.Value as MonoBehaviour;
+                if (behaviour != null)
                 {
-                    kvp.Value.enabled = true;
-                    kvp.Value.gameObject.SetActive(true);
+                    behaviour.enabled = true;
+                    behaviour.gameObject.SetActive(true);
                 }
             }
 
@@ -337,23 +247,16 @@ namespace UnitySim.Demo
                 try
                 {
                     string systemType = kvp.Key;
-                    MonoBehaviour system = kvp.Value;
 
-                    if (system != null && system.isActiveAndEnabled)
+                    // Disabled systems drop out of the registry but stay in the demo so they can be resumed
+                    if (SimulationRegistry.Contains(kvp.Value))
                     {
-                        // Try to get data from ExportState method
-                        var exportMethod = system.GetType().GetMethod("ExportState");
-                        if (exportMethod != null)
+                        workingSystems++;
+
+                        // Update display
+                        if (systemDisplays.ContainsKey(systemType))
                         {
-                            string jsonData = (string)exportMethod.Invoke(system, null);
-                            systemData[systemType] = jsonData;
-                            workingSystems++;
-
-                            // Update display
-                            if (systemDisplays.ContainsKey(systemType))
-                            {
-                                UpdateSystemDisplayFromJson(systemType, jsonData);
-                            }
+                            UpdateSystemDisplay(systemType, kvp.Value);
                         }
                     }
                 }
@@ -367,38 +270,23 @@ namespace UnitySim.Demo
             UpdateGlobalStatus();
         }
 
-        private void UpdateSystemDisplayFromJson(string systemType, string jsonData)
+        // Writes the first few fields straight from the live state; no JSON is built or parsed,
+        // and the Text is only touched (and its mesh rebuilt) when the preview changed
+        private void UpdateSystemDisplay(string systemType, ISimulationSystem system)
         {
-            if (!systemDisplays.ContainsKey(systemType)) return;
-
-            GameObject display = systemDisplays[systemType];
-            Text dataText = display.transform.Find("Data")?.GetComponent<Text>();
-
-            if (dataText != null && !string.IsNullOrEmpty(jsonData))
+            if (!systemDataTexts.TryGetValue(systemType, out var dataText))
             {
-                try
-                {
-                    var parsed = JsonConvert.DeserializeObject<Dictionary<string, object>>(jsonData);
-                    string preview = "";
-                    int count = 0;
-
-                    foreach (var kvp in parsed)
-                    {
-                        if (count >= 3) break;
-                        if (kvp.Key != "timestamp" && kvp.Key != "currentTime")
-                        {
-                            preview += $"{kvp.Key}: {kvp.Value}\\n";
-                            count++;
-                        }
-                    }
+                dataText = systemDisplays[systemType].transform.Find("Data")?.GetComponent<Text>();
+                systemDataTexts[systemType] = dataText;
+            }
+            if (dataText == null) return;
 
-                    dataText.text = preview;
-                }
-                catch
-                {
-                    dataText.text = "Data parsing error";
-                }
+            if (!previewWriter.Capture(system))
+            {
+                if (dataText.text.Length > 0) dataText.text = "";
+                return;
             }
+            if (!previewWriter.Matches(dataText.text)) dataText.text = previewWriter.ToString();
         }
 
         #endregion
@@ -407,42 +295,45 @@ namespace UnitySim.Demo
 
         public void ExportAllSystemData()
         {
-            var allData = new Dictionary<string, object>();
+            string fileName = $"all_systems_data_{System.DateTime.Now:yyyyMMdd_HHmmss}.json";
+            string filePath = System.IO.Path.Combine(Application.persistentDataPath, fileName);
+
+            // Systems write their live state straight into the snapshot, so nothing is re-parsed;
+            // JSON and the file write run on the exporter's thread
+            var exporter = SimulationScheduler.Instance.Exporter;
+            var tape = exporter.Begin(filePath, compressExports);
+            if (tape == null)
+            {
+                Debug.LogWarning("AllSystemsDemo: Export skipped - previous exports are still being written");
+                return;
+            }
 
-            foreach (var kvp in systemData)
+            try
             {
-                if (!string.IsNullOrEmpty(kvp.Value))
+                tape.BeginObject(null);
+                tape.Write("exportTime", System.DateTime.Now.ToString("o"));
+                tape.Write("totalSystems", totalSystemsFound);
+                tape.Write("workingSystems", totalSystemsWorking);
+                tape.BeginObject("systems");
+                foreach (var kvp in activeSystems)
                 {
-                    try
-                    {
-                        allData[kvp.Key] = JsonConvert.DeserializeObject(kvp.Value);
-                    }
-                    catch
-                    {
-                        allData[kvp.Key] = kvp.Value;
-                    }
+                    if (kvp.Value != null)
+                        tape.WriteSource(kvp.Key, kvp.Value);
                 }
+                tape.EndObject();
+                tape.EndObject();
             }
-
-            var exportData = new
+            catch (System.Exception e)
             {
-                exportTime = System.DateTime.Now,
-                totalSystems = totalSystemsFound,
-                workingSystems = totalSystemsWorking,
-                systems = allData
-            };
-
-            string jsonData = JsonConvert.SerializeObject(exportData, Formatting.Indented);
-
-            // Save to file
-            string fileName = $"all_systems_data_{System.DateTime.Now:yyyyMMdd_HHmmss}.json";
-            string filePath = System.IO.Path.Combine(Application.persistentDataPath, fileName);
-            System.IO.File.WriteAllText(filePath, jsonData);
+                exporter.Abort(tape);
+                Debug.LogError($"AllSystemsDemo: Export failed - {e.Message}");
+                return;
+            }
+            exporter.Submit(tape);
 
-            Debug.Log("📄 All Systems Data Exported:");
+            Debug.Log("📄 Exporting All Systems Data:");
             Debug.Log($"File: {filePath}");
             Debug.Log($"Systems: {totalSystemsWorking}/{totalSystemsFound}");
-            Debug.Log(jsonData);
         }
 
         public void ResetAllSystems()
@@ -451,8 +342,7 @@ namespace UnitySim.Demo
             {
                 try
                 {
-                    var resetMethod = kvp.Value.GetType().GetMethod("ResetData");
-                    resetMethod?.Invoke(kvp.Value, null);
+                    kvp.Value.ResetData();
                 }
                 catch (System.Exception e)
                 {
@@ -469,9 +359,10 @@ namespace UnitySim.Demo
 
             foreach (var kvp in activeSystems)
             {
-                if (kvp.Value != null)
+                var behaviour = kvp.Value as MonoBehaviour;
+                if (behaviour != null)
                 {
-                    kvp.Value.enabled = allSystemsActive;
+                    behaviour.enabled = allSystemsActive;
                 }
             }
 
@@ -550,5 +441,55 @@ namespace UnitySim.Demo
 
             GUILayout.EndArea();
         }
+
+        // "name: value" lines for the first fields of a system's state, skipping wall-clock stamps
+        private class PreviewWriter : IStateWriter
+        {
+            private readonly StringBuilder text = new StringBuilder(128);
+            private readonly int maxFields;
+            private int fields;
+
+            public PreviewWriter(int maxFields)
+            {
+                this.maxFields = maxFields;
+            }
+
+            public bool Capture(IStateSource source)
+            {
+                text.Clear();
+                fields = 0;
+                return source.WriteState(this);
+            }
+
+            public bool Matches(string current)
+            {
+                if (current == null || current.Length != text.Length) return false;
+                for (int i = 0; i < current.Length; i++)
+                {
+                    if (current[i] != text[i]) return false;
+                }
+                return true;
+            }
+
+            public override string ToString() => text.ToString();
+
+            public void BeginObject(string name) { }
+            public void EndObject() { }
+
+            public void Write(string name, int value) { if (Line(name)) text.Append(value).Append('\n'); }
+            public void Write(string name, long value) { if (Line(name)) text.Append(value).Append('\n'); }
+            public void Write(string name, float value) { if (Line(name)) text.Append(value.ToString("0.##")).Append('\n'); }
+            public void Write(string name, bool value) { if (Line(name)) text.Append(value ? "true" : "false").Append('\n'); }
+            public void Write(string name, string value) { if (Line(name)) text.Append(value).Append('\n'); }
+            public void Write(string name, Vector2Int value) { if (Line(name)) text.Append(value.x).Append(", ").Append(value.y).Append('\n'); }
+
+            private bool Line(string name)
+            {
+                if (fields >= maxFields || name == "timestamp" || name == "currentTime") return false;
+                fields++;
+                text.Append(name).Append(": ");
+                return true;
+            }
+        }
     }
 }
\ No newline at end of file
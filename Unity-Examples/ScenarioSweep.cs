@@ -0,0 +1,68 @@
+using System;
+using System.IO;
+using System.Text;
+using UnityEngine;
+using UnitySim.Core;
+using UnitySim.Economy;
+using UnitySim.Population;
+using UnitySim.DisasterManagement;
+
+namespace UnitySim.Examples
+{
+    // Monte-Carlo sweep over economy, population and disaster scenarios, run on every core.
+    // Batch mode: Unity -batchmode -quit -executeMethod UnitySim.Examples.ScenarioSweep.Run
+    //   -scenarios 10000 -steps 8760 -seed 1 -sample 24 -out sweep.ndjson
+    public static class ScenarioSweep
+    {
+        public static ISimulationModel CreateScenario(uint seed)
+        {
+            // Each model gets its own stream so adding one does not shift the others' results
+            return new SimulationModelGroup()
+                .Add(new EconomyModel(seed))
+                .Add(new PopulationModel(seed ^ 0x68E31DA4u))
+                .Add(new DisasterManagementModel(seed ^ 0xB5297A4Du));
+        }
+
+        public static void Run()
+        {
+            var settings = new SimulationBatchSettings();
+            string outputPath = Path.Combine(Application.persistentDataPath, "sweep.ndjson");
+
+            string[] args = Environment.GetCommandLineArgs();
+            for (int i = 0; i < args.Length - 1; i++)
+            {
+                string value = args[i + 1];
+                switch (args[i])
+                {
+                    case "-scenarios": settings.scenarioCount = int.Parse(value); break;
+                    case "-steps": settings.stepsPerScenario = int.Parse(value); break;
+                    case "-seed": settings.baseSeed = uint.Parse(value); break;
+                    case "-sample": settings.sampleInterval = int.Parse(value); break;
+                    case "-threads": settings.maxDegreeOfParallelism = int.Parse(value); break;
+                    case "-out": outputPath = value; break;
+                }
+            }
+
+            Run(settings, outputPath);
+        }
+
+        public static SimulationBatchSummary Run(SimulationBatchSettings settings, string outputPath)
+        {
+            var runner = new SimulationBatchRunner(CreateScenario, settings);
+
+            SimulationBatchSummary summary;
+            using (var output = new FileStream(outputPath, FileMode.Create, FileAccess.Write, FileShare.Read, 1 << 16))
+            {
+                summary = runner.Run(output);
+            }
+
+            var buffer = new PooledBufferWriter();
+            summary.WriteState(new SimulationJsonWriter(buffer));
+            string summaryPath = Path.ChangeExtension(outputPath, ".summary.json");
+            File.WriteAllText(summaryPath, Encoding.UTF8.GetString(buffer.WrittenSpan));
+
+            Debug.Log($"ScenarioSweep: Wrote {outputPath} and {summaryPath}");
+            return summary;
+        }
+    }
+}
@@ -1,10 +1,11 @@
 using System.Collections.Generic;
 using UnityEngine;
 using UnityEngine.UI;
+using UnitySim.Core;
 using UnitySim.Weather;
 using UnitySim.Economy;
 using UnitySim.Physics;
-using UnitySim.Ai;
+using UnitySim.AI;
 
 namespace UnitySim.Examples
 {
@@ -14,7 +15,7 @@ namespace UnitySim.Examples
         public WeatherSystem weatherSystem;
         public EconomySystem economySystem;
         public PhysicsSystem physicsSystem;
-        public AiSystem aiSystem;
+        public AISystem aiSystem;
 
         [Header("UI Elements")]
         public Text weatherDisplay;
@@ -26,10 +27,22 @@ namespace UnitySim.Examples
         [Header("Settings")]
         public bool autoExport = false;
         public float exportInterval = 5f;
+        public bool compressSaves = false;
 
         private float exportTimer = 0f;
         private Dictionary<string, object> allSimulationData = new Dictionary<string, object>();
 
+        // Formatted display lines, rebuilt only for the fields a delta reports as changed
+        private readonly string[] weatherLines = new string[4];
+        private readonly string[] economyLines = new string[4];
+        private readonly string[] physicsLines = new string[4];
+        private readonly string[] aiLines = new string[4];
+
+        private const WeatherField WeatherDisplayFields = WeatherField.Temperature | WeatherField.Humidity | WeatherField.WindSpeed | WeatherField.Pressure;
+        private const EconomyField EconomyDisplayFields = EconomyField.MarketValue | EconomyField.Inflation | EconomyField.Unemployment | EconomyField.Gdp;
+        private const PhysicsField PhysicsDisplayFields = PhysicsField.Gravity | PhysicsField.RigidBodies | PhysicsField.Constraints | PhysicsField.Collisions;
+        private const AIField AIDisplayFields = AIField.AgentCount | AIField.DecisionsMade | AIField.Accuracy | AIField.NeuralNetworkActive;
+
         void Start()
         {
             SetupEventListeners();
@@ -40,7 +53,7 @@ namespace UnitySim.Examples
         {
             if (autoExport)
             {
-                exportTimer += Time.deltaTime;
+                exportTimer += UnityEngine.Time.deltaTime;
                 if (exportTimer >= exportInterval)
                 {
                     ExportAllData();
@@ -52,16 +65,16 @@ namespace UnitySim.Examples
         private void SetupEventListeners()
         {
             if (weatherSystem != null)
-                weatherSystem.OnWeatherChanged += UpdateWeatherDisplay;
+                weatherSystem.OnWeatherDelta += UpdateWeatherDisplay;
 
             if (economySystem != null)
-                economySystem.OnEconomyChanged += UpdateEconomyDisplay;
+                economySystem.OnEconomyDelta += UpdateEconomyDisplay;
 
             if (physicsSystem != null)
-                physicsSystem.OnPhysicsChanged += UpdatePhysicsDisplay;
+                physicsSystem.OnPhysicsDelta += UpdatePhysicsDisplay;
 
             if (aiSystem != null)
-                aiSystem.OnAiChanged += UpdateAIDisplay;
+                aiSystem.OnAIDelta += UpdateAIDisplay;
         }
 
         private void SetupUI()
@@ -72,60 +85,76 @@ namespace UnitySim.Examples
             }
         }
 
-        private void UpdateWeatherDisplay(WeatherData data)
+        private void UpdateWeatherDisplay(WeatherDelta delta)
         {
-            if (weatherDisplay != null)
-            {
-                weatherDisplay.text = $"🌡️ Weather\\n" +
-                    $"Temperature: {data.weather.temperature:F1}°C\\n" +
-                    $"Humidity: {data.weather.humidity}%\\n" +
-                    $"Wind: {data.weather.windSpeed:F1} km/h\\n" +
-                    $"Pressure: {data.weather.pressure:F1} hPa";
-            }
-
-            allSimulationData["weather"] = data;
+            allSimulationData["weather"] = weatherSystem.GetData();
+            if (weatherDisplay == null || !delta.Has(WeatherDisplayFields)) return;
+
+            var info = delta.values;
+            if (delta.Has(WeatherField.Temperature))
+                weatherLines[0] = $"Temperature: {info.temperature:F1}°C";
+            if (delta.Has(WeatherField.Humidity))
+                weatherLines[1] = $"Humidity: {info.humidity}%";
+            if (delta.Has(WeatherField.WindSpeed))
+                weatherLines[2] = $"Wind: {info.windSpeed:F1} km/h";
+            if (delta.Has(WeatherField.Pressure))
+                weatherLines[3] = $"Pressure: {info.pressure:F1} hPa";
+
+            weatherDisplay.text = "🌡️ Weather\n" + string.Join("\n", weatherLines);
         }
 
-        private void UpdateEconomyDisplay(EconomyData data)
+        private void UpdateEconomyDisplay(EconomyDelta delta)
         {
-            if (economyDisplay != null)
-            {
-                economyDisplay.text = $"💰 Economy\\n" +
-                    $"Market: ${data.economy.marketValue:F0}\\n" +
-                    $"Inflation: {data.economy.inflation:F1}%\\n" +
-                    $"Unemployment: {data.economy.unemployment:F1}%\\n" +
-                    $"GDP Growth: {data.economy.gdpGrowth:F1}%";
-            }
-
-            allSimulationData["economy"] = data;
+            allSimulationData["economy"] = economySystem.GetData();
+            if (economyDisplay == null || !delta.Has(EconomyDisplayFields)) return;
+
+            var info = delta.values;
+            if (delta.Has(EconomyField.MarketValue))
+                economyLines[0] = $"Market: ${info.marketValue:F0}";
+            if (delta.Has(EconomyField.Inflation))
+                economyLines[1] = $"Inflation: {info.inflation:F1}%";
+            if (delta.Has(EconomyField.Unemployment))
+                economyLines[2] = $"Unemployment: {info.unemployment:F1}%";
+            if (delta.Has(EconomyField.Gdp))
+                economyLines[3] = $"GDP: ${info.gdp:N0}";
+
+            economyDisplay.text = "💰 Economy\n" + string.Join("\n", economyLines);
         }
 
-        private void UpdatePhysicsDisplay(PhysicsData data)
+        private void UpdatePhysicsDisplay(PhysicsDelta delta)
         {
-            if (physicsDisplay != null)
-            {
-                physicsDisplay.text = $"⚡ Physics\\n" +
-                    $"Gravity: {data.physics.gravity:F2}\\n" +
-                    $"Rigid Bodies: {data.physics.rigidBodies}\\n" +
-                    $"Constraints: {data.physics.constraints}\\n" +
-                    $"Collisions: {data.physics.collisions}";
-            }
-
-            allSimulationData["physics"] = data;
+            allSimulationData["physics"] = physicsSystem.GetData();
+            if (physicsDisplay == null || !delta.Has(PhysicsDisplayFields)) return;
+
+            var info = delta.values;
+            if (delta.Has(PhysicsField.Gravity))
+                physicsLines[0] = $"Gravity: {info.gravity:F2}";
+            if (delta.Has(PhysicsField.RigidBodies))
+                physicsLines[1] = $"Rigid Bodies: {info.rigidBodies}";
+            if (delta.Has(PhysicsField.Constraints))
+                physicsLines[2] = $"Constraints: {info.constraints}";
+            if (delta.Has(PhysicsField.Collisions))
+                physicsLines[3] = $"Collisions: {info.collisions}";
+
+            physicsDisplay.text = "⚡ Physics\n" + string.Join("\n", physicsLines);
         }
 
-        private void UpdateAIDisplay(AiData data)
+        private void UpdateAIDisplay(AIDelta delta)
         {
-            if (aiDisplay != null)
-            {
-                aiDisplay.text = $"🤖 AI\\n" +
-                    $"Agents: {data.ai.agents}\\n" +
-                    $"Decisions: {data.ai.decisions}\\n" +
-                    $"Behavior Trees: {data.ai.behaviorTrees}\\n" +
-                    $"Learning: {(data.ai.learning ? "Active" : "Inactive")}";
-            }
-
-            allSimulationData["ai"] = data;
+            allSimulationData["ai"] = aiSystem.GetData();
+            if (aiDisplay == null || !delta.Has(AIDisplayFields)) return;
+
+            var info = delta.values;
+            if (delta.Has(AIField.AgentCount))
+                aiLines[0] = $"Agents: {info.agentCount}";
+            if (delta.Has(AIField.DecisionsMade))
+                aiLines[1] = $"Decisions: {info.decisionsMade}";
+            if (delta.Has(AIField.Accuracy))
+                aiLines[2] = $"Accuracy: {info.accuracy:F1}%";
+            if (delta.Has(AIField.NeuralNetworkActive))
+                aiLines[3] = $"Learning: {(info.neuralNetworkActive ? "Active" : "Inactive")}";
+
+            aiDisplay.text = "🤖 AI\n" + string.Join("\n", aiLines);
         }
 
         public void ExportAllData()
@@ -182,34 +211,50 @@ namespace UnitySim.Examples
             string fileName = $"simulation_data_{System.DateTime.Now:yyyyMMdd_HHmmss}.json";
             string filePath = System.IO.Path.Combine(Application.persistentDataPath, fileName);
 
-            var allData = new Dictionary<string, object>();
-
-            if (weatherSystem != null)
-                allData["weather"] = weatherSystem.GetData();
-            if (economySystem != null)
-                allData["economy"] = economySystem.GetData();
-            if (physicsSystem != null)
-                allData["physics"] = physicsSystem.GetData();
-            if (aiSystem != null)
-                allData["ai"] = aiSystem.GetData();
+            // Only the snapshot happens here; JSON and the file write run on the exporter's thread
+            var exporter = SimulationScheduler.Instance.Exporter;
+            var tape = exporter.Begin(filePath, compressSaves);
+            if (tape == null)
+            {
+                Debug.LogWarning("SimulationManager: Save skipped - previous saves are still being written");
+                return;
+            }
 
-            string jsonData = Newtonsoft.Json.JsonConvert.SerializeObject(allData, Newtonsoft.Json.Formatting.Indented);
-            System.IO.File.WriteAllText(filePath, jsonData);
+            try
+            {
+                tape.BeginObject(null);
+                if (weatherSystem != null)
+                    tape.WriteSource("weather", weatherSystem);
+                if (economySystem != null)
+                    tape.WriteSource("economy", economySystem);
+                if (physicsSystem != null)
+                    tape.WriteSource("physics", physicsSystem);
+                if (aiSystem != null)
+                    tape.WriteSource("ai", aiSystem);
+                tape.EndObject();
+            }
+            catch (System.Exception e)
+            {
+                exporter.Abort(tape);
+                Debug.LogError($"SimulationManager: Save failed - {e.Message}");
+                return;
+            }
+            exporter.Submit(tape);
 
-            Debug.Log($"📄 Data saved to: {filePath}");
+            Debug.Log($"📄 Saving data to: {filePath}");
         }
 
         void OnDestroy()
         {
             // Clean up event listeners
             if (weatherSystem != null)
-                weatherSystem.OnWeatherChanged -= UpdateWeatherDisplay;
+                weatherSystem.OnWeatherDelta -= UpdateWeatherDisplay;
             if (economySystem != null)
-                economySystem.OnEconomyChanged -= UpdateEconomyDisplay;
+                economySystem.OnEconomyDelta -= UpdateEconomyDisplay;
             if (physicsSystem != null)
-                physicsSystem.OnPhysicsChanged -= UpdatePhysicsDisplay;
+                physicsSystem.OnPhysicsDelta -= UpdatePhysicsDisplay;
             if (aiSystem != null)
-                aiSystem.OnAiChanged -= UpdateAIDisplay;
+                aiSystem.OnAIDelta -= UpdateAIDisplay;
         }
 
         void OnGUI()
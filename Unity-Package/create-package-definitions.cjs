@@ -196,12 +196,13 @@ const packageConfigs = {
 // Base package configuration
 const basePackageConfig = {
     version: "1.0.0",
-    unity: "2020.3",
+    unity: "2021.3",
     author: {
         name: "Unity Simulation Framework",
         email: "contact@unity-sim.com"
     },
     dependencies: {
+        "com.unity-sim.core": "1.0.0",
         "com.unity.nuget.newtonsoft-json": "3.0.2"
     },
     samples: [],
@@ -244,6 +245,7 @@ function createAssemblyDefinition(packageName, config) {
         name: assemblyName,
         displayName: config.displayName,
         references: [
+            "UnitySim.Core",
             "Unity.Newtonsoft.Json"
         ],
         includePlatforms: [],
@@ -334,7 +336,9 @@ AssemblyDefinitionImporter:
 
 function createMainPackageManifest() {
     const mainManifest = {
-        dependencies: {}
+        dependencies: {
+            "com.unity-sim.core": "1.0.0"
+        }
     };
 
     // Add all simulation packages as dependencies
@@ -385,7 +389,7 @@ ${Object.entries(packageConfigs).map(([name, config]) =>
 ## 🔧 Dependencies
 
 All packages require:
-- Unity 2020.3 or newer
+- Unity 2021.3 or newer
 - Newtonsoft JSON package (automatically installed)
 
 ## 📖 Usage
@@ -0,0 +1,109 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.CompilerServices;
+using Newtonsoft.Json;
+using UnityEngine;
+
+namespace UnitySim.Testing.Benchmarks
+{
+    [System.Serializable]
+    public class BenchmarkEntry
+    {
+        public string name;
+        public double medianMs;
+        public long allocatedBytes;
+    }
+
+    [System.Serializable]
+    public class BenchmarkBaselineFile
+    {
+        public int version = 1;
+
+        // A result regresses when it exceeds baseline * (1 + tolerance) plus the slack, which
+        // keeps sub-tick timings and small allocations from failing on noise
+        public double tolerance = 0.25;
+        public double slackMs = 0.05;
+        public long slackBytes = 256;
+        public List<BenchmarkEntry> entries = new List<BenchmarkEntry>();
+    }
+
+    // Machine-readable baseline the benchmarks compare against, benchmark-baseline.json next to
+    // this file by default. Set UNITYSIM_BENCHMARK_BASELINE to use another file, and
+    // UNITYSIM_BENCHMARK_RECORD=1 to write the current results into it instead of failing.
+    public static class BenchmarkBaseline
+    {
+        private static BenchmarkBaselineFile file;
+        private static readonly Dictionary<string, BenchmarkEntry> lookup = new Dictionary<string, BenchmarkEntry>();
+        private static readonly Dictionary<string, BenchmarkEntry> results = new Dictionary<string, BenchmarkEntry>();
+
+        public static bool Recording => Environment.GetEnvironmentVariable("UNITYSIM_BENCHMARK_RECORD") == "1";
+
+        public static string Path
+        {
+            get
+            {
+                string overridePath = Environment.GetEnvironmentVariable("UNITYSIM_BENCHMARK_BASELINE");
+                return string.IsNullOrEmpty(overridePath) ? DefaultPath() : overridePath;
+            }
+        }
+
+        // Records the result and returns why it regressed, or null when it is within the baseline
+        public static string Check(string name, double medianMs, long allocatedBytes)
+        {
+            Load();
+            results[name] = new BenchmarkEntry { name = name, medianMs = medianMs, allocatedBytes = allocatedBytes };
+
+            if (Recording || !lookup.TryGetValue(name, out var baseline)) return null;
+
+            double limitMs = baseline.medianMs * (1.0 + file.tolerance) + file.slackMs;
+            double limitBytes = baseline.allocatedBytes * (1.0 + file.tolerance) + file.slackBytes;
+
+            if (medianMs > limitMs)
+                return $"{name}: {medianMs:F3}ms exceeds baseline {baseline.medianMs:F3}ms (limit {limitMs:F3}ms)";
+            if (allocatedBytes > limitBytes)
+                return $"{name}: {allocatedBytes} bytes exceeds baseline {baseline.allocatedBytes} bytes (limit {limitBytes:F0})";
+            return null;
+        }
+
+        // Merges this run's results into the baseline file when recording
+        public static void Save()
+        {
+            if (!Recording || results.Count == 0) return;
+
+            Load();
+            foreach (var result in results.Values)
+            {
+                lookup[result.name] = result;
+            }
+
+            file.entries = new List<BenchmarkEntry>(lookup.Values);
+            file.entries.Sort((a, b) => string.CompareOrdinal(a.name, b.name));
+            File.WriteAllText(Path, JsonConvert.SerializeObject(file, Formatting.Indented));
+            results.Clear();
+
+            Debug.Log($"BenchmarkBaseline: Recorded {file.entries.Count} entries to {Path}");
+        }
+
+        private static void Load()
+        {
+            if (file != null) return;
+
+            string path = Path;
+            file = File.Exists(path) ? JsonConvert.DeserializeObject<BenchmarkBaselineFile>(File.ReadAllText(path)) : null;
+            file = file ?? new BenchmarkBaselineFile();
+
+            lookup.Clear();
+            foreach (var entry in file.entries)
+            {
+                lookup[entry.name] = entry;
+            }
+        }
+
+        // The compiler fills in this source file's path, which finds the baseline in the editor
+        private static string DefaultPath([CallerFilePath] string sourcePath = "")
+        {
+            return System.IO.Path.Combine(System.IO.Path.GetDirectoryName(sourcePath) ?? ".", "benchmark-baseline.json");
+        }
+    }
+}
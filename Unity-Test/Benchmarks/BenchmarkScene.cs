@@ -0,0 +1,213 @@
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+using UnityEngine;
+using UnitySim.Core;
+
+namespace UnitySim.Testing.Benchmarks
+{
+    // All 30 simulation systems in one scene at a given scale. Systems with an entity count
+    // (citizens, vehicles, grid size) get that count scaled, one instance each; the rest run
+    // scale copies, since their cost is per instance. Base counts are roughly a hundredth of
+    // each package's shipped defaults, so 100x is about the scene the packages ship with.
+    public class BenchmarkScene : IDisposable
+    {
+        public static readonly string[] SystemNames = {
+            "AdvancedEconomicsSystem", "AgricultureSystem", "AISystem", "AIDecisionFrameworkSystem",
+            "AnalyticsSystem", "DataVisualizationSystem", "DisasterManagementSystem", "EconomySystem",
+            "EcosystemSystem", "ElectricalGridSystem", "FluidDynamicsSystem", "ManufacturingSystem",
+            "MiningGeologySystem", "MLIntegrationSystem", "ModdingSystem", "NetworkMultiplayerSystem",
+            "PerformanceSystem", "PhysicsSystem", "PopulationSystem", "ProceduralSystem",
+            "ProceduralGenerationSystem", "RealWorldDataAdaptersSystem", "ResourcesSystem",
+            "SimulationAlgorithmsSystem", "SupplyChainSystem", "TimeSystem", "UITemplatesSystem",
+            "UrbanPlanningSystem", "VehicleSimulationSystem", "WeatherSystem"
+        };
+
+        private enum KnobKind
+        {
+            Count,  // base * scale
+            Side,   // base * sqrt(scale), for square grids whose cost follows their area
+            Fixed   // set to value regardless of scale
+        }
+
+        private struct Knob
+        {
+            public string system;
+            public string path;
+            public KnobKind kind;
+            public int value;
+
+            public Knob(string system, string path, KnobKind kind, int value)
+            {
+                this.system = system;
+                this.path = path;
+                this.kind = kind;
+                this.value = value;
+            }
+        }
+
+        private static readonly Knob[] Knobs = {
+            new Knob("AIDecisionFrameworkSystem", "agentCount", KnobKind.Count, 20),
+            new Knob("AISystem", "agents.agents", KnobKind.Count, 20),
+            new Knob("ElectricalGridSystem", "busGrid", KnobKind.Side, 12),
+            new Knob("FluidDynamicsSystem", "gridResolution", KnobKind.Side, 8),
+            new Knob("ManufacturingSystem", "production.machines", KnobKind.Count, 1),
+            new Knob("ManufacturingSystem", "production.workers", KnobKind.Count, 1),
+            new Knob("PopulationSystem", "initialCitizens", KnobKind.Count, 10000),
+            new Knob("ProceduralGenerationSystem", "world.size", KnobKind.Side, 102),
+            new Knob("ProceduralGenerationSystem", "useDiskCache", KnobKind.Fixed, 0),
+            new Knob("ProceduralSystem", "viewRadius", KnobKind.Side, 1),
+            new Knob("SimulationAlgorithmsSystem", "gridSize", KnobKind.Side, 26),
+            new Knob("SupplyChainSystem", "logistics.vehicles", KnobKind.Count, 1),
+            new Knob("UrbanPlanningSystem", "initialBuildings", KnobKind.Count, 3),
+            new Knob("VehicleSimulationSystem", "vehicleCount", KnobKind.Count, 500),
+            new Knob("VehicleSimulationSystem", "gridSize", KnobKind.Side, 4),
+            new Knob("WeatherSystem", "fieldTiles", KnobKind.Side, 8)
+        };
+
+        private readonly GameObject root;
+        private readonly Dictionary<string, List<ISimulationSystem>> systems = new Dictionary<string, List<ISimulationSystem>>();
+
+        public int Scale { get; }
+        public int InstanceCount { get; private set; }
+
+        // Components are added now and initialize in Start, so wait a frame before measuring
+        public BenchmarkScene(int scale)
+        {
+            Scale = Mathf.Max(1, scale);
+            root = new GameObject($"BenchmarkScene {Scale}x");
+
+            foreach (string name in SystemNames)
+            {
+                Type type = FindSystemType(name);
+                if (type == null)
+                {
+                    Debug.LogWarning($"BenchmarkScene: {name} not found, skipping");
+                    continue;
+                }
+
+                // TimeSystem configures the scheduler's shared clock, so one is enough
+                bool scaled = HasKnobs(name, KnobKind.Count) || HasKnobs(name, KnobKind.Side);
+                int copies = scaled || name == "TimeSystem" ? 1 : Scale;
+                var list = new List<ISimulationSystem>(copies);
+
+                for (int i = 0; i < copies; i++)
+                {
+                    var host = new GameObject(copies > 1 ? $"{name} {i}" : name);
+                    host.transform.SetParent(root.transform, false);
+                    var component = host.AddComponent(type);
+                    ApplyKnobs(name, component);
+                    if (component is ISimulationSystem system) list.Add(system);
+                }
+
+                systems[name] = list;
+                InstanceCount += list.Count;
+            }
+        }
+
+        public bool IsInitialized
+        {
+            get
+            {
+                foreach (var list in systems.Values)
+                {
+                    foreach (var system in list)
+                    {
+                        if (!system.IsInitialized) return false;
+                    }
+                }
+                return true;
+            }
+        }
+
+        public IReadOnlyList<ISimulationSystem> Get(string systemName)
+        {
+            return systems.TryGetValue(systemName, out var list) ? list : (IReadOnlyList<ISimulationSystem>)Array.Empty<ISimulationSystem>();
+        }
+
+        public void Dispose()
+        {
+            if (root != null) UnityEngine.Object.Destroy(root);
+            systems.Clear();
+        }
+
+        #region Helpers
+
+        private static bool HasKnobs(string systemName, KnobKind kind)
+        {
+            foreach (var knob in Knobs)
+            {
+                if (knob.system == systemName && knob.kind == kind) return true;
+            }
+            return false;
+        }
+
+        private void ApplyKnobs(string systemName, object component)
+        {
+            foreach (var knob in Knobs)
+            {
+                if (knob.system != systemName) continue;
+
+                int value = knob.value;
+                if (knob.kind == KnobKind.Count) value = knob.value * Scale;
+                else if (knob.kind == KnobKind.Side) value = Mathf.Max(1, Mathf.RoundToInt(knob.value * Mathf.Sqrt(Scale)));
+
+                if (!SetField(component, knob.path, value))
+                    Debug.LogWarning($"BenchmarkScene: {systemName}.{knob.path} not found");
+            }
+        }
+
+        // Follows a dotted path of public fields; Vector2Int fields are set square, bools from 0/1
+        private static bool SetField(object target, string path, int value)
+        {
+            string[] parts = path.Split('.');
+            for (int i = 0; i < parts.Length; i++)
+            {
+                FieldInfo field = target.GetType().GetField(parts[i], BindingFlags.Public | BindingFlags.Instance);
+                if (field == null) return false;
+
+                if (i < parts.Length - 1)
+                {
+                    target = field.GetValue(target);
+                    if (target == null) return false;
+                    continue;
+                }
+
+                if (field.FieldType == typeof(int)) field.SetValue(target, value);
+                else if (field.FieldType == typeof(float)) field.SetValue(target, (float)value);
+                else if (field.FieldType == typeof(bool)) field.SetValue(target, value != 0);
+                else if (field.FieldType == typeof(Vector2Int)) field.SetValue(target, new Vector2Int(value, value));
+                else return false;
+            }
+            return true;
+        }
+
+        private static Type FindSystemType(string systemName)
+        {
+            foreach (Assembly assembly in AppDomain.CurrentDomain.GetAssemblies())
+            {
+                foreach (Type type in GetLoadableTypes(assembly))
+                {
+                    if (type != null && type.Name == systemName && typeof(MonoBehaviour).IsAssignableFrom(type))
+                        return type;
+                }
+            }
+            return null;
+        }
+
+        // An assembly with a missing dependency still yields the types that did load
+        private static Type[] GetLoadableTypes(Assembly assembly)
+        {
+            try
+            {
+                return assembly.GetTypes();
+            }
+            catch (ReflectionTypeLoadException e)
+            {
+                return e.Types;
+            }
+        }
+
+        #endregion
+    }
+}
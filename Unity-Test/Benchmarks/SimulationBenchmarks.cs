@@ -0,0 +1,240 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+using UnityEngine.TestTools;
+using UnitySim.Core;
+
+namespace UnitySim.Testing.Benchmarks
+{
+    // Cost of every package with all 30 systems active, at three scene scales. Each result is
+    // reported to the Performance Testing Extension and compared with benchmark-baseline.json;
+    // a result past the baseline's tolerance fails its test.
+    //   Update  - Tick for one update interval, summed over the package's instances
+    //   Publish - ProcessScheduledUpdate with a SystemUpdated listener, i.e. event dispatch
+    //   Export  - ExportState into a reused buffer, timed and allocation-counted
+    [TestFixture(1)]
+    [TestFixture(10)]
+    [TestFixture(100)]
+    public class SimulationBenchmarks
+    {
+        private const int WarmupCount = 3;
+        private const int MeasurementCount = 15;
+        private const int WarmupFrames = 10;
+        private const int MeasuredFrames = 60;
+
+        private readonly int scale;
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(64 * 1024);
+        private BenchmarkScene scene;
+        private int listenerCalls = 0;
+
+        public static IEnumerable<string> Systems => BenchmarkScene.SystemNames;
+
+        public SimulationBenchmarks(int scale)
+        {
+            this.scale = scale;
+        }
+
+        #region Setup
+
+        // Builds the scene once per fixture and waits for every system's Start
+        [UnitySetUp]
+        public IEnumerator SetUpScene()
+        {
+            if (scene != null) yield break;
+
+            scene = new BenchmarkScene(scale);
+
+            // Benchmarks drive the systems themselves; the scheduler only runs in Frame
+            SimulationScheduler.Instance.enabled = false;
+
+            for (int frame = 0; frame < 600 && !scene.IsInitialized; frame++)
+                yield return null;
+
+            Assert.IsTrue(scene.IsInitialized, $"Benchmark scene at {scale}x did not initialize");
+            UnityEngine.Debug.Log($"SimulationBenchmarks: {scene.InstanceCount} systems active at {scale}x");
+        }
+
+        [OneTimeTearDown]
+        public void TearDownScene()
+        {
+            scene?.Dispose();
+            scene = null;
+
+            var scheduler = SimulationScheduler.Instance;
+            if (scheduler != null) scheduler.enabled = true;
+
+            BenchmarkBaseline.Save();
+        }
+
+        #endregion
+
+        #region Benchmarks
+
+        [Test, Performance]
+        public void Update([ValueSource(nameof(Systems))] string system)
+        {
+            var instances = Instances(system);
+            long timestamp = SimulationClock.Now;
+
+            Run($"Update/{system}/{scale}x", () =>
+            {
+                for (int i = 0; i < instances.Count; i++)
+                {
+                    var instance = instances[i];
+                    instance.Tick(Mathf.Max(0.0001f, instance.UpdateInterval), timestamp);
+                }
+            });
+        }
+
+        [Test, Performance]
+        public void Publish([ValueSource(nameof(Systems))] string system)
+        {
+            var instances = Instances(system);
+            Action<ISimulationSystem> listener = OnSystemUpdated;
+
+            for (int i = 0; i < instances.Count; i++) instances[i].SystemUpdated += listener;
+            listenerCalls = 0;
+
+            try
+            {
+                Run($"Publish/{system}/{scale}x", () =>
+                {
+                    for (int i = 0; i < instances.Count; i++) instances[i].ProcessScheduledUpdate();
+                });
+            }
+            finally
+            {
+                for (int i = 0; i < instances.Count; i++) instances[i].SystemUpdated -= listener;
+            }
+
+            Assert.Greater(listenerCalls, 0, $"{system} never raised SystemUpdated");
+        }
+
+        [Test, Performance]
+        public void Export([ValueSource(nameof(Systems))] string system)
+        {
+            var instances = Instances(system);
+
+            Run($"Export/{system}/{scale}x", () =>
+            {
+                for (int i = 0; i < instances.Count; i++)
+                {
+                    exportBuffer.Clear();
+                    instances[i].ExportState(exportBuffer);
+                }
+            });
+        }
+
+        // Discrete events through the scheduler's queue type, 1000 per scale step
+        [Test, Performance]
+        public void EventQueue()
+        {
+            int count = 1000 * scale;
+            var queue = new SimulationEventQueue();
+            var handler = new CountingHandler();
+            var random = new System.Random(1);
+            var offsets = new double[count];
+            for (int i = 0; i < count; i++) offsets[i] = random.NextDouble();
+
+            Run($"EventQueue/{scale}x", () =>
+            {
+                double start = queue.Now;
+                for (int i = 0; i < count; i++) queue.ScheduleAt(start + offsets[i], handler, 0, i);
+                queue.AdvanceTo(start + 1.0);
+            });
+
+            Assert.AreEqual((long)count * (WarmupCount + MeasurementCount), handler.Handled);
+        }
+
+        // Whole scheduler passes over every system, as the game would run them
+        [UnityTest, Performance]
+        public IEnumerator Frame()
+        {
+            var scheduler = SimulationScheduler.Instance;
+            var group = new SampleGroup("Frame", SampleUnit.Millisecond);
+            var samples = new double[MeasuredFrames];
+
+            scheduler.enabled = true;
+            for (int frame = 0; frame < WarmupFrames + MeasuredFrames; frame++)
+            {
+                yield return null;
+                if (frame < WarmupFrames) continue;
+
+                samples[frame - WarmupFrames] = scheduler.LastFrameTimeMs;
+                Measure.Custom(group, scheduler.LastFrameTimeMs);
+            }
+            scheduler.enabled = false;
+
+            Report($"Frame/{scale}x", samples, 0);
+        }
+
+        #endregion
+
+        #region Helpers
+
+        private IReadOnlyList<ISimulationSystem> Instances(string system)
+        {
+            var instances = scene.Get(system);
+            if (instances.Count == 0) Assert.Ignore($"{system} is not in this project");
+            return instances;
+        }
+
+        private void OnSystemUpdated(ISimulationSystem system)
+        {
+            listenerCalls++;
+        }
+
+        // Times each call and keeps the fewest bytes any call allocated, so one-off buffer
+        // growth in the first measurement doesn't count as a per-call allocation
+        private static void Run(string name, Action action)
+        {
+            for (int i = 0; i < WarmupCount; i++) action();
+
+            var timeGroup = new SampleGroup("Time", SampleUnit.Millisecond);
+            var allocationGroup = new SampleGroup("Allocated", SampleUnit.Byte);
+            var samples = new double[MeasurementCount];
+            long allocated = long.MaxValue;
+
+            for (int i = 0; i < MeasurementCount; i++)
+            {
+                long bytesBefore = GC.GetAllocatedBytesForCurrentThread();
+                long start = Stopwatch.GetTimestamp();
+                action();
+                long elapsed = Stopwatch.GetTimestamp() - start;
+                long bytes = GC.GetAllocatedBytesForCurrentThread() - bytesBefore;
+
+                samples[i] = elapsed * 1000.0 / Stopwatch.Frequency;
+                allocated = Math.Min(allocated, bytes);
+                Measure.Custom(timeGroup, samples[i]);
+                Measure.Custom(allocationGroup, bytes);
+            }
+
+            Report(name, samples, allocated);
+        }
+
+        private static void Report(string name, double[] samples, long allocatedBytes)
+        {
+            Array.Sort(samples);
+            double median = samples[samples.Length / 2];
+
+            string regression = BenchmarkBaseline.Check(name, median, allocatedBytes);
+            if (regression != null) Assert.Fail(regression);
+        }
+
+        private class CountingHandler : ISimulationEventHandler
+        {
+            public long Handled { get; private set; }
+
+            public void HandleEvent(SimulationEventQueue queue, SimulationEvent e)
+            {
+                Handled++;
+            }
+        }
+
+        #endregion
+    }
+}
@@ -355,7 +355,7 @@ namespace UnitySim.Testing
                 if (systemType != null)
                 {
                     // Check for required methods
-                    bool hasExportState = systemType.GetMethod("ExportState") != null;
+                    bool hasExportState = systemType.GetMethod("ExportState", Type.EmptyTypes) != null;
                     bool hasGetData = systemType.GetMethod("GetData") != null;
                     bool hasResetData = systemType.GetMethod("ResetData") != null;
 
@@ -441,7 +441,7 @@ namespace UnitySim.Testing
                             yield return new WaitForSeconds(0.1f);
 
                             // Try to call ExportState method
-                            MethodInfo exportMethod = systemType.GetMethod("ExportState");
+                            MethodInfo exportMethod = systemType.GetMethod("ExportState", Type.EmptyTypes);
                             if (exportMethod != null)
                             {
                                 string jsonData = (string)exportMethod.Invoke(systemComponent, null);
@@ -6,6 +6,7 @@ using System.Reflection;
 using UnityEngine;
 using UnityEngine.UI;
 using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Testing
 {
@@ -202,7 +203,7 @@ namespace UnitySim.Testing
                 }
 
                 // Check if ExportState method exists
-                MethodInfo exportMethod = systemType.GetMethod("ExportState");
+                MethodInfo exportMethod = systemType.GetMethod("ExportState", Type.EmptyTypes);
                 result.exportMethodExists = exportMethod != null;
 
                 if (!result.exportMethodExists)
@@ -568,17 +569,19 @@ namespace UnitySim.Testing
                     verifyDataTypes,
                     testDuration
                 },
-                detailedResults = testResults
+                detailedResults = testResults.ToList()
             };
 
-            string jsonData = JsonConvert.SerializeObject(exportData, Formatting.Indented);
-
-            // Save to file
+            // Serialized and written on the exporter's thread from the copied result list
             string fileName = $"json_export_validation_report_{System.DateTime.Now:yyyyMMdd_HHmmss}.json";
             string filePath = System.IO.Path.Combine(Application.persistentDataPath, fileName);
-            System.IO.File.WriteAllText(filePath, jsonData);
+            if (!SimulationScheduler.Instance.Exporter.TryExport(filePath, () => JsonConvert.SerializeObject(exportData, Formatting.Indented)))
+            {
+                Debug.LogWarning("JsonExportValidator: Report export skipped - previous exports are still being written");
+                return;
+            }
 
-            Debug.Log($"📄 JSON export validation report exported to: {filePath}");
+            Debug.Log($"📄 JSON export validation report exporting to: {filePath}");
             Debug.Log($"📊 Summary: {testResults.Count(r => r.IsFullyValid)}/{testResults.Count} systems have valid JSON export");
         }
 
@@ -0,0 +1,65 @@
+using NUnit.Framework;
+using UnitySim.Core;
+using UnitySim.Manufacturing;
+using UnitySim.SupplyChain;
+
+namespace UnitySim.Testing.Simulation
+{
+    // A mid-run reset rebases the event queue onto a smaller clock. Each model runs twice from
+    // the same seed, once straight through and once rebased to zero partway, and both runs must
+    // report the same results.
+    public class EventQueueRebaseTests
+    {
+        private const double SecondsPerDay = 86400.0;
+        private const double RebaseAt = 3.0 * SecondsPerDay;
+        private const double RunFor = 10.0 * SecondsPerDay;
+
+        [Test]
+        public void LogisticsOnTimeRateSurvivesRebase()
+        {
+            // No slack, so a good share of deliveries are late
+            var straight = new LogisticsNetwork(new LogisticsSettings { deliverySlackHours = 0f }, 7);
+            Run(straight.Start, false);
+
+            var rebased = new LogisticsNetwork(new LogisticsSettings { deliverySlackHours = 0f }, 7);
+            Run(rebased.Start, true);
+
+            Assert.Greater(straight.Deliveries, straight.OnTimeDeliveries, "Every delivery was on time, so the test proves nothing");
+            Assert.AreEqual(straight.Deliveries, rebased.Deliveries);
+            Assert.AreEqual(straight.OnTimeDeliveries, rebased.OnTimeDeliveries);
+        }
+
+        [Test]
+        public void ProductionUptimeSurvivesRebase()
+        {
+            var straight = new ProductionLine(new ProductionSettings(), 7);
+            Run(straight.Start, false);
+
+            var rebased = new ProductionLine(new ProductionSettings(), 7);
+            Run(rebased.Start, true);
+
+            Assert.Less(straight.Uptime, 1f, "No downtime was recorded, so the test proves nothing");
+            Assert.AreEqual(straight.UnitsProduced, rebased.UnitsProduced);
+            Assert.AreEqual(straight.Uptime, rebased.Uptime, 1e-4f);
+            Assert.AreEqual(straight.Efficiency, rebased.Efficiency, 1e-4f);
+        }
+
+        // Advances an hour at a time, as the scheduler would, rebasing to zero once if asked
+        private static void Run(System.Action<SimulationEventQueue> start, bool rebase)
+        {
+            var queue = new SimulationEventQueue();
+            start(queue);
+
+            double origin = 0.0;
+            for (double t = 3600.0; t <= RunFor; t += 3600.0)
+            {
+                if (rebase && origin == 0.0 && t > RebaseAt)
+                {
+                    origin = queue.Now;
+                    queue.Rebase(0.0);
+                }
+                queue.AdvanceTo(t - origin);
+            }
+        }
+    }
+}
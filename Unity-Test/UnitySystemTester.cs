@@ -4,6 +4,7 @@ using System.Linq;
 using UnityEngine;
 using UnityEngine.UI;
 using Newtonsoft.Json;
+using UnitySim.Core;
 using System;
 
 namespace UnitySim.Testing
@@ -255,7 +256,7 @@ namespace UnitySim.Testing
             try
             {
                 // Try to call ExportState method using reflection
-                var exportMethod = system.GetType().GetMethod("ExportState");
+                var exportMethod = system.GetType().GetMethod("ExportState", Type.EmptyTypes);
                 if (exportMethod != null)
                 {
                     string jsonData = (string)exportMethod.Invoke(system, null);
@@ -403,17 +404,19 @@ namespace UnitySim.Testing
                 failedSystems = failedSystems,
                 successRate = (passedSystems * 100f / totalSystems),
                 testDuration = testDuration,
-                results = testResults
+                results = testResults.ToList()
             };
 
-            string jsonData = JsonConvert.SerializeObject(exportData, Formatting.Indented);
-
-            // Save to file
+            // Serialized and written on the exporter's thread from the copied result list
             string fileName = $"unity_systems_test_results_{System.DateTime.Now:yyyyMMdd_HHmmss}.json";
             string filePath = System.IO.Path.Combine(Application.persistentDataPath, fileName);
-            System.IO.File.WriteAllText(filePath, jsonData);
+            if (!SimulationScheduler.Instance.Exporter.TryExport(filePath, () => JsonConvert.SerializeObject(exportData, Formatting.Indented)))
+            {
+                Debug.LogWarning("UnitySystemTester: Results export skipped - previous exports are still being written");
+                return;
+            }
 
-            Debug.Log($"📄 Test results exported to: {filePath}");
+            Debug.Log($"📄 Test results exporting to: {filePath}");
             Debug.Log($"📊 Results Summary: {passedSystems}/{totalSystems} systems passed ({(passedSystems * 100f / totalSystems):F1}%)");
         }
 
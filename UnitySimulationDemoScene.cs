@@ -345,7 +345,7 @@ public class UnitySimulationDemoScene : MonoBehaviour
         {
             if (system != null)
             {
-                var exportMethod = system.GetType().GetMethod("ExportState");
+                var exportMethod = system.GetType().GetMethod("ExportState", System.Type.EmptyTypes);
                 if (exportMethod != null)
                 {
                     try
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.AdvancedEconomics
 {
@@ -13,10 +17,22 @@ namespace UnitySim.AdvancedEconomics
 
         public AdvancedEconomicsData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             advancedeconomics = new AdvancedEconomicsInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (advancedeconomics != null)
+                advancedeconomics.WriteState(writer, "advancedeconomics");
+            else
+                writer.Write("advancedeconomics", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,9 +46,84 @@ namespace UnitySim.AdvancedEconomics
         public float inflationRate = 2.1f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-advanced-economics";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("marketCapitalization", marketCapitalization);
+            writer.Write("stockIndex", stockIndex);
+            writer.Write("commodityPrices", commodityPrices);
+            writer.Write("exchangeRate", exchangeRate);
+            writer.Write("interestRate", interestRate);
+            writer.Write("inflationRate", inflationRate);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public AdvancedEconomicsField Diff(AdvancedEconomicsInfo other)
+        {
+            var changed = AdvancedEconomicsField.None;
+            if (marketCapitalization != other.marketCapitalization) changed |= AdvancedEconomicsField.MarketCapitalization;
+            if (stockIndex != other.stockIndex) changed |= AdvancedEconomicsField.StockIndex;
+            if (commodityPrices != other.commodityPrices) changed |= AdvancedEconomicsField.CommodityPrices;
+            if (exchangeRate != other.exchangeRate) changed |= AdvancedEconomicsField.ExchangeRate;
+            if (interestRate != other.interestRate) changed |= AdvancedEconomicsField.InterestRate;
+            if (inflationRate != other.inflationRate) changed |= AdvancedEconomicsField.InflationRate;
+            if (systemHealth != other.systemHealth) changed |= AdvancedEconomicsField.SystemHealth;
+            if (framework != other.framework) changed |= AdvancedEconomicsField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(AdvancedEconomicsInfo target)
+        {
+            target.marketCapitalization = marketCapitalization;
+            target.stockIndex = stockIndex;
+            target.commodityPrices = commodityPrices;
+            target.exchangeRate = exchangeRate;
+            target.interestRate = interestRate;
+            target.inflationRate = inflationRate;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum AdvancedEconomicsField
+    {
+        None = 0,
+        MarketCapitalization = 1 << 0,
+        StockIndex = 1 << 1,
+        CommodityPrices = 1 << 2,
+        ExchangeRate = 1 << 3,
+        InterestRate = 1 << 4,
+        InflationRate = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct AdvancedEconomicsDelta
+    {
+        public readonly long timestamp;
+        public readonly AdvancedEconomicsField changed;
+        public readonly AdvancedEconomicsInfo values;
+
+        public AdvancedEconomicsDelta(long timestamp, AdvancedEconomicsField changed, AdvancedEconomicsInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(AdvancedEconomicsField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class AdvancedEconomicsSystem : MonoBehaviour
+    public class AdvancedEconomicsSystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem
     {
         [Header("AdvancedEconomics Settings")]
         public float updateInterval = 1f;
@@ -48,12 +139,19 @@ namespace UnitySim.AdvancedEconomics
 
         // Events
         public System.Action<AdvancedEconomicsData> OnAdvancedEconomicsChanged;
+        public System.Action<AdvancedEconomicsDelta> OnAdvancedEconomicsDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.AdvancedEconomicsSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly AdvancedEconomicsInfo publishedInfo = new AdvancedEconomicsInfo();
+        private bool publishFullDelta = true;
+        private int stateVersion = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +160,16 @@ namespace UnitySim.AdvancedEconomics
             InitializeAdvancedEconomics();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +179,8 @@ namespace UnitySim.AdvancedEconomics
         private void InitializeAdvancedEconomics()
         {
             currentData = new AdvancedEconomicsData();
+            stateVersion++;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,19 +191,19 @@ namespace UnitySim.AdvancedEconomics
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
                         currentData.advancedeconomics.marketCapitalization *= (1 + UnityEngine.Random.Range(-0.05f, 0.05f));
             currentData.advancedeconomics.stockIndex += UnityEngine.Random.Range(-50f, 50f);
@@ -122,6 +220,12 @@ namespace UnitySim.AdvancedEconomics
                 OnAdvancedEconomicsChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +233,96 @@ namespace UnitySim.AdvancedEconomics
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.advancedeconomics;
+            var changed = publishFullDelta ? AdvancedEconomicsField.All : info.Diff(publishedInfo);
+            if (changed == AdvancedEconomicsField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnAdvancedEconomicsDelta?.Invoke(new AdvancedEconomicsDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(AdvancedEconomicsSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.Multiply(-0.05f, 0.05f));
+            channels.Add(SimulationChannel.Add(-50f, 50f));
+            channels.Add(SimulationChannel.Multiply(-0.02f, 0.02f));
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.advancedeconomics.marketCapitalization;
+            values[1] = currentData.advancedeconomics.stockIndex;
+            values[2] = currentData.advancedeconomics.commodityPrices;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.advancedeconomics.marketCapitalization = (float)values[0];
+            currentData.advancedeconomics.stockIndex = (float)values[1];
+            currentData.advancedeconomics.commodityPrices = (float)values[2];
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("AdvancedEconomicsSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +333,9 @@ namespace UnitySim.AdvancedEconomics
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +387,7 @@ namespace UnitySim.AdvancedEconomics
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -218,6 +410,7 @@ namespace UnitySim.AdvancedEconomics
             Debug.Log($"AdvancedEconomicsSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Agriculture
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Agriculture
 
         public AgricultureData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             agriculture = new AgricultureInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (agriculture != null)
+                agriculture.WriteState(writer, "agriculture");
+            else
+                writer.Write("agriculture", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,94 @@ namespace UnitySim.Agriculture
         public string season = "spring";
         public string systemHealth = "operational";
         public string framework = "unity-sim-agriculture";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("cropYield", cropYield);
+            writer.Write("soilQuality", soilQuality);
+            writer.Write("rainfall", rainfall);
+            writer.Write("plantedAcres", plantedAcres);
+            writer.Write("fertilizer", fertilizer);
+            writer.Write("season", season);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public AgricultureField Diff(AgricultureInfo other)
+        {
+            var changed = AgricultureField.None;
+            if (cropYield != other.cropYield) changed |= AgricultureField.CropYield;
+            if (soilQuality != other.soilQuality) changed |= AgricultureField.SoilQuality;
+            if (rainfall != other.rainfall) changed |= AgricultureField.Rainfall;
+            if (plantedAcres != other.plantedAcres) changed |= AgricultureField.PlantedAcres;
+            if (fertilizer != other.fertilizer) changed |= AgricultureField.Fertilizer;
+            if (season != other.season) changed |= AgricultureField.Season;
+            if (systemHealth != other.systemHealth) changed |= AgricultureField.SystemHealth;
+            if (framework != other.framework) changed |= AgricultureField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(AgricultureInfo target)
+        {
+            target.cropYield = cropYield;
+            target.soilQuality = soilQuality;
+            target.rainfall = rainfall;
+            target.plantedAcres = plantedAcres;
+            target.fertilizer = fertilizer;
+            target.season = season;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum AgricultureField
+    {
+        None = 0,
+        CropYield = 1 << 0,
+        SoilQuality = 1 << 1,
+        Rainfall = 1 << 2,
+        PlantedAcres = 1 << 3,
+        Fertilizer = 1 << 4,
+        Season = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct AgricultureDelta
+    {
+        public readonly long timestamp;
+        public readonly AgricultureField changed;
+        public readonly AgricultureInfo values;
+
+        public AgricultureDelta(long timestamp, AgricultureField changed, AgricultureInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(AgricultureField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class AgricultureSystem : MonoBehaviour
+    public class AgricultureSystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem
     {
         [Header("Agriculture Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Local Weather")]
+        public bool useLocalWeather = true;
+        public float rainfallResponseTime = 600f;
+
         [Header("Current Data")]
         [SerializeField] private AgricultureData currentData;
 
@@ -48,12 +143,22 @@ namespace UnitySim.Agriculture
 
         // Events
         public System.Action<AgricultureData> OnAgricultureChanged;
+        public System.Action<AgricultureDelta> OnAgricultureDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
+
+        private const float HoursPerYear = 8760f;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.AgricultureSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly AgricultureInfo publishedInfo = new AgricultureInfo();
+        private bool publishFullDelta = true;
+        private int stateVersion = 0;
+        private long lastWeatherTimestamp = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +167,16 @@ namespace UnitySim.Agriculture
             InitializeAgriculture();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +186,9 @@ namespace UnitySim.Agriculture
         private void InitializeAgriculture()
         {
             currentData = new AgricultureData();
+            stateVersion++;
+            lastWeatherTimestamp = currentData.timestamp;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,19 +199,19 @@ namespace UnitySim.Agriculture
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
                         currentData.agriculture.cropYield += UnityEngine.Random.Range(-2f, 3f);
             currentData.agriculture.soilQuality = Mathf.Clamp(currentData.agriculture.soilQuality + UnityEngine.Random.Range(-1f, 1f), 0f, 100f);
@@ -116,12 +222,20 @@ namespace UnitySim.Agriculture
         {
             updateCounter++;
 
+            ApplyLocalWeather();
+
             // Trigger events
             if (enableEvents && OnAgricultureChanged != null)
             {
                 OnAgricultureChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +243,113 @@ namespace UnitySim.Agriculture
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.agriculture;
+            var changed = publishFullDelta ? AgricultureField.All : info.Diff(publishedInfo);
+            if (changed == AgricultureField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnAgricultureDelta?.Invoke(new AgricultureDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        // Rainfall follows the weather tile under this object when a weather provider is
+        // present; otherwise the random walk above stays in charge
+        private void ApplyLocalWeather()
+        {
+            float elapsed = Mathf.Max(0f, (currentData.timestamp - lastWeatherTimestamp) / 1000f);
+            lastWeatherTimestamp = currentData.timestamp;
+
+            if (!useLocalWeather) return;
+            var weather = SimulationRegistry.Find<IWeatherProvider>();
+            if (weather == null) return;
+
+            var local = weather.SampleWeather(transform.position);
+            float annualRainfall = local.precipitation * HoursPerYear;
+            float blend = 1f - Mathf.Exp(-elapsed / Mathf.Max(1f, rainfallResponseTime));
+            currentData.agriculture.rainfall += (annualRainfall - currentData.agriculture.rainfall) * blend;
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(AgricultureSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.Add(-2f, 3f));
+            channels.Add(SimulationChannel.Add(-1f, 1f).Clamp(0f, 100f));
+            channels.Add(SimulationChannel.Add(-10f, 15f));
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.agriculture.cropYield;
+            values[1] = currentData.agriculture.soilQuality;
+            values[2] = currentData.agriculture.rainfall;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.agriculture.cropYield = (float)values[0];
+            currentData.agriculture.soilQuality = (float)values[1];
+            currentData.agriculture.rainfall = (float)values[2];
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("AgricultureSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +360,9 @@ namespace UnitySim.Agriculture
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +414,7 @@ namespace UnitySim.Agriculture
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -218,6 +437,7 @@ namespace UnitySim.Agriculture
             Debug.Log($"AgricultureSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.AIDecisionFramework
 {
@@ -13,10 +17,22 @@ namespace UnitySim.AIDecisionFramework
 
         public AIDecisionFrameworkData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             aidecisionframework = new AIDecisionFrameworkInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (aidecisionframework != null)
+                aidecisionframework.WriteState(writer, "aidecisionframework");
+            else
+                writer.Write("aidecisionframework", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,103 @@ namespace UnitySim.AIDecisionFramework
         public int activeAgents = 25;
         public string systemHealth = "operational";
         public string framework = "unity-sim-ai-decision-framework";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("behaviorTrees", behaviorTrees);
+            writer.Write("stateMachines", stateMachines);
+            writer.Write("goalPlanning", goalPlanning);
+            writer.Write("decisionTime", decisionTime);
+            writer.Write("adaptiveBehavior", adaptiveBehavior);
+            writer.Write("activeAgents", activeAgents);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public AIDecisionFrameworkField Diff(AIDecisionFrameworkInfo other)
+        {
+            var changed = AIDecisionFrameworkField.None;
+            if (behaviorTrees != other.behaviorTrees) changed |= AIDecisionFrameworkField.BehaviorTrees;
+            if (stateMachines != other.stateMachines) changed |= AIDecisionFrameworkField.StateMachines;
+            if (goalPlanning != other.goalPlanning) changed |= AIDecisionFrameworkField.GoalPlanning;
+            if (decisionTime != other.decisionTime) changed |= AIDecisionFrameworkField.DecisionTime;
+            if (adaptiveBehavior != other.adaptiveBehavior) changed |= AIDecisionFrameworkField.AdaptiveBehavior;
+            if (activeAgents != other.activeAgents) changed |= AIDecisionFrameworkField.ActiveAgents;
+            if (systemHealth != other.systemHealth) changed |= AIDecisionFrameworkField.SystemHealth;
+            if (framework != other.framework) changed |= AIDecisionFrameworkField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(AIDecisionFrameworkInfo target)
+        {
+            target.behaviorTrees = behaviorTrees;
+            target.stateMachines = stateMachines;
+            target.goalPlanning = goalPlanning;
+            target.decisionTime = decisionTime;
+            target.adaptiveBehavior = adaptiveBehavior;
+            target.activeAgents = activeAgents;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum AIDecisionFrameworkField
+    {
+        None = 0,
+        BehaviorTrees = 1 << 0,
+        StateMachines = 1 << 1,
+        GoalPlanning = 1 << 2,
+        DecisionTime = 1 << 3,
+        AdaptiveBehavior = 1 << 4,
+        ActiveAgents = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
     }
 
-    public class AIDecisionFrameworkSystem : MonoBehaviour
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct AIDecisionFrameworkDelta
+    {
+        public readonly long timestamp;
+        public readonly AIDecisionFrameworkField changed;
+        public readonly AIDecisionFrameworkInfo values;
+
+        public AIDecisionFrameworkDelta(long timestamp, AIDecisionFrameworkField changed, AIDecisionFrameworkInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(AIDecisionFrameworkField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class AIDecisionFrameworkSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("AIDecisionFramework Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Agents")]
+        public int agentCount = 2000;
+        public float spawnRadius = 200f;
+        public int randomSeed = 0;
+        public Transform player;
+
+        [Header("Execution")]
+        public BehaviorExecutorSettings execution = new BehaviorExecutorSettings();
+        public float frameBudgetMs = 1f;
+        [SerializeField] private float lastFrameMs = 0f;
+        [SerializeField] private int ticksLastFrame = 0;
+        [SerializeField] private float maxStaleness = 0f;
+
         [Header("Current Data")]
         [SerializeField] private AIDecisionFrameworkData currentData;
 
@@ -48,12 +152,20 @@ namespace UnitySim.AIDecisionFramework
 
         // Events
         public System.Action<AIDecisionFrameworkData> OnAIDecisionFrameworkChanged;
+        public System.Action<AIDecisionFrameworkDelta> OnAIDecisionFrameworkDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.AIDecisionFrameworkSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly AIDecisionFrameworkInfo publishedInfo = new AIDecisionFrameworkInfo();
+        private bool publishFullDelta = true;
+        private BehaviorExecutor executor;
+        private VillagerBehavior villagers;
 
         #region Unity Lifecycle
 
@@ -62,18 +174,29 @@ namespace UnitySim.AIDecisionFramework
             InitializeAIDecisionFramework();
         }
 
+        void OnEnable()
+        {
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
+
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
+
         void Update()
         {
-            if (!isInitialized) return;
+            if (executor == null) return;
 
-            UpdateSystem();
+            // Trees tick every frame inside the budget; the scheduled update only publishes
+            var focus = FocusPosition();
+            villagers.focus = focus;
+            executor.Update(SimulationScheduler.Instance.Clock.SimulatedSeconds, focus, frameBudgetMs);
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+            lastFrameMs = executor.LastFrameMs;
+            ticksLastFrame = executor.LastFrameTicks;
         }
 
         #endregion
@@ -83,6 +206,28 @@ namespace UnitySim.AIDecisionFramework
         private void InitializeAIDecisionFramework()
         {
             currentData = new AIDecisionFrameworkData();
+
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            villagers = new VillagerBehavior(seed);
+            executor = new BehaviorExecutor(VillagerBehavior.KeyCount, villagers, execution, agentCount);
+            int tree = executor.AddTree(VillagerBehavior.CreateTree());
+
+            // Scattered over a disc around this object with staggered needs
+            var centre = transform.position;
+            var random = new System.Random((int)seed);
+            for (int i = 0; i < agentCount; i++)
+            {
+                float angle = (float)(random.NextDouble() * 2.0 * Math.PI);
+                float radius = spawnRadius * (float)Math.Sqrt(random.NextDouble());
+                var position = new Vector3(centre.x + radius * Mathf.Cos(angle), centre.y, centre.z + radius * Mathf.Sin(angle));
+
+                int agent = executor.AddAgent(tree, position);
+                executor.Set(agent, VillagerBehavior.Hunger, (float)random.NextDouble());
+                executor.Set(agent, VillagerBehavior.Fatigue, (float)random.NextDouble());
+                executor.Set(agent, VillagerBehavior.TargetX, position.x);
+                executor.Set(agent, VillagerBehavior.TargetZ, position.z);
+            }
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,22 +238,34 @@ namespace UnitySim.AIDecisionFramework
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
+        }
+
+        private void UpdateSpecificData(float deltaTime)
+        {
+            if (executor == null) return;
+
+            var info = currentData.aidecisionframework;
+            info.behaviorTrees = executor.TreeCount;
+            info.activeAgents = executor.AgentCount;
+            info.decisionTime = executor.AverageFrameMs;
+            maxStaleness = executor.MaxStaleness;
         }
 
-        private void UpdateSpecificData()
+        private Vector3 FocusPosition()
         {
-                        currentData.aidecisionframework.decisionTime += UnityEngine.Random.Range(-0.02f, 0.02f);
-            currentData.aidecisionframework.activeAgents = Mathf.Max(1, currentData.aidecisionframework.activeAgents + UnityEngine.Random.Range(-2, 3));
+            if (player != null) return player.position;
+            var camera = Camera.main;
+            return camera != null ? camera.transform.position : transform.position;
         }
 
         private void ProcessUpdate()
@@ -121,6 +278,12 @@ namespace UnitySim.AIDecisionFramework
                 OnAIDecisionFrameworkChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -128,10 +291,67 @@ namespace UnitySim.AIDecisionFramework
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.aidecisionframework;
+            var changed = publishFullDelta ? AIDecisionFrameworkField.All : info.Diff(publishedInfo);
+            if (changed == AIDecisionFrameworkField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnAIDecisionFrameworkDelta?.Invoke(new AIDecisionFrameworkDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(AIDecisionFrameworkSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("AIDecisionFrameworkSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -142,7 +362,9 @@ namespace UnitySim.AIDecisionFramework
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -163,6 +385,11 @@ namespace UnitySim.AIDecisionFramework
             return currentData;
         }
 
+        public BehaviorExecutor GetExecutor()
+        {
+            return executor;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -194,7 +421,7 @@ namespace UnitySim.AIDecisionFramework
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -206,6 +433,12 @@ namespace UnitySim.AIDecisionFramework
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            agentCount = Mathf.Max(0, agentCount);
+            spawnRadius = Mathf.Max(0f, spawnRadius);
+            frameBudgetMs = Mathf.Max(0.05f, frameBudgetMs);
+            execution.nearRadius = Mathf.Max(0f, execution.nearRadius);
+            execution.nearShare = Mathf.Clamp01(execution.nearShare);
+            execution.tierRefreshSeconds = Mathf.Max(0f, execution.tierRefreshSeconds);
         }
 
         #endregion
@@ -217,7 +450,10 @@ namespace UnitySim.AIDecisionFramework
             Debug.Log($"AIDecisionFrameworkSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (executor != null)
+                Debug.Log($"- Behaviour Trees: {executor.AgentCount} agents ({executor.NearAgents} near), {executor.LastFrameTicks} ticked in {executor.LastFrameMs:F3}ms of {frameBudgetMs}ms, {executor.AverageTickMicroseconds:F2}us per tick, oldest {executor.MaxStaleness:F2}s");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
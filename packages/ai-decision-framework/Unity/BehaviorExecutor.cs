@@ -0,0 +1,310 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.AIDecisionFramework
+{
+    // Leaf actions for every tree an executor runs. deltaTime is the simulated time since the
+    // agent last ticked, which grows when the frame budget spreads agents over several frames.
+    public interface IBehaviorActions
+    {
+        BehaviorStatus Execute(BehaviorExecutor executor, int agent, int action, float deltaTime);
+    }
+
+    [System.Serializable]
+    public class BehaviorExecutorSettings
+    {
+        // Agents within nearRadius of the focus tick every frame, using up to nearShare of the budget
+        public float nearRadius = 40f;
+        public float nearShare = 0.5f;
+
+        // How often the near set is rebuilt from agent positions, in seconds
+        public float tierRefreshSeconds = 0.25f;
+    }
+
+    // Ticks behaviour trees for many agents inside a per-frame millisecond budget. Blackboards
+    // are one contiguous float array, keysPerAgent floats per agent. Each frame the agents near
+    // the focus go first, then a round-robin cursor continues over everyone else from where
+    // the last frame stopped, so every agent is reached within a few frames and none is skipped
+    // for long. Trees are re-evaluated from the root, so a Running action simply runs again on
+    // the agent's next tick.
+    public class BehaviorExecutor
+    {
+        private readonly BehaviorExecutorSettings settings;
+        private readonly IBehaviorActions actions;
+        private readonly int keysPerAgent;
+        private readonly List<BehaviorTree> trees = new List<BehaviorTree>();
+
+        private float[] blackboard = new float[0];
+        private Vector3[] positions = new Vector3[0];
+        private int[] treeOf = new int[0];
+        private double[] lastTick = new double[0];
+        private int[] tickedFrame = new int[0];
+        private BehaviorStatus[] status = new BehaviorStatus[0];
+        private int count = 0;
+
+        private readonly List<int> near = new List<int>();
+        private double lastTierRefresh = double.NegativeInfinity;
+        private int nearCursor = 0;
+        private int cursor = 0;
+        private int frame = 0;
+
+        private readonly System.Diagnostics.Stopwatch stopwatch = new System.Diagnostics.Stopwatch();
+
+        public int AgentCount => count;
+        public int TreeCount => trees.Count;
+        public int KeysPerAgent => keysPerAgent;
+        public int NearAgents => near.Count;
+
+        public float LastFrameMs { get; private set; }
+        public int LastFrameTicks { get; private set; }
+        public long TotalTicks { get; private set; }
+
+        // Smoothed per-frame cost and per-tick cost
+        public float AverageFrameMs { get; private set; }
+        public float AverageTickMicroseconds { get; private set; }
+
+        // Longest any agent had gone without a tick at the last tier refresh, in seconds
+        public float MaxStaleness { get; private set; }
+
+        public BehaviorExecutor(int keysPerAgent, IBehaviorActions actions, BehaviorExecutorSettings settings = null, int capacity = 256)
+        {
+            this.keysPerAgent = Math.Max(1, keysPerAgent);
+            this.actions = actions ?? throw new ArgumentNullException(nameof(actions));
+            this.settings = settings ?? new BehaviorExecutorSettings();
+            Grow(Math.Max(1, capacity));
+        }
+
+        #region Agents
+
+        public int AddTree(BehaviorTree tree)
+        {
+            trees.Add(tree ?? throw new ArgumentNullException(nameof(tree)));
+            return trees.Count - 1;
+        }
+
+        public BehaviorTree GetTree(int index)
+        {
+            return trees[index];
+        }
+
+        public int AddAgent(int tree, Vector3 position)
+        {
+            if ((uint)tree >= (uint)trees.Count) throw new ArgumentOutOfRangeException(nameof(tree));
+            if (count == treeOf.Length) Grow(treeOf.Length * 2);
+
+            int agent = count++;
+            treeOf[agent] = tree;
+            positions[agent] = position;
+            lastTick[agent] = double.NaN;
+            tickedFrame[agent] = -1;
+            status[agent] = BehaviorStatus.Success;
+            Array.Clear(blackboard, agent * keysPerAgent, keysPerAgent);
+
+            // Picked up by the next tier refresh
+            lastTierRefresh = double.NegativeInfinity;
+            return agent;
+        }
+
+        public void Clear()
+        {
+            count = 0;
+            near.Clear();
+            nearCursor = 0;
+            cursor = 0;
+        }
+
+        public float Get(int agent, int key)
+        {
+            return blackboard[agent * keysPerAgent + key];
+        }
+
+        public void Set(int agent, int key, float value)
+        {
+            blackboard[agent * keysPerAgent + key] = value;
+        }
+
+        public Span<float> GetBlackboard(int agent)
+        {
+            return new Span<float>(blackboard, agent * keysPerAgent, keysPerAgent);
+        }
+
+        public Vector3 GetPosition(int agent)
+        {
+            return positions[agent];
+        }
+
+        public void SetPosition(int agent, Vector3 position)
+        {
+            positions[agent] = position;
+        }
+
+        public BehaviorStatus GetStatus(int agent)
+        {
+            return status[agent];
+        }
+
+        #endregion
+
+        #region Update
+
+        // Ticks as many agents as fit in budgetMs, always at least one. now is simulated seconds.
+        public int Update(double now, Vector3 focus, float budgetMs)
+        {
+            stopwatch.Restart();
+            frame++;
+
+            if (now - lastTierRefresh >= settings.tierRefreshSeconds)
+                RefreshTiers(now, focus);
+
+            int ticks = 0;
+            budgetMs = Math.Max(0f, budgetMs);
+
+            // Near agents first, capped so they can't starve the rest
+            float nearBudget = budgetMs * Mathf.Clamp01(settings.nearShare);
+            int visited = 0;
+            for (; visited < near.Count; visited++)
+            {
+                if (ticks > 0 && stopwatch.Elapsed.TotalMilliseconds >= nearBudget) break;
+
+                int agent = near[(nearCursor + visited) % near.Count];
+                if (agent >= count) continue;
+
+                Tick(agent, now);
+                ticks++;
+            }
+            if (near.Count > 0) nearCursor = (nearCursor + visited) % near.Count;
+
+            // Then round-robin over everyone
+            visited = 0;
+            for (; visited < count; visited++)
+            {
+                if (ticks > 0 && stopwatch.Elapsed.TotalMilliseconds >= budgetMs) break;
+
+                int agent = (cursor + visited) % count;
+                if (tickedFrame[agent] == frame) continue;
+
+                Tick(agent, now);
+                ticks++;
+            }
+            if (count > 0) cursor = (cursor + visited) % count;
+
+            stopwatch.Stop();
+            LastFrameMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+            LastFrameTicks = ticks;
+            TotalTicks += ticks;
+            AverageFrameMs += (LastFrameMs - AverageFrameMs) * 0.05f;
+            if (ticks > 0)
+                AverageTickMicroseconds += (LastFrameMs * 1000f / ticks - AverageTickMicroseconds) * 0.05f;
+            return ticks;
+        }
+
+        // Ticks one agent immediately, outside the budget
+        public BehaviorStatus Tick(int agent, double now)
+        {
+            double previous = lastTick[agent];
+            float deltaTime = double.IsNaN(previous) ? 0f : (float)Math.Max(0.0, now - previous);
+            lastTick[agent] = now;
+            tickedFrame[agent] = frame;
+
+            status[agent] = Evaluate(trees[treeOf[agent]], 0, agent, deltaTime);
+            return status[agent];
+        }
+
+        private void RefreshTiers(double now, Vector3 focus)
+        {
+            lastTierRefresh = now;
+            near.Clear();
+
+            float radiusSq = settings.nearRadius * settings.nearRadius;
+            double oldest = now;
+            for (int agent = 0; agent < count; agent++)
+            {
+                float dx = positions[agent].x - focus.x;
+                float dz = positions[agent].z - focus.z;
+                if (dx * dx + dz * dz <= radiusSq) near.Add(agent);
+
+                if (!double.IsNaN(lastTick[agent]) && lastTick[agent] < oldest) oldest = lastTick[agent];
+            }
+
+            MaxStaleness = (float)(now - oldest);
+            if (nearCursor >= near.Count) nearCursor = 0;
+        }
+
+        #endregion
+
+        #region Evaluation
+
+        private BehaviorStatus Evaluate(BehaviorTree tree, int node, int agent, float deltaTime)
+        {
+            switch (tree.type[node])
+            {
+                case BehaviorNode.Selector:
+                    for (int child = node + 1; child < tree.end[node]; child = tree.end[child])
+                    {
+                        var result = Evaluate(tree, child, agent, deltaTime);
+                        if (result != BehaviorStatus.Failure) return result;
+                    }
+                    return BehaviorStatus.Failure;
+
+                case BehaviorNode.Sequence:
+                    for (int child = node + 1; child < tree.end[node]; child = tree.end[child])
+                    {
+                        var result = Evaluate(tree, child, agent, deltaTime);
+                        if (result != BehaviorStatus.Success) return result;
+                    }
+                    return BehaviorStatus.Success;
+
+                case BehaviorNode.UtilitySelector:
+                    return Evaluate(tree, BestChild(tree, node, agent), agent, deltaTime);
+
+                case BehaviorNode.Inverter:
+                    var inner = Evaluate(tree, node + 1, agent, deltaTime);
+                    return inner == BehaviorStatus.Running ? inner : (inner == BehaviorStatus.Success ? BehaviorStatus.Failure : BehaviorStatus.Success);
+
+                case BehaviorNode.Condition:
+                    float value = blackboard[agent * keysPerAgent + tree.key[node]];
+                    bool passed = tree.compare[node] == BlackboardCompare.Less ? value < tree.value[node] : value > tree.value[node];
+                    return passed ? BehaviorStatus.Success : BehaviorStatus.Failure;
+
+                default:
+                    return actions.Execute(this, agent, tree.action[node], deltaTime);
+            }
+        }
+
+        private int BestChild(BehaviorTree tree, int node, int agent)
+        {
+            int best = node + 1;
+            float bestScore = float.NegativeInfinity;
+            int row = agent * keysPerAgent;
+
+            for (int child = node + 1; child < tree.end[node]; child = tree.end[child])
+            {
+                int key = tree.scoreKey[child];
+                float score = tree.scoreWeight[child] * (key >= 0 ? blackboard[row + key] : 1f);
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    best = child;
+                }
+            }
+            return best;
+        }
+
+        #endregion
+
+        #region Helpers
+
+        private void Grow(int capacity)
+        {
+            Array.Resize(ref blackboard, capacity * keysPerAgent);
+            Array.Resize(ref positions, capacity);
+            Array.Resize(ref treeOf, capacity);
+            Array.Resize(ref lastTick, capacity);
+            Array.Resize(ref tickedFrame, capacity);
+            Array.Resize(ref status, capacity);
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,204 @@
+using System;
+using System.Collections.Generic;
+
+namespace UnitySim.AIDecisionFramework
+{
+    public enum BehaviorNode : byte
+    {
+        Selector,
+        Sequence,
+        UtilitySelector,
+        Inverter,
+        Condition,
+        Action
+    }
+
+    public enum BehaviorStatus : byte
+    {
+        Success,
+        Failure,
+        Running
+    }
+
+    public enum BlackboardCompare : byte
+    {
+        Less,
+        Greater
+    }
+
+    // An immutable tree flattened into parallel arrays in depth-first order. A node's first
+    // child is the next index and its subtree ends at end[node], so siblings are found by
+    // jumping to the previous sibling's end. Trees are shared by every agent that runs them;
+    // all per-agent state lives in the executor's blackboards.
+    public sealed class BehaviorTree
+    {
+        internal readonly BehaviorNode[] type;
+        internal readonly int[] end;
+
+        // Conditions compare blackboard[key] against value; actions dispatch on action
+        internal readonly short[] key;
+        internal readonly BlackboardCompare[] compare;
+        internal readonly float[] value;
+        internal readonly int[] action;
+
+        // Children of a utility selector score weight * blackboard[scoreKey], or weight alone
+        // when scoreKey is -1
+        internal readonly short[] scoreKey;
+        internal readonly float[] scoreWeight;
+
+        public string Name { get; }
+        public int NodeCount => type.Length;
+
+        internal BehaviorTree(string name, List<BehaviorTreeBuilder.Node> nodes)
+        {
+            Name = name;
+            int count = nodes.Count;
+            type = new BehaviorNode[count];
+            end = new int[count];
+            key = new short[count];
+            compare = new BlackboardCompare[count];
+            value = new float[count];
+            action = new int[count];
+            scoreKey = new short[count];
+            scoreWeight = new float[count];
+
+            for (int i = 0; i < count; i++)
+            {
+                var node = nodes[i];
+                type[i] = node.type;
+                end[i] = node.end;
+                key[i] = node.key;
+                compare[i] = node.compare;
+                value[i] = node.value;
+                action[i] = node.action;
+                scoreKey[i] = node.scoreKey;
+                scoreWeight[i] = node.scoreWeight;
+            }
+        }
+
+        public BehaviorNode GetNodeType(int node)
+        {
+            return type[node];
+        }
+    }
+
+    // Builds a BehaviorTree in the order it reads:
+    //   new BehaviorTreeBuilder().Selector().Condition(0, BlackboardCompare.Greater, 0.5f).Action(1).End().Build("guard")
+    // Composites stay open until End; Score applies to the next node added.
+    public class BehaviorTreeBuilder
+    {
+        internal struct Node
+        {
+            public BehaviorNode type;
+            public int end;
+            public short key;
+            public BlackboardCompare compare;
+            public float value;
+            public int action;
+            public short scoreKey;
+            public float scoreWeight;
+        }
+
+        private readonly List<Node> nodes = new List<Node>();
+        private readonly Stack<int> open = new Stack<int>();
+        private short pendingScoreKey = -1;
+        private float pendingScoreWeight = 1f;
+
+        public BehaviorTreeBuilder Selector() => Open(BehaviorNode.Selector);
+        public BehaviorTreeBuilder Sequence() => Open(BehaviorNode.Sequence);
+        public BehaviorTreeBuilder Utility() => Open(BehaviorNode.UtilitySelector);
+        public BehaviorTreeBuilder Inverter() => Open(BehaviorNode.Inverter);
+
+        public BehaviorTreeBuilder Condition(int key, BlackboardCompare compare, float value)
+        {
+            int node = Add(BehaviorNode.Condition);
+            var entry = nodes[node];
+            entry.key = checked((short)key);
+            entry.compare = compare;
+            entry.value = value;
+            nodes[node] = entry;
+            Close(node);
+            return this;
+        }
+
+        public BehaviorTreeBuilder Action(int action)
+        {
+            int node = Add(BehaviorNode.Action);
+            var entry = nodes[node];
+            entry.action = action;
+            nodes[node] = entry;
+            Close(node);
+            return this;
+        }
+
+        // Utility consideration for the next node, read when its parent is a utility selector
+        public BehaviorTreeBuilder Score(int key, float weight)
+        {
+            pendingScoreKey = checked((short)key);
+            pendingScoreWeight = weight;
+            return this;
+        }
+
+        public BehaviorTreeBuilder End()
+        {
+            if (open.Count == 0) throw new InvalidOperationException("End without an open composite");
+
+            int node = open.Pop();
+            int children = CountChildren(node);
+            if (children == 0) throw new InvalidOperationException($"{nodes[node].type} at {node} has no children");
+            if (nodes[node].type == BehaviorNode.Inverter && children != 1) throw new InvalidOperationException($"Inverter at {node} needs exactly one child");
+
+            Close(node);
+            return this;
+        }
+
+        public BehaviorTree Build(string name)
+        {
+            if (open.Count > 0) throw new InvalidOperationException($"{open.Count} composite(s) left open");
+            if (nodes.Count == 0) throw new InvalidOperationException("Empty tree");
+            if (nodes[0].end != nodes.Count) throw new InvalidOperationException("A tree must have a single root");
+
+            return new BehaviorTree(name, nodes);
+        }
+
+        private BehaviorTreeBuilder Open(BehaviorNode type)
+        {
+            open.Push(Add(type));
+            return this;
+        }
+
+        private int Add(BehaviorNode type)
+        {
+            if (open.Count == 0 && nodes.Count > 0) throw new InvalidOperationException("A tree must have a single root");
+
+            nodes.Add(new Node
+            {
+                type = type,
+                end = -1,
+                key = -1,
+                scoreKey = pendingScoreKey,
+                scoreWeight = pendingScoreWeight
+            });
+            pendingScoreKey = -1;
+            pendingScoreWeight = 1f;
+            return nodes.Count - 1;
+        }
+
+        private void Close(int node)
+        {
+            var entry = nodes[node];
+            entry.end = nodes.Count;
+            nodes[node] = entry;
+        }
+
+        private int CountChildren(int node)
+        {
+            int children = 0;
+            for (int child = node + 1; child < nodes.Count; child = nodes[child].end)
+            {
+                children++;
+            }
+            return children;
+        }
+    }
+}
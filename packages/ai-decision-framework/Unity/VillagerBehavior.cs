@@ -0,0 +1,127 @@
+using UnityEngine;
+
+namespace UnitySim.AIDecisionFramework
+{
+    // Default agents for AIDecisionFrameworkSystem: villagers that sense the focus, flee when it
+    // comes close, and otherwise pick between eating, resting and wandering by utility.
+    public class VillagerBehavior : IBehaviorActions
+    {
+        // Blackboard layout
+        public const int Hunger = 0;
+        public const int Fatigue = 1;
+        public const int Threat = 2;
+        public const int TargetX = 3;
+        public const int TargetZ = 4;
+        public const int KeyCount = 5;
+
+        // Actions
+        public const int Sense = 0;
+        public const int Flee = 1;
+        public const int Eat = 2;
+        public const int Rest = 3;
+        public const int Wander = 4;
+
+        public Vector3 focus;
+        public float threatRadius = 25f;
+        public float walkSpeed = 2f;
+        public float runSpeed = 5f;
+        public float worldExtent = 500f;
+
+        private uint state;
+
+        public VillagerBehavior(uint seed)
+        {
+            state = seed != 0 ? seed : 1u;
+        }
+
+        public static BehaviorTree CreateTree()
+        {
+            return new BehaviorTreeBuilder()
+                .Sequence()
+                    .Action(Sense)
+                    .Selector()
+                        .Sequence()
+                            .Condition(Threat, BlackboardCompare.Greater, 0.6f)
+                            .Action(Flee)
+                        .End()
+                        .Utility()
+                            .Score(Hunger, 1f).Action(Eat)
+                            .Score(Fatigue, 0.8f).Action(Rest)
+                            .Score(-1, 0.35f).Action(Wander)
+                        .End()
+                    .End()
+                .End()
+                .Build("villager");
+        }
+
+        public BehaviorStatus Execute(BehaviorExecutor executor, int agent, int action, float deltaTime)
+        {
+            var board = executor.GetBlackboard(agent);
+            var position = executor.GetPosition(agent);
+
+            switch (action)
+            {
+                case Sense:
+                {
+                    // Needs build up over time; threat falls off linearly with distance to the focus
+                    board[Hunger] = Mathf.Min(1f, board[Hunger] + deltaTime * 0.01f);
+                    board[Fatigue] = Mathf.Min(1f, board[Fatigue] + deltaTime * 0.006f);
+                    float dx = position.x - focus.x;
+                    float dz = position.z - focus.z;
+                    board[Threat] = Mathf.Clamp01(1f - Mathf.Sqrt(dx * dx + dz * dz) / Mathf.Max(0.01f, threatRadius));
+                    return BehaviorStatus.Success;
+                }
+
+                case Flee:
+                {
+                    var away = new Vector3(position.x - focus.x, 0f, position.z - focus.z);
+                    float length = Mathf.Max(0.001f, Mathf.Sqrt(away.x * away.x + away.z * away.z));
+                    float step = runSpeed * deltaTime / length;
+                    executor.SetPosition(agent, Clamp(new Vector3(position.x + away.x * step, position.y, position.z + away.z * step)));
+                    board[Fatigue] = Mathf.Min(1f, board[Fatigue] + deltaTime * 0.02f);
+                    return BehaviorStatus.Running;
+                }
+
+                case Eat:
+                    board[Hunger] = Mathf.Max(0f, board[Hunger] - deltaTime * 0.1f);
+                    return board[Hunger] <= 0.05f ? BehaviorStatus.Success : BehaviorStatus.Running;
+
+                case Rest:
+                    board[Fatigue] = Mathf.Max(0f, board[Fatigue] - deltaTime * 0.05f);
+                    return board[Fatigue] <= 0.05f ? BehaviorStatus.Success : BehaviorStatus.Running;
+
+                case Wander:
+                {
+                    float tx = board[TargetX] - position.x;
+                    float tz = board[TargetZ] - position.z;
+                    float distance = Mathf.Sqrt(tx * tx + tz * tz);
+                    if (distance < 1f)
+                    {
+                        board[TargetX] = Mathf.Clamp(position.x + NextSigned() * 30f, -worldExtent, worldExtent);
+                        board[TargetZ] = Mathf.Clamp(position.z + NextSigned() * 30f, -worldExtent, worldExtent);
+                        return BehaviorStatus.Success;
+                    }
+
+                    float step = Mathf.Min(1f, walkSpeed * deltaTime / distance);
+                    executor.SetPosition(agent, new Vector3(position.x + tx * step, position.y, position.z + tz * step));
+                    return BehaviorStatus.Running;
+                }
+            }
+            return BehaviorStatus.Failure;
+        }
+
+        private Vector3 Clamp(Vector3 position)
+        {
+            return new Vector3(Mathf.Clamp(position.x, -worldExtent, worldExtent), position.y, Mathf.Clamp(position.z, -worldExtent, worldExtent));
+        }
+
+        // xorshift in [-1, 1]
+        private float NextSigned()
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return (state >> 8) / 8388608f - 1f;
+        }
+    }
+}
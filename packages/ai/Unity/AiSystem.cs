@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.AI
 {
@@ -13,10 +17,22 @@ namespace UnitySim.AI
 
         public AIData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             ai = new AIInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (ai != null)
+                ai.WriteState(writer, "ai");
+            else
+                writer.Write("ai", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,98 @@ namespace UnitySim.AI
         public int trainingIterations = 1000;
         public string systemHealth = "operational";
         public string framework = "unity-sim-ai";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("agentCount", agentCount);
+            writer.Write("decisionsMade", decisionsMade);
+            writer.Write("learningRate", learningRate);
+            writer.Write("neuralNetworkActive", neuralNetworkActive);
+            writer.Write("accuracy", accuracy);
+            writer.Write("trainingIterations", trainingIterations);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public AIField Diff(AIInfo other)
+        {
+            var changed = AIField.None;
+            if (agentCount != other.agentCount) changed |= AIField.AgentCount;
+            if (decisionsMade != other.decisionsMade) changed |= AIField.DecisionsMade;
+            if (learningRate != other.learningRate) changed |= AIField.LearningRate;
+            if (neuralNetworkActive != other.neuralNetworkActive) changed |= AIField.NeuralNetworkActive;
+            if (accuracy != other.accuracy) changed |= AIField.Accuracy;
+            if (trainingIterations != other.trainingIterations) changed |= AIField.TrainingIterations;
+            if (systemHealth != other.systemHealth) changed |= AIField.SystemHealth;
+            if (framework != other.framework) changed |= AIField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(AIInfo target)
+        {
+            target.agentCount = agentCount;
+            target.decisionsMade = decisionsMade;
+            target.learningRate = learningRate;
+            target.neuralNetworkActive = neuralNetworkActive;
+            target.accuracy = accuracy;
+            target.trainingIterations = trainingIterations;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum AIField
+    {
+        None = 0,
+        AgentCount = 1 << 0,
+        DecisionsMade = 1 << 1,
+        LearningRate = 1 << 2,
+        NeuralNetworkActive = 1 << 3,
+        Accuracy = 1 << 4,
+        TrainingIterations = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct AIDelta
+    {
+        public readonly long timestamp;
+        public readonly AIField changed;
+        public readonly AIInfo values;
+
+        public AIDelta(long timestamp, AIField changed, AIInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(AIField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class AISystem : MonoBehaviour
+    public class AISystem : MonoBehaviour, ISimulationSystem
     {
         [Header("AI Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Policy")]
+        public PolicyAgentSettings agents = new PolicyAgentSettings();
+        public int[] hiddenLayers = { 32, 32 };
+        public int randomSeed = 0;
+        public bool useInferenceService = true;
+        [SerializeField] private long goalsReached = 0;
+        [SerializeField] private float policyP95Ms = 0f;
+
         [Header("Current Data")]
         [SerializeField] private AIData currentData;
 
@@ -48,12 +147,23 @@ namespace UnitySim.AI
 
         // Events
         public System.Action<AIData> OnAIChanged;
+        public System.Action<AIDelta> OnAIDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.AISystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly AIInfo publishedInfo = new AIInfo();
+        private bool publishFullDelta = true;
+        private PolicyAgentGroup group;
+        private PolicyNetwork policy;
+        private IInferenceService service;
+        private long decisions = 0;
+        private long consumedRuns = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +172,21 @@ namespace UnitySim.AI
             InitializeAI();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            ReleasePolicy();
         }
 
         #endregion
@@ -83,6 +196,26 @@ namespace UnitySim.AI
         private void InitializeAI()
         {
             currentData = new AIData();
+
+            ReleasePolicy();
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            group = new PolicyAgentGroup(agents, seed);
+
+            // Observations -> hidden layers -> two tanh steering outputs
+            var layers = new int[hiddenLayers.Length + 2];
+            layers[0] = PolicyAgentGroup.ObservationSize;
+            for (int i = 0; i < hiddenLayers.Length; i++) layers[i + 1] = hiddenLayers[i];
+            layers[layers.Length - 1] = PolicyAgentGroup.ActionSize;
+
+            // With an inference service the batch joins its per-tick pass and the actions arrive
+            // one tick later; otherwise the policy runs inline here
+            service = useInferenceService ? SimulationRegistry.Find<IInferenceService>() : null;
+            policy = service != null
+                ? service.LoadModel(PolicyName, layers, group.Count, seed, Activation.Tanh, Activation.Tanh)
+                : new PolicyNetwork(PolicyName, layers, group.Count, seed, Activation.Tanh, Activation.Tanh);
+            consumedRuns = policy.Timings.TotalRuns;
+            decisions = 0;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +226,63 @@ namespace UnitySim.AI
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.ai.decisionsMade += UnityEngine.Random.Range(1, 5);
-            currentData.ai.accuracy = Mathf.Clamp(currentData.ai.accuracy + UnityEngine.Random.Range(-0.5f, 0.5f), 80f, 100f);
-            currentData.ai.trainingIterations += UnityEngine.Random.Range(10, 50);
+            if (group == null || policy == null) return;
+
+            if (service == null)
+            {
+                group.WriteObservations(policy);
+                policy.Run();
+            }
+
+            // Act on the latest batch once; a service that hasn't ticked yet leaves steering as is
+            if (policy.Timings.TotalRuns != consumedRuns)
+            {
+                consumedRuns = policy.Timings.TotalRuns;
+                group.ReadActions(policy);
+                decisions += policy.LastBatchSize;
+            }
+
+            group.Step(deltaTime);
+            if (service != null) group.WriteObservations(policy);
+
+            var info = currentData.ai;
+            info.agentCount = group.Count;
+            info.decisionsMade = (int)Math.Min(int.MaxValue, decisions);
+            info.neuralNetworkActive = true;
+            info.accuracy = group.Alignment * 100f;
+
+            goalsReached = group.GoalsReached;
+            policyP95Ms = policy.Timings.Percentile(95f);
+        }
+
+        private string PolicyName => $"ai-policy-{GetInstanceID()}";
+
+        private void ReleasePolicy()
+        {
+            if (policy == null) return;
+
+            // A destroyed service has already disposed its models
+            if (service == null)
+                policy.Dispose();
+            else if (!(service is UnityEngine.Object owner) || owner != null)
+                service.UnloadModel(policy.Name);
+
+            policy = null;
+            service = null;
         }
 
         private void ProcessUpdate()
@@ -122,6 +295,12 @@ namespace UnitySim.AI
                 OnAIChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +308,67 @@ namespace UnitySim.AI
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.ai;
+            var changed = publishFullDelta ? AIField.All : info.Diff(publishedInfo);
+            if (changed == AIField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnAIDelta?.Invoke(new AIDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(AISystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("AISystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +379,9 @@ namespace UnitySim.AI
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +402,11 @@ namespace UnitySim.AI
             return currentData;
         }
 
+        public PolicyNetwork GetPolicy()
+        {
+            return policy;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +438,7 @@ namespace UnitySim.AI
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +450,11 @@ namespace UnitySim.AI
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            agents.agents = Mathf.Max(1, agents.agents);
+            agents.arenaSize = Mathf.Max(1f, agents.arenaSize);
+            agents.maxSpeed = Mathf.Max(0.01f, agents.maxSpeed);
+            if (hiddenLayers == null) hiddenLayers = new int[0];
+            for (int i = 0; i < hiddenLayers.Length; i++) hiddenLayers[i] = Mathf.Max(1, hiddenLayers[i]);
         }
 
         #endregion
@@ -218,7 +466,10 @@ namespace UnitySim.AI
             Debug.Log($"AISystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (policy != null)
+                Debug.Log($"- Policy: {policy.Parameters} parameters over {policy.LastBatchSize} agents, {(service != null ? "batched by the inference service" : "run inline")}, p50 {policy.Timings.Percentile(50f):F3}ms p95 {policyP95Ms:F3}ms");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
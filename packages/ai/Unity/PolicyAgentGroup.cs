@@ -0,0 +1,156 @@
+using System;
+using UnitySim.Core;
+
+namespace UnitySim.AI
+{
+    [System.Serializable]
+    public class PolicyAgentSettings
+    {
+        public int agents = 2000;
+
+        // Square arena in metres; agents bounce off its walls
+        public float arenaSize = 200f;
+        public float maxSpeed = 4f;
+        public float acceleration = 8f;
+        public float goalRadius = 2f;
+    }
+
+    // Point agents steered by a policy network toward goals spread over an arena. Each agent
+    // fills one observation row and reads two steering outputs in [-1, 1] from its row, so the
+    // whole group is a single batch per tick.
+    public class PolicyAgentGroup
+    {
+        public const int ObservationSize = 8;
+        public const int ActionSize = 2;
+
+        private readonly PolicyAgentSettings settings;
+        private Unity.Mathematics.Random random;
+
+        private readonly float[] positionX;
+        private readonly float[] positionY;
+        private readonly float[] velocityX;
+        private readonly float[] velocityY;
+        private readonly float[] goalX;
+        private readonly float[] goalY;
+        private readonly float[] steerX;
+        private readonly float[] steerY;
+
+        public int Count => positionX.Length;
+        public long GoalsReached { get; private set; }
+
+        // Share of agents whose last steering pointed toward their goal
+        public float Alignment { get; private set; }
+
+        public PolicyAgentGroup(PolicyAgentSettings settings, uint seed)
+        {
+            this.settings = settings ?? new PolicyAgentSettings();
+            this.settings.agents = Math.Max(1, this.settings.agents);
+            this.settings.arenaSize = Math.Max(1f, this.settings.arenaSize);
+
+            random = new Unity.Mathematics.Random(seed != 0 ? seed : 1u);
+            int count = this.settings.agents;
+            positionX = new float[count];
+            positionY = new float[count];
+            velocityX = new float[count];
+            velocityY = new float[count];
+            goalX = new float[count];
+            goalY = new float[count];
+            steerX = new float[count];
+            steerY = new float[count];
+
+            for (int i = 0; i < count; i++)
+            {
+                positionX[i] = random.NextFloat(this.settings.arenaSize);
+                positionY[i] = random.NextFloat(this.settings.arenaSize);
+                PickGoal(i);
+            }
+        }
+
+        public void WriteObservations(PolicyNetwork policy)
+        {
+            float arena = settings.arenaSize;
+            float inverseSpeed = 1f / Math.Max(0.01f, settings.maxSpeed);
+
+            for (int i = 0; i < Count; i++)
+            {
+                float dx = goalX[i] - positionX[i];
+                float dy = goalY[i] - positionY[i];
+
+                policy.SetInput(i, 0, dx / arena);
+                policy.SetInput(i, 1, dy / arena);
+                policy.SetInput(i, 2, velocityX[i] * inverseSpeed);
+                policy.SetInput(i, 3, velocityY[i] * inverseSpeed);
+                policy.SetInput(i, 4, positionX[i] / arena * 2f - 1f);
+                policy.SetInput(i, 5, positionY[i] / arena * 2f - 1f);
+                policy.SetInput(i, 6, (float)Math.Sqrt(dx * dx + dy * dy) / arena);
+                policy.SetInput(i, 7, 1f);
+            }
+            policy.SetBatchSize(Count);
+        }
+
+        public void ReadActions(PolicyNetwork policy)
+        {
+            int aligned = 0;
+            int rows = Math.Min(Count, policy.LastBatchSize);
+
+            for (int i = 0; i < rows; i++)
+            {
+                steerX[i] = Clamp(policy.GetOutput(i, 0));
+                steerY[i] = Clamp(policy.GetOutput(i, 1));
+
+                float dot = steerX[i] * (goalX[i] - positionX[i]) + steerY[i] * (goalY[i] - positionY[i]);
+                if (dot > 0f) aligned++;
+            }
+            Alignment = rows > 0 ? aligned / (float)rows : 0f;
+        }
+
+        public void Step(float deltaTime)
+        {
+            float arena = settings.arenaSize;
+            float maxSpeed = settings.maxSpeed;
+            float goalRadiusSq = settings.goalRadius * settings.goalRadius;
+
+            for (int i = 0; i < Count; i++)
+            {
+                float vx = velocityX[i] + steerX[i] * settings.acceleration * deltaTime;
+                float vy = velocityY[i] + steerY[i] * settings.acceleration * deltaTime;
+                float speedSq = vx * vx + vy * vy;
+                if (speedSq > maxSpeed * maxSpeed)
+                {
+                    float scale = maxSpeed / (float)Math.Sqrt(speedSq);
+                    vx *= scale;
+                    vy *= scale;
+                }
+
+                float x = positionX[i] + vx * deltaTime;
+                float y = positionY[i] + vy * deltaTime;
+                if (x < 0f || x > arena) { vx = -vx; x = Math.Max(0f, Math.Min(arena, x)); }
+                if (y < 0f || y > arena) { vy = -vy; y = Math.Max(0f, Math.Min(arena, y)); }
+
+                positionX[i] = x;
+                positionY[i] = y;
+                velocityX[i] = vx;
+                velocityY[i] = vy;
+
+                float dx = goalX[i] - x;
+                float dy = goalY[i] - y;
+                if (dx * dx + dy * dy <= goalRadiusSq)
+                {
+                    GoalsReached++;
+                    PickGoal(i);
+                }
+            }
+        }
+
+        private void PickGoal(int agent)
+        {
+            goalX[agent] = random.NextFloat(settings.arenaSize);
+            goalY[agent] = random.NextFloat(settings.arenaSize);
+        }
+
+        private static float Clamp(float value)
+        {
+            return value < -1f ? -1f : (value > 1f ? 1f : value);
+        }
+    }
+}
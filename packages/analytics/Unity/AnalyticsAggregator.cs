@@ -0,0 +1,205 @@
+using System;
+
+namespace UnitySim.Analytics
+{
+    // One event type over the rolling window
+    public struct AnalyticsMetric
+    {
+        public long count;
+        public double sum;
+        public float min;
+        public float max;
+        public float p50;
+        public float p90;
+        public float p99;
+        public long uniqueUsers;
+
+        public float Mean => count > 0 ? (float)(sum / count) : 0f;
+    }
+
+    // Windowed aggregates in fixed memory. Time is cut into windowCount slots of windowTicks
+    // each, reused round-robin; every slot keeps a count, sum, range, t-digest and distinct-user
+    // estimate per event type. Queries merge the live slots, so the rolling window moves one
+    // slot at a time. Lifetime totals and distinct users are kept beside it. Not thread-safe.
+    public class AnalyticsAggregator
+    {
+        private class Window
+        {
+            public long index = -1;
+            public readonly long[] counts;
+            public readonly double[] sums;
+            public readonly float[] mins;
+            public readonly float[] maxs;
+            public readonly TDigest[] digests;
+            public readonly HyperLogLog[] users;
+
+            public Window(int types, float compression, int precision)
+            {
+                counts = new long[types];
+                sums = new double[types];
+                mins = new float[types];
+                maxs = new float[types];
+                digests = new TDigest[types];
+                users = new HyperLogLog[types];
+                for (int t = 0; t < types; t++)
+                {
+                    digests[t] = new TDigest(compression);
+                    users[t] = new HyperLogLog(precision);
+                }
+                Reset(-1);
+            }
+
+            public void Reset(long newIndex)
+            {
+                index = newIndex;
+                for (int t = 0; t < counts.Length; t++)
+                {
+                    if (counts[t] == 0 && newIndex >= 0) continue;
+                    counts[t] = 0;
+                    sums[t] = 0.0;
+                    mins[t] = float.PositiveInfinity;
+                    maxs[t] = float.NegativeInfinity;
+                    digests[t].Clear();
+                    users[t].Clear();
+                }
+            }
+        }
+
+        private readonly Window[] windows;
+        private readonly long windowTicks;
+        private readonly long[] lifetimeCounts;
+        private readonly HyperLogLog lifetimeUsers;
+        private readonly TDigest scratchDigest;
+        private readonly HyperLogLog scratchUsers;
+        private long head = -1;
+
+        public int TypeCount => lifetimeCounts.Length;
+        public int WindowCount => windows.Length;
+        public long WindowTicks => windowTicks;
+        public long Head => head;
+        public long LateEvents { get; private set; }
+
+        public AnalyticsAggregator(int types, long windowTicks, int windowCount, float compression = 100f, int precision = 10)
+        {
+            types = Math.Max(1, types);
+            this.windowTicks = Math.Max(1, windowTicks);
+            windows = new Window[Math.Max(1, windowCount)];
+            for (int i = 0; i < windows.Length; i++) windows[i] = new Window(types, compression, precision);
+
+            lifetimeCounts = new long[types];
+            lifetimeUsers = new HyperLogLog(Math.Max(precision, 14));
+            scratchDigest = new TDigest(compression);
+            scratchUsers = new HyperLogLog(precision);
+        }
+
+        // ticks are relative to the pipeline's start or its last reset
+        public void Add(in AnalyticsEvent e, long ticks)
+        {
+            if ((uint)e.type >= (uint)lifetimeCounts.Length) return;
+
+            lifetimeCounts[e.type]++;
+            lifetimeUsers.Add(e.userId);
+
+            long index = Math.Max(0, ticks) / windowTicks;
+            if (index > head) AdvanceWindow(index);
+            if (index <= head - windows.Length)
+            {
+                LateEvents++;
+                return;
+            }
+
+            var window = windows[index % windows.Length];
+            int t = e.type;
+            window.counts[t]++;
+            window.sums[t] += e.value;
+            if (e.value < window.mins[t]) window.mins[t] = e.value;
+            if (e.value > window.maxs[t]) window.maxs[t] = e.value;
+            window.digests[t].Add(e.value);
+            window.users[t].Add(e.userId);
+        }
+
+        // Rolls the window forward to the slot holding ticks, clearing slots that fall out
+        public void AdvanceTo(long ticks)
+        {
+            AdvanceWindow(Math.Max(0, ticks) / windowTicks);
+        }
+
+        private void AdvanceWindow(long index)
+        {
+            if (index <= head) return;
+
+            long first = Math.Max(head + 1, index - windows.Length + 1);
+            for (long i = first; i <= index; i++) windows[i % windows.Length].Reset(i);
+            head = index;
+        }
+
+        public long GetLifetimeCount(int type)
+        {
+            return (uint)type < (uint)lifetimeCounts.Length ? lifetimeCounts[type] : 0;
+        }
+
+        public long EstimateLifetimeUsers()
+        {
+            return lifetimeUsers.Estimate();
+        }
+
+        // Events of every type in the live slots
+        public long CountWindow()
+        {
+            long total = 0;
+            for (int w = 0; w < windows.Length; w++)
+            {
+                if (!IsLive(windows[w])) continue;
+                for (int t = 0; t < lifetimeCounts.Length; t++) total += windows[w].counts[t];
+            }
+            return total;
+        }
+
+        // Merges the live slots for one type
+        public void Compute(int type, ref AnalyticsMetric metric)
+        {
+            metric = default;
+            if ((uint)type >= (uint)lifetimeCounts.Length) return;
+
+            scratchDigest.Clear();
+            scratchUsers.Clear();
+            float min = float.PositiveInfinity, max = float.NegativeInfinity;
+
+            for (int w = 0; w < windows.Length; w++)
+            {
+                var window = windows[w];
+                if (!IsLive(window) || window.counts[type] == 0) continue;
+
+                metric.count += window.counts[type];
+                metric.sum += window.sums[type];
+                min = Math.Min(min, window.mins[type]);
+                max = Math.Max(max, window.maxs[type]);
+                scratchDigest.Add(window.digests[type]);
+                scratchUsers.Add(window.users[type]);
+            }
+
+            if (metric.count == 0) return;
+
+            metric.min = min;
+            metric.max = max;
+            metric.p50 = scratchDigest.Quantile(0.5f);
+            metric.p90 = scratchDigest.Quantile(0.9f);
+            metric.p99 = scratchDigest.Quantile(0.99f);
+            metric.uniqueUsers = scratchUsers.Estimate();
+        }
+
+        public void Clear()
+        {
+            for (int w = 0; w < windows.Length; w++) windows[w].Reset(-1);
+            Array.Clear(lifetimeCounts, 0, lifetimeCounts.Length);
+            lifetimeUsers.Clear();
+            head = -1;
+            LateEvents = 0;
+        }
+
+        private bool IsLive(Window window)
+        {
+            return window.index >= 0 && window.index > head - windows.Length;
+        }
+    }
+}
@@ -0,0 +1,100 @@
+using System;
+using System.Threading;
+
+namespace UnitySim.Analytics
+{
+    public struct AnalyticsEvent
+    {
+        public long timestamp;      // Stopwatch ticks when tracked
+        public ulong userId;
+        public int type;
+        public float value;
+    }
+
+    // Bounded queue with any number of producers and a single consumer, without locks. Each
+    // cell carries a sequence number: a producer claims a position by advancing the enqueue
+    // counter, fills the cell and publishes it by setting the sequence one past the position;
+    // the consumer frees the cell by moving the sequence a lap ahead. A full queue refuses
+    // the event instead of blocking or growing.
+    public class AnalyticsEventQueue
+    {
+        private struct Cell
+        {
+            public long sequence;
+            public AnalyticsEvent item;
+        }
+
+        private readonly Cell[] cells;
+        private readonly int mask;
+        private long enqueuePosition = 0;
+        private long dequeuePosition = 0;
+
+        public int Capacity => cells.Length;
+
+        // Approximate, for diagnostics
+        public int Count => (int)Math.Max(0, Volatile.Read(ref enqueuePosition) - Volatile.Read(ref dequeuePosition));
+
+        // Capacity is rounded up to a power of two
+        public AnalyticsEventQueue(int capacity)
+        {
+            int size = 2;
+            while (size < capacity && size < (1 << 30)) size <<= 1;
+
+            cells = new Cell[size];
+            mask = size - 1;
+            for (int i = 0; i < size; i++) cells[i].sequence = i;
+        }
+
+        // Any thread. Returns false when the queue is full.
+        public bool TryEnqueue(in AnalyticsEvent item)
+        {
+            long position = Volatile.Read(ref enqueuePosition);
+            while (true)
+            {
+                ref var cell = ref cells[position & mask];
+                long sequence = Volatile.Read(ref cell.sequence);
+                long difference = sequence - position;
+
+                if (difference == 0)
+                {
+                    long observed = Interlocked.CompareExchange(ref enqueuePosition, position + 1, position);
+                    if (observed == position)
+                    {
+                        cell.item = item;
+                        Volatile.Write(ref cell.sequence, position + 1);
+                        return true;
+                    }
+                    position = observed;
+                }
+                else if (difference < 0)
+                {
+                    // The consumer hasn't freed this cell from the previous lap
+                    return false;
+                }
+                else
+                {
+                    position = Volatile.Read(ref enqueuePosition);
+                }
+            }
+        }
+
+        // Consumer thread only. Copies up to destination.Length events and returns how many.
+        public int Drain(Span<AnalyticsEvent> destination)
+        {
+            int count = 0;
+            long position = dequeuePosition;
+            while (count < destination.Length)
+            {
+                ref var cell = ref cells[position & mask];
+                if (Volatile.Read(ref cell.sequence) != position + 1) break;
+
+                destination[count++] = cell.item;
+                Volatile.Write(ref cell.sequence, position + cells.Length);
+                position++;
+            }
+
+            Volatile.Write(ref dequeuePosition, position);
+            return count;
+        }
+    }
+}
@@ -0,0 +1,492 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using UnitySim.Core;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.Analytics
+{
+    public class AnalyticsPipelineSettings
+    {
+        public int queueCapacity = 1 << 17;
+        public int maxEventTypes = 16;
+        public float windowSeconds = 5f;
+        public int windowCount = 12;
+        public float compression = 100f;
+        public int uniquePrecision = 10;
+        public int batchSize = 4096;
+        public int batchCount = 4;
+        public float flushInterval = 1f;
+        public float publishInterval = 0.25f;
+
+        public bool SameAs(AnalyticsPipelineSettings other)
+        {
+            return other != null && queueCapacity == other.queueCapacity && maxEventTypes == other.maxEventTypes
+                && windowSeconds == other.windowSeconds && windowCount == other.windowCount && compression == other.compression
+                && uniquePrecision == other.uniquePrecision && batchSize == other.batchSize && batchCount == other.batchCount
+                && flushInterval == other.flushInterval && publishInterval == other.publishInterval;
+        }
+    }
+
+    // Aggregates published by the pipeline's aggregator thread
+    public class AnalyticsSummary
+    {
+        public long processedEvents;
+        public long droppedEvents;      // refused because the queue was full
+        public long lateEvents;         // older than the rolling window when aggregated
+        public long flushedEvents;
+        public long unflushedEvents;    // aggregated, but no batch was free or the sink failed
+        public long failedBatches;
+        public long windowEvents;
+        public float windowSeconds;
+        public float eventsPerSecond;
+        public long uniqueUsers;
+        public long activeSessions;
+        public int queueDepth;
+        public int typeCount;
+        public readonly AnalyticsMetric[] metrics;
+
+        public AnalyticsSummary(int types)
+        {
+            metrics = new AnalyticsMetric[Math.Max(1, types)];
+        }
+
+        public void CopyTo(AnalyticsSummary target)
+        {
+            target.processedEvents = processedEvents;
+            target.droppedEvents = droppedEvents;
+            target.lateEvents = lateEvents;
+            target.flushedEvents = flushedEvents;
+            target.unflushedEvents = unflushedEvents;
+            target.failedBatches = failedBatches;
+            target.windowEvents = windowEvents;
+            target.windowSeconds = windowSeconds;
+            target.eventsPerSecond = eventsPerSecond;
+            target.uniqueUsers = uniqueUsers;
+            target.activeSessions = activeSessions;
+            target.queueDepth = queueDepth;
+            target.typeCount = typeCount;
+            Array.Copy(metrics, target.metrics, Math.Min(metrics.Length, target.metrics.Length));
+        }
+
+        // Zeroes every figure but the type count
+        public void Clear()
+        {
+            int types = typeCount;
+            new AnalyticsSummary(0).CopyTo(this);
+            Array.Clear(metrics, 0, metrics.Length);
+            typeCount = types;
+        }
+    }
+
+    // Takes events from any thread and aggregates and flushes them off the main thread in
+    // fixed memory. Track stamps an event and pushes it onto a lock-free queue; a full queue
+    // drops it. The aggregator thread drains the queue every few milliseconds into the
+    // rolling-window AnalyticsAggregator and into batches, and publishes an AnalyticsSummary.
+    // Full or due batches go to a flusher thread that writes them to the sink. There is a
+    // fixed number of batches, so a slow sink costs unflushed events, never aggregation.
+    public class AnalyticsPipeline : IDisposable
+    {
+        public const int SessionStartEvent = 0;
+        public const int SessionEndEvent = 1;    // value is the session length in seconds
+        public const int ConversionEvent = 2;
+
+        private const int DrainIntervalMs = 5;
+        private const int DrainChunk = 4096;
+
+        private class Batch
+        {
+            public readonly AnalyticsEvent[] events;
+            public int count;
+
+            public Batch(int size)
+            {
+                events = new AnalyticsEvent[size];
+            }
+        }
+
+        private readonly AnalyticsPipelineSettings settings;
+        private readonly AnalyticsEventQueue queue;
+        private readonly IAnalyticsSink sink;
+        private readonly string[] typeNames;
+        private readonly object typeLock = new object();
+        private int typeCount = 0;
+        private long droppedEvents = 0;
+
+        private readonly object gate = new object();
+        private readonly Thread aggregatorThread;
+        private readonly Thread flusherThread;
+        private readonly Stack<Batch> freeBatches = new Stack<Batch>();
+        private readonly Queue<Batch> pendingBatches = new Queue<Batch>();
+        private readonly AnalyticsSummary published;
+        private bool disposing = false;
+        private bool resetRequested = false;
+        private bool aggregating = true;
+        private long flushedEvents = 0;
+        private long unflushedEvents = 0;
+        private long failedBatches = 0;
+
+        // Aggregator thread only
+        private readonly AnalyticsAggregator aggregator;
+        private readonly AnalyticsSummary working;
+        private readonly long origin;
+        private readonly long originUnixMs;
+        private long windowOrigin;      // origin, or the time of the last Reset
+        private Batch current;
+        private long processedEvents = 0;
+        private long localUnflushed = 0;
+
+        // Flusher thread only
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private readonly PooledBufferWriter flushBuffer;
+
+        public int MaxEventTypes => typeNames.Length;
+        public int QueueCapacity => queue.Capacity;
+        public long DroppedEvents => Interlocked.Read(ref droppedEvents);
+
+        public AnalyticsPipeline(AnalyticsPipelineSettings settings, IAnalyticsSink sink)
+        {
+            this.settings = settings ?? new AnalyticsPipelineSettings();
+            this.sink = sink;
+
+            int types = Math.Max(4, this.settings.maxEventTypes);
+            typeNames = new string[types];
+            queue = new AnalyticsEventQueue(this.settings.queueCapacity);
+
+            long windowTicks = (long)(Math.Max(0.1f, this.settings.windowSeconds) * Stopwatch.Frequency);
+            aggregator = new AnalyticsAggregator(types, windowTicks, this.settings.windowCount,
+                this.settings.compression, this.settings.uniquePrecision);
+            working = new AnalyticsSummary(types);
+            published = new AnalyticsSummary(types);
+
+            origin = Stopwatch.GetTimestamp();
+            windowOrigin = origin;
+            originUnixMs = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+
+            RegisterEventType("session_start");
+            RegisterEventType("session_end");
+            RegisterEventType("conversion");
+
+            int batchSize = Math.Max(64, this.settings.batchSize);
+            flushBuffer = new PooledBufferWriter(batchSize * 96);
+            if (sink != null)
+            {
+                for (int i = 0; i < Math.Max(1, this.settings.batchCount); i++) freeBatches.Push(new Batch(batchSize));
+                flusherThread = new Thread(RunFlusher) { IsBackground = true, Name = "AnalyticsFlusher" };
+                flusherThread.Start();
+            }
+
+            aggregatorThread = new Thread(RunAggregator) { IsBackground = true, Name = "AnalyticsAggregator" };
+            aggregatorThread.Start();
+        }
+
+        #region Producers
+
+        // Returns the type id for name, registering it if needed; -1 once maxEventTypes are taken
+        public int RegisterEventType(string name)
+        {
+            if (string.IsNullOrEmpty(name)) return -1;
+
+            lock (typeLock)
+            {
+                for (int i = 0; i < typeCount; i++)
+                {
+                    if (typeNames[i] == name) return i;
+                }
+                if (typeCount == typeNames.Length) return -1;
+
+                typeNames[typeCount] = name;
+                Volatile.Write(ref typeCount, typeCount + 1);
+                return typeCount - 1;
+            }
+        }
+
+        public string GetEventTypeName(int type)
+        {
+            return (uint)type < (uint)Volatile.Read(ref typeCount) ? typeNames[type] : null;
+        }
+
+        // Any thread, allocation-free. Returns false for unknown types or when the queue is full.
+        public bool Track(int type, ulong userId, float value = 0f)
+        {
+            if ((uint)type >= (uint)Volatile.Read(ref typeCount)) return false;
+
+            var e = new AnalyticsEvent
+            {
+                timestamp = Stopwatch.GetTimestamp(),
+                userId = userId,
+                type = type,
+                value = value
+            };
+
+            if (queue.TryEnqueue(e)) return true;
+
+            Interlocked.Increment(ref droppedEvents);
+            return false;
+        }
+
+        // Copies the latest published aggregates
+        public void GetSummary(AnalyticsSummary target)
+        {
+            lock (gate) published.CopyTo(target);
+        }
+
+        // Any thread. Clears every aggregate and counter, applied by the aggregator thread on
+        // its next pass; event types, queued events and the sink are kept.
+        public void Reset()
+        {
+            lock (gate)
+            {
+                if (disposing) return;
+                resetRequested = true;
+                published.Clear();
+                Monitor.PulseAll(gate);
+            }
+        }
+
+        #endregion
+
+        #region Aggregator Thread
+
+        private void RunAggregator()
+        {
+            var drained = new AnalyticsEvent[DrainChunk];
+            long flushTicks = (long)(Math.Max(0.05f, settings.flushInterval) * Stopwatch.Frequency);
+            long publishTicks = (long)(Math.Max(0.02f, settings.publishInterval) * Stopwatch.Frequency);
+            long nextFlush = Stopwatch.GetTimestamp() + flushTicks;
+            long nextPublish = Stopwatch.GetTimestamp() + publishTicks;
+
+            while (true)
+            {
+                bool stopping, reset;
+                lock (gate)
+                {
+                    if (!disposing && !resetRequested) Monitor.Wait(gate, DrainIntervalMs);
+                    stopping = disposing;
+                    reset = resetRequested;
+                    resetRequested = false;
+                }
+
+                try
+                {
+                    if (reset) ClearAggregates();
+
+                    // One attempt at a free batch per pass, so a stalled sink costs no locking per event
+                    bool starved = false;
+                    int count;
+                    while ((count = queue.Drain(drained)) > 0)
+                    {
+                        for (int i = 0; i < count; i++) Process(in drained[i], ref starved);
+                    }
+
+                    long now = Stopwatch.GetTimestamp();
+                    aggregator.AdvanceTo(now - windowOrigin);
+
+                    if (current != null && current.count > 0 && (now >= nextFlush || stopping))
+                    {
+                        HandOff();
+                        nextFlush = now + flushTicks;
+                    }
+
+                    if (now >= nextPublish || stopping)
+                    {
+                        Publish(now);
+                        nextPublish = now + publishTicks;
+                    }
+                }
+                catch (Exception e)
+                {
+                    Debug.LogError($"AnalyticsPipeline: Aggregation failed - {e.Message}");
+                }
+
+                if (stopping) break;
+            }
+
+            lock (gate)
+            {
+                if (current != null) freeBatches.Push(current);
+                current = null;
+                aggregating = false;
+                Monitor.PulseAll(gate);
+            }
+        }
+
+        private void Process(in AnalyticsEvent e, ref bool starved)
+        {
+            processedEvents++;
+            aggregator.Add(in e, e.timestamp - windowOrigin);
+
+            if (sink == null) return;
+
+            if (current == null && !starved)
+            {
+                lock (gate)
+                {
+                    if (freeBatches.Count > 0) current = freeBatches.Pop();
+                }
+                starved = current == null;
+            }
+
+            if (current == null)
+            {
+                localUnflushed++;
+                return;
+            }
+
+            current.events[current.count++] = e;
+            if (current.count == current.events.Length) HandOff();
+        }
+
+        private void HandOff()
+        {
+            lock (gate)
+            {
+                pendingBatches.Enqueue(current);
+                Monitor.PulseAll(gate);
+            }
+            current = null;
+        }
+
+        private void Publish(long now)
+        {
+            int types = Volatile.Read(ref typeCount);
+            for (int t = 0; t < working.metrics.Length; t++)
+            {
+                if (t < types) aggregator.Compute(t, ref working.metrics[t]);
+                else working.metrics[t] = default;
+            }
+
+            // The window runs from the start of its oldest live slot to now
+            long windowStart = Math.Max(0, aggregator.Head - aggregator.WindowCount + 1) * aggregator.WindowTicks;
+            double span = (double)Math.Max(1, now - windowOrigin - windowStart) / Stopwatch.Frequency;
+
+            working.processedEvents = processedEvents;
+            working.lateEvents = aggregator.LateEvents;
+            working.windowEvents = aggregator.CountWindow();
+            working.windowSeconds = (float)span;
+            working.eventsPerSecond = (float)(working.windowEvents / span);
+            working.uniqueUsers = aggregator.EstimateLifetimeUsers();
+            working.activeSessions = Math.Max(0, aggregator.GetLifetimeCount(SessionStartEvent) - aggregator.GetLifetimeCount(SessionEndEvent));
+            working.queueDepth = queue.Count;
+            working.typeCount = types;
+            working.droppedEvents = DroppedEvents;
+
+            lock (gate)
+            {
+                working.flushedEvents = flushedEvents;
+                working.failedBatches = failedBatches;
+                working.unflushedEvents = unflushedEvents + localUnflushed;
+
+                // A Reset during this pass has cleared published; the next pass republishes
+                if (!resetRequested) working.CopyTo(published);
+            }
+        }
+
+        private void ClearAggregates()
+        {
+            aggregator.Clear();
+            windowOrigin = Stopwatch.GetTimestamp();
+            processedEvents = 0;
+            localUnflushed = 0;
+            Interlocked.Exchange(ref droppedEvents, 0);
+
+            lock (gate)
+            {
+                flushedEvents = 0;
+                unflushedEvents = 0;
+                failedBatches = 0;
+            }
+        }
+
+        #endregion
+
+        #region Flusher Thread
+
+        private void RunFlusher()
+        {
+            string lastError = null;
+            while (true)
+            {
+                Batch batch;
+                lock (gate)
+                {
+                    while (pendingBatches.Count == 0 && aggregating) Monitor.Wait(gate);
+                    if (pendingBatches.Count == 0) return;
+                    batch = pendingBatches.Dequeue();
+                }
+
+                bool written = false;
+                try
+                {
+                    Format(batch);
+                    sink.Write(flushBuffer.WrittenSegment, batch.count);
+                    written = true;
+                }
+                catch (Exception e)
+                {
+                    // Logged once per distinct error, not per batch
+                    if (e.Message != lastError) Debug.LogWarning($"AnalyticsPipeline: Flush failed - {e.Message}");
+                    lastError = e.Message;
+                }
+
+                lock (gate)
+                {
+                    if (written) flushedEvents += batch.count;
+                    else
+                    {
+                        failedBatches++;
+                        unflushedEvents += batch.count;
+                    }
+                    batch.count = 0;
+                    freeBatches.Push(batch);
+                }
+            }
+        }
+
+        // One JSON object per line; user ids above long.MaxValue come out negative
+        private void Format(Batch batch)
+        {
+            flushBuffer.Clear();
+            double ticksToMs = 1000.0 / Stopwatch.Frequency;
+
+            for (int i = 0; i < batch.count; i++)
+            {
+                ref var e = ref batch.events[i];
+                jsonWriter.Reset(flushBuffer);
+                jsonWriter.BeginObject(null);
+                jsonWriter.Write("time", originUnixMs + (long)((e.timestamp - origin) * ticksToMs));
+                jsonWriter.Write("type", typeNames[e.type]);
+                jsonWriter.Write("user", (long)e.userId);
+                jsonWriter.Write("value", e.value);
+                jsonWriter.EndObject();
+
+                flushBuffer.GetSpan(1)[0] = (byte)'\n';
+                flushBuffer.Advance(1);
+            }
+        }
+
+        #endregion
+
+        // Drains and flushes what is queued, then stops both threads and disposes the sink.
+        // A sink still blocked after two seconds is disposed under it, which cancels HTTP requests.
+        public void Dispose()
+        {
+            lock (gate)
+            {
+                if (disposing) return;
+                disposing = true;
+                Monitor.PulseAll(gate);
+            }
+
+            aggregatorThread.Join();
+            if (flusherThread != null && !flusherThread.Join(2000))
+            {
+                sink.Dispose();
+                flusherThread.Join();
+                return;
+            }
+            sink?.Dispose();
+        }
+    }
+}
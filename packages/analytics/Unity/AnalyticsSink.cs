@@ -0,0 +1,99 @@
+using System;
+using System.IO;
+using System.Net.Http;
+using System.Net.Http.Headers;
+
+namespace UnitySim.Analytics
+{
+    public enum AnalyticsSinkMode
+    {
+        None,
+        File,
+        Http
+    }
+
+    // Receives flushed batches on the pipeline's flusher thread, as newline-delimited JSON.
+    // Throwing fails the batch; it is counted and dropped rather than retried.
+    public interface IAnalyticsSink : IDisposable
+    {
+        void Write(ArraySegment<byte> batch, int eventCount);
+    }
+
+    // Appends batches to a file. Past maxFileBytes the file moves to "<path>.1", replacing the
+    // previous one, so disk use stays bounded at about twice the limit.
+    public class FileAnalyticsSink : IAnalyticsSink
+    {
+        private readonly string path;
+        private readonly long maxFileBytes;
+        private FileStream stream;
+
+        public string Path => path;
+
+        public FileAnalyticsSink(string path, long maxFileBytes = 64L * 1024 * 1024)
+        {
+            this.path = path ?? throw new ArgumentNullException(nameof(path));
+            this.maxFileBytes = Math.Max(1024, maxFileBytes);
+        }
+
+        public void Write(ArraySegment<byte> batch, int eventCount)
+        {
+            if (stream == null)
+            {
+                string directory = System.IO.Path.GetDirectoryName(path);
+                if (!string.IsNullOrEmpty(directory)) Directory.CreateDirectory(directory);
+                stream = new FileStream(path, FileMode.Append, FileAccess.Write, FileShare.Read, 64 * 1024);
+            }
+
+            stream.Write(batch.Array, batch.Offset, batch.Count);
+            stream.Flush();
+
+            if (stream.Length >= maxFileBytes)
+            {
+                stream.Dispose();
+                stream = null;
+
+                string rolled = path + ".1";
+                if (File.Exists(rolled)) File.Delete(rolled);
+                File.Move(path, rolled);
+            }
+        }
+
+        public void Dispose()
+        {
+            stream?.Dispose();
+            stream = null;
+        }
+    }
+
+    // POSTs each batch to an endpoint as application/x-ndjson
+    public class HttpAnalyticsSink : IAnalyticsSink
+    {
+        private readonly HttpClient client;
+        private readonly Uri endpoint;
+        private readonly MediaTypeHeaderValue contentType = new MediaTypeHeaderValue("application/x-ndjson");
+
+        public HttpAnalyticsSink(string endpoint, float timeoutSeconds = 10f)
+        {
+            this.endpoint = new Uri(endpoint);
+            client = new HttpClient { Timeout = TimeSpan.FromSeconds(Math.Max(1f, timeoutSeconds)) };
+        }
+
+        public void Write(ArraySegment<byte> batch, int eventCount)
+        {
+            using (var content = new ByteArrayContent(batch.Array, batch.Offset, batch.Count))
+            {
+                content.Headers.ContentType = contentType;
+                using (var response = client.PostAsync(endpoint, content).GetAwaiter().GetResult())
+                {
+                    response.EnsureSuccessStatusCode();
+                }
+            }
+        }
+
+        // Also cancels a request still in flight
+        public void Dispose()
+        {
+            client.Dispose();
+        }
+    }
+}
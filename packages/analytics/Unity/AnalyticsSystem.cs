@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Analytics
 {
@@ -13,32 +17,157 @@ namespace UnitySim.Analytics
 
         public AnalyticsData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             analytics = new AnalyticsInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (analytics != null)
+                analytics.WriteState(writer, "analytics");
+            else
+                writer.Write("analytics", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
     public class AnalyticsInfo
     {
-                public int totalEvents = 0;
+        public long totalEvents = 0;
         public int activeSessions = 0;
         public float averageSessionTime = 0f;
-        public int dataPoints = 0;
+        public long dataPoints = 0;
         public float conversionRate = 0f;
-        public int uniqueUsers = 0;
+        public long uniqueUsers = 0;
+        public float eventsPerSecond = 0f;
+        public long droppedEvents = 0;
+        public long flushedEvents = 0;
         public string systemHealth = "operational";
         public string framework = "unity-sim-analytics";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("totalEvents", totalEvents);
+            writer.Write("activeSessions", activeSessions);
+            writer.Write("averageSessionTime", averageSessionTime);
+            writer.Write("dataPoints", dataPoints);
+            writer.Write("conversionRate", conversionRate);
+            writer.Write("uniqueUsers", uniqueUsers);
+            writer.Write("eventsPerSecond", eventsPerSecond);
+            writer.Write("droppedEvents", droppedEvents);
+            writer.Write("flushedEvents", flushedEvents);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public AnalyticsField Diff(AnalyticsInfo other)
+        {
+            var changed = AnalyticsField.None;
+            if (totalEvents != other.totalEvents) changed |= AnalyticsField.TotalEvents;
+            if (activeSessions != other.activeSessions) changed |= AnalyticsField.ActiveSessions;
+            if (averageSessionTime != other.averageSessionTime) changed |= AnalyticsField.AverageSessionTime;
+            if (dataPoints != other.dataPoints) changed |= AnalyticsField.DataPoints;
+            if (conversionRate != other.conversionRate) changed |= AnalyticsField.ConversionRate;
+            if (uniqueUsers != other.uniqueUsers) changed |= AnalyticsField.UniqueUsers;
+            if (systemHealth != other.systemHealth) changed |= AnalyticsField.SystemHealth;
+            if (framework != other.framework) changed |= AnalyticsField.Framework;
+            if (eventsPerSecond != other.eventsPerSecond) changed |= AnalyticsField.EventsPerSecond;
+            if (droppedEvents != other.droppedEvents) changed |= AnalyticsField.DroppedEvents;
+            if (flushedEvents != other.flushedEvents) changed |= AnalyticsField.FlushedEvents;
+            return changed;
+        }
+
+        public void CopyTo(AnalyticsInfo target)
+        {
+            target.totalEvents = totalEvents;
+            target.activeSessions = activeSessions;
+            target.averageSessionTime = averageSessionTime;
+            target.dataPoints = dataPoints;
+            target.conversionRate = conversionRate;
+            target.uniqueUsers = uniqueUsers;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+            target.eventsPerSecond = eventsPerSecond;
+            target.droppedEvents = droppedEvents;
+            target.flushedEvents = flushedEvents;
+        }
+    }
+
+    [System.Flags]
+    public enum AnalyticsField
+    {
+        None = 0,
+        TotalEvents = 1 << 0,
+        ActiveSessions = 1 << 1,
+        AverageSessionTime = 1 << 2,
+        DataPoints = 1 << 3,
+        ConversionRate = 1 << 4,
+        UniqueUsers = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        EventsPerSecond = 1 << 8,
+        DroppedEvents = 1 << 9,
+        FlushedEvents = 1 << 10,
+        All = (1 << 11) - 1
     }
 
-    public class AnalyticsSystem : MonoBehaviour
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct AnalyticsDelta
+    {
+        public readonly long timestamp;
+        public readonly AnalyticsField changed;
+        public readonly AnalyticsInfo values;
+
+        public AnalyticsDelta(long timestamp, AnalyticsField changed, AnalyticsInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(AnalyticsField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class AnalyticsSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Analytics Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Event Pipeline")]
+        public int queueCapacity = 1 << 17;
+        public int maxEventTypes = 16;
+
+        [Header("Windows")]
+        public float windowSeconds = 5f;
+        public int windowCount = 12;
+        public float percentileCompression = 100f;
+        public int uniqueUsersPrecision = 10;
+
+        [Header("Sink")]
+        public AnalyticsSinkMode sinkMode = AnalyticsSinkMode.None;
+        public string fileName = "analytics.ndjson";
+        public int maxFileMegabytes = 64;
+        public string httpEndpoint = "";
+        public float httpTimeout = 10f;
+        public int batchSize = 4096;
+        public float flushInterval = 1f;
+        [SerializeField] private int queueDepth = 0;
+        [SerializeField] private long lateEvents = 0;
+        [SerializeField] private long unflushedEvents = 0;
+        [SerializeField] private long failedBatches = 0;
+
         [Header("Current Data")]
         [SerializeField] private AnalyticsData currentData;
 
@@ -48,12 +177,24 @@ namespace UnitySim.Analytics
 
         // Events
         public System.Action<AnalyticsData> OnAnalyticsChanged;
+        public System.Action<AnalyticsDelta> OnAnalyticsDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.AnalyticsSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly AnalyticsInfo publishedInfo = new AnalyticsInfo();
+        private bool publishFullDelta = true;
+
+        // Pipeline
+        private AnalyticsPipeline pipeline;
+        private AnalyticsPipelineSettings pipelineSettings;
+        private string sinkSettings;
+        private AnalyticsSummary summary;
 
         #region Unity Lifecycle
 
@@ -62,18 +203,22 @@ namespace UnitySim.Analytics
             InitializeAnalytics();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            pipeline?.Dispose();
+            pipeline = null;
         }
 
         #endregion
@@ -83,33 +228,122 @@ namespace UnitySim.Analytics
         private void InitializeAnalytics()
         {
             currentData = new AnalyticsData();
+
+            // Settings are read once; a reset clears the pipeline in place, or rebuilds it when they changed
+            var settings = new AnalyticsPipelineSettings
+            {
+                queueCapacity = queueCapacity,
+                maxEventTypes = maxEventTypes,
+                windowSeconds = windowSeconds,
+                windowCount = windowCount,
+                compression = percentileCompression,
+                uniquePrecision = uniqueUsersPrecision,
+                batchSize = batchSize,
+                flushInterval = flushInterval
+            };
+            string sink = $"{sinkMode}|{fileName}|{maxFileMegabytes}|{httpEndpoint}|{httpTimeout}";
+
+            if (pipeline != null && settings.SameAs(pipelineSettings) && sink == sinkSettings)
+                pipeline.Reset();
+            else
+                CreatePipeline(settings, sink);
+
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
                 Debug.Log($"AnalyticsSystem initialized successfully");
         }
 
+        // Registered event types carry over, so ids cached by callers stay valid
+        private void CreatePipeline(AnalyticsPipelineSettings settings, string sink)
+        {
+            var previous = pipeline;
+            pipelineSettings = settings;
+            sinkSettings = sink;
+            pipeline = new AnalyticsPipeline(settings, CreateSink());
+            summary = new AnalyticsSummary(pipeline.MaxEventTypes);
+
+            if (previous == null) return;
+
+            string name;
+            for (int type = AnalyticsPipeline.ConversionEvent + 1; (name = previous.GetEventTypeName(type)) != null; type++)
+            {
+                if (pipeline.RegisterEventType(name) != type)
+                    Debug.LogWarning($"AnalyticsSystem: Event type {name} no longer fits in maxEventTypes and was dropped");
+            }
+            previous.Dispose();
+        }
+
+        private IAnalyticsSink CreateSink()
+        {
+            try
+            {
+                switch (sinkMode)
+                {
+                    case AnalyticsSinkMode.File:
+                        string path = System.IO.Path.Combine(Application.persistentDataPath, fileName);
+                        return new FileAnalyticsSink(path, maxFileMegabytes * 1024L * 1024L);
+
+                    case AnalyticsSinkMode.Http:
+                        return new HttpAnalyticsSink(httpEndpoint, httpTimeout);
+                }
+            }
+            catch (System.Exception e)
+            {
+                Debug.LogWarning($"AnalyticsSystem: Sink disabled - {e.Message}");
+            }
+            return null;
+        }
+
         #endregion
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.analytics.totalEvents += UnityEngine.Random.Range(5, 20);
-            currentData.analytics.activeSessions = UnityEngine.Random.Range(10, 100);
-            currentData.analytics.dataPoints += UnityEngine.Random.Range(50, 200);
+            if (pipeline == null) return;
+
+            var info = currentData.analytics;
+            long previousDropped = info.droppedEvents;
+            long previousFailed = failedBatches;
+            pipeline.GetSummary(summary);
+
+            var starts = summary.metrics[AnalyticsPipeline.SessionStartEvent];
+            var ends = summary.metrics[AnalyticsPipeline.SessionEndEvent];
+            var conversions = summary.metrics[AnalyticsPipeline.ConversionEvent];
+
+            // Session figures are over the rolling window, totals over the pipeline's lifetime
+            info.totalEvents = summary.processedEvents;
+            info.activeSessions = (int)System.Math.Min(int.MaxValue, summary.activeSessions);
+            info.averageSessionTime = ends.Mean;
+            info.conversionRate = starts.count > 0 ? Mathf.Clamp01((float)conversions.count / starts.count) : 0f;
+            info.dataPoints = summary.windowEvents;
+            info.uniqueUsers = summary.uniqueUsers;
+            info.eventsPerSecond = summary.eventsPerSecond;
+            info.droppedEvents = summary.droppedEvents;
+            info.flushedEvents = summary.flushedEvents;
+
+            queueDepth = summary.queueDepth;
+            lateEvents = summary.lateEvents;
+            unflushedEvents = summary.unflushedEvents;
+            failedBatches = summary.failedBatches;
+
+            if (info.droppedEvents > previousDropped) info.systemHealth = "dropping";
+            else if (failedBatches > previousFailed) info.systemHealth = "sink-failing";
+            else info.systemHealth = "operational";
         }
 
         private void ProcessUpdate()
@@ -122,6 +356,12 @@ namespace UnitySim.Analytics
                 OnAnalyticsChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +369,67 @@ namespace UnitySim.Analytics
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.analytics;
+            var changed = publishFullDelta ? AnalyticsField.All : info.Diff(publishedInfo);
+            if (changed == AnalyticsField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnAnalyticsDelta?.Invoke(new AnalyticsDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(AnalyticsSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("AnalyticsSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +440,9 @@ namespace UnitySim.Analytics
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +463,55 @@ namespace UnitySim.Analytics
             return currentData;
         }
 
+        // Main thread; the built-in session_start, session_end and conversion are always registered
+        public int RegisterEventType(string name)
+        {
+            return pipeline != null ? pipeline.RegisterEventType(name) : -1;
+        }
+
+        // Any thread, allocation-free. False before initialization, for unknown types, or when
+        // the queue is full.
+        public bool Track(int eventType, ulong userId, float value = 0f)
+        {
+            var target = pipeline;
+            return target != null && target.Track(eventType, userId, value);
+        }
+
+        public bool TrackSessionStart(ulong userId)
+        {
+            return Track(AnalyticsPipeline.SessionStartEvent, userId);
+        }
+
+        public bool TrackSessionEnd(ulong userId, float sessionSeconds)
+        {
+            return Track(AnalyticsPipeline.SessionEndEvent, userId, sessionSeconds);
+        }
+
+        public bool TrackConversion(ulong userId, float value = 0f)
+        {
+            return Track(AnalyticsPipeline.ConversionEvent, userId, value);
+        }
+
+        // Rolling-window aggregates as of the last scheduled update
+        public bool TryGetMetric(int eventType, out AnalyticsMetric metric)
+        {
+            metric = default;
+            if (summary == null || (uint)eventType >= (uint)summary.typeCount) return false;
+
+            metric = summary.metrics[eventType];
+            return true;
+        }
+
+        public AnalyticsSummary GetSummary()
+        {
+            return summary;
+        }
+
+        public AnalyticsPipeline GetPipeline()
+        {
+            return pipeline;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +543,7 @@ namespace UnitySim.Analytics
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +555,16 @@ namespace UnitySim.Analytics
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            queueCapacity = Mathf.Clamp(queueCapacity, 1024, 1 << 24);
+            maxEventTypes = Mathf.Clamp(maxEventTypes, 4, 256);
+            windowSeconds = Mathf.Max(0.1f, windowSeconds);
+            windowCount = Mathf.Clamp(windowCount, 1, 1024);
+            percentileCompression = Mathf.Clamp(percentileCompression, 10f, 1000f);
+            uniqueUsersPrecision = Mathf.Clamp(uniqueUsersPrecision, 4, 16);
+            maxFileMegabytes = Mathf.Max(1, maxFileMegabytes);
+            httpTimeout = Mathf.Max(1f, httpTimeout);
+            batchSize = Mathf.Clamp(batchSize, 64, 1 << 20);
+            flushInterval = Mathf.Max(0.05f, flushInterval);
         }
 
         #endregion
@@ -218,7 +576,10 @@ namespace UnitySim.Analytics
             Debug.Log($"AnalyticsSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Events: {currentData?.analytics.eventsPerSecond ?? 0f:F0}/s, queue {queueDepth}/{pipeline?.QueueCapacity ?? 0}, {currentData?.analytics.droppedEvents ?? 0} dropped, {lateEvents} late");
+            Debug.Log($"- Sink: {sinkMode}, {currentData?.analytics.flushedEvents ?? 0} flushed, {unflushedEvents} unflushed, {failedBatches} failed batches");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
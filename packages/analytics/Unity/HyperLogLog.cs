@@ -0,0 +1,115 @@
+using System;
+
+namespace UnitySim.Analytics
+{
+    // Distinct-count estimator in 2^precision bytes. Each hashed id picks a register by its top
+    // bits and records the longest run of leading zeros seen in the rest; the harmonic mean
+    // of the registers estimates the count with about 1.04 / sqrt(2^precision) relative error.
+    // Small counts fall back to linear counting. Not thread-safe.
+    public class HyperLogLog
+    {
+        private readonly byte[] registers;
+        private readonly int precision;
+        private readonly double alpha;
+
+        private static readonly double[] InversePowers = CreateInversePowers();
+
+        public int Precision => precision;
+        public int RegisterCount => registers.Length;
+
+        // precision is clamped to [4, 16]
+        public HyperLogLog(int precision = 12)
+        {
+            this.precision = Math.Max(4, Math.Min(16, precision));
+            registers = new byte[1 << this.precision];
+            alpha = 0.7213 / (1.0 + 1.079 / registers.Length);
+        }
+
+        // id is mixed first, so sequential ids spread like random hashes
+        public void Add(ulong id)
+        {
+            ulong hash = Mix(id);
+            int index = (int)(hash >> (64 - precision));
+            ulong rest = (hash << precision) | (1UL << (precision - 1));
+            byte rank = (byte)(LeadingZeros(rest) + 1);
+            if (rank > registers[index]) registers[index] = rank;
+        }
+
+        // Union with another estimator of the same precision
+        public void Add(HyperLogLog other)
+        {
+            if (other == null) return;
+            if (other.precision != precision) throw new ArgumentException("HyperLogLog: Precision mismatch", nameof(other));
+
+            for (int i = 0; i < registers.Length; i++)
+            {
+                if (other.registers[i] > registers[i]) registers[i] = other.registers[i];
+            }
+        }
+
+        public void Clear()
+        {
+            Array.Clear(registers, 0, registers.Length);
+        }
+
+        public long Estimate()
+        {
+            int m = registers.Length;
+            double sum = 0.0;
+            int zeros = 0;
+            for (int i = 0; i < m; i++)
+            {
+                sum += InversePowers[registers[i]];
+                if (registers[i] == 0) zeros++;
+            }
+
+            double estimate = alpha * m * m / sum;
+            if (estimate <= 2.5 * m && zeros > 0) estimate = m * Math.Log((double)m / zeros);
+            return (long)Math.Round(estimate);
+        }
+
+        // splitmix64 finalizer
+        public static ulong Mix(ulong x)
+        {
+            x ^= x >> 30;
+            x *= 0xBF58476D1CE4E5B9UL;
+            x ^= x >> 27;
+            x *= 0x94D049BB133111EBUL;
+            x ^= x >> 31;
+            return x;
+        }
+
+        // FNV-1a, for callers whose user ids are strings
+        public static ulong Hash(string id)
+        {
+            ulong hash = 14695981039346656037UL;
+            if (id == null) return hash;
+
+            for (int i = 0; i < id.Length; i++)
+            {
+                hash ^= id[i];
+                hash *= 1099511628211UL;
+            }
+            return hash;
+        }
+
+        private static int LeadingZeros(ulong x)
+        {
+            int n = 0;
+            if ((x >> 32) == 0) { n += 32; x <<= 32; }
+            if ((x >> 48) == 0) { n += 16; x <<= 16; }
+            if ((x >> 56) == 0) { n += 8; x <<= 8; }
+            if ((x >> 60) == 0) { n += 4; x <<= 4; }
+            if ((x >> 62) == 0) { n += 2; x <<= 2; }
+            if ((x >> 63) == 0) { n += 1; }
+            return n;
+        }
+
+        private static double[] CreateInversePowers()
+        {
+            var table = new double[66];
+            for (int i = 0; i < table.Length; i++) table[i] = Math.Pow(2.0, -i);
+            return table;
+        }
+    }
+}
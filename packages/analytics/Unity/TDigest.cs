@@ -0,0 +1,169 @@
+using System;
+
+namespace UnitySim.Analytics
+{
+    // Merging t-digest for streaming percentiles in fixed memory. Values collect in a buffer
+    // and are merged into at most about compression + 1 centroids, kept small near the tails
+    // by the arcsine scale function, so extreme percentiles stay accurate. Not thread-safe.
+    public class TDigest
+    {
+        private readonly double compression;
+        private readonly float[] means;
+        private readonly float[] weights;
+        private readonly float[] bufferMeans;
+        private readonly float[] bufferWeights;
+        private int count = 0;
+        private int buffered = 0;
+        private double totalWeight = 0.0;
+        private float min = float.PositiveInfinity;
+        private float max = float.NegativeInfinity;
+
+        // Shared by every digest compressed on the same thread
+        [ThreadStatic] private static float[] scratchMeans;
+        [ThreadStatic] private static float[] scratchWeights;
+
+        public double TotalWeight => totalWeight;
+        public float Min => min;
+        public float Max => max;
+
+        public int CentroidCount
+        {
+            get { Compress(); return count; }
+        }
+
+        public TDigest(float compression = 100f)
+        {
+            this.compression = Math.Max(10f, compression);
+            int capacity = (int)Math.Ceiling(this.compression) + 8;
+            means = new float[capacity];
+            weights = new float[capacity];
+            bufferMeans = new float[capacity];
+            bufferWeights = new float[capacity];
+        }
+
+        public void Add(float value, float weight = 1f)
+        {
+            if (float.IsNaN(value) || weight <= 0f) return;
+            if (buffered == bufferMeans.Length) Compress();
+
+            bufferMeans[buffered] = value;
+            bufferWeights[buffered] = weight;
+            buffered++;
+            totalWeight += weight;
+            if (value < min) min = value;
+            if (value > max) max = value;
+        }
+
+        public void Add(TDigest other)
+        {
+            if (other == null || other.totalWeight <= 0.0) return;
+
+            other.Compress();
+            for (int i = 0; i < other.count; i++) Add(other.means[i], other.weights[i]);
+            if (other.min < min) min = other.min;
+            if (other.max > max) max = other.max;
+        }
+
+        public void Clear()
+        {
+            count = 0;
+            buffered = 0;
+            totalWeight = 0.0;
+            min = float.PositiveInfinity;
+            max = float.NegativeInfinity;
+        }
+
+        // Value at quantile q in [0, 1], interpolating between centroid centres; NaN when empty
+        public float Quantile(float q)
+        {
+            Compress();
+            if (count == 0) return float.NaN;
+            if (count == 1) return means[0];
+
+            q = Math.Max(0f, Math.Min(1f, q));
+            double target = q * totalWeight;
+
+            // Below the first centroid's centre, interpolate from the minimum
+            double firstHalf = weights[0] * 0.5;
+            if (target < firstHalf) return Lerp(min, means[0], target / firstHalf);
+
+            double cumulative = 0.0;
+            for (int i = 0; i < count - 1; i++)
+            {
+                double centre = cumulative + weights[i] * 0.5;
+                double nextCentre = cumulative + weights[i] + weights[i + 1] * 0.5;
+                if (target <= nextCentre) return Lerp(means[i], means[i + 1], (target - centre) / (nextCentre - centre));
+                cumulative += weights[i];
+            }
+
+            int last = count - 1;
+            double lastHalf = weights[last] * 0.5;
+            double lastCentre = totalWeight - lastHalf;
+            return Lerp(means[last], max, (target - lastCentre) / lastHalf);
+        }
+
+        private void Compress()
+        {
+            if (buffered == 0) return;
+
+            int total = count + buffered;
+            if (scratchMeans == null || scratchMeans.Length < total)
+            {
+                scratchMeans = new float[Math.Max(total, 256)];
+                scratchWeights = new float[scratchMeans.Length];
+            }
+
+            Array.Copy(means, 0, scratchMeans, 0, count);
+            Array.Copy(weights, 0, scratchWeights, 0, count);
+            Array.Copy(bufferMeans, 0, scratchMeans, count, buffered);
+            Array.Copy(bufferWeights, 0, scratchWeights, count, buffered);
+            Array.Sort(scratchMeans, scratchWeights, 0, total);
+            buffered = 0;
+
+            // Greedy merge: a centroid may grow while it spans less than one unit of k
+            double mergedWeight = 0.0;
+            double limit = QuantileLimit(0.0);
+            double mean = scratchMeans[0];
+            double weight = scratchWeights[0];
+            count = 0;
+
+            for (int i = 1; i < total; i++)
+            {
+                double next = scratchWeights[i];
+                bool full = count == means.Length - 1;
+                if ((mergedWeight + weight + next) / totalWeight <= limit || full)
+                {
+                    weight += next;
+                    mean += (scratchMeans[i] - mean) * next / weight;
+                }
+                else
+                {
+                    means[count] = (float)mean;
+                    weights[count] = (float)weight;
+                    count++;
+                    mergedWeight += weight;
+                    limit = QuantileLimit(mergedWeight / totalWeight);
+                    mean = scratchMeans[i];
+                    weight = next;
+                }
+            }
+
+            means[count] = (float)mean;
+            weights[count] = (float)weight;
+            count++;
+        }
+
+        // Furthest quantile a centroid starting at q may reach: q(k(q) + 1) with k1(q) = d/2pi asin(2q - 1)
+        private double QuantileLimit(double q)
+        {
+            double k = compression / (2.0 * Math.PI) * Math.Asin(2.0 * q - 1.0) + 1.0;
+            if (k >= compression / 4.0) return 1.0;
+            return (Math.Sin(k * 2.0 * Math.PI / compression) + 1.0) * 0.5;
+        }
+
+        private static float Lerp(float a, float b, double t)
+        {
+            return (float)(a + (b - a) * Math.Max(0.0, Math.Min(1.0, t)));
+        }
+    }
+}
@@ -0,0 +1,16 @@
+namespace UnitySim.Core
+{
+    // Implemented by the ml-integration package. Loaded models are evaluated together once per
+    // tick: a client writes its observations and sets the batch size during its own tick, and
+    // reads the outputs after the service's next tick. Find one with
+    // SimulationRegistry.Find<IInferenceService>().
+    public interface IInferenceService
+    {
+        // Returns the existing model when one with this name is already loaded
+        PolicyNetwork LoadModel(string name, int[] layerSizes, int capacity, uint seed,
+            Activation hidden = Activation.ReLU, Activation output = Activation.Linear);
+
+        PolicyNetwork GetModel(string name);
+        bool UnloadModel(string name);
+    }
+}
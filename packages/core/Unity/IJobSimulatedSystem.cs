@@ -0,0 +1,20 @@
+using System.Collections.Generic;
+
+namespace UnitySim.Core
+{
+    // Optional contract for systems whose per-tick step can run on the job backend.
+    // Channel values are exchanged in DescribeChannels order.
+    public interface IJobSimulatedSystem : IScheduledSystem
+    {
+        // Incremented whenever the managed data is replaced (initialize, reset)
+        int StateVersion { get; }
+
+        void DescribeChannels(List<SimulationChannel> channels);
+
+        // Managed data -> job state
+        void WriteChannels(double[] values);
+
+        // Job state -> managed data, called only right before the system publishes
+        void ReadChannels(double[] values, long timestamp);
+    }
+}
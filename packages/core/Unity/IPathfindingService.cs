@@ -0,0 +1,53 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    public enum PathStatus : byte
+    {
+        Found,
+        NotFound,
+        Invalid,
+        TooLong,
+        Cancelled       // the service was reset or destroyed before the request was solved
+    }
+
+    public readonly struct PathResult
+    {
+        public readonly int requestId;
+        public readonly PathStatus status;
+        public readonly int nodesExpanded;
+        public readonly float latencyMs;
+
+        // Start to goal inclusive; owned by the service and reused after the callback returns
+        public readonly IReadOnlyList<Vector2Int> path;
+
+        public PathResult(int requestId, PathStatus status, int nodesExpanded, float latencyMs, IReadOnlyList<Vector2Int> path)
+        {
+            this.requestId = requestId;
+            this.status = status;
+            this.nodesExpanded = nodesExpanded;
+            this.latencyMs = latencyMs;
+            this.path = path;
+        }
+    }
+
+    // Batched grid pathfinding shared by agents in any package. Requests are solved off the
+    // main thread and callbacks run on the main thread at the end of a later frame.
+    // Find one with SimulationRegistry.Find<IPathfindingService>().
+    public interface IPathfindingService
+    {
+        Vector2Int GridSize { get; }
+        int PendingRequests { get; }
+
+        Vector2Int WorldToCell(Vector3 position);
+        Vector3 CellToWorld(Vector2Int cell);
+
+        // Cost multiplier of entering a cell; 0 blocks it
+        void SetCost(Vector2Int cell, byte cost);
+
+        // Returns a request id, also passed back in PathResult
+        int RequestPath(Vector2Int start, Vector2Int goal, Action<PathResult> onComplete);
+    }
+}
@@ -0,0 +1,21 @@
+using System;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Implemented by packages with many moving objects, such as vehicles, so the network
+    // package can replicate them by interest without referencing the package. Entities are
+    // read by index on the main thread between the system's updates.
+    public interface IReplicatedEntitySource
+    {
+        string SystemName { get; }
+        int EntityCount { get; }
+
+        // Values each entity has besides its position, e.g. speed
+        int EntityValueCount { get; }
+
+        // id must stay with the entity across updates even when its index changes;
+        // values has EntityValueCount elements
+        void GetEntity(int index, out uint id, out Vector3 position, Span<float> values);
+    }
+}
@@ -0,0 +1,19 @@
+namespace UnitySim.Core
+{
+    // Contract between a simulation package and the SimulationScheduler.
+    // Packages register themselves on enable instead of running their own Update().
+    public interface IScheduledSystem
+    {
+        string SystemName { get; }
+        float UpdateInterval { get; }
+        int MaxUpdatesPerFrame { get; }
+        bool EnableOptimization { get; }
+        bool IsInitialized { get; }
+
+        // Advances the system's data by deltaTime seconds; timestamp is shared by every system in the pass
+        void Tick(float deltaTime, long timestamp);
+
+        // Publishes the current data (events, logging) once per update interval
+        void ProcessScheduledUpdate();
+    }
+}
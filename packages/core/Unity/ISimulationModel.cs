@@ -0,0 +1,45 @@
+using System.Collections.Generic;
+
+namespace UnitySim.Core
+{
+    // State and step logic of one system as plain C#, with no Unity object or main-thread
+    // dependency. Systems own one for in-game use; SimulationBatchRunner runs many in parallel.
+    public interface ISimulationModel
+    {
+        // Advances the model by one update; all randomness comes from the model's own seed
+        void Step(float deltaTime);
+
+        // Writes the model's fields into the writer's current object (no root object)
+        void WriteState(IStateWriter writer);
+    }
+
+    // Steps several models together as one scenario, in the order they were added
+    public class SimulationModelGroup : ISimulationModel
+    {
+        private readonly List<ISimulationModel> models = new List<ISimulationModel>();
+
+        public int Count => models.Count;
+
+        public SimulationModelGroup Add(ISimulationModel model)
+        {
+            if (model != null) models.Add(model);
+            return this;
+        }
+
+        public void Step(float deltaTime)
+        {
+            for (int i = 0; i < models.Count; i++)
+            {
+                models[i].Step(deltaTime);
+            }
+        }
+
+        public void WriteState(IStateWriter writer)
+        {
+            for (int i = 0; i < models.Count; i++)
+            {
+                models[i].WriteState(writer);
+            }
+        }
+    }
+}
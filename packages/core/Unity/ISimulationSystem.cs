@@ -0,0 +1,22 @@
+using System;
+using System.Buffers;
+
+namespace UnitySim.Core
+{
+    // Common surface of every simulation package, so tools can drive any system
+    // through SimulationRegistry without reflection.
+    public interface ISimulationSystem : IScheduledSystem, IStateSource
+    {
+        // Declared on both base interfaces; redeclared so calls through this interface are not ambiguous
+        new string SystemName { get; }
+
+        // Raised after every publish, alongside the system's typed OnXChanged/OnXDelta events
+        event Action<ISimulationSystem> SystemUpdated;
+
+        string ExportState();
+        void ExportState(IBufferWriter<byte> output);
+        void ResetData();
+        void SetUpdateInterval(float interval);
+        void ForceUpdate();
+    }
+}
@@ -0,0 +1,12 @@
+namespace UnitySim.Core
+{
+    // Systems whose current *Data can be written through an IStateWriter.
+    // Used by the snapshot recorder and any other non-JSON exporter.
+    public interface IStateSource
+    {
+        string SystemName { get; }
+
+        // Writes the root *Data object; returns false when there is no data yet
+        bool WriteState(IStateWriter writer);
+    }
+}
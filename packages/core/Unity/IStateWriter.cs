@@ -0,0 +1,20 @@
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Visitor that *Data/*Info classes write their fields through, so one hand-written
+    // WriteState per class can feed any output format without reflection.
+    public interface IStateWriter
+    {
+        // name is null for the root object
+        void BeginObject(string name);
+        void EndObject();
+
+        void Write(string name, int value);
+        void Write(string name, long value);
+        void Write(string name, float value);
+        void Write(string name, bool value);
+        void Write(string name, string value);
+        void Write(string name, Vector2Int value);
+    }
+}
@@ -0,0 +1,33 @@
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Local weather at one point of the world
+    public readonly struct WeatherSample
+    {
+        public readonly float temperature;    // °C
+        public readonly float humidity;       // %
+        public readonly float pressure;       // hPa
+        public readonly float windSpeed;      // m/s
+        public readonly float windDirection;  // degrees, 0 = north
+        public readonly float precipitation;  // mm/h
+
+        public WeatherSample(float temperature, float humidity, float pressure, float windSpeed, float windDirection, float precipitation)
+        {
+            this.temperature = temperature;
+            this.humidity = humidity;
+            this.pressure = pressure;
+            this.windSpeed = windSpeed;
+            this.windDirection = windDirection;
+            this.precipitation = precipitation;
+        }
+    }
+
+    // Implemented by the weather package so other packages can read local conditions
+    // without referencing it. Find one with SimulationRegistry.Find<IWeatherProvider>().
+    public interface IWeatherProvider
+    {
+        // O(1) and allocation-free; positions outside the field clamp to its edge
+        WeatherSample SampleWeather(Vector3 position);
+    }
+}
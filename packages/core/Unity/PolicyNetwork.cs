@@ -0,0 +1,438 @@
+using System;
+using System.Diagnostics;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+
+namespace UnitySim.Core
+{
+    public enum Activation : byte
+    {
+        Linear,
+        ReLU,
+        Tanh
+    }
+
+    // Latest inference times in a fixed ring, with percentiles over the ring
+    public class InferenceTimings
+    {
+        private readonly float[] samples;
+        private readonly float[] sorted;
+        private int next = 0;
+        private int count = 0;
+        private bool sortedValid = false;
+
+        public int Count => count;
+        public long TotalRuns { get; private set; }
+        public float LastMs { get; private set; }
+
+        public InferenceTimings(int window = 256)
+        {
+            samples = new float[Math.Max(1, window)];
+            sorted = new float[samples.Length];
+        }
+
+        public void Record(float milliseconds)
+        {
+            samples[next] = milliseconds;
+            next = (next + 1) % samples.Length;
+            count = Math.Min(count + 1, samples.Length);
+            TotalRuns++;
+            LastMs = milliseconds;
+            sortedValid = false;
+        }
+
+        // Nearest-rank percentile, p in 0-100; 0 before the first sample
+        public float Percentile(float p)
+        {
+            if (count == 0) return 0f;
+
+            if (!sortedValid)
+            {
+                Array.Copy(samples, sorted, count);
+                Array.Sort(sorted, 0, count);
+                sortedValid = true;
+            }
+
+            int rank = (int)Math.Ceiling(Math.Max(0f, Math.Min(100f, p)) / 100f * count) - 1;
+            return sorted[Math.Max(0, rank)];
+        }
+
+        public void Clear()
+        {
+            next = 0;
+            count = 0;
+            TotalRuns = 0;
+            LastMs = 0f;
+            sortedValid = false;
+        }
+    }
+
+    // A fully connected network evaluated for a whole batch of rows in one job. Observations
+    // are written into Inputs row by row, Run or Schedule evaluates the first BatchSize rows,
+    // and the results for LastBatchSize rows are read back from Outputs. Every buffer is
+    // allocated for the full capacity up front, so a tick never allocates. Rows are
+    // independent, so each worker runs all layers for its own tile of rows with no barrier
+    // between layers.
+    public class PolicyNetwork : IDisposable
+    {
+        private const int TileRows = 32;
+
+        private readonly int[] layerSizes;
+        private readonly int capacity;
+        private readonly int widest;
+
+        // Layer l weights are [in x paddedOut] row-major from layers[l].z; outputs are
+        // padded to float4 with zero weights and biases so the padding stays zero
+        private NativeArray<float> weights;
+        private NativeArray<float> biases;
+        private NativeArray<int4> layers;
+        private NativeArray<float> inputs;
+        private NativeArray<float> outputs;
+        private NativeArray<float> scratch;
+
+        private readonly Stopwatch stopwatch = new Stopwatch();
+        private JobHandle pending;
+        private bool scheduled = false;
+
+        public string Name { get; }
+        public int InputSize => layerSizes[0];
+        public int OutputSize => layerSizes[layerSizes.Length - 1];
+        public int LayerCount => layerSizes.Length - 1;
+        public int Capacity => capacity;
+        public int BatchSize { get; private set; }
+
+        // Rows the last completed run evaluated
+        public int LastBatchSize { get; private set; }
+
+        public int Parameters { get; }
+        public Activation HiddenActivation { get; }
+        public Activation OutputActivation { get; }
+        public InferenceTimings Timings { get; } = new InferenceTimings();
+
+        // Row-major [capacity x InputSize] and [capacity x OutputSize]
+        public NativeArray<float> Inputs => inputs;
+        public NativeArray<float> Outputs => outputs;
+
+        public PolicyNetwork(string name, int[] layerSizes, int capacity, uint seed,
+            Activation hidden = Activation.ReLU, Activation output = Activation.Linear)
+        {
+            if (layerSizes == null || layerSizes.Length < 2) throw new ArgumentException("A network needs input and output sizes", nameof(layerSizes));
+
+            Name = name;
+            this.layerSizes = (int[])layerSizes.Clone();
+            for (int i = 0; i < this.layerSizes.Length; i++) this.layerSizes[i] = Math.Max(1, this.layerSizes[i]);
+            this.capacity = Math.Max(1, capacity);
+            HiddenActivation = hidden;
+            OutputActivation = output;
+
+            int weightCount = 0, biasCount = 0, parameters = 0;
+            layers = new NativeArray<int4>(LayerCount, Allocator.Persistent);
+            for (int l = 0; l < LayerCount; l++)
+            {
+                int fanIn = this.layerSizes[l];
+                int fanOut = this.layerSizes[l + 1];
+                int padded = Padded(fanOut);
+
+                // x = input width, y = output width, z = weight offset, w = bias offset
+                layers[l] = new int4(fanIn, fanOut, weightCount, biasCount);
+                weightCount += fanIn * padded;
+                biasCount += padded;
+                parameters += fanIn * fanOut + fanOut;
+                widest = Math.Max(widest, padded);
+            }
+            Parameters = parameters;
+
+            weights = new NativeArray<float>(weightCount, Allocator.Persistent);
+            biases = new NativeArray<float>(biasCount, Allocator.Persistent);
+            inputs = new NativeArray<float>(this.capacity * InputSize, Allocator.Persistent);
+            outputs = new NativeArray<float>(this.capacity * OutputSize, Allocator.Persistent);
+            scratch = new NativeArray<float>(this.capacity * widest * 2, Allocator.Persistent);
+
+            Randomize(seed);
+        }
+
+        #region Weights
+
+        // He-style uniform initialisation; trained weights replace it through SetLayer
+        public void Randomize(uint seed)
+        {
+            CompletePending();
+
+            var random = new Unity.Mathematics.Random(seed != 0 ? seed : 1u);
+            for (int l = 0; l < LayerCount; l++)
+            {
+                var layer = layers[l];
+                int padded = Padded(layer.y);
+                float scale = math.sqrt(6f / layer.x);
+
+                for (int k = 0; k < layer.x; k++)
+                {
+                    for (int j = 0; j < padded; j++)
+                    {
+                        weights[layer.z + k * padded + j] = j < layer.y ? random.NextFloat(-scale, scale) : 0f;
+                    }
+                }
+                for (int j = 0; j < padded; j++) biases[layer.w + j] = 0f;
+            }
+        }
+
+        // weights are [fanIn x fanOut] row-major, biases [fanOut]
+        public void SetLayer(int layer, float[] layerWeights, float[] layerBiases)
+        {
+            var info = layers[layer];
+            if (layerWeights == null || layerWeights.Length != info.x * info.y) throw new ArgumentException($"Expected {info.x * info.y} weights", nameof(layerWeights));
+            if (layerBiases == null || layerBiases.Length != info.y) throw new ArgumentException($"Expected {info.y} biases", nameof(layerBiases));
+
+            CompletePending();
+
+            int padded = Padded(info.y);
+            for (int k = 0; k < info.x; k++)
+            {
+                for (int j = 0; j < info.y; j++)
+                {
+                    weights[info.z + k * padded + j] = layerWeights[k * info.y + j];
+                }
+            }
+            for (int j = 0; j < info.y; j++) biases[info.w + j] = layerBiases[j];
+        }
+
+        #endregion
+
+        #region Batching
+
+        // Sets how many rows the next run evaluates. Each run consumes the batch, so a client
+        // that stops feeding is not re-evaluated; rows keep their values between runs.
+        public void SetBatchSize(int rows)
+        {
+            CompletePending();
+            BatchSize = Math.Max(0, Math.Min(capacity, rows));
+        }
+
+        public void SetInput(int row, int feature, float value)
+        {
+            inputs[row * InputSize + feature] = value;
+        }
+
+        public float GetOutput(int row, int index)
+        {
+            return outputs[row * OutputSize + index];
+        }
+
+        public int ArgMax(int row)
+        {
+            int best = 0;
+            int offset = row * OutputSize;
+            for (int i = 1; i < OutputSize; i++)
+            {
+                if (outputs[offset + i] > outputs[offset + best]) best = i;
+            }
+            return best;
+        }
+
+        #endregion
+
+        #region Evaluation
+
+        // Evaluates the batch on worker threads; call Complete before touching the buffers
+        public JobHandle Schedule(JobHandle dependency = default)
+        {
+            CompletePending();
+            stopwatch.Restart();
+
+            if (BatchSize == 0)
+            {
+                pending = dependency;
+            }
+            else
+            {
+                pending = new ForwardJob
+                {
+                    weights = weights.Reinterpret<float4>(sizeof(float)),
+                    biases = biases.Reinterpret<float4>(sizeof(float)),
+                    layers = layers,
+                    inputs = inputs,
+                    outputs = outputs,
+                    scratch = scratch,
+                    inputSize = InputSize,
+                    outputSize = OutputSize,
+                    widest = widest,
+                    rows = BatchSize,
+                    hidden = HiddenActivation,
+                    output = OutputActivation
+                }.Schedule((BatchSize + TileRows - 1) / TileRows, 1, dependency);
+            }
+
+            scheduled = true;
+            return pending;
+        }
+
+        // Waits for a scheduled batch and records how long it took from Schedule
+        public void Complete()
+        {
+            if (!scheduled) return;
+
+            pending.Complete();
+            scheduled = false;
+            LastBatchSize = BatchSize;
+            BatchSize = 0;
+            stopwatch.Stop();
+            Timings.Record((float)stopwatch.Elapsed.TotalMilliseconds);
+        }
+
+        public void Run()
+        {
+            Schedule();
+            Complete();
+        }
+
+        public void Dispose()
+        {
+            if (scheduled) pending.Complete();
+            scheduled = false;
+
+            if (weights.IsCreated) weights.Dispose();
+            if (biases.IsCreated) biases.Dispose();
+            if (layers.IsCreated) layers.Dispose();
+            if (inputs.IsCreated) inputs.Dispose();
+            if (outputs.IsCreated) outputs.Dispose();
+            if (scratch.IsCreated) scratch.Dispose();
+        }
+
+        private void CompletePending()
+        {
+            if (scheduled) Complete();
+        }
+
+        private static int Padded(int width)
+        {
+            return (width + 3) & ~3;
+        }
+
+        #endregion
+
+        #region Job
+
+        [BurstCompile(FloatMode = FloatMode.Fast)]
+        private struct ForwardJob : IJobParallelFor
+        {
+            [ReadOnly] public NativeArray<float4> weights;
+            [ReadOnly] public NativeArray<float4> biases;
+            [ReadOnly] public NativeArray<int4> layers;
+            [ReadOnly] public NativeArray<float> inputs;
+
+            // Each tile writes only its own rows
+            [NativeDisableParallelForRestriction] public NativeArray<float> outputs;
+            [NativeDisableParallelForRestriction] public NativeArray<float> scratch;
+
+            public int inputSize;
+            public int outputSize;
+            public int widest;
+            public int rows;
+            public Activation hidden;
+            public Activation output;
+
+            public void Execute(int tile)
+            {
+                int first = tile * TileRows;
+                int last = math.min(rows, first + TileRows);
+
+                // Ping-pong between two halves of scratch; layer 0 reads the packed inputs
+                int half = scratch.Length / 2;
+                int source = -1;
+                int sourceStride = inputSize;
+
+                for (int l = 0; l < layers.Length; l++)
+                {
+                    var layer = layers[l];
+                    int padded = (layer.y + 3) & ~3;
+                    bool final = l == layers.Length - 1;
+                    int target = (l & 1) * half;
+                    var activation = final ? output : hidden;
+
+                    int r = first;
+                    for (; r + 4 <= last; r += 4)
+                    {
+                        for (int j = 0; j < padded >> 2; j++)
+                        {
+                            float4 bias = biases[(layer.w >> 2) + j];
+                            float4 a0 = bias, a1 = bias, a2 = bias, a3 = bias;
+                            int w = (layer.z >> 2) + j;
+
+                            for (int k = 0; k < layer.x; k++, w += padded >> 2)
+                            {
+                                float4 weight = weights[w];
+                                a0 += Input(source, sourceStride, r, k) * weight;
+                                a1 += Input(source, sourceStride, r + 1, k) * weight;
+                                a2 += Input(source, sourceStride, r + 2, k) * weight;
+                                a3 += Input(source, sourceStride, r + 3, k) * weight;
+                            }
+
+                            Store(final, target, r, j, layer.y, Activate(a0, activation));
+                            Store(final, target, r + 1, j, layer.y, Activate(a1, activation));
+                            Store(final, target, r + 2, j, layer.y, Activate(a2, activation));
+                            Store(final, target, r + 3, j, layer.y, Activate(a3, activation));
+                        }
+                    }
+
+                    for (; r < last; r++)
+                    {
+                        for (int j = 0; j < padded >> 2; j++)
+                        {
+                            float4 a = biases[(layer.w >> 2) + j];
+                            int w = (layer.z >> 2) + j;
+                            for (int k = 0; k < layer.x; k++, w += padded >> 2)
+                            {
+                                a += Input(source, sourceStride, r, k) * weights[w];
+                            }
+
+                            Store(final, target, r, j, layer.y, Activate(a, activation));
+                        }
+                    }
+
+                    source = target;
+                    sourceStride = widest;
+                }
+            }
+
+            private float Input(int source, int stride, int row, int k)
+            {
+                return source < 0 ? inputs[row * stride + k] : scratch[source + row * stride + k];
+            }
+
+            private void Store(bool final, int target, int row, int column4, int width, float4 value)
+            {
+                int column = column4 << 2;
+                if (!final)
+                {
+                    int offset = target + row * widest + column;
+                    scratch[offset] = value.x;
+                    scratch[offset + 1] = value.y;
+                    scratch[offset + 2] = value.z;
+                    scratch[offset + 3] = value.w;
+                    return;
+                }
+
+                int baseIndex = row * outputSize + column;
+                int remaining = width - column;
+                outputs[baseIndex] = value.x;
+                if (remaining > 1) outputs[baseIndex + 1] = value.y;
+                if (remaining > 2) outputs[baseIndex + 2] = value.z;
+                if (remaining > 3) outputs[baseIndex + 3] = value.w;
+            }
+
+            private static float4 Activate(float4 value, Activation activation)
+            {
+                switch (activation)
+                {
+                    case Activation.ReLU: return math.max(value, 0f);
+                    case Activation.Tanh: return math.tanh(value);
+                    default: return value;
+                }
+            }
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,60 @@
+using System;
+using System.Buffers;
+
+namespace UnitySim.Core
+{
+    // Growable IBufferWriter<byte> that keeps its array between uses, so repeated
+    // exports reach a steady state with no allocations.
+    public class PooledBufferWriter : IBufferWriter<byte>
+    {
+        private byte[] buffer;
+        private int written;
+
+        public PooledBufferWriter(int initialCapacity = 1024)
+        {
+            buffer = new byte[Math.Max(16, initialCapacity)];
+        }
+
+        public int WrittenCount => written;
+        public int Capacity => buffer.Length;
+        public ReadOnlySpan<byte> WrittenSpan => new ReadOnlySpan<byte>(buffer, 0, written);
+        public ReadOnlyMemory<byte> WrittenMemory => new ReadOnlyMemory<byte>(buffer, 0, written);
+
+        // Exposes the backing array for APIs that take byte[] (streams, sockets)
+        public ArraySegment<byte> WrittenSegment => new ArraySegment<byte>(buffer, 0, written);
+
+        public void Clear()
+        {
+            written = 0;
+        }
+
+        public void Advance(int count)
+        {
+            if (count < 0 || written + count > buffer.Length)
+                throw new ArgumentOutOfRangeException(nameof(count));
+
+            written += count;
+        }
+
+        public Memory<byte> GetMemory(int sizeHint = 0)
+        {
+            EnsureCapacity(sizeHint);
+            return new Memory<byte>(buffer, written, buffer.Length - written);
+        }
+
+        public Span<byte> GetSpan(int sizeHint = 0)
+        {
+            EnsureCapacity(sizeHint);
+            return new Span<byte>(buffer, written, buffer.Length - written);
+        }
+
+        private void EnsureCapacity(int sizeHint)
+        {
+            if (sizeHint < 1) sizeHint = 1;
+            if (buffer.Length - written >= sizeHint) return;
+
+            int newSize = Math.Max(buffer.Length * 2, written + sizeHint);
+            Array.Resize(ref buffer, newSize);
+        }
+    }
+}
@@ -0,0 +1,227 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+using UnityEngine;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.Core
+{
+    [Serializable]
+    public class SimulationBatchSettings
+    {
+        public int scenarioCount = 1000;
+        public int stepsPerScenario = 8760;
+        public float stepInterval = 1f;
+        public uint baseSeed = 1;
+
+        // Steps between streamed rows; 0 streams only each scenario's final state
+        public int sampleInterval = 0;
+
+        // 0 or less uses every core
+        public int maxDegreeOfParallelism = 0;
+    }
+
+    // Runs many independently seeded scenarios across all cores with Parallel.For. Each
+    // worker thread owns its models, JSON writer and statistics, so the only shared state
+    // is the output stream, which receives whole buffered blocks of rows under a lock.
+    public class SimulationBatchRunner
+    {
+        private const int FlushThreshold = 1 << 16;
+
+        private readonly Func<uint, ISimulationModel> factory;
+        private readonly SimulationBatchSettings settings;
+        private readonly object outputLock = new object();
+        private Stream output;
+        private int completed = 0;
+
+        public SimulationBatchSettings Settings => settings;
+        public int CompletedScenarios => Volatile.Read(ref completed);
+
+        // Raised on a worker thread as each scenario finishes: (scenario index, seed)
+        public event Action<int, uint> ScenarioCompleted;
+
+        public SimulationBatchRunner(Func<uint, ISimulationModel> factory, SimulationBatchSettings settings = null)
+        {
+            this.factory = factory ?? throw new ArgumentNullException(nameof(factory));
+            this.settings = settings ?? new SimulationBatchSettings();
+        }
+
+        // Seed of one scenario, so any run from a sweep can be replayed on its own
+        public static uint SeedFor(uint baseSeed, int scenario)
+        {
+            uint x = (baseSeed * 0x9E3779B9u) ^ ((uint)scenario * 0x85EBCA6Bu);
+            x ^= x >> 16;
+            x *= 0x7FEB352Du;
+            x ^= x >> 15;
+            x *= 0x846CA68Bu;
+            x ^= x >> 16;
+            return x == 0 ? 1u : x;
+        }
+
+        // Runs the sweep and returns statistics over every scenario's final state. When output
+        // is set, one JSON object per line (scenario, seed, step, model fields) is streamed to it.
+        public SimulationBatchSummary Run(Stream output = null, CancellationToken cancellation = default)
+        {
+            this.output = output;
+            completed = 0;
+
+            var summary = new SimulationBatchSummary(settings);
+            var options = new ParallelOptions
+            {
+                CancellationToken = cancellation,
+                MaxDegreeOfParallelism = settings.maxDegreeOfParallelism > 0 ? settings.maxDegreeOfParallelism : -1
+            };
+
+            var stopwatch = Stopwatch.StartNew();
+            Parallel.For(0, Math.Max(0, settings.scenarioCount), options,
+                () => new Worker(this),
+                (index, loop, worker) =>
+                {
+                    worker.RunScenario(index);
+                    return worker;
+                },
+                worker =>
+                {
+                    worker.Flush();
+                    lock (summary) summary.Merge(worker.Metrics);
+                });
+            stopwatch.Stop();
+
+            output?.Flush();
+            this.output = null;
+
+            summary.ElapsedMs = stopwatch.Elapsed.TotalMilliseconds;
+            Debug.Log($"SimulationBatchRunner: {summary.ScenarioCount} scenarios x {settings.stepsPerScenario} steps in {summary.ElapsedMs:F0}ms");
+            return summary;
+        }
+
+        #region Workers
+
+        private class Worker
+        {
+            private readonly SimulationBatchRunner owner;
+            private readonly SimulationJsonWriter json = new SimulationJsonWriter();
+            private readonly PooledBufferWriter buffer;
+            public readonly MetricAccumulator Metrics = new MetricAccumulator();
+
+            public Worker(SimulationBatchRunner owner)
+            {
+                this.owner = owner;
+                buffer = owner.output != null ? new PooledBufferWriter(FlushThreshold * 2) : null;
+            }
+
+            public void RunScenario(int index)
+            {
+                var settings = owner.settings;
+                uint seed = SeedFor(settings.baseSeed, index);
+                var model = owner.factory(seed);
+
+                int steps = settings.stepsPerScenario;
+                int sampleInterval = settings.sampleInterval;
+                for (int step = 1; step <= steps; step++)
+                {
+                    model.Step(settings.stepInterval);
+
+                    if (sampleInterval > 0 && step % sampleInterval == 0 && step < steps)
+                        WriteRow(index, seed, step, model);
+                }
+
+                WriteRow(index, seed, steps, model);
+                Metrics.Add(model);
+
+                Interlocked.Increment(ref owner.completed);
+                owner.ScenarioCompleted?.Invoke(index, seed);
+            }
+
+            public void Flush()
+            {
+                if (buffer == null || buffer.WrittenCount == 0) return;
+
+                lock (owner.outputLock)
+                {
+                    owner.output.Write(buffer.WrittenSpan);
+                }
+                buffer.Clear();
+            }
+
+            private void WriteRow(int index, uint seed, int step, ISimulationModel model)
+            {
+                if (buffer == null) return;
+
+                json.Reset(buffer);
+                json.BeginObject(null);
+                json.Write("scenario", index);
+                json.Write("seed", (long)seed);
+                json.Write("step", step);
+                model.WriteState(json);
+                json.EndObject();
+
+                buffer.GetSpan(1)[0] = (byte)'\n';
+                buffer.Advance(1);
+
+                if (buffer.WrittenCount >= FlushThreshold)
+                    Flush();
+            }
+        }
+
+        // Folds each numeric field of a model's state into running statistics. Field paths
+        // are resolved on the first scenario only; later scenarios are matched by position.
+        internal class MetricAccumulator : IStateWriter
+        {
+            private readonly List<string> scope = new List<string>();
+            public readonly List<SimulationMetric> metrics = new List<SimulationMetric>();
+            public int scenarios;
+            private int fieldIndex;
+
+            public void Add(ISimulationModel model)
+            {
+                scenarios++;
+                scope.Clear();
+                fieldIndex = 0;
+                model.WriteState(this);
+            }
+
+            public void BeginObject(string name)
+            {
+                if (name != null) scope.Add(name);
+            }
+
+            public void EndObject()
+            {
+                if (scope.Count > 0) scope.RemoveAt(scope.Count - 1);
+            }
+
+            public void Write(string name, int value) => Sample(name, value);
+            public void Write(string name, long value) => Sample(name, value);
+            public void Write(string name, float value) => Sample(name, value);
+            public void Write(string name, bool value) => Sample(name, value ? 1.0 : 0.0);
+
+            // Strings have no meaningful average
+            public void Write(string name, string value) { }
+
+            public void Write(string name, Vector2Int value)
+            {
+                BeginObject(name);
+                Sample("x", value.x);
+                Sample("y", value.y);
+                EndObject();
+            }
+
+            private void Sample(string name, double value)
+            {
+                if (fieldIndex == metrics.Count)
+                {
+                    string path = scope.Count == 0 ? name : string.Join(".", scope) + "." + name;
+                    metrics.Add(new SimulationMetric(path));
+                }
+
+                metrics[fieldIndex++].Add(value);
+            }
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,126 @@
+using System;
+using System.Collections.Generic;
+
+namespace UnitySim.Core
+{
+    // Running mean/variance (Welford) with min and max; mergeable across worker threads
+    public class SimulationMetric
+    {
+        public readonly string path;
+        public long count;
+        public double mean;
+        public double min = double.PositiveInfinity;
+        public double max = double.NegativeInfinity;
+        private double m2;
+
+        public double Variance => count > 1 ? m2 / (count - 1) : 0.0;
+        public double StdDev => Math.Sqrt(Variance);
+
+        public SimulationMetric(string path)
+        {
+            this.path = path;
+        }
+
+        public void Add(double value)
+        {
+            count++;
+            double delta = value - mean;
+            mean += delta / count;
+            m2 += delta * (value - mean);
+
+            if (value < min) min = value;
+            if (value > max) max = value;
+        }
+
+        public void Merge(SimulationMetric other)
+        {
+            if (other.count == 0) return;
+            if (count == 0)
+            {
+                count = other.count;
+                mean = other.mean;
+                m2 = other.m2;
+                min = other.min;
+                max = other.max;
+                return;
+            }
+
+            long total = count + other.count;
+            double delta = other.mean - mean;
+            mean += delta * other.count / total;
+            m2 += other.m2 + delta * delta * ((double)count * other.count / total);
+            count = total;
+
+            if (other.min < min) min = other.min;
+            if (other.max > max) max = other.max;
+        }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(path);
+            writer.Write("count", count);
+            writer.Write("mean", (float)mean);
+            writer.Write("stdDev", (float)StdDev);
+            writer.Write("min", (float)min);
+            writer.Write("max", (float)max);
+            writer.EndObject();
+        }
+    }
+
+    // Aggregated final-state statistics of a SimulationBatchRunner sweep
+    public class SimulationBatchSummary
+    {
+        private readonly List<SimulationMetric> metrics = new List<SimulationMetric>();
+        private readonly Dictionary<string, SimulationMetric> byPath = new Dictionary<string, SimulationMetric>();
+
+        public int ScenarioCount { get; private set; }
+        public int StepsPerScenario { get; }
+        public uint BaseSeed { get; }
+        public double ElapsedMs { get; internal set; }
+        public IReadOnlyList<SimulationMetric> Metrics => metrics;
+
+        internal SimulationBatchSummary(SimulationBatchSettings settings)
+        {
+            StepsPerScenario = settings.stepsPerScenario;
+            BaseSeed = settings.baseSeed;
+        }
+
+        public SimulationMetric Find(string path)
+        {
+            return byPath.TryGetValue(path, out var metric) ? metric : null;
+        }
+
+        internal void Merge(SimulationBatchRunner.MetricAccumulator accumulator)
+        {
+            var source = accumulator.metrics;
+            for (int i = 0; i < source.Count; i++)
+            {
+                if (!byPath.TryGetValue(source[i].path, out var metric))
+                {
+                    metric = new SimulationMetric(source[i].path);
+                    metrics.Add(metric);
+                    byPath[metric.path] = metric;
+                }
+                metric.Merge(source[i]);
+            }
+
+            ScenarioCount += accumulator.scenarios;
+        }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("scenarios", ScenarioCount);
+            writer.Write("stepsPerScenario", StepsPerScenario);
+            writer.Write("baseSeed", (long)BaseSeed);
+            writer.Write("elapsedMs", (float)ElapsedMs);
+            writer.BeginObject("metrics");
+            for (int i = 0; i < metrics.Count; i++)
+            {
+                metrics[i].WriteState(writer);
+            }
+            writer.EndObject();
+            writer.EndObject();
+        }
+    }
+}
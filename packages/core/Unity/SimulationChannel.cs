@@ -0,0 +1,89 @@
+using System;
+
+namespace UnitySim.Core
+{
+    public enum ChannelMode : byte
+    {
+        Add = 0,
+        Multiply = 1,
+        Set = 2
+    }
+
+    // Blittable description of how one numeric *Info field advances per tick.
+    // Used by the job backend so the step can run in Burst without touching managed data.
+    [Serializable]
+    public struct SimulationChannel
+    {
+        public ChannelMode mode;
+        public bool integer;
+        public bool clampMin;
+        public bool clampMax;
+        public float rangeMin;
+        public float rangeMax;
+        public float lower;
+        public float upper;
+
+        public static SimulationChannel Add(float min, float max) => Create(ChannelMode.Add, min, max, false);
+        public static SimulationChannel AddInt(int min, int max) => Create(ChannelMode.Add, min, max, true);
+        public static SimulationChannel Multiply(float min, float max) => Create(ChannelMode.Multiply, min, max, false);
+        public static SimulationChannel Set(float min, float max) => Create(ChannelMode.Set, min, max, false);
+        public static SimulationChannel SetInt(int min, int max) => Create(ChannelMode.Set, min, max, true);
+
+        public SimulationChannel Clamp(float min, float max)
+        {
+            return WithMin(min).WithMax(max);
+        }
+
+        public SimulationChannel WithMin(float min)
+        {
+            var channel = this;
+            channel.clampMin = true;
+            channel.lower = min;
+            return channel;
+        }
+
+        public SimulationChannel WithMax(float max)
+        {
+            var channel = this;
+            channel.clampMax = true;
+            channel.upper = max;
+            return channel;
+        }
+
+        // Integer ranges are max-exclusive to match UnityEngine.Random.Range(int, int)
+        public double Step(double value, ref Unity.Mathematics.Random random)
+        {
+            double sample = integer
+                ? random.NextInt((int)rangeMin, (int)rangeMax)
+                : random.NextFloat(rangeMin, rangeMax);
+
+            switch (mode)
+            {
+                case ChannelMode.Multiply:
+                    value *= 1.0 + sample;
+                    break;
+                case ChannelMode.Set:
+                    value = sample;
+                    break;
+                default:
+                    value += sample;
+                    break;
+            }
+
+            if (clampMin && value < lower) value = lower;
+            if (clampMax && value > upper) value = upper;
+            return value;
+        }
+
+        private static SimulationChannel Create(ChannelMode mode, float min, float max, bool integer)
+        {
+            return new SimulationChannel
+            {
+                mode = mode,
+                integer = integer,
+                rangeMin = min,
+                rangeMax = max
+            };
+        }
+    }
+}
@@ -0,0 +1,105 @@
+using System;
+
+namespace UnitySim.Core
+{
+    // Authoritative simulation time. Real time is accumulated (scaled by TimeScale) and
+    // consumed in whole FixedStep increments, so simulated time and timestamps depend
+    // only on the number of steps taken, never on frame rate or the wall clock.
+    public class SimulationClock
+    {
+        // Default epoch for deterministic runs: 2024-01-01T00:00:00Z
+        public const long DefaultEpochMs = 1704067200000;
+
+        // Clock of the active SimulationScheduler, if any
+        public static SimulationClock Main { get; internal set; }
+
+        // Current simulation timestamp; falls back to the wall clock when no scheduler exists
+        public static long Now => Main != null ? Main.Timestamp : DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+
+        private float fixedStep = 0.02f;
+        private int maxStepsPerFrame = 8;
+        private float timeScale = 1f;
+        private double accumulator = 0.0;
+        private long stepCount = 0;
+        private long epochMs = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+
+        public float FixedStep => fixedStep;
+        public int MaxStepsPerFrame => maxStepsPerFrame;
+        public bool Paused { get; set; }
+
+        // When set, the scheduler runs every step in full and skips its frame budget
+        public bool Deterministic { get; set; }
+
+        public float TimeScale
+        {
+            get => timeScale;
+            set => timeScale = Math.Max(0f, value);
+        }
+
+        public long StepCount => stepCount;
+        public double SimulatedSeconds => stepCount * (double)fixedStep;
+        public long EpochMs => epochMs;
+        public long Timestamp => epochMs + (long)Math.Round(SimulatedSeconds * 1000.0);
+
+        // Real time dropped because catch-up hit MaxStepsPerFrame
+        public double DroppedSeconds { get; private set; }
+
+        // Fraction of a step left in the accumulator, for render interpolation
+        public float Alpha => (float)(accumulator / fixedStep);
+
+        public void Configure(float step, int maxSteps)
+        {
+            fixedStep = Math.Max(0.0001f, step);
+            maxStepsPerFrame = Math.Max(1, maxSteps);
+        }
+
+        // Restarts simulated time at the given epoch; pass 0 to start from the wall clock
+        public void Reset(long epoch)
+        {
+            epochMs = epoch != 0 ? epoch : DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+            stepCount = 0;
+            accumulator = 0.0;
+            DroppedSeconds = 0.0;
+        }
+
+        // Accumulates a frame of real time and returns how many fixed steps are due
+        public int Accumulate(float realDeltaTime)
+        {
+            if (Paused) return 0;
+
+            accumulator += realDeltaTime * (double)timeScale;
+            int due = (int)Math.Min(accumulator / fixedStep, int.MaxValue);
+            if (due <= maxStepsPerFrame) return due;
+
+            // Drop backlog that could never be caught up instead of spiralling
+            double excess = accumulator - maxStepsPerFrame * (double)fixedStep;
+            DroppedSeconds += excess;
+            accumulator -= excess;
+            return maxStepsPerFrame;
+        }
+
+        // Consumes one step of accumulated time and advances the clock
+        public void Step()
+        {
+            accumulator = Math.Max(0.0, accumulator - fixedStep);
+            stepCount++;
+        }
+
+        // Advances the clock without touching the accumulator (headless runs)
+        public void StepHeadless()
+        {
+            stepCount++;
+        }
+
+        // Jumps whole steps at once, for event-only fast-forward
+        public void Skip(long steps)
+        {
+            stepCount += Math.Max(0L, steps);
+        }
+
+        public long StepsFor(double simulatedSeconds)
+        {
+            return (long)Math.Ceiling(simulatedSeconds / fixedStep - 1e-9);
+        }
+    }
+}
@@ -0,0 +1,266 @@
+using System;
+using System.Collections.Generic;
+
+namespace UnitySim.Core
+{
+    public interface ISimulationEventHandler
+    {
+        // The event goes back to the pool when this returns; copy anything you need to keep
+        void HandleEvent(SimulationEventQueue queue, SimulationEvent e);
+    }
+
+    // A scheduled occurrence. Instances are pooled and reused, so hold a SimulationEventHandle
+    // rather than the event itself.
+    public sealed class SimulationEvent
+    {
+        public double Time { get; internal set; }
+        public ISimulationEventHandler Handler { get; internal set; }
+
+        // Payload, interpreted by the handler
+        public int kind;
+        public int a;
+        public int b;
+        public float value;
+
+        internal long sequence;
+        internal int heapIndex = -1;
+        internal int version = 1;
+    }
+
+    public readonly struct SimulationEventHandle
+    {
+        private readonly SimulationEvent target;
+        private readonly int version;
+
+        internal SimulationEventHandle(SimulationEvent target, int version)
+        {
+            this.target = target;
+            this.version = version;
+        }
+
+        // False once the event has fired or been cancelled
+        public bool IsPending => target != null && target.version == version && target.heapIndex >= 0;
+        public double Time => IsPending ? target.Time : double.NaN;
+
+        internal SimulationEvent Target => IsPending ? target : null;
+    }
+
+    // Discrete-event calendar on simulated seconds. Events sit in a binary min-heap ordered by
+    // time and then by scheduling order, so ties fire first-in first-out and runs are
+    // reproducible. Work is only done when an event fires: advancing with nothing due is a
+    // single comparison against the heap top.
+    public class SimulationEventQueue
+    {
+        private SimulationEvent[] heap = new SimulationEvent[64];
+        private readonly Stack<SimulationEvent> pool = new Stack<SimulationEvent>();
+        private int count = 0;
+        private long nextSequence = 0;
+        private double now = 0.0;
+        private bool dispatching = false;
+
+        public double Now => now;
+        public int Count => count;
+        public int PooledEvents => pool.Count;
+        public long ProcessedEvents { get; private set; }
+
+        // Raised by Rebase with the shift applied, for handlers that keep absolute times
+        public event Action<double> Rebased;
+
+        // Time of the next event, or +infinity when the queue is empty
+        public double NextTime => count > 0 ? heap[0].Time : double.PositiveInfinity;
+
+        #region Scheduling
+
+        public SimulationEventHandle Schedule(double delay, ISimulationEventHandler handler, int kind, int a = 0, int b = 0, float value = 0f)
+        {
+            return ScheduleAt(now + Math.Max(0.0, delay), handler, kind, a, b, value);
+        }
+
+        // Times in the past fire on the next advance, at the current time
+        public SimulationEventHandle ScheduleAt(double time, ISimulationEventHandler handler, int kind, int a = 0, int b = 0, float value = 0f)
+        {
+            if (handler == null) throw new ArgumentNullException(nameof(handler));
+            if (double.IsNaN(time)) throw new ArgumentException("Event time is NaN", nameof(time));
+
+            var e = pool.Count > 0 ? pool.Pop() : new SimulationEvent();
+            e.Time = Math.Max(now, time);
+            e.Handler = handler;
+            e.kind = kind;
+            e.a = a;
+            e.b = b;
+            e.value = value;
+            e.sequence = nextSequence++;
+
+            if (count == heap.Length) Array.Resize(ref heap, count * 2);
+            heap[count] = e;
+            e.heapIndex = count;
+            count++;
+            SiftUp(e.heapIndex);
+
+            return new SimulationEventHandle(e, e.version);
+        }
+
+        public bool Cancel(SimulationEventHandle handle)
+        {
+            var e = handle.Target;
+            if (e == null) return false;
+
+            RemoveAt(e.heapIndex);
+            Recycle(e);
+            return true;
+        }
+
+        // Drops every pending event of a handler, e.g. when its system is reset or disabled
+        public int CancelAll(ISimulationEventHandler handler)
+        {
+            int kept = 0;
+            for (int i = 0; i < count; i++)
+            {
+                var e = heap[i];
+                if (e.Handler == handler)
+                {
+                    e.heapIndex = -1;
+                    Recycle(e);
+                    continue;
+                }
+
+                heap[kept] = e;
+                e.heapIndex = kept;
+                kept++;
+            }
+
+            int removed = count - kept;
+            for (int i = kept; i < count; i++) heap[i] = null;
+            count = kept;
+
+            // Compacting breaks heap order, so rebuild it bottom-up
+            if (removed > 0)
+            {
+                for (int i = (count >> 1) - 1; i >= 0; i--) SiftDown(i);
+            }
+            return removed;
+        }
+
+        #endregion
+
+        #region Dispatch
+
+        // Fires every event due at or before time in order, with Now set to each event's time,
+        // and returns how many fired. Handlers may schedule and cancel freely.
+        public int AdvanceTo(double time)
+        {
+            if (dispatching) throw new InvalidOperationException("SimulationEventQueue: AdvanceTo called from an event handler");
+
+            int fired = 0;
+            dispatching = true;
+            try
+            {
+                while (count > 0 && heap[0].Time <= time)
+                {
+                    var e = heap[0];
+                    RemoveAt(0);
+                    now = e.Time;
+
+                    e.Handler.HandleEvent(this, e);
+                    Recycle(e);
+                    fired++;
+                }
+            }
+            finally
+            {
+                dispatching = false;
+            }
+
+            if (time > now) now = time;
+            ProcessedEvents += fired;
+            return fired;
+        }
+
+        // Moves the calendar to a new origin, keeping each pending event's delay from Now
+        public void Rebase(double time)
+        {
+            double shift = time - now;
+            for (int i = 0; i < count; i++)
+            {
+                heap[i].Time += shift;
+            }
+            now = time;
+
+            if (shift != 0.0) Rebased?.Invoke(shift);
+        }
+
+        #endregion
+
+        #region Heap
+
+        private bool Before(SimulationEvent x, SimulationEvent y)
+        {
+            return x.Time < y.Time || (x.Time == y.Time && x.sequence < y.sequence);
+        }
+
+        private void RemoveAt(int index)
+        {
+            var removed = heap[index];
+            count--;
+
+            if (index != count)
+            {
+                var last = heap[count];
+                heap[index] = last;
+                last.heapIndex = index;
+
+                if (index > 0 && Before(last, heap[(index - 1) >> 1]))
+                    SiftUp(index);
+                else
+                    SiftDown(index);
+            }
+
+            heap[count] = null;
+            removed.heapIndex = -1;
+        }
+
+        private void SiftUp(int index)
+        {
+            var e = heap[index];
+            while (index > 0)
+            {
+                int parent = (index - 1) >> 1;
+                if (!Before(e, heap[parent])) break;
+
+                heap[index] = heap[parent];
+                heap[index].heapIndex = index;
+                index = parent;
+            }
+            heap[index] = e;
+            e.heapIndex = index;
+        }
+
+        private void SiftDown(int index)
+        {
+            var e = heap[index];
+            while (true)
+            {
+                int child = index * 2 + 1;
+                if (child >= count) break;
+                if (child + 1 < count && Before(heap[child + 1], heap[child])) child++;
+                if (!Before(heap[child], e)) break;
+
+                heap[index] = heap[child];
+                heap[index].heapIndex = index;
+                index = child;
+            }
+            heap[index] = e;
+            e.heapIndex = index;
+        }
+
+        private void Recycle(SimulationEvent e)
+        {
+            // A bumped version invalidates any handle still pointing at this instance
+            e.version++;
+            e.Handler = null;
+            pool.Push(e);
+        }
+
+        #endregion
+    }
+}
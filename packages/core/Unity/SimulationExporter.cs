@@ -0,0 +1,459 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.IO.Compression;
+using System.Text;
+using System.Threading;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.Core
+{
+    public enum ExportBackpressure
+    {
+        Skip,           // refuse new exports while every buffer is busy
+        ReplacePending  // the newest snapshot takes over the oldest one not yet being written
+    }
+
+    public readonly struct SimulationExportResult
+    {
+        public readonly string path;
+        public readonly long bytes;
+        public readonly float milliseconds;
+        public readonly bool dropped;
+        public readonly string error;
+
+        public bool Succeeded => !dropped && error == null;
+
+        public SimulationExportResult(string path, long bytes, float milliseconds, bool dropped, string error)
+        {
+            this.path = path;
+            this.bytes = bytes;
+            this.milliseconds = milliseconds;
+            this.dropped = dropped;
+            this.error = error;
+        }
+    }
+
+    // Writes export files without blocking the main thread. Snapshots are taken on the main
+    // thread into a SimulationStateTape, which costs one append per field, and a background
+    // thread turns them into JSON, optionally gzips them and writes the file. Each of the
+    // fixed number of buffers is either free, queued or being written, so memory stays
+    // bounded; when all are busy the backpressure mode decides what happens to new exports.
+    // Results are raised from Poll on the main thread.
+    public class SimulationExporter : IDisposable
+    {
+        private class Slot
+        {
+            public readonly SimulationStateTape tape = new SimulationStateTape();
+            public Func<string> serialize;
+            public string path;
+            public bool compress;
+            public bool indent;
+            public bool queued;
+            public bool writing;
+        }
+
+        private readonly Slot[] slots;
+        private readonly List<Slot> queue = new List<Slot>();
+        private readonly Queue<SimulationExportResult> results = new Queue<SimulationExportResult>();
+        private readonly object gate = new object();
+        private readonly Thread worker;
+        private bool disposing = false;
+
+        // Worker-only state
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private readonly PooledBufferWriter compact = new PooledBufferWriter(64 * 1024);
+        private readonly PooledBufferWriter indented = new PooledBufferWriter(64 * 1024);
+
+        public bool indent = true;
+        public ExportBackpressure backpressure = ExportBackpressure.Skip;
+
+        public event Action<SimulationExportResult> ExportCompleted;
+
+        public int BufferCount => slots.Length;
+        public long Completed { get; private set; }
+        public long Failed { get; private set; }
+        public long Dropped { get; private set; }
+
+        public int Pending
+        {
+            get { lock (gate) return queue.Count; }
+        }
+
+        public SimulationExporter(int bufferCount = 2)
+        {
+            slots = new Slot[Math.Max(1, bufferCount)];
+            for (int i = 0; i < slots.Length; i++) slots[i] = new Slot();
+
+            worker = new Thread(Run) { IsBackground = true, Name = "SimulationExporter" };
+            worker.Start();
+        }
+
+        #region Export
+
+        // Writes {"<name>": {...}, ...} for the given sources. Returns false when dropped by backpressure.
+        public bool TryExport(string path, IReadOnlyList<IStateSource> sources, bool compress = false)
+        {
+            var tape = Begin(path, compress);
+            if (tape == null) return false;
+
+            try
+            {
+                tape.BeginObject(null);
+                for (int i = 0; i < sources.Count; i++)
+                {
+                    if (sources[i] != null) tape.WriteSource(sources[i].SystemName, sources[i]);
+                }
+                tape.EndObject();
+            }
+            catch
+            {
+                Abort(tape);
+                throw;
+            }
+
+            Submit(tape);
+            return true;
+        }
+
+        // For payloads that aren't IStateSources. serialize runs on the worker thread, so it must
+        // only read a snapshot the caller won't touch again.
+        public bool TryExport(string path, Func<string> serialize, bool compress = false)
+        {
+            if (serialize == null) throw new ArgumentNullException(nameof(serialize));
+
+            lock (gate)
+            {
+                var slot = Acquire(path, compress);
+                if (slot == null) return false;
+
+                slot.serialize = serialize;
+                Enqueue(slot);
+            }
+            return true;
+        }
+
+        // Returns a cleared tape to record one root object into, then pass to Submit; null when
+        // dropped by backpressure. The buffer stays reserved until the tape is submitted or aborted.
+        public SimulationStateTape Begin(string path, bool compress = false)
+        {
+            lock (gate)
+            {
+                return Acquire(path, compress)?.tape;
+            }
+        }
+
+        public void Submit(SimulationStateTape tape)
+        {
+            lock (gate)
+            {
+                Enqueue(Reserved(tape));
+            }
+        }
+
+        // Releases a tape from Begin without writing it, e.g. when recording threw
+        public void Abort(SimulationStateTape tape)
+        {
+            lock (gate)
+            {
+                var slot = Reserved(tape);
+                slot.path = null;
+                slot.tape.Clear();
+            }
+        }
+
+        // Raises ExportCompleted for finished exports; call from the main thread
+        public void Poll()
+        {
+            while (true)
+            {
+                SimulationExportResult result;
+                lock (gate)
+                {
+                    if (results.Count == 0) return;
+                    result = results.Dequeue();
+                }
+
+                if (result.dropped) Dropped++;
+                else if (result.error != null) Failed++;
+                else Completed++;
+
+                if (result.error != null)
+                    Debug.LogError($"SimulationExporter: Export to {result.path} failed - {result.error}");
+
+                ExportCompleted?.Invoke(result);
+            }
+        }
+
+        // Blocks until every queued export is written, e.g. before quitting
+        public bool Flush(int timeoutMs = 5000)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            lock (gate)
+            {
+                while (queue.Count > 0 || IsWriting())
+                {
+                    int remaining = timeoutMs - (int)stopwatch.ElapsedMilliseconds;
+                    if (remaining <= 0) return false;
+                    Monitor.Wait(gate, remaining);
+                }
+            }
+            Poll();
+            return true;
+        }
+
+        public void Dispose()
+        {
+            lock (gate)
+            {
+                if (disposing) return;
+                disposing = true;
+                Monitor.PulseAll(gate);
+            }
+
+            // Queued exports are still written before the worker exits
+            worker.Join();
+            Poll();
+        }
+
+        #endregion
+
+        #region Buffers
+
+        // Caller holds the gate
+        private Slot Acquire(string path, bool compress)
+        {
+            if (disposing) throw new ObjectDisposedException(nameof(SimulationExporter));
+
+            Slot slot = null;
+            for (int i = 0; i < slots.Length; i++)
+            {
+                if (!slots[i].queued && !slots[i].writing && slots[i].path == null)
+                {
+                    slot = slots[i];
+                    break;
+                }
+            }
+
+            if (slot == null)
+            {
+                if (backpressure == ExportBackpressure.Skip || queue.Count == 0)
+                {
+                    results.Enqueue(new SimulationExportResult(path, 0, 0f, true, null));
+                    return null;
+                }
+
+                // Take back the oldest queued snapshot; its export is reported as dropped
+                slot = queue[0];
+                queue.RemoveAt(0);
+                slot.queued = false;
+                results.Enqueue(new SimulationExportResult(slot.path, 0, 0f, true, null));
+            }
+
+            slot.tape.Clear();
+            slot.serialize = null;
+            slot.path = path;
+            slot.compress = compress;
+            slot.indent = indent;
+            return slot;
+        }
+
+        // Caller holds the gate
+        private Slot Reserved(SimulationStateTape tape)
+        {
+            for (int i = 0; i < slots.Length; i++)
+            {
+                if (slots[i].tape != tape) continue;
+                if (slots[i].path == null || slots[i].queued || slots[i].writing)
+                    throw new InvalidOperationException("SimulationExporter: Tape was not started with Begin");
+                return slots[i];
+            }
+            throw new ArgumentException("SimulationExporter: Tape does not belong to this exporter", nameof(tape));
+        }
+
+        // Caller holds the gate
+        private void Enqueue(Slot slot)
+        {
+            slot.queued = true;
+            queue.Add(slot);
+            Monitor.PulseAll(gate);
+        }
+
+        private bool IsWriting()
+        {
+            for (int i = 0; i < slots.Length; i++)
+            {
+                if (slots[i].writing) return true;
+            }
+            return false;
+        }
+
+        #endregion
+
+        #region Worker
+
+        private void Run()
+        {
+            while (true)
+            {
+                Slot slot;
+                lock (gate)
+                {
+                    while (queue.Count == 0 && !disposing) Monitor.Wait(gate);
+                    if (queue.Count == 0) return;
+
+                    slot = queue[0];
+                    queue.RemoveAt(0);
+                    slot.queued = false;
+                    slot.writing = true;
+                }
+
+                var result = Write(slot);
+
+                lock (gate)
+                {
+                    slot.writing = false;
+                    slot.path = null;
+                    slot.serialize = null;
+                    slot.tape.Clear();
+                    results.Enqueue(result);
+                    Monitor.PulseAll(gate);
+                }
+            }
+        }
+
+        private SimulationExportResult Write(Slot slot)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            string path = slot.compress && !slot.path.EndsWith(".gz", StringComparison.OrdinalIgnoreCase) ? slot.path + ".gz" : slot.path;
+
+            try
+            {
+                ArraySegment<byte> bytes;
+                if (slot.serialize != null)
+                {
+                    bytes = new ArraySegment<byte>(Encoding.UTF8.GetBytes(slot.serialize()));
+                }
+                else
+                {
+                    compact.Clear();
+                    jsonWriter.Reset(compact);
+                    slot.tape.Replay(jsonWriter);
+                    bytes = compact.WrittenSegment;
+
+                    if (slot.indent)
+                    {
+                        indented.Clear();
+                        Indent(compact.WrittenSpan, indented);
+                        bytes = indented.WrittenSegment;
+                    }
+                }
+
+                // Written beside the target and moved over it, so readers never see a partial file
+                string directory = Path.GetDirectoryName(path);
+                if (!string.IsNullOrEmpty(directory)) Directory.CreateDirectory(directory);
+                string temporary = path + ".tmp";
+
+                using (var file = new FileStream(temporary, FileMode.Create, FileAccess.Write, FileShare.None, 1 << 16))
+                {
+                    if (slot.compress)
+                    {
+                        using (var gzip = new GZipStream(file, CompressionLevel.Fastest, true))
+                            gzip.Write(bytes.Array, bytes.Offset, bytes.Count);
+                    }
+                    else
+                    {
+                        file.Write(bytes.Array, bytes.Offset, bytes.Count);
+                    }
+                }
+
+                if (File.Exists(path)) File.Delete(path);
+                File.Move(temporary, path);
+
+                return new SimulationExportResult(path, bytes.Count, (float)stopwatch.Elapsed.TotalMilliseconds, false, null);
+            }
+            catch (Exception e)
+            {
+                return new SimulationExportResult(path, 0, (float)stopwatch.Elapsed.TotalMilliseconds, false, e.Message);
+            }
+        }
+
+        // Re-indents compact JSON two spaces per level, leaving string contents untouched
+        private static void Indent(ReadOnlySpan<byte> json, PooledBufferWriter output)
+        {
+            int depth = 0;
+            bool inString = false;
+            bool escaped = false;
+
+            for (int i = 0; i < json.Length; i++)
+            {
+                byte c = json[i];
+                if (inString)
+                {
+                    Put(output, c);
+                    if (escaped) escaped = false;
+                    else if (c == '\\') escaped = true;
+                    else if (c == '"') inString = false;
+                    continue;
+                }
+
+                switch (c)
+                {
+                    case (byte)'"':
+                        inString = true;
+                        Put(output, c);
+                        break;
+
+                    case (byte)'{':
+                    case (byte)'[':
+                        Put(output, c);
+                        // Empty containers stay on one line
+                        if (i + 1 < json.Length && (json[i + 1] == '}' || json[i + 1] == ']'))
+                        {
+                            Put(output, json[++i]);
+                            break;
+                        }
+                        NewLine(output, ++depth);
+                        break;
+
+                    case (byte)'}':
+                    case (byte)']':
+                        NewLine(output, --depth);
+                        Put(output, c);
+                        break;
+
+                    case (byte)',':
+                        Put(output, c);
+                        NewLine(output, depth);
+                        break;
+
+                    case (byte)':':
+                        Put(output, c);
+                        Put(output, (byte)' ');
+                        break;
+
+                    default:
+                        Put(output, c);
+                        break;
+                }
+            }
+        }
+
+        private static void NewLine(PooledBufferWriter output, int depth)
+        {
+            var span = output.GetSpan(1 + depth * 2);
+            span[0] = (byte)'\n';
+            span.Slice(1, depth * 2).Fill((byte)' ');
+            output.Advance(1 + depth * 2);
+        }
+
+        private static void Put(PooledBufferWriter output, byte c)
+        {
+            output.GetSpan(1)[0] = c;
+            output.Advance(1);
+        }
+
+        #endregion
+    }
+}
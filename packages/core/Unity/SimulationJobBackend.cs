@@ -0,0 +1,357 @@
+using System;
+using System.Collections.Generic;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+
+namespace UnitySim.Core
+{
+    // Holds the channel state of every job-capable system in flat NativeArrays and
+    // advances it in a single Burst IJobParallelFor. Managed *Data objects only see
+    // the results when their system publishes.
+    public class SimulationJobBackend : IDisposable
+    {
+        private class Slot
+        {
+            public IJobSimulatedSystem system;
+            public int start;
+            public int count;
+            public int version;
+            public bool queued;
+            public bool publish;
+            public long timestamp;
+            public SimulationChannel[] channels;
+        }
+
+        [BurstCompile]
+        private struct ChannelStepJob : IJobParallelFor
+        {
+            public NativeArray<double> values;
+            public NativeArray<Unity.Mathematics.Random> random;
+            [ReadOnly] public NativeArray<SimulationChannel> channels;
+            [ReadOnly] public NativeArray<int> steps;
+
+            public void Execute(int index)
+            {
+                int stepCount = steps[index];
+                if (stepCount == 0) return;
+
+                var channel = channels[index];
+                var rng = random[index];
+                double value = values[index];
+
+                for (int i = 0; i < stepCount; i++)
+                {
+                    value = channel.Step(value, ref rng);
+                }
+
+                values[index] = value;
+                random[index] = rng;
+            }
+        }
+
+        private const int InnerBatchCount = 16;
+
+        private readonly List<Slot> slots = new List<Slot>();
+        private readonly Dictionary<IJobSimulatedSystem, Slot> lookup = new Dictionary<IJobSimulatedSystem, Slot>();
+        private readonly List<SimulationChannel> channelScratch = new List<SimulationChannel>();
+        private readonly List<IJobSimulatedSystem> publishScratch = new List<IJobSimulatedSystem>();
+        private double[] valueScratch = new double[16];
+
+        private NativeArray<double> values;
+        private NativeArray<Unity.Mathematics.Random> random;
+        private NativeArray<SimulationChannel> channels;
+        private NativeArray<int> steps;
+        private int channelCount = 0;
+        private bool layoutDirty = false;
+        private bool anyQueued = false;
+        private bool anyPublish = false;
+
+        private JobHandle handle;
+        private bool jobScheduled = false;
+        private readonly uint baseSeed;
+
+        public int SystemCount => slots.Count;
+        public int ChannelCount => channelCount;
+        public bool IsJobInFlight => jobScheduled;
+        public bool HasPendingPublish => anyPublish;
+
+        public SimulationJobBackend(uint seed = 1)
+        {
+            baseSeed = seed;
+        }
+
+        #region Queueing
+
+        public bool Contains(IJobSimulatedSystem system)
+        {
+            return lookup.ContainsKey(system);
+        }
+
+        public void QueueSteps(IJobSimulatedSystem system, int stepCount, bool publish, long timestamp)
+        {
+            EnsureCompleted();
+
+            var slot = GetOrCreateSlot(system);
+            if (layoutDirty) RebuildLayout();
+
+            if (slot.version != system.StateVersion)
+                ReloadSlot(slot);
+
+            for (int i = 0; i < slot.count; i++)
+            {
+                steps[slot.start + i] += stepCount;
+            }
+
+            slot.queued = true;
+            anyQueued = true;
+
+            if (publish)
+            {
+                slot.publish = true;
+                slot.timestamp = timestamp;
+                anyPublish = true;
+            }
+        }
+
+        public void Remove(IJobSimulatedSystem system)
+        {
+            if (!lookup.TryGetValue(system, out var slot)) return;
+
+            EnsureCompleted();
+            SyncSlot(slot);
+            slots.Remove(slot);
+            lookup.Remove(system);
+            layoutDirty = true;
+        }
+
+        #endregion
+
+        #region Execution
+
+        public void Schedule()
+        {
+            if (!anyQueued || jobScheduled) return;
+
+            var job = new ChannelStepJob
+            {
+                values = values,
+                random = random,
+                channels = channels,
+                steps = steps
+            };
+
+            handle = job.Schedule(channelCount, InnerBatchCount);
+            jobScheduled = true;
+            JobHandle.ScheduleBatchedJobs();
+        }
+
+        // Completes the job, hands results back to publishing systems and returns them in order
+        public List<IJobSimulatedSystem> CompleteAndPublish()
+        {
+            publishScratch.Clear();
+            EnsureCompleted();
+
+            if (!anyQueued) return publishScratch;
+
+            for (int s = 0; s < slots.Count; s++)
+            {
+                var slot = slots[s];
+                if (!slot.queued) continue;
+
+                for (int i = 0; i < slot.count; i++)
+                {
+                    steps[slot.start + i] = 0;
+                }
+                slot.queued = false;
+
+                if (!slot.publish) continue;
+                slot.publish = false;
+
+                // A reset landed while the job was running; keep the fresh managed data instead
+                if (slot.version != slot.system.StateVersion)
+                {
+                    ReloadSlot(slot);
+                }
+                else
+                {
+                    CopyOut(slot);
+                    slot.system.ReadChannels(valueScratch, slot.timestamp);
+                }
+
+                publishScratch.Add(slot.system);
+            }
+
+            anyQueued = false;
+            anyPublish = false;
+            return publishScratch;
+        }
+
+        // Hands the latest job state back to every managed *Data object without publishing
+        public void SyncAll()
+        {
+            EnsureCompleted();
+            for (int s = 0; s < slots.Count; s++)
+            {
+                SyncSlot(slots[s]);
+            }
+        }
+
+        public void Dispose()
+        {
+            EnsureCompleted();
+            DisposeArrays();
+            slots.Clear();
+            lookup.Clear();
+            channelCount = 0;
+        }
+
+        private void EnsureCompleted()
+        {
+            if (!jobScheduled) return;
+
+            handle.Complete();
+            jobScheduled = false;
+        }
+
+        #endregion
+
+        #region Layout
+
+        private Slot GetOrCreateSlot(IJobSimulatedSystem system)
+        {
+            if (lookup.TryGetValue(system, out var slot)) return slot;
+
+            channelScratch.Clear();
+            system.DescribeChannels(channelScratch);
+
+            slot = new Slot
+            {
+                system = system,
+                count = channelScratch.Count,
+                version = int.MinValue,
+                channels = channelScratch.ToArray()
+            };
+
+            slots.Add(slot);
+            lookup[system] = slot;
+            layoutDirty = true;
+            return slot;
+        }
+
+        private void RebuildLayout()
+        {
+            int total = 0;
+            for (int s = 0; s < slots.Count; s++)
+            {
+                total += slots[s].count;
+            }
+
+            var newValues = new NativeArray<double>(Math.Max(1, total), Allocator.Persistent);
+            var newRandom = new NativeArray<Unity.Mathematics.Random>(Math.Max(1, total), Allocator.Persistent);
+            var newChannels = new NativeArray<SimulationChannel>(Math.Max(1, total), Allocator.Persistent);
+            var newSteps = new NativeArray<int>(Math.Max(1, total), Allocator.Persistent);
+
+            int offset = 0;
+            for (int s = 0; s < slots.Count; s++)
+            {
+                var slot = slots[s];
+                bool existing = slot.version != int.MinValue;
+
+                for (int i = 0; i < slot.count; i++)
+                {
+                    newChannels[offset + i] = slot.channels[i];
+
+                    if (existing)
+                    {
+                        // Carry job-advanced state across the rebuild
+                        newValues[offset + i] = values[slot.start + i];
+                        newRandom[offset + i] = random[slot.start + i];
+                        newSteps[offset + i] = steps[slot.start + i];
+                    }
+                    else
+                    {
+                        newRandom[offset + i] = new Unity.Mathematics.Random(SeedFor(slot.system.SystemName, i));
+                    }
+                }
+
+                slot.start = offset;
+                offset += slot.count;
+            }
+
+            DisposeArrays();
+            values = newValues;
+            random = newRandom;
+            channels = newChannels;
+            steps = newSteps;
+            channelCount = total;
+            layoutDirty = false;
+
+            for (int s = 0; s < slots.Count; s++)
+            {
+                if (slots[s].version == int.MinValue)
+                    ReloadSlot(slots[s]);
+            }
+        }
+
+        private void SyncSlot(Slot slot)
+        {
+            // Slots that were never loaded or were reset have nothing newer than the managed data
+            if (slot.version != slot.system.StateVersion) return;
+
+            CopyOut(slot);
+            slot.system.ReadChannels(valueScratch, SimulationClock.Now);
+        }
+
+        private void ReloadSlot(Slot slot)
+        {
+            EnsureScratch(slot.count);
+            slot.system.WriteChannels(valueScratch);
+
+            for (int i = 0; i < slot.count; i++)
+            {
+                values[slot.start + i] = valueScratch[i];
+            }
+
+            slot.version = slot.system.StateVersion;
+        }
+
+        private void CopyOut(Slot slot)
+        {
+            EnsureScratch(slot.count);
+            for (int i = 0; i < slot.count; i++)
+            {
+                valueScratch[i] = values[slot.start + i];
+            }
+        }
+
+        private void EnsureScratch(int count)
+        {
+            if (valueScratch.Length < count)
+                valueScratch = new double[Math.Max(count, valueScratch.Length * 2)];
+        }
+
+        private uint SeedFor(string systemName, int channelIndex)
+        {
+            // FNV-1a so seeds are stable across runtimes, unlike string.GetHashCode
+            uint hash = 2166136261u;
+            for (int i = 0; i < systemName.Length; i++)
+            {
+                hash = (hash ^ systemName[i]) * 16777619u;
+            }
+
+            uint seed = hash ^ (baseSeed * 0x9E3779B9u) ^ ((uint)channelIndex * 0x85EBCA6Bu);
+            return seed == 0 ? 1u : seed;
+        }
+
+        private void DisposeArrays()
+        {
+            if (values.IsCreated) values.Dispose();
+            if (random.IsCreated) random.Dispose();
+            if (channels.IsCreated) channels.Dispose();
+            if (steps.IsCreated) steps.Dispose();
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,239 @@
+using System;
+using System.Buffers;
+using System.Buffers.Text;
+using System.Globalization;
+using System.Text;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Compact UTF-8 JSON writer over an IBufferWriter<byte>. Writes straight into the
+    // output buffer with no intermediate strings, so it is reusable and allocation-free.
+    public class SimulationJsonWriter : IStateWriter
+    {
+        private const int MaxDepth = 32;
+        private const int NumberBufferSize = 32;
+
+        private IBufferWriter<byte> output;
+        private readonly bool[] hasValue = new bool[MaxDepth];
+        private int depth = 0;
+
+        public SimulationJsonWriter() { }
+
+        public SimulationJsonWriter(IBufferWriter<byte> output)
+        {
+            Reset(output);
+        }
+
+        public void Reset(IBufferWriter<byte> output)
+        {
+            this.output = output ?? throw new ArgumentNullException(nameof(output));
+            depth = 0;
+            hasValue[0] = false;
+        }
+
+        #region IStateWriter
+
+        public void BeginObject(string name)
+        {
+            if (depth >= MaxDepth - 1)
+                throw new InvalidOperationException("SimulationJsonWriter: Maximum depth exceeded");
+
+            WritePropertyPrefix(name);
+            WriteByte((byte)'{');
+            depth++;
+            hasValue[depth] = false;
+        }
+
+        public void EndObject()
+        {
+            if (depth == 0)
+                throw new InvalidOperationException("SimulationJsonWriter: EndObject without BeginObject");
+
+            depth--;
+            WriteByte((byte)'}');
+        }
+
+        public void Write(string name, int value)
+        {
+            WritePropertyPrefix(name);
+            var span = output.GetSpan(NumberBufferSize);
+            Utf8Formatter.TryFormat(value, span, out int bytesWritten);
+            output.Advance(bytesWritten);
+        }
+
+        public void Write(string name, long value)
+        {
+            WritePropertyPrefix(name);
+            var span = output.GetSpan(NumberBufferSize);
+            Utf8Formatter.TryFormat(value, span, out int bytesWritten);
+            output.Advance(bytesWritten);
+        }
+
+        public void Write(string name, float value)
+        {
+            WritePropertyPrefix(name);
+
+            // Matches Newtonsoft's default handling of non-finite floats
+            if (float.IsNaN(value) || float.IsInfinity(value))
+            {
+                WriteQuotedAscii(float.IsNaN(value) ? "NaN" : value > 0 ? "Infinity" : "-Infinity");
+                return;
+            }
+
+            Span<char> chars = stackalloc char[NumberBufferSize];
+            value.TryFormat(chars, out int charCount, "R", CultureInfo.InvariantCulture);
+
+            var span = output.GetSpan(charCount + 2);
+            bool isIntegral = true;
+            for (int i = 0; i < charCount; i++)
+            {
+                char c = chars[i];
+                if (c == '.' || c == 'E' || c == 'e') isIntegral = false;
+                span[i] = (byte)c;
+            }
+
+            // Keep a fractional part so readers still see a float, as Newtonsoft does
+            if (isIntegral)
+            {
+                span[charCount++] = (byte)'.';
+                span[charCount++] = (byte)'0';
+            }
+
+            output.Advance(charCount);
+        }
+
+        public void Write(string name, bool value)
+        {
+            WritePropertyPrefix(name);
+            WriteAscii(value ? "true" : "false");
+        }
+
+        public void Write(string name, string value)
+        {
+            WritePropertyPrefix(name);
+
+            if (value == null)
+            {
+                WriteAscii("null");
+                return;
+            }
+
+            WriteEscapedString(value);
+        }
+
+        public void Write(string name, Vector2Int value)
+        {
+            BeginObject(name);
+            Write("x", value.x);
+            Write("y", value.y);
+            EndObject();
+        }
+
+        #endregion
+
+        #region Encoding
+
+        private void WritePropertyPrefix(string name)
+        {
+            if (hasValue[depth])
+                WriteByte((byte)',');
+            hasValue[depth] = true;
+
+            if (name == null) return;
+
+            WriteEscapedString(name);
+            WriteByte((byte)':');
+        }
+
+        private void WriteByte(byte value)
+        {
+            var span = output.GetSpan(1);
+            span[0] = value;
+            output.Advance(1);
+        }
+
+        private void WriteAscii(string value)
+        {
+            var span = output.GetSpan(value.Length);
+            for (int i = 0; i < value.Length; i++)
+            {
+                span[i] = (byte)value[i];
+            }
+            output.Advance(value.Length);
+        }
+
+        private void WriteQuotedAscii(string value)
+        {
+            WriteByte((byte)'"');
+            WriteAscii(value);
+            WriteByte((byte)'"');
+        }
+
+        private void WriteEscapedString(string value)
+        {
+            WriteByte((byte)'"');
+
+            int index = 0;
+            while (index < value.Length)
+            {
+                char c = value[index];
+
+                if (c >= 0x80)
+                {
+                    // Encode the whole non-ASCII run at once so surrogate pairs stay together
+                    int end = index + 1;
+                    while (end < value.Length && value[end] >= 0x80) end++;
+
+                    var run = value.AsSpan(index, end - index);
+                    var span = output.GetSpan(Encoding.UTF8.GetMaxByteCount(run.Length));
+                    int bytes = Encoding.UTF8.GetBytes(run, span);
+                    output.Advance(bytes);
+                    index = end;
+                    continue;
+                }
+
+                WriteEscapedAscii(c);
+                index++;
+            }
+
+            WriteByte((byte)'"');
+        }
+
+        private void WriteEscapedAscii(char c)
+        {
+            switch (c)
+            {
+                case '"': WriteAscii("\\\""); return;
+                case '\\': WriteAscii("\\\\"); return;
+                case '\n': WriteAscii("\\n"); return;
+                case '\r': WriteAscii("\\r"); return;
+                case '\t': WriteAscii("\\t"); return;
+                case '\b': WriteAscii("\\b"); return;
+                case '\f': WriteAscii("\\f"); return;
+            }
+
+            if (c < 0x20)
+            {
+                var span = output.GetSpan(6);
+                span[0] = (byte)'\\';
+                span[1] = (byte)'u';
+                span[2] = (byte)'0';
+                span[3] = (byte)'0';
+                span[4] = HexDigit(c >> 4);
+                span[5] = HexDigit(c & 0xF);
+                output.Advance(6);
+                return;
+            }
+
+            WriteByte((byte)c);
+        }
+
+        private static byte HexDigit(int value)
+        {
+            return (byte)(value < 10 ? '0' + value : 'a' + value - 10);
+        }
+
+        #endregion
+    }
+}
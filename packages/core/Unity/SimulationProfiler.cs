@@ -0,0 +1,142 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using Unity.Profiling;
+
+namespace UnitySim.Core
+{
+    // Time one system spent in one frame's tick pass
+    public readonly struct SystemFrameSample
+    {
+        public readonly int frame;
+        public readonly int system;
+        public readonly float milliseconds;
+
+        public SystemFrameSample(int frame, int system, float milliseconds)
+        {
+            this.frame = frame;
+            this.system = system;
+            this.milliseconds = milliseconds;
+        }
+    }
+
+    public struct SystemCost
+    {
+        public int system;
+        public string name;
+        public float totalMs;
+        public float maxMs;
+        public int frames;
+    }
+
+    // Per-system update cost, owned by the scheduler. Each registered system gets a
+    // ProfilerMarker, "UnitySim.<SystemName>.Update", so the Unity Profiler shows it by name.
+    // Every tick is also written into a lock-free history, so tools on other threads can
+    // see which systems are eating the frame.
+    public class SimulationProfiler
+    {
+        private static readonly double TicksToMs = 1000.0 / Stopwatch.Frequency;
+
+        private readonly List<string> names = new List<string>();
+        private readonly List<ProfilerMarker> markers = new List<ProfilerMarker>();
+        private readonly Dictionary<string, int> ids = new Dictionary<string, int>();
+        private readonly SimulationRingBuffer<SystemFrameSample> history;
+
+        private float[] lastFrameMs = new float[0];
+        private float[] averageMs = new float[0];
+        private int[] lastFrameSeen = new int[0];
+        private SystemFrameSample[] scratch = new SystemFrameSample[0];
+        private int[] scratchFrame = new int[0];
+        private int frame = 0;
+
+        public int SystemCount => names.Count;
+        public int Frame => frame;
+        public SimulationRingBuffer<SystemFrameSample> History => history;
+
+        public SimulationProfiler(int historyCapacity = 8192)
+        {
+            history = new SimulationRingBuffer<SystemFrameSample>(historyCapacity);
+        }
+
+        // Ids are stable per name, so a system that is disabled and enabled again keeps its history
+        public int Register(string systemName)
+        {
+            if (ids.TryGetValue(systemName, out int id)) return id;
+
+            id = names.Count;
+            names.Add(systemName);
+            markers.Add(new ProfilerMarker($"UnitySim.{systemName}.Update"));
+            ids[systemName] = id;
+
+            Array.Resize(ref lastFrameMs, names.Count);
+            Array.Resize(ref averageMs, names.Count);
+            Array.Resize(ref lastFrameSeen, names.Count);
+            lastFrameSeen[id] = -1;
+            return id;
+        }
+
+        public string GetName(int system) => names[system];
+        public ProfilerMarker GetMarker(int system) => markers[system];
+
+        // Cost in the most recent frame the system ticked, and its smoothed cost per ticking frame
+        public float GetLastFrameMs(int system) => lastFrameMs[system];
+        public float GetAverageMs(int system) => averageMs[system];
+
+        public void BeginFrame()
+        {
+            frame++;
+        }
+
+        public void Record(int system, long elapsedTicks)
+        {
+            float ms = (float)(elapsedTicks * TicksToMs);
+
+            // Several ticks in one frame (catch-up) add up to one sample for that frame
+            if (lastFrameSeen[system] == frame)
+            {
+                lastFrameMs[system] += ms;
+            }
+            else
+            {
+                lastFrameMs[system] = ms;
+                lastFrameSeen[system] = frame;
+            }
+
+            averageMs[system] += (ms - averageMs[system]) * 0.05f;
+            history.Add(new SystemFrameSample(frame, system, ms));
+        }
+
+        // Sums the history over the last frames and fills results heaviest first
+        public void GetHeaviest(int frames, List<SystemCost> results)
+        {
+            results.Clear();
+            if (scratch.Length != history.Capacity) scratch = new SystemFrameSample[history.Capacity];
+
+            int count = history.CopyLatest(scratch);
+            int oldest = frame - Math.Max(1, frames) + 1;
+
+            if (scratchFrame.Length < names.Count) scratchFrame = new int[names.Count];
+            for (int i = 0; i < names.Count; i++)
+            {
+                results.Add(new SystemCost { system = i, name = names[i] });
+                scratchFrame[i] = int.MinValue;
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                var sample = scratch[i];
+                if (sample.frame < oldest) continue;
+
+                var cost = results[sample.system];
+                cost.totalMs += sample.milliseconds;
+                cost.maxMs = Math.Max(cost.maxMs, sample.milliseconds);
+                if (sample.frame != scratchFrame[sample.system]) cost.frames++;
+                results[sample.system] = cost;
+                scratchFrame[sample.system] = sample.frame;
+            }
+
+            results.RemoveAll(cost => cost.totalMs <= 0f);
+            results.Sort((a, b) => b.totalMs.CompareTo(a.totalMs));
+        }
+    }
+}
@@ -0,0 +1,124 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Systems register themselves on enable and unregister on disable. Lookups by
+    // concrete type or SystemName are dictionary hits; iteration is over a flat list.
+    public static class SimulationRegistry
+    {
+        private static readonly List<ISimulationSystem> systems = new List<ISimulationSystem>(32);
+        private static readonly Dictionary<Type, ISimulationSystem> byType = new Dictionary<Type, ISimulationSystem>();
+        private static readonly Dictionary<string, ISimulationSystem> byName = new Dictionary<string, ISimulationSystem>();
+        private static readonly Dictionary<Type, object> byService = new Dictionary<Type, object>();
+
+        public static event Action<ISimulationSystem> SystemRegistered;
+        public static event Action<ISimulationSystem> SystemUnregistered;
+
+        public static int Count => systems.Count;
+        public static IReadOnlyList<ISimulationSystem> Systems => systems;
+
+        public static void Register(ISimulationSystem system)
+        {
+            if (system == null || systems.Contains(system)) return;
+
+            systems.Add(system);
+            byService.Clear();
+
+            // First instance of a type wins; later ones are still iterable but not the typed default
+            var type = system.GetType();
+            if (!byType.ContainsKey(type))
+                byType[type] = system;
+            if (!byName.ContainsKey(system.SystemName))
+                byName[system.SystemName] = system;
+
+            SystemRegistered?.Invoke(system);
+        }
+
+        public static void Unregister(ISimulationSystem system)
+        {
+            if (system == null || !systems.Remove(system)) return;
+            byService.Clear();
+
+            var type = system.GetType();
+            if (byType.TryGetValue(type, out var current) && current == system)
+            {
+                byType.Remove(type);
+                var replacement = FindFirst(s => s.GetType() == type);
+                if (replacement != null) byType[type] = replacement;
+            }
+
+            if (byName.TryGetValue(system.SystemName, out current) && current == system)
+            {
+                byName.Remove(system.SystemName);
+                var replacement = FindFirst(s => s.SystemName == system.SystemName);
+                if (replacement != null) byName[system.SystemName] = replacement;
+            }
+
+            SystemUnregistered?.Invoke(system);
+        }
+
+        public static T Get<T>() where T : class, ISimulationSystem
+        {
+            return byType.TryGetValue(typeof(T), out var system) ? (T)system : null;
+        }
+
+        public static bool TryGet<T>(out T system) where T : class, ISimulationSystem
+        {
+            system = Get<T>();
+            return system != null;
+        }
+
+        // First system implementing a service interface such as IWeatherProvider. Results,
+        // including misses, are cached until a system registers or unregisters.
+        public static T Find<T>() where T : class
+        {
+            if (byService.TryGetValue(typeof(T), out var cached)) return (T)cached;
+
+            T found = null;
+            for (int i = 0; i < systems.Count; i++)
+            {
+                if (systems[i] is T match)
+                {
+                    found = match;
+                    break;
+                }
+            }
+
+            byService[typeof(T)] = found;
+            return found;
+        }
+
+        public static ISimulationSystem Get(string systemName)
+        {
+            return systemName != null && byName.TryGetValue(systemName, out var system) ? system : null;
+        }
+
+        public static bool Contains(ISimulationSystem system)
+        {
+            return system != null && systems.Contains(system);
+        }
+
+        private static ISimulationSystem FindFirst(Predicate<ISimulationSystem> match)
+        {
+            for (int i = 0; i < systems.Count; i++)
+            {
+                if (match(systems[i])) return systems[i];
+            }
+            return null;
+        }
+
+        // Domain reload may be disabled in the editor, so statics are cleared explicitly
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+        private static void ResetStatics()
+        {
+            systems.Clear();
+            byType.Clear();
+            byName.Clear();
+            byService.Clear();
+            SystemRegistered = null;
+            SystemUnregistered = null;
+        }
+    }
+}
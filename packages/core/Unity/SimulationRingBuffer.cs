@@ -0,0 +1,64 @@
+using System;
+using System.Threading;
+
+namespace UnitySim.Core
+{
+    // Fixed-size history with one writer and any number of readers, without locks. The writer
+    // fills a slot and then publishes it by advancing the write count. A reader copies the
+    // range it saw published and then re-reads the count. Slots the writer may have lapped
+    // during the copy are dropped, so a reader never returns a torn sample.
+    public class SimulationRingBuffer<T> where T : struct
+    {
+        private readonly T[] slots;
+        private long written = 0;
+
+        public int Capacity => slots.Length;
+
+        // Total samples ever written; the buffer holds the latest Capacity of them
+        public long Written => Volatile.Read(ref written);
+        public int Count => (int)Math.Min(Written, slots.Length);
+
+        public SimulationRingBuffer(int capacity)
+        {
+            slots = new T[Math.Max(1, capacity)];
+        }
+
+        // Writer thread only
+        public void Add(in T sample)
+        {
+            long index = written;
+            slots[(int)(index % slots.Length)] = sample;
+            Volatile.Write(ref written, index + 1);
+        }
+
+        // Copies up to destination.Length of the newest samples, oldest first, and returns how
+        // many were copied. Safe to call from any thread while the writer keeps adding.
+        public int CopyLatest(Span<T> destination)
+        {
+            long end = Volatile.Read(ref written);
+            long start = Math.Max(0, end - Math.Min(destination.Length, slots.Length));
+
+            for (long i = start; i < end; i++)
+            {
+                destination[(int)(i - start)] = slots[(int)(i % slots.Length)];
+            }
+
+            // The writer may be part way through the slot after the last one it published, so
+            // anything that slot or an earlier lap overwrote during the copy is dropped
+            Interlocked.MemoryBarrier();
+            long lapped = Volatile.Read(ref written) + 1 - slots.Length;
+            if (lapped <= start) return (int)(end - start);
+
+            int dropped = (int)Math.Min(end - start, lapped - start);
+            int kept = (int)(end - start) - dropped;
+            destination.Slice(dropped, kept).CopyTo(destination);
+            return kept;
+        }
+
+        // Writer thread only
+        public void Clear()
+        {
+            Volatile.Write(ref written, 0);
+        }
+    }
+}
@@ -0,0 +1,531 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using Unity.Profiling;
+using UnityEngine;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.Core
+{
+    public enum SimulationExecutionMode
+    {
+        MainThread,
+        Jobs
+    }
+
+    [DisallowMultipleComponent]
+    [DefaultExecutionOrder(-100)]
+    public class SimulationScheduler : MonoBehaviour
+    {
+        [Header("Scheduler Settings")]
+        public bool enableFrameBudget = true;
+        public float frameBudgetMs = 2f;
+        public bool enableLogging = false;
+
+        [Header("Execution")]
+        public SimulationExecutionMode executionMode = SimulationExecutionMode.MainThread;
+        public uint jobRandomSeed = 1;
+
+        [Header("Statistics")]
+        [SerializeField] private int registeredSystems = 0;
+        [SerializeField] private int lastFrameTicks = 0;
+        [SerializeField] private int lastFrameDeferred = 0;
+        [SerializeField] private float lastFrameTimeMs = 0f;
+        [SerializeField] private int jobSystems = 0;
+        [SerializeField] private int lastFrameSteps = 0;
+        [SerializeField] private int pendingEvents = 0;
+        [SerializeField] private long processedEvents = 0;
+
+        private class ScheduledEntry
+        {
+            public IScheduledSystem system;
+            public float accumulator;
+            public float rate = 1f;
+            public bool removed;
+            public int profileId;
+            public ProfilerMarker marker;
+        }
+
+        private static SimulationScheduler instance;
+        private static bool isQuitting = false;
+
+        private readonly List<ScheduledEntry> entries = new List<ScheduledEntry>();
+        private readonly Dictionary<IScheduledSystem, ScheduledEntry> lookup = new Dictionary<IScheduledSystem, ScheduledEntry>();
+        private readonly Stopwatch frameStopwatch = new Stopwatch();
+        private int cursor = 0;
+        private bool hasRemovals = false;
+        private SimulationJobBackend jobBackend;
+        private SimulationExecutionMode activeMode = SimulationExecutionMode.MainThread;
+        private readonly SimulationClock clock = new SimulationClock();
+        private readonly SimulationEventQueue events = new SimulationEventQueue();
+        private readonly SimulationProfiler profiler = new SimulationProfiler();
+        private SimulationExporter exporter;
+
+        public static SimulationScheduler Instance
+        {
+            get
+            {
+                if (instance == null && !isQuitting)
+                {
+                    instance = FindObjectOfType<SimulationScheduler>();
+                    if (instance == null)
+                    {
+                        var schedulerObject = new GameObject("SimulationScheduler");
+                        instance = schedulerObject.AddComponent<SimulationScheduler>();
+                        DontDestroyOnLoad(schedulerObject);
+                    }
+                }
+                return instance;
+            }
+        }
+
+        public int RegisteredSystems => entries.Count;
+
+        // Wall time of the last frame's tick passes, in milliseconds
+        public float LastFrameTimeMs => lastFrameTimeMs;
+
+        // Fixed-step clock every system is ticked from; configured by TimeSystem when present
+        public SimulationClock Clock => clock;
+
+        // Discrete-event calendar keyed on the clock's simulated seconds; due events fire
+        // at the start of each step, before systems tick
+        public SimulationEventQueue Events => events;
+
+        // Per-system tick cost and a lock-free history of it; each system's ticks also show
+        // up in the Unity Profiler as UnitySim.<SystemName>.Update
+        public SimulationProfiler Profiler => profiler;
+
+        // Shared background file exporter; completions are raised during the scheduler's Update
+        public SimulationExporter Exporter => exporter ?? (exporter = new SimulationExporter());
+
+        #region Registration
+
+        public static void Register(IScheduledSystem system)
+        {
+            if (system == null) return;
+            Instance?.AddSystem(system);
+        }
+
+        public static void Unregister(IScheduledSystem system)
+        {
+            if (system == null || instance == null) return;
+            instance.RemoveSystem(system);
+        }
+
+        // Scales how fast a system accumulates time: 1 = normal, 0.5 = half rate, 0 = paused
+        public void SetSystemRate(IScheduledSystem system, float rate)
+        {
+            if (lookup.TryGetValue(system, out var entry))
+            {
+                entry.rate = Mathf.Max(0f, rate);
+            }
+        }
+
+        // Fills results with the live registered systems, in tick order
+        public void GetSystems(List<IScheduledSystem> results)
+        {
+            results.Clear();
+            for (int i = 0; i < entries.Count; i++)
+            {
+                if (!entries[i].removed)
+                    results.Add(entries[i].system);
+            }
+        }
+
+        private void AddSystem(IScheduledSystem system)
+        {
+            if (lookup.ContainsKey(system)) return;
+
+            var entry = new ScheduledEntry { system = system };
+            entry.profileId = profiler.Register(system.SystemName);
+            entry.marker = profiler.GetMarker(entry.profileId);
+            entries.Add(entry);
+            lookup[system] = entry;
+            registeredSystems = entries.Count;
+
+            if (enableLogging)
+                Debug.Log($"SimulationScheduler: Registered {system.SystemName}");
+        }
+
+        private void RemoveSystem(IScheduledSystem system)
+        {
+            if (!lookup.TryGetValue(system, out var entry)) return;
+
+            // Entries are compacted after the tick pass so systems can disable themselves from callbacks
+            entry.removed = true;
+            lookup.Remove(system);
+            hasRemovals = true;
+
+            if (jobBackend != null && system is IJobSimulatedSystem jobSystem)
+                jobBackend.Remove(jobSystem);
+
+            if (enableLogging)
+                Debug.Log($"SimulationScheduler: Unregistered {system.SystemName}");
+        }
+
+        #endregion
+
+        #region Unity Lifecycle
+
+        void Awake()
+        {
+            if (instance != null && instance != this)
+            {
+                Debug.LogWarning("SimulationScheduler: Duplicate scheduler found, destroying");
+                Destroy(this);
+                return;
+            }
+            instance = this;
+            SimulationClock.Main = clock;
+        }
+
+        void Update()
+        {
+            if (executionMode != activeMode)
+                SwitchExecutionMode(executionMode);
+
+            frameStopwatch.Restart();
+            lastFrameTicks = 0;
+            lastFrameDeferred = 0;
+            profiler.BeginFrame();
+
+            // Systems only ever see whole fixed steps, however long the frame was
+            int steps = clock.Accumulate(UnityEngine.Time.deltaTime);
+            for (int i = 0; i < steps; i++)
+            {
+                clock.Step();
+                events.AdvanceTo(clock.SimulatedSeconds);
+                RunTickPass(clock.FixedStep, clock.Timestamp);
+            }
+            UpdateEventStatistics();
+
+            frameStopwatch.Stop();
+            lastFrameSteps = steps;
+            lastFrameTimeMs = (float)frameStopwatch.Elapsed.TotalMilliseconds;
+
+            if (jobBackend != null)
+                jobBackend.Schedule();
+
+            exporter?.Poll();
+        }
+
+        void LateUpdate()
+        {
+            if (jobBackend == null) return;
+
+            // Jobs ran alongside the rest of the frame; publish the systems that were due
+            PublishJobResults();
+        }
+
+        void OnApplicationQuit()
+        {
+            isQuitting = true;
+        }
+
+        void OnDestroy()
+        {
+            if (exporter != null)
+            {
+                // Exports already snapshotted are still written before the worker exits
+                exporter.Dispose();
+                exporter = null;
+            }
+
+            if (jobBackend != null)
+            {
+                jobBackend.SyncAll();
+                jobBackend.Dispose();
+                jobBackend = null;
+            }
+
+            if (instance == this)
+                instance = null;
+            if (SimulationClock.Main == clock)
+                SimulationClock.Main = null;
+        }
+
+        #endregion
+
+        #region Headless
+
+        // Advances the simulation by simulatedSeconds as fast as possible, independent of
+        // frame rate. Produces the same state as running the same number of steps in real time.
+        public long RunHeadless(double simulatedSeconds)
+        {
+            if (executionMode != activeMode)
+                SwitchExecutionMode(executionMode);
+
+            // Results from the current frame's job belong before the fast-forward
+            if (jobBackend != null)
+                PublishJobResults();
+
+            long steps = clock.StepsFor(simulatedSeconds);
+            var stopwatch = Stopwatch.StartNew();
+
+            for (long i = 0; i < steps; i++)
+            {
+                clock.StepHeadless();
+                events.AdvanceTo(clock.SimulatedSeconds);
+                RunTickPass(clock.FixedStep, clock.Timestamp, false);
+
+                // A system publishing mid-run must see exactly the steps queued up to now
+                if (jobBackend != null && jobBackend.HasPendingPublish)
+                {
+                    jobBackend.Schedule();
+                    PublishJobResults();
+                }
+            }
+
+            // Run whatever is still queued so nothing is left for this frame's LateUpdate
+            if (jobBackend != null)
+            {
+                jobBackend.Schedule();
+                PublishJobResults();
+            }
+
+            stopwatch.Stop();
+            UpdateEventStatistics();
+            if (enableLogging)
+                Debug.Log($"SimulationScheduler: Ran {steps} headless steps ({simulatedSeconds:F0}s simulated) in {stopwatch.Elapsed.TotalMilliseconds:F1}ms");
+
+            return steps;
+        }
+
+        // Jumps the clock forward by simulatedSeconds, firing only the discrete events due on
+        // the way. Cost scales with the number of events, not with elapsed time, so months of
+        // event-driven logistics take seconds; systems are not ticked during the jump.
+        public int SkipAhead(double simulatedSeconds)
+        {
+            if (simulatedSeconds <= 0.0) return 0;
+
+            if (jobBackend != null)
+                PublishJobResults();
+
+            var stopwatch = Stopwatch.StartNew();
+            clock.Skip(clock.StepsFor(simulatedSeconds));
+            int fired = events.AdvanceTo(clock.SimulatedSeconds);
+
+            stopwatch.Stop();
+            UpdateEventStatistics();
+            if (enableLogging)
+                Debug.Log($"SimulationScheduler: Skipped {simulatedSeconds:F0}s, fired {fired} events in {stopwatch.Elapsed.TotalMilliseconds:F1}ms");
+
+            return fired;
+        }
+
+        private void UpdateEventStatistics()
+        {
+            pendingEvents = events.Count;
+            processedEvents = events.ProcessedEvents;
+        }
+
+        #endregion
+
+        #region Tick Pass
+
+        private void RunTickPass(float deltaTime, long timestamp, bool useBudget = true)
+        {
+            // The budget trades reproducibility for frame time, so deterministic runs skip it
+            bool budgeted = useBudget && enableFrameBudget && !clock.Deterministic;
+            int count = entries.Count;
+            int ticks = 0;
+            int deferred = 0;
+
+            for (int i = 0; i < count; i++)
+            {
+                var entry = entries[i];
+                if (!entry.removed)
+                    entry.accumulator += deltaTime * entry.rate;
+            }
+
+            if (cursor >= count) cursor = 0;
+
+            for (int visited = 0; visited < count; visited++)
+            {
+                int index = (cursor + visited) % count;
+                var entry = entries[index];
+                if (entry.removed || !entry.system.IsInitialized) continue;
+
+                if (!IsDue(entry)) continue;
+
+                // Always make progress on at least one system, then respect the budget
+                if (budgeted && ticks > 0 && frameStopwatch.Elapsed.TotalMilliseconds >= frameBudgetMs)
+                {
+                    deferred = CountDue(index, count - visited);
+                    cursor = index;
+                    break;
+                }
+
+                ticks += RunEntry(entry, deltaTime, timestamp);
+            }
+
+            if (deferred == 0)
+                cursor = 0;
+
+            if (hasRemovals)
+                CompactEntries();
+
+            lastFrameTicks += ticks;
+            lastFrameDeferred = deferred;
+
+            if (enableLogging && deferred > 0)
+                Debug.Log($"SimulationScheduler: Budget reached, deferred {deferred} systems");
+        }
+
+        private bool IsDue(ScheduledEntry entry)
+        {
+            // Unoptimized systems keep the legacy behaviour of advancing every frame
+            if (!entry.system.EnableOptimization) return true;
+            return entry.accumulator >= entry.system.UpdateInterval;
+        }
+
+        private int RunEntry(ScheduledEntry entry, float deltaTime, long timestamp)
+        {
+            entry.marker.Begin();
+            long start = Stopwatch.GetTimestamp();
+
+            int ticks = RunEntryBody(entry, deltaTime, timestamp);
+
+            profiler.Record(entry.profileId, Stopwatch.GetTimestamp() - start);
+            entry.marker.End();
+            return ticks;
+        }
+
+        private int RunEntryBody(ScheduledEntry entry, float deltaTime, long timestamp)
+        {
+            var system = entry.system;
+            float interval = Mathf.Max(0.0001f, system.UpdateInterval);
+
+            if (jobBackend != null && system is IJobSimulatedSystem jobSystem)
+                return QueueJobEntry(entry, jobSystem, interval, timestamp);
+
+            if (!system.EnableOptimization)
+            {
+                system.Tick(deltaTime * entry.rate, timestamp);
+                if (entry.accumulator >= interval)
+                {
+                    system.ProcessScheduledUpdate();
+                    entry.accumulator = 0f;
+                }
+                return 1;
+            }
+
+            // Optimized systems only compute when they publish, catching up to MaxUpdatesPerFrame
+            int maxUpdates = Mathf.Max(1, system.MaxUpdatesPerFrame);
+            int updates = 0;
+            while (entry.accumulator >= interval && updates < maxUpdates && !entry.removed)
+            {
+                system.Tick(interval, timestamp);
+                system.ProcessScheduledUpdate();
+                entry.accumulator -= interval;
+                updates++;
+            }
+
+            // Drop backlog that could never be caught up instead of spiralling
+            entry.accumulator = Mathf.Min(entry.accumulator, interval * maxUpdates);
+            return updates;
+        }
+
+        private int QueueJobEntry(ScheduledEntry entry, IJobSimulatedSystem system, float interval, long timestamp)
+        {
+            if (!system.EnableOptimization)
+            {
+                bool publish = entry.accumulator >= interval;
+                if (publish) entry.accumulator = 0f;
+
+                jobBackend.QueueSteps(system, 1, publish, timestamp);
+                return 1;
+            }
+
+            // Catch-up steps run back to back in the job; the system publishes once with the result
+            int maxUpdates = Mathf.Max(1, system.MaxUpdatesPerFrame);
+            int updates = 0;
+            while (entry.accumulator >= interval && updates < maxUpdates)
+            {
+                entry.accumulator -= interval;
+                updates++;
+            }
+
+            entry.accumulator = Mathf.Min(entry.accumulator, interval * maxUpdates);
+            if (updates > 0)
+                jobBackend.QueueSteps(system, updates, true, timestamp);
+            return updates;
+        }
+
+        private void PublishJobResults()
+        {
+            var published = jobBackend.CompleteAndPublish();
+            for (int i = 0; i < published.Count; i++)
+            {
+                var system = published[i];
+                if (lookup.ContainsKey(system))
+                    system.ProcessScheduledUpdate();
+            }
+            jobSystems = jobBackend.SystemCount;
+        }
+
+        private void SwitchExecutionMode(SimulationExecutionMode mode)
+        {
+            if (mode == SimulationExecutionMode.Jobs)
+            {
+                jobBackend = new SimulationJobBackend(jobRandomSeed);
+            }
+            else if (jobBackend != null)
+            {
+                // Managed data must be current before the main thread takes over again
+                jobBackend.SyncAll();
+                jobBackend.Dispose();
+                jobBackend = null;
+                jobSystems = 0;
+            }
+
+            activeMode = mode;
+
+            if (enableLogging)
+                Debug.Log($"SimulationScheduler: Execution mode set to {mode}");
+        }
+
+        private int CountDue(int startIndex, int remaining)
+        {
+            int due = 0;
+            for (int i = 0; i < remaining; i++)
+            {
+                var entry = entries[(startIndex + i) % entries.Count];
+                if (!entry.removed && entry.system.IsInitialized && IsDue(entry))
+                    due++;
+            }
+            return due;
+        }
+
+        private void CompactEntries()
+        {
+            var cursorEntry = cursor < entries.Count ? entries[cursor] : null;
+            entries.RemoveAll(e => e.removed);
+
+            cursor = cursorEntry != null && !cursorEntry.removed ? entries.IndexOf(cursorEntry) : 0;
+            if (cursor < 0) cursor = 0;
+
+            registeredSystems = entries.Count;
+            hasRemovals = false;
+        }
+
+        #endregion
+
+        #region Debug Info
+
+        public void GetSystemInfo()
+        {
+            Debug.Log($"SimulationScheduler Info:");
+            Debug.Log($"- Registered Systems: {entries.Count}");
+            Debug.Log($"- Execution Mode: {activeMode} ({jobSystems} job systems, {jobBackend?.ChannelCount ?? 0} channels)");
+            Debug.Log($"- Frame Budget: {(enableFrameBudget ? $"{frameBudgetMs}ms" : "disabled")}");
+            Debug.Log($"- Clock: step {clock.StepCount}, {clock.SimulatedSeconds:F2}s simulated ({clock.FixedStep}s fixed step, x{clock.TimeScale}{(clock.Paused ? ", paused" : "")})");
+            Debug.Log($"- Last Frame Steps: {lastFrameSteps}");
+            Debug.Log($"- Last Frame Ticks: {lastFrameTicks}");
+            Debug.Log($"- Last Frame Deferred: {lastFrameDeferred}");
+            Debug.Log($"- Last Frame Time: {lastFrameTimeMs:F3}ms");
+        }
+
+        #endregion
+    }
+}
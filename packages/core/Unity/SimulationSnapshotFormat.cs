@@ -0,0 +1,78 @@
+using System.Collections.Generic;
+
+namespace UnitySim.Core
+{
+    // Binary capture layout (all values little-endian):
+    //
+    //   Header (64 bytes)   magic, version, counts and section offsets
+    //   Schema block        one schema per captured system, one field entry per value
+    //   Name table          system names and field paths (string ids 0..nameCount-1)
+    //   Frames              frameCount * frameSize bytes, fixed layout
+    //   String table        every interned string, written when the capture is closed
+    //
+    // The name table is written with the header, so a capture that is still recording or
+    // was never closed can be opened by name; string field values need the final table.
+    //
+    // A frame is an int64 capture timestamp followed by one record per schema. A record
+    // is a presence byte followed by its fields packed at the offsets in the schema.
+    // Strings are stored as int32 ids into the string table (-1 for null).
+    public static class SimulationSnapshotFormat
+    {
+        public const ulong Magic = 0x50414E534D495355; // "USIMSNAP"
+        public const ushort Version = 2;
+        public const int HeaderSize = 64;
+        public const int SchemaEntrySize = 16;
+        public const int FieldEntrySize = 12;
+        public const int FrameHeaderSize = 8;
+        public const int RecordHeaderSize = 1;
+
+        public static int GetSize(SnapshotFieldType type)
+        {
+            switch (type)
+            {
+                case SnapshotFieldType.Int32: return 4;
+                case SnapshotFieldType.Int64: return 8;
+                case SnapshotFieldType.Float32: return 4;
+                case SnapshotFieldType.Bool: return 1;
+                case SnapshotFieldType.String: return 4;
+                case SnapshotFieldType.Vector2Int: return 8;
+                default: return 0;
+            }
+        }
+    }
+
+    public enum SnapshotFieldType : byte
+    {
+        Int32 = 1,
+        Int64 = 2,
+        Float32 = 3,
+        Bool = 4,
+        String = 5,
+        Vector2Int = 6
+    }
+
+    public struct SnapshotField
+    {
+        // Dotted path from the root object, e.g. "economy.gdp"
+        public string path;
+        public SnapshotFieldType type;
+        public int offset;
+    }
+
+    public class SnapshotSchema
+    {
+        public string systemName;
+        public int recordOffset;
+        public int recordSize;
+        public readonly List<SnapshotField> fields = new List<SnapshotField>();
+
+        public int FindField(string path)
+        {
+            for (int i = 0; i < fields.Count; i++)
+            {
+                if (fields[i].path == path) return i;
+            }
+            return -1;
+        }
+    }
+}
@@ -0,0 +1,250 @@
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Text;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Memory-maps a capture written by SimulationSnapshotWriter. Frames are read in place
+    // from the mapping, so GetFrame(n) is O(1) and copies nothing; only the schema block
+    // and the string table are decoded when the file is opened.
+    public unsafe class SimulationSnapshotReader : IDisposable
+    {
+        private readonly MemoryMappedFile file;
+        private readonly MemoryMappedViewAccessor view;
+        private readonly byte* basePointer;
+        private readonly long length;
+        private readonly long dataOffset;
+        private readonly List<SnapshotSchema> schemas = new List<SnapshotSchema>();
+        private readonly string[] strings;
+        private bool disposed = false;
+
+        public int Version { get; }
+        public int FrameSize { get; }
+        public long FrameCount { get; }
+
+        // False for captures that were not closed; frames and names are readable, string values are not
+        public bool IsFinalized { get; }
+
+        public IReadOnlyList<SnapshotSchema> Schemas => schemas;
+
+        public SimulationSnapshotReader(string path)
+        {
+            // ReadWrite sharing lets a capture be opened while its writer still has it open
+            var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite);
+            length = stream.Length;
+            if (length < SimulationSnapshotFormat.HeaderSize)
+            {
+                stream.Dispose();
+                throw new InvalidDataException($"SimulationSnapshotReader: {path} is too small to be a capture");
+            }
+
+            file = MemoryMappedFile.CreateFromFile(stream, null, 0, MemoryMappedFileAccess.Read, HandleInheritability.None, false);
+            view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+
+            byte* pointer = null;
+            view.SafeMemoryMappedViewHandle.AcquirePointer(ref pointer);
+            basePointer = pointer + view.PointerOffset;
+
+            try
+            {
+                var header = Slice(0, SimulationSnapshotFormat.HeaderSize);
+                if (BinaryPrimitives.ReadUInt64LittleEndian(header) != SimulationSnapshotFormat.Magic)
+                    throw new InvalidDataException("SimulationSnapshotReader: Not a simulation capture");
+
+                Version = BinaryPrimitives.ReadUInt16LittleEndian(header.Slice(8));
+                if (Version > SimulationSnapshotFormat.Version)
+                    throw new InvalidDataException($"SimulationSnapshotReader: Unsupported capture version {Version}");
+
+                int schemaCount = BinaryPrimitives.ReadInt32LittleEndian(header.Slice(12));
+                FrameSize = BinaryPrimitives.ReadInt32LittleEndian(header.Slice(16));
+                long frames = BinaryPrimitives.ReadInt64LittleEndian(header.Slice(24));
+                long schemaOffset = BinaryPrimitives.ReadInt64LittleEndian(header.Slice(32));
+                dataOffset = BinaryPrimitives.ReadInt64LittleEndian(header.Slice(40));
+                long stringTableOffset = BinaryPrimitives.ReadInt64LittleEndian(header.Slice(48));
+                int stringCount = BinaryPrimitives.ReadInt32LittleEndian(header.Slice(56));
+                int nameCount = Version >= 2 ? BinaryPrimitives.ReadInt32LittleEndian(header.Slice(60)) : 0;
+
+                IsFinalized = stringTableOffset != 0;
+                FrameCount = IsFinalized ? frames : (length - dataOffset) / FrameSize;
+
+                // The name table directly follows the schema block
+                long nameTableOffset = schemaOffset;
+                for (int i = 0; i < schemaCount; i++)
+                {
+                    int fieldCount = BinaryPrimitives.ReadInt32LittleEndian(Slice(nameTableOffset + 12, 4));
+                    nameTableOffset += SimulationSnapshotFormat.SchemaEntrySize + (long)fieldCount * SimulationSnapshotFormat.FieldEntrySize;
+                }
+
+                strings = IsFinalized ? ReadStringTable(stringTableOffset, stringCount) : ReadStringTable(nameTableOffset, nameCount);
+                ReadSchemas(schemaOffset, schemaCount);
+            }
+            catch
+            {
+                Dispose();
+                throw;
+            }
+        }
+
+        public int FindSchema(string systemName)
+        {
+            for (int i = 0; i < schemas.Count; i++)
+            {
+                if (schemas[i].systemName == systemName) return i;
+            }
+            return -1;
+        }
+
+        public SnapshotFrame GetFrame(long index)
+        {
+            if (index < 0 || index >= FrameCount)
+                throw new ArgumentOutOfRangeException(nameof(index));
+
+            return new SnapshotFrame(this, Slice(dataOffset + index * FrameSize, FrameSize));
+        }
+
+        internal string GetString(int id)
+        {
+            return id >= 0 && id < strings.Length ? strings[id] : null;
+        }
+
+        internal SnapshotField GetField(int schemaIndex, int fieldIndex, SnapshotFieldType expected, out SnapshotSchema schema)
+        {
+            schema = schemas[schemaIndex];
+            var field = schema.fields[fieldIndex];
+            if (field.type != expected)
+                throw new InvalidOperationException($"SimulationSnapshotReader: {field.path} is {field.type}, not {expected}");
+            return field;
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            disposed = true;
+
+            if (view != null)
+            {
+                view.SafeMemoryMappedViewHandle.ReleasePointer();
+                view.Dispose();
+            }
+            file?.Dispose();
+        }
+
+        private ReadOnlySpan<byte> Slice(long offset, int count)
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(SimulationSnapshotReader));
+            if (offset < 0 || offset + count > length)
+                throw new InvalidDataException("SimulationSnapshotReader: Capture is truncated");
+
+            return new ReadOnlySpan<byte>(basePointer + offset, count);
+        }
+
+        private string[] ReadStringTable(long offset, int count)
+        {
+            var result = new string[count];
+            for (int i = 0; i < count; i++)
+            {
+                int byteCount = BinaryPrimitives.ReadInt32LittleEndian(Slice(offset, 4));
+                result[i] = Encoding.UTF8.GetString(Slice(offset + 4, byteCount));
+                offset += 4 + byteCount;
+            }
+            return result;
+        }
+
+        private void ReadSchemas(long offset, int count)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                var entry = Slice(offset, SimulationSnapshotFormat.SchemaEntrySize);
+                offset += SimulationSnapshotFormat.SchemaEntrySize;
+
+                int nameId = BinaryPrimitives.ReadInt32LittleEndian(entry);
+                var schema = new SnapshotSchema
+                {
+                    systemName = GetString(nameId) ?? $"schema{i}",
+                    recordOffset = BinaryPrimitives.ReadInt32LittleEndian(entry.Slice(4)),
+                    recordSize = BinaryPrimitives.ReadInt32LittleEndian(entry.Slice(8))
+                };
+
+                int fieldCount = BinaryPrimitives.ReadInt32LittleEndian(entry.Slice(12));
+                for (int f = 0; f < fieldCount; f++)
+                {
+                    var fieldEntry = Slice(offset, SimulationSnapshotFormat.FieldEntrySize);
+                    offset += SimulationSnapshotFormat.FieldEntrySize;
+
+                    int pathId = BinaryPrimitives.ReadInt32LittleEndian(fieldEntry);
+                    schema.fields.Add(new SnapshotField
+                    {
+                        path = GetString(pathId) ?? $"field{f}",
+                        type = (SnapshotFieldType)fieldEntry[4],
+                        offset = BinaryPrimitives.ReadInt32LittleEndian(fieldEntry.Slice(8))
+                    });
+                }
+
+                schemas.Add(schema);
+            }
+        }
+    }
+
+    // View over one frame inside the mapping; valid until the reader is disposed
+    public readonly ref struct SnapshotFrame
+    {
+        private readonly SimulationSnapshotReader reader;
+        private readonly ReadOnlySpan<byte> data;
+
+        internal SnapshotFrame(SimulationSnapshotReader reader, ReadOnlySpan<byte> data)
+        {
+            this.reader = reader;
+            this.data = data;
+        }
+
+        public long Timestamp => BinaryPrimitives.ReadInt64LittleEndian(data);
+        public ReadOnlySpan<byte> RawData => data;
+
+        public bool HasRecord(int schemaIndex)
+        {
+            return data[reader.Schemas[schemaIndex].recordOffset] != 0;
+        }
+
+        public int GetInt(int schemaIndex, int fieldIndex)
+        {
+            return BinaryPrimitives.ReadInt32LittleEndian(Value(schemaIndex, fieldIndex, SnapshotFieldType.Int32));
+        }
+
+        public long GetLong(int schemaIndex, int fieldIndex)
+        {
+            return BinaryPrimitives.ReadInt64LittleEndian(Value(schemaIndex, fieldIndex, SnapshotFieldType.Int64));
+        }
+
+        public float GetFloat(int schemaIndex, int fieldIndex)
+        {
+            return BitConverter.Int32BitsToSingle(BinaryPrimitives.ReadInt32LittleEndian(Value(schemaIndex, fieldIndex, SnapshotFieldType.Float32)));
+        }
+
+        public bool GetBool(int schemaIndex, int fieldIndex)
+        {
+            return Value(schemaIndex, fieldIndex, SnapshotFieldType.Bool)[0] != 0;
+        }
+
+        // Returns the interned instance, so repeated reads do not allocate
+        public string GetString(int schemaIndex, int fieldIndex)
+        {
+            return reader.GetString(BinaryPrimitives.ReadInt32LittleEndian(Value(schemaIndex, fieldIndex, SnapshotFieldType.String)));
+        }
+
+        public Vector2Int GetVector2Int(int schemaIndex, int fieldIndex)
+        {
+            var value = Value(schemaIndex, fieldIndex, SnapshotFieldType.Vector2Int);
+            return new Vector2Int(BinaryPrimitives.ReadInt32LittleEndian(value), BinaryPrimitives.ReadInt32LittleEndian(value.Slice(4)));
+        }
+
+        private ReadOnlySpan<byte> Value(int schemaIndex, int fieldIndex, SnapshotFieldType type)
+        {
+            var field = reader.GetField(schemaIndex, fieldIndex, type, out var schema);
+            return data.Slice(schema.recordOffset + field.offset, SimulationSnapshotFormat.GetSize(type));
+        }
+    }
+}
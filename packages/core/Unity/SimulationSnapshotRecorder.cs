@@ -0,0 +1,154 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Captures every scheduler-registered IStateSource into a binary snapshot file at a
+    // fixed rate. Runs after the scheduler so job results are published before capture.
+    [DisallowMultipleComponent]
+    [DefaultExecutionOrder(100)]
+    public class SimulationSnapshotRecorder : MonoBehaviour
+    {
+        [Header("Capture Settings")]
+        public float captureRate = 30f;
+        public string fileName = "simulation_capture.usnap";
+        public bool recordOnStart = false;
+        public bool enableLogging = false;
+
+        [Header("Statistics")]
+        [SerializeField] private bool isRecording = false;
+        [SerializeField] private int capturedSystems = 0;
+        [SerializeField] private long framesCaptured = 0;
+
+        // Events
+        public System.Action<string> OnRecordingStopped;
+
+        private readonly List<IScheduledSystem> systemBuffer = new List<IScheduledSystem>();
+        private readonly List<IStateSource> sources = new List<IStateSource>();
+        private SimulationSnapshotWriter writer;
+        private string filePath;
+        private float captureTimer = 0f;
+
+        public bool IsRecording => writer != null;
+        public string FilePath => filePath;
+        public long FramesCaptured => framesCaptured;
+
+        #region Unity Lifecycle
+
+        void Start()
+        {
+            if (recordOnStart)
+                StartRecording();
+        }
+
+        void LateUpdate()
+        {
+            if (writer == null) return;
+
+            captureTimer += UnityEngine.Time.unscaledDeltaTime;
+            float interval = 1f / Mathf.Max(0.1f, captureRate);
+            if (captureTimer < interval) return;
+
+            // One frame per LateUpdate at most; a slow frame drops captures instead of bursting
+            captureTimer = Mathf.Min(captureTimer - interval, interval);
+            CaptureFrame();
+        }
+
+        void OnDisable()
+        {
+            StopRecording();
+        }
+
+        #endregion
+
+        #region Public API
+
+        public bool StartRecording()
+        {
+            if (writer != null) return true;
+
+            var scheduler = SimulationScheduler.Instance;
+            if (scheduler == null) return false;
+
+            scheduler.GetSystems(systemBuffer);
+            sources.Clear();
+            for (int i = 0; i < systemBuffer.Count; i++)
+            {
+                if (systemBuffer[i] is IStateSource source && systemBuffer[i].IsInitialized)
+                    sources.Add(source);
+            }
+
+            filePath = System.IO.Path.Combine(Application.persistentDataPath, fileName);
+
+            try
+            {
+                writer = new SimulationSnapshotWriter(filePath, sources);
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"SimulationSnapshotRecorder: Failed to start recording - {e.Message}");
+                writer = null;
+                return false;
+            }
+
+            isRecording = true;
+            capturedSystems = writer.SchemaCount;
+            framesCaptured = 0;
+            captureTimer = 0f;
+
+            if (enableLogging)
+                Debug.Log($"SimulationSnapshotRecorder: Recording {capturedSystems} systems ({writer.FrameSize} bytes/frame) to {filePath}");
+
+            return true;
+        }
+
+        public void StopRecording()
+        {
+            if (writer == null) return;
+
+            try
+            {
+                writer.Close();
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"SimulationSnapshotRecorder: Failed to finalize capture - {e.Message}");
+            }
+
+            writer = null;
+            isRecording = false;
+
+            if (enableLogging)
+                Debug.Log($"SimulationSnapshotRecorder: Saved {framesCaptured} frames to {filePath}");
+
+            OnRecordingStopped?.Invoke(filePath);
+        }
+
+        public void CaptureFrame()
+        {
+            if (writer == null) return;
+
+            writer.WriteFrame(SimulationClock.Now);
+            framesCaptured = writer.FrameCount;
+        }
+
+        #endregion
+
+        #region Context Menu Actions
+
+        [ContextMenu("Start Recording")]
+        private void StartRecordingMenu()
+        {
+            StartRecording();
+        }
+
+        [ContextMenu("Stop Recording")]
+        private void StopRecordingMenu()
+        {
+            StopRecording();
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,339 @@
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Writes fixed-layout binary frames for a fixed set of IStateSources. Each source's
+    // schema is taken from its first WriteState call, so the field set must not change
+    // while the capture is open. See SimulationSnapshotFormat for the layout.
+    public class SimulationSnapshotWriter : IDisposable
+    {
+        private readonly Stream stream;
+        private readonly bool ownsStream;
+        private readonly List<IStateSource> sources = new List<IStateSource>();
+        private readonly List<SnapshotSchema> schemas = new List<SnapshotSchema>();
+        private readonly Dictionary<string, int> stringIds = new Dictionary<string, int>();
+        private readonly List<string> strings = new List<string>();
+        private readonly FrameWriter frameWriter;
+        private readonly byte[] frameBuffer;
+        private readonly long dataOffset;
+        private readonly int nameCount;
+        private long frameCount = 0;
+        private bool closed = false;
+
+        public int SchemaCount => schemas.Count;
+        public int FrameSize => frameBuffer.Length;
+        public long FrameCount => frameCount;
+        public int StringCount => strings.Count;
+        public IReadOnlyList<SnapshotSchema> Schemas => schemas;
+
+        public SimulationSnapshotWriter(string path, IReadOnlyList<IStateSource> sources)
+            : this(new FileStream(path, FileMode.Create, FileAccess.ReadWrite, FileShare.Read, 1 << 16), sources, true)
+        {
+        }
+
+        public SimulationSnapshotWriter(Stream stream, IReadOnlyList<IStateSource> sources, bool ownsStream = false)
+        {
+            if (stream == null) throw new ArgumentNullException(nameof(stream));
+            if (!stream.CanSeek) throw new ArgumentException("SimulationSnapshotWriter: Stream must be seekable", nameof(stream));
+
+            this.stream = stream;
+            this.ownsStream = ownsStream;
+
+            int frameSize = SimulationSnapshotFormat.FrameHeaderSize;
+            var builder = new SchemaBuilder();
+            for (int i = 0; i < sources.Count; i++)
+            {
+                var source = sources[i];
+                var schema = new SnapshotSchema { systemName = source.SystemName, recordOffset = frameSize };
+
+                builder.Reset(schema);
+                if (!source.WriteState(builder))
+                {
+                    Debug.LogWarning($"SimulationSnapshotWriter: Skipping {source.SystemName} - no data available");
+                    continue;
+                }
+
+                schema.recordSize = builder.RecordSize;
+                frameSize += schema.recordSize;
+
+                Intern(schema.systemName);
+                for (int f = 0; f < schema.fields.Count; f++)
+                    Intern(schema.fields[f].path);
+
+                this.sources.Add(source);
+                schemas.Add(schema);
+            }
+
+            frameBuffer = new byte[frameSize];
+            frameWriter = new FrameWriter(this);
+            nameCount = strings.Count;
+
+            long schemaBytes = 0;
+            for (int i = 0; i < schemas.Count; i++)
+                schemaBytes += SimulationSnapshotFormat.SchemaEntrySize + schemas[i].fields.Count * SimulationSnapshotFormat.FieldEntrySize;
+
+            long nameBytes = 0;
+            for (int i = 0; i < nameCount; i++)
+                nameBytes += 4 + Encoding.UTF8.GetByteCount(strings[i]);
+            dataOffset = SimulationSnapshotFormat.HeaderSize + schemaBytes + nameBytes;
+
+            // Frame count stays 0 until Close; readers of an unfinished capture derive it from the length
+            stream.SetLength(0);
+            WriteHeader(0, 0);
+            WriteSchemaBlock();
+            WriteStringTable(nameCount);
+            stream.Flush();
+        }
+
+        public void WriteFrame(long timestamp)
+        {
+            if (closed) throw new ObjectDisposedException(nameof(SimulationSnapshotWriter));
+
+            Array.Clear(frameBuffer, 0, frameBuffer.Length);
+            BinaryPrimitives.WriteInt64LittleEndian(frameBuffer, timestamp);
+
+            for (int i = 0; i < sources.Count; i++)
+            {
+                var schema = schemas[i];
+                frameWriter.Reset(schema);
+
+                bool present;
+                try
+                {
+                    present = sources[i].WriteState(frameWriter) && frameWriter.IsComplete;
+                }
+                catch (InvalidOperationException e)
+                {
+                    Debug.LogError($"SimulationSnapshotWriter: {schema.systemName} record dropped - {e.Message}");
+                    present = false;
+                }
+
+                // Partially written records are zeroed so readers never see half a frame
+                if (!present)
+                    Array.Clear(frameBuffer, schema.recordOffset, schema.recordSize);
+                else
+                    frameBuffer[schema.recordOffset] = 1;
+            }
+
+            stream.Write(frameBuffer, 0, frameBuffer.Length);
+            frameCount++;
+        }
+
+        // Writes the string table and finalizes the header; the stream stays valid for reading
+        public void Close()
+        {
+            if (closed) return;
+            closed = true;
+
+            long stringTableOffset = stream.Position;
+            WriteStringTable(strings.Count);
+            long end = stream.Position;
+
+            stream.Position = 0;
+            WriteHeader(frameCount, stringTableOffset);
+            stream.Position = end;
+            stream.Flush();
+
+            if (ownsStream)
+                stream.Dispose();
+        }
+
+        public void Dispose()
+        {
+            Close();
+        }
+
+        private int Intern(string value)
+        {
+            if (value == null) return -1;
+            if (stringIds.TryGetValue(value, out int id)) return id;
+
+            id = strings.Count;
+            strings.Add(value);
+            stringIds[value] = id;
+            return id;
+        }
+
+        #region Sections
+
+        private void WriteHeader(long frames, long stringTableOffset)
+        {
+            Span<byte> header = stackalloc byte[SimulationSnapshotFormat.HeaderSize];
+            header.Clear();
+            BinaryPrimitives.WriteUInt64LittleEndian(header, SimulationSnapshotFormat.Magic);
+            BinaryPrimitives.WriteUInt16LittleEndian(header.Slice(8), SimulationSnapshotFormat.Version);
+            BinaryPrimitives.WriteUInt16LittleEndian(header.Slice(10), SimulationSnapshotFormat.HeaderSize);
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(12), schemas.Count);
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(16), frameBuffer.Length);
+            BinaryPrimitives.WriteInt64LittleEndian(header.Slice(24), frames);
+            BinaryPrimitives.WriteInt64LittleEndian(header.Slice(32), SimulationSnapshotFormat.HeaderSize);
+            BinaryPrimitives.WriteInt64LittleEndian(header.Slice(40), dataOffset);
+            BinaryPrimitives.WriteInt64LittleEndian(header.Slice(48), stringTableOffset);
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(56), strings.Count);
+            BinaryPrimitives.WriteInt32LittleEndian(header.Slice(60), nameCount);
+            stream.Write(header);
+        }
+
+        private void WriteSchemaBlock()
+        {
+            Span<byte> entry = stackalloc byte[SimulationSnapshotFormat.SchemaEntrySize];
+            for (int i = 0; i < schemas.Count; i++)
+            {
+                var schema = schemas[i];
+                BinaryPrimitives.WriteInt32LittleEndian(entry, stringIds[schema.systemName]);
+                BinaryPrimitives.WriteInt32LittleEndian(entry.Slice(4), schema.recordOffset);
+                BinaryPrimitives.WriteInt32LittleEndian(entry.Slice(8), schema.recordSize);
+                BinaryPrimitives.WriteInt32LittleEndian(entry.Slice(12), schema.fields.Count);
+                stream.Write(entry);
+
+                for (int f = 0; f < schema.fields.Count; f++)
+                {
+                    var field = schema.fields[f];
+                    Span<byte> fieldEntry = entry.Slice(0, SimulationSnapshotFormat.FieldEntrySize);
+                    fieldEntry.Clear();
+                    BinaryPrimitives.WriteInt32LittleEndian(fieldEntry, stringIds[field.path]);
+                    fieldEntry[4] = (byte)field.type;
+                    BinaryPrimitives.WriteInt32LittleEndian(fieldEntry.Slice(8), field.offset);
+                    stream.Write(fieldEntry);
+                }
+            }
+        }
+
+        // The first count strings; also used for the name table, which is strings[0..nameCount)
+        private void WriteStringTable(int count)
+        {
+            // [int32 byteLength][utf8 bytes] per string, in id order
+            Span<byte> length = stackalloc byte[4];
+            byte[] scratch = new byte[256];
+            for (int i = 0; i < count; i++)
+            {
+                int byteCount = Encoding.UTF8.GetByteCount(strings[i]);
+                if (scratch.Length < byteCount)
+                    scratch = new byte[byteCount];
+
+                Encoding.UTF8.GetBytes(strings[i], 0, strings[i].Length, scratch, 0);
+                BinaryPrimitives.WriteInt32LittleEndian(length, byteCount);
+                stream.Write(length);
+                stream.Write(scratch, 0, byteCount);
+            }
+        }
+
+        #endregion
+
+        #region State Writers
+
+        // Records field paths and types from a source's first WriteState call
+        private class SchemaBuilder : IStateWriter
+        {
+            private readonly List<string> path = new List<string>();
+            private SnapshotSchema schema;
+            private int offset;
+
+            public int RecordSize => offset;
+
+            public void Reset(SnapshotSchema target)
+            {
+                schema = target;
+                schema.fields.Clear();
+                path.Clear();
+                offset = SimulationSnapshotFormat.RecordHeaderSize;
+            }
+
+            public void BeginObject(string name)
+            {
+                if (name != null) path.Add(name);
+            }
+
+            public void EndObject()
+            {
+                if (path.Count > 0) path.RemoveAt(path.Count - 1);
+            }
+
+            public void Write(string name, int value) => Add(name, SnapshotFieldType.Int32);
+            public void Write(string name, long value) => Add(name, SnapshotFieldType.Int64);
+            public void Write(string name, float value) => Add(name, SnapshotFieldType.Float32);
+            public void Write(string name, bool value) => Add(name, SnapshotFieldType.Bool);
+            public void Write(string name, string value) => Add(name, SnapshotFieldType.String);
+            public void Write(string name, Vector2Int value) => Add(name, SnapshotFieldType.Vector2Int);
+
+            private void Add(string name, SnapshotFieldType type)
+            {
+                string fieldPath = path.Count == 0 ? name : string.Join(".", path) + "." + name;
+                schema.fields.Add(new SnapshotField { path = fieldPath, type = type, offset = offset });
+                offset += SimulationSnapshotFormat.GetSize(type);
+            }
+        }
+
+        // Writes field values straight into the frame buffer at their schema offsets
+        private class FrameWriter : IStateWriter
+        {
+            private readonly SimulationSnapshotWriter owner;
+            private SnapshotSchema schema;
+            private int fieldIndex;
+
+            public bool IsComplete => fieldIndex == schema.fields.Count;
+
+            public FrameWriter(SimulationSnapshotWriter owner)
+            {
+                this.owner = owner;
+            }
+
+            public void Reset(SnapshotSchema target)
+            {
+                schema = target;
+                fieldIndex = 0;
+            }
+
+            public void BeginObject(string name) { }
+            public void EndObject() { }
+
+            public void Write(string name, int value)
+            {
+                BinaryPrimitives.WriteInt32LittleEndian(Next(SnapshotFieldType.Int32), value);
+            }
+
+            public void Write(string name, long value)
+            {
+                BinaryPrimitives.WriteInt64LittleEndian(Next(SnapshotFieldType.Int64), value);
+            }
+
+            public void Write(string name, float value)
+            {
+                BinaryPrimitives.WriteInt32LittleEndian(Next(SnapshotFieldType.Float32), BitConverter.SingleToInt32Bits(value));
+            }
+
+            public void Write(string name, bool value)
+            {
+                Next(SnapshotFieldType.Bool)[0] = value ? (byte)1 : (byte)0;
+            }
+
+            public void Write(string name, string value)
+            {
+                BinaryPrimitives.WriteInt32LittleEndian(Next(SnapshotFieldType.String), owner.Intern(value));
+            }
+
+            public void Write(string name, Vector2Int value)
+            {
+                var span = Next(SnapshotFieldType.Vector2Int);
+                BinaryPrimitives.WriteInt32LittleEndian(span, value.x);
+                BinaryPrimitives.WriteInt32LittleEndian(span.Slice(4), value.y);
+            }
+
+            private Span<byte> Next(SnapshotFieldType type)
+            {
+                if (fieldIndex >= schema.fields.Count || schema.fields[fieldIndex].type != type)
+                    throw new InvalidOperationException($"State layout changed at field {fieldIndex}");
+
+                var field = schema.fields[fieldIndex++];
+                return new Span<byte>(owner.frameBuffer, schema.recordOffset + field.offset, SimulationSnapshotFormat.GetSize(type));
+            }
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,143 @@
+using System;
+using UnityEngine;
+
+namespace UnitySim.Core
+{
+    // Records IStateWriter calls so they can be replayed later, on another thread, into any
+    // writer. Recording is a flat append per field with no formatting; strings are kept by
+    // reference since they're immutable. Reused tapes don't allocate once they've grown.
+    public class SimulationStateTape : IStateWriter
+    {
+        private enum Op : byte
+        {
+            BeginObject,
+            EndObject,
+            Int,
+            Long,
+            Float,
+            Bool,
+            String,
+            Vector2Int
+        }
+
+        private struct Token
+        {
+            public Op op;
+            public string name;
+            public long number;
+            public float value;
+            public string text;
+        }
+
+        private Token[] tokens;
+        private int count = 0;
+        private string pendingName = null;
+
+        public int Count => count;
+
+        public SimulationStateTape(int capacity = 256)
+        {
+            tokens = new Token[Math.Max(1, capacity)];
+        }
+
+        public void Clear()
+        {
+            // Drop string references so a parked tape doesn't keep old data alive
+            Array.Clear(tokens, 0, count);
+            count = 0;
+            pendingName = null;
+        }
+
+        // Writes a source's root object as the named property of the current object
+        public bool WriteSource(string name, IStateSource source)
+        {
+            pendingName = name;
+            int start = count;
+            bool written = source.WriteState(this);
+            pendingName = null;
+
+            if (!written) count = start;
+            return written;
+        }
+
+        public void Replay(IStateWriter writer)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                ref var token = ref tokens[i];
+                switch (token.op)
+                {
+                    case Op.BeginObject: writer.BeginObject(token.name); break;
+                    case Op.EndObject: writer.EndObject(); break;
+                    case Op.Int: writer.Write(token.name, (int)token.number); break;
+                    case Op.Long: writer.Write(token.name, token.number); break;
+                    case Op.Float: writer.Write(token.name, token.value); break;
+                    case Op.Bool: writer.Write(token.name, token.number != 0); break;
+                    case Op.String: writer.Write(token.name, token.text); break;
+                    case Op.Vector2Int: writer.Write(token.name, new Vector2Int((int)(token.number >> 32), (int)token.number)); break;
+                }
+            }
+        }
+
+        #region IStateWriter
+
+        public void BeginObject(string name)
+        {
+            // The source's root object takes the name given to WriteSource
+            if (name == null && pendingName != null)
+            {
+                name = pendingName;
+                pendingName = null;
+            }
+            Append(Op.BeginObject, name);
+        }
+
+        public void EndObject()
+        {
+            Append(Op.EndObject, null);
+        }
+
+        public void Write(string name, int value)
+        {
+            Append(Op.Int, name).number = value;
+        }
+
+        public void Write(string name, long value)
+        {
+            Append(Op.Long, name).number = value;
+        }
+
+        public void Write(string name, float value)
+        {
+            Append(Op.Float, name).value = value;
+        }
+
+        public void Write(string name, bool value)
+        {
+            Append(Op.Bool, name).number = value ? 1 : 0;
+        }
+
+        public void Write(string name, string value)
+        {
+            Append(Op.String, name).text = value;
+        }
+
+        public void Write(string name, Vector2Int value)
+        {
+            Append(Op.Vector2Int, name).number = ((long)value.x << 32) | (uint)value.y;
+        }
+
+        #endregion
+
+        private ref Token Append(Op op, string name)
+        {
+            if (count == tokens.Length) Array.Resize(ref tokens, tokens.Length * 2);
+
+            ref var token = ref tokens[count++];
+            token.op = op;
+            token.name = name;
+            token.text = null;
+            return ref token;
+        }
+    }
+}
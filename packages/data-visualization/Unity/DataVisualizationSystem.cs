@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.DataVisualization
 {
@@ -13,32 +17,137 @@ namespace UnitySim.DataVisualization
 
         public DataVisualizationData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             datavisualization = new DataVisualizationInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (datavisualization != null)
+                datavisualization.WriteState(writer, "datavisualization");
+            else
+                writer.Write("datavisualization", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
     public class DataVisualizationInfo
     {
-                public int chartsGenerated = 0;
-        public int dataPoints = 0;
+        public int chartsGenerated = 0;
+        public long dataPoints = 0;
+        public int seriesCount = 0;
+        public int plottedPoints = 0;
         public string chartType = "line";
         public bool realTimeUpdate = true;
         public float refreshRate = 1f;
         public int colorPalette = 1;
         public string systemHealth = "operational";
         public string framework = "unity-sim-data-visualization";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("chartsGenerated", chartsGenerated);
+            writer.Write("dataPoints", dataPoints);
+            writer.Write("seriesCount", seriesCount);
+            writer.Write("plottedPoints", plottedPoints);
+            writer.Write("chartType", chartType);
+            writer.Write("realTimeUpdate", realTimeUpdate);
+            writer.Write("refreshRate", refreshRate);
+            writer.Write("colorPalette", colorPalette);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public DataVisualizationField Diff(DataVisualizationInfo other)
+        {
+            var changed = DataVisualizationField.None;
+            if (chartsGenerated != other.chartsGenerated) changed |= DataVisualizationField.ChartsGenerated;
+            if (dataPoints != other.dataPoints) changed |= DataVisualizationField.DataPoints;
+            if (chartType != other.chartType) changed |= DataVisualizationField.ChartType;
+            if (realTimeUpdate != other.realTimeUpdate) changed |= DataVisualizationField.RealTimeUpdate;
+            if (refreshRate != other.refreshRate) changed |= DataVisualizationField.RefreshRate;
+            if (colorPalette != other.colorPalette) changed |= DataVisualizationField.ColorPalette;
+            if (systemHealth != other.systemHealth) changed |= DataVisualizationField.SystemHealth;
+            if (framework != other.framework) changed |= DataVisualizationField.Framework;
+            if (seriesCount != other.seriesCount) changed |= DataVisualizationField.SeriesCount;
+            if (plottedPoints != other.plottedPoints) changed |= DataVisualizationField.PlottedPoints;
+            return changed;
+        }
+
+        public void CopyTo(DataVisualizationInfo target)
+        {
+            target.chartsGenerated = chartsGenerated;
+            target.dataPoints = dataPoints;
+            target.chartType = chartType;
+            target.realTimeUpdate = realTimeUpdate;
+            target.refreshRate = refreshRate;
+            target.colorPalette = colorPalette;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+            target.seriesCount = seriesCount;
+            target.plottedPoints = plottedPoints;
+        }
+    }
+
+    [System.Flags]
+    public enum DataVisualizationField
+    {
+        None = 0,
+        ChartsGenerated = 1 << 0,
+        DataPoints = 1 << 1,
+        ChartType = 1 << 2,
+        RealTimeUpdate = 1 << 3,
+        RefreshRate = 1 << 4,
+        ColorPalette = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        SeriesCount = 1 << 8,
+        PlottedPoints = 1 << 9,
+        All = (1 << 10) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct DataVisualizationDelta
+    {
+        public readonly long timestamp;
+        public readonly DataVisualizationField changed;
+        public readonly DataVisualizationInfo values;
+
+        public DataVisualizationDelta(long timestamp, DataVisualizationField changed, DataVisualizationInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(DataVisualizationField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class DataVisualizationSystem : MonoBehaviour
+    public class DataVisualizationSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("DataVisualization Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Time Series")]
+        public bool sampleSystems = true;
+        public string[] sampledSystems = new string[0];     // empty samples every registered system
+        public int historyCapacity = 4096;
+        public int maxSeries = 512;
+        [SerializeField] private long samplesRecorded = 0;
+        [SerializeField] private long historyBytes = 0;
+
         [Header("Current Data")]
         [SerializeField] private DataVisualizationData currentData;
 
@@ -48,12 +157,24 @@ namespace UnitySim.DataVisualization
 
         // Events
         public System.Action<DataVisualizationData> OnDataVisualizationChanged;
+        public System.Action<DataVisualizationDelta> OnDataVisualizationDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.DataVisualizationSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly DataVisualizationInfo publishedInfo = new DataVisualizationInfo();
+        private bool publishFullDelta = true;
+
+        // Time series
+        private readonly Dictionary<string, TimeSeries> seriesByName = new Dictionary<string, TimeSeries>();
+        private readonly List<TimeSeries> series = new List<TimeSeries>();
+        private TimeSeriesRecorder recorder;
+        private bool seriesLimitLogged = false;
 
         #region Unity Lifecycle
 
@@ -62,18 +183,16 @@ namespace UnitySim.DataVisualization
             InitializeDataVisualization();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +202,13 @@ namespace UnitySim.DataVisualization
         private void InitializeDataVisualization()
         {
             currentData = new DataVisualizationData();
+            seriesByName.Clear();
+            series.Clear();
+            recorder = new TimeSeriesRecorder(name => GetOrCreateSeries(name, historyCapacity));
+            seriesLimitLogged = false;
+            samplesRecorded = 0;
+            historyBytes = 0;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,22 +219,82 @@ namespace UnitySim.DataVisualization
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
+        }
+
+        private void UpdateSpecificData(float deltaTime)
+        {
+            if (sampleSystems) SampleSystems(currentData.timestamp / 1000.0);
+
+            var info = currentData.datavisualization;
+            long points = 0, bytes = 0;
+            for (int i = 0; i < series.Count; i++)
+            {
+                points += series[i].Count;
+                bytes += EstimateBytes(series[i]);
+            }
+
+            int plotted = 0;
+            var charts = TimeSeriesChart.Active;
+            for (int i = 0; i < charts.Count; i++) plotted += charts[i].PlottedPoints;
+
+            info.chartsGenerated = charts.Count;
+            info.dataPoints = points;
+            info.seriesCount = series.Count;
+            info.plottedPoints = plotted;
+            historyBytes = bytes;
+        }
+
+        private void SampleSystems(double time)
+        {
+            var systems = SimulationRegistry.Systems;
+            for (int i = 0; i < systems.Count; i++)
+            {
+                var system = systems[i];
+                if (ReferenceEquals(system, this) || !system.IsInitialized || !IsSampled(system.SystemName)) continue;
+                if (recorder.Record(system, time)) samplesRecorded++;
+            }
         }
 
-        private void UpdateSpecificData()
+        private bool IsSampled(string systemName)
         {
-                        currentData.datavisualization.chartsGenerated += UnityEngine.Random.Range(1, 3);
-            currentData.datavisualization.dataPoints += UnityEngine.Random.Range(10, 50);
+            if (sampledSystems == null || sampledSystems.Length == 0) return true;
+            for (int i = 0; i < sampledSystems.Length; i++)
+            {
+                if (sampledSystems[i] == systemName) return true;
+            }
+            return false;
+        }
+
+        private TimeSeries GetOrCreateSeries(string name, int capacity)
+        {
+            if (seriesByName.TryGetValue(name, out var existing)) return existing;
+            if (series.Count >= maxSeries)
+            {
+                if (!seriesLimitLogged) Debug.LogWarning($"DataVisualizationSystem: Series limit of {maxSeries} reached, not recording {name}");
+                seriesLimitLogged = true;
+                return null;
+            }
+
+            var created = new TimeSeries(name, capacity);
+            seriesByName[name] = created;
+            series.Add(created);
+            return created;
+        }
+
+        // Samples plus about three bytes a sample of min/max pyramid
+        private static long EstimateBytes(TimeSeries timeSeries)
+        {
+            return timeSeries.Capacity * 15L;
         }
 
         private void ProcessUpdate()
@@ -121,6 +307,12 @@ namespace UnitySim.DataVisualization
                 OnDataVisualizationChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -128,10 +320,67 @@ namespace UnitySim.DataVisualization
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.datavisualization;
+            var changed = publishFullDelta ? DataVisualizationField.All : info.Diff(publishedInfo);
+            if (changed == DataVisualizationField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnDataVisualizationDelta?.Invoke(new DataVisualizationDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(DataVisualizationSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("DataVisualizationSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -142,7 +391,9 @@ namespace UnitySim.DataVisualization
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -163,6 +414,31 @@ namespace UnitySim.DataVisualization
             return currentData;
         }
 
+        // Sampled metrics are named "<SystemName>.<object>.<field>", e.g. "EconomySystem.economy.gdp"
+        public TimeSeries GetSeries(string name)
+        {
+            return name != null && seriesByName.TryGetValue(name, out var found) ? found : null;
+        }
+
+        public IReadOnlyList<TimeSeries> GetAllSeries()
+        {
+            return series;
+        }
+
+        // For metrics fed by hand; capacity 0 uses historyCapacity, and an existing series is returned as is
+        public TimeSeries CreateSeries(string name, int capacity = 0)
+        {
+            if (string.IsNullOrEmpty(name)) return null;
+            return GetOrCreateSeries(name, capacity > 0 ? capacity : historyCapacity);
+        }
+
+        // Appends at the current simulation time
+        public bool Record(string name, float value)
+        {
+            var target = CreateSeries(name);
+            return target != null && target.Append(SimulationClock.Now / 1000.0, value);
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -194,7 +470,7 @@ namespace UnitySim.DataVisualization
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -206,6 +482,8 @@ namespace UnitySim.DataVisualization
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            historyCapacity = Mathf.Clamp(historyCapacity, 64, 1 << 24);
+            maxSeries = Mathf.Max(1, maxSeries);
         }
 
         #endregion
@@ -217,7 +495,10 @@ namespace UnitySim.DataVisualization
             Debug.Log($"DataVisualizationSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Time Series: {series.Count} series, {currentData?.datavisualization.dataPoints ?? 0} points, {historyBytes / 1024} KB, {samplesRecorded} samples recorded");
+            Debug.Log($"- Charts: {TimeSeriesChart.Active.Count} active, {currentData?.datavisualization.plottedPoints ?? 0} points plotted");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
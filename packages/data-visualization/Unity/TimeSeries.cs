@@ -0,0 +1,304 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.DataVisualization
+{
+    public enum TimeSeriesDecimation
+    {
+        MinMax,     // each column keeps its lowest and highest sample, so no spike is lost
+        Lttb        // largest-triangle-three-buckets over min/max candidates, for smoother lines
+    }
+
+    // Fixed-capacity history of one metric with a level-of-detail pyramid. Samples go into a
+    // ring buffer; level L keeps the min and max of every 8^L consecutive samples in a ring of
+    // its own, covering the same history. Decimate reads the coarsest level that still has a
+    // bucket per output column, so plotting a million samples costs about the same as a
+    // thousand. Times must not decrease. Not thread-safe.
+    public class TimeSeries
+    {
+        private struct Bucket
+        {
+            public float min;
+            public float max;
+            public double minTime;
+            public double maxTime;
+        }
+
+        private const int LevelShift = 3;
+        private const int MinLevelBuckets = 64;
+
+        private readonly double[] times;
+        private readonly float[] values;
+        private readonly int mask;
+        private readonly Bucket[][] levels;
+        private long appended = 0;
+
+        // Decimate scratch
+        private readonly List<Vector2> candidates = new List<Vector2>();
+
+        public string Name { get; }
+        public int Capacity => values.Length;
+        public int LevelCount => levels.Length;
+        public int Count => (int)Math.Min(appended, values.Length);
+        public long TotalAppended => appended;
+
+        // Bumped by every append, so renderers can skip rebuilding unchanged charts
+        public int Version { get; private set; }
+
+        public double FirstTime => appended > 0 ? times[(appended - Count) & mask] : 0.0;
+        public double LastTime => appended > 0 ? times[(appended - 1) & mask] : 0.0;
+        public float LastValue => appended > 0 ? values[(appended - 1) & mask] : 0f;
+
+        // Capacity is rounded up to a power of two
+        public TimeSeries(string name, int capacity)
+        {
+            Name = name;
+
+            int size = MinLevelBuckets;
+            while (size < capacity && size < (1 << 26)) size <<= 1;
+            times = new double[size];
+            values = new float[size];
+            mask = size - 1;
+
+            var pyramid = new List<Bucket[]>();
+            for (int shift = LevelShift; (size >> shift) >= MinLevelBuckets; shift += LevelShift)
+            {
+                pyramid.Add(new Bucket[size >> shift]);
+            }
+            levels = pyramid.ToArray();
+        }
+
+        // Returns false for NaN; earlier times are clamped to the last one
+        public bool Append(double time, float value)
+        {
+            if (float.IsNaN(value)) return false;
+            if (appended > 0 && time < LastTime) time = LastTime;
+
+            long index = appended;
+            times[index & mask] = time;
+            values[index & mask] = value;
+
+            for (int level = 0; level < levels.Length; level++)
+            {
+                int shift = (level + 1) * LevelShift;
+                var ring = levels[level];
+                ref var bucket = ref ring[(index >> shift) & (ring.Length - 1)];
+
+                if ((index & ((1L << shift) - 1)) == 0)
+                {
+                    bucket.min = value;
+                    bucket.max = value;
+                    bucket.minTime = time;
+                    bucket.maxTime = time;
+                    continue;
+                }
+
+                if (value < bucket.min)
+                {
+                    bucket.min = value;
+                    bucket.minTime = time;
+                }
+                if (value > bucket.max)
+                {
+                    bucket.max = value;
+                    bucket.maxTime = time;
+                }
+            }
+
+            appended++;
+            Version++;
+            return true;
+        }
+
+        public void Clear()
+        {
+            appended = 0;
+            Version++;
+        }
+
+        // At most about 2 * columns points from [start, end]. x is seconds since start, so
+        // float precision holds for any absolute time; y is the value.
+        public void Decimate(double start, double end, int columns, TimeSeriesDecimation mode, List<Vector2> output)
+        {
+            output.Clear();
+            columns = Math.Max(1, columns);
+
+            long first = LowerBound(start);
+            long last = UpperBound(end);
+            if (last <= first) return;
+
+            if (mode == TimeSeriesDecimation.Lttb)
+            {
+                // MinMax preselection at twice the resolution keeps extremes as LTTB candidates
+                MinMax(first, last, start, columns * 2, candidates);
+                Lttb(candidates, columns, output);
+                return;
+            }
+
+            MinMax(first, last, start, columns, output);
+        }
+
+        private void MinMax(long first, long last, double origin, int columns, List<Vector2> output)
+        {
+            output.Clear();
+            long count = last - first;
+            if (count <= columns * 2L)
+            {
+                for (long i = first; i < last; i++) output.Add(new Vector2((float)(times[i & mask] - origin), values[i & mask]));
+                return;
+            }
+
+            // Coarsest level with at least one bucket per column; level -1 is the raw samples
+            int level = -1;
+            while (level + 1 < levels.Length && (count >> ((level + 2) * LevelShift)) >= columns) level++;
+
+            int shift = (level + 1) * LevelShift;
+            long firstBucket = first >> shift;
+            long lastBucket = (last - 1) >> shift;
+
+            // The oldest retained sample's bucket may share a ring slot with the newest one
+            if (level >= 0)
+            {
+                long oldest = ((appended - 1) >> shift) - levels[level].Length + 1;
+                firstBucket = Math.Max(firstBucket, oldest);
+            }
+            long bucketCount = lastBucket - firstBucket + 1;
+
+            for (int c = 0; c < columns; c++)
+            {
+                long from = firstBucket + bucketCount * c / columns;
+                long to = firstBucket + bucketCount * (c + 1) / columns;
+                if (to <= from) continue;
+
+                float min = float.PositiveInfinity, max = float.NegativeInfinity;
+                double minTime = 0.0, maxTime = 0.0;
+                for (long b = from; b < to; b++)
+                {
+                    GetBucket(level, b, out float bucketMin, out double bucketMinTime, out float bucketMax, out double bucketMaxTime);
+                    if (bucketMin < min)
+                    {
+                        min = bucketMin;
+                        minTime = bucketMinTime;
+                    }
+                    if (bucketMax > max)
+                    {
+                        max = bucketMax;
+                        maxTime = bucketMaxTime;
+                    }
+                }
+
+                // Both extremes, in time order
+                if (minTime == maxTime)
+                {
+                    output.Add(new Vector2((float)(minTime - origin), min));
+                }
+                else if (minTime < maxTime)
+                {
+                    output.Add(new Vector2((float)(minTime - origin), min));
+                    output.Add(new Vector2((float)(maxTime - origin), max));
+                }
+                else
+                {
+                    output.Add(new Vector2((float)(maxTime - origin), max));
+                    output.Add(new Vector2((float)(minTime - origin), min));
+                }
+            }
+        }
+
+        private void GetBucket(int level, long bucket, out float min, out double minTime, out float max, out double maxTime)
+        {
+            if (level < 0)
+            {
+                min = max = values[bucket & mask];
+                minTime = maxTime = times[bucket & mask];
+                return;
+            }
+
+            var ring = levels[level];
+            ref var entry = ref ring[bucket & (ring.Length - 1)];
+            min = entry.min;
+            max = entry.max;
+            minTime = entry.minTime;
+            maxTime = entry.maxTime;
+        }
+
+        // Keeps the first and last points and, per bucket between them, the point forming the
+        // largest triangle with the previous pick and the next bucket's average
+        private static void Lttb(List<Vector2> data, int threshold, List<Vector2> output)
+        {
+            output.Clear();
+            int count = data.Count;
+            if (threshold >= count || threshold < 3)
+            {
+                for (int i = 0; i < count; i++) output.Add(data[i]);
+                return;
+            }
+
+            double every = (double)(count - 2) / (threshold - 2);
+            int previous = 0;
+            output.Add(data[0]);
+
+            for (int i = 0; i < threshold - 2; i++)
+            {
+                int nextStart = (int)Math.Floor((i + 1) * every) + 1;
+                int nextEnd = Math.Min((int)Math.Floor((i + 2) * every) + 1, count);
+                float averageX = 0f, averageY = 0f;
+                for (int k = nextStart; k < nextEnd; k++)
+                {
+                    averageX += data[k].x;
+                    averageY += data[k].y;
+                }
+                int span = Math.Max(1, nextEnd - nextStart);
+                averageX /= span;
+                averageY /= span;
+
+                int start = (int)Math.Floor(i * every) + 1;
+                int end = (int)Math.Floor((i + 1) * every) + 1;
+                var a = data[previous];
+                float bestArea = -1f;
+                int best = start;
+                for (int k = start; k < end; k++)
+                {
+                    float area = Math.Abs((a.x - averageX) * (data[k].y - a.y) - (a.x - data[k].x) * (averageY - a.y));
+                    if (area > bestArea)
+                    {
+                        bestArea = area;
+                        best = k;
+                    }
+                }
+
+                output.Add(data[best]);
+                previous = best;
+            }
+
+            output.Add(data[count - 1]);
+        }
+
+        // First retained index with time >= t
+        private long LowerBound(double t)
+        {
+            long low = appended - Count, high = appended;
+            while (low < high)
+            {
+                long middle = low + (high - low) / 2;
+                if (times[middle & mask] < t) low = middle + 1;
+                else high = middle;
+            }
+            return low;
+        }
+
+        // First retained index with time > t
+        private long UpperBound(double t)
+        {
+            long low = appended - Count, high = appended;
+            while (low < high)
+            {
+                long middle = low + (high - low) / 2;
+                if (times[middle & mask] <= t) low = middle + 1;
+                else high = middle;
+            }
+            return low;
+        }
+    }
+}
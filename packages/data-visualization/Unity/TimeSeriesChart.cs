@@ -0,0 +1,248 @@
+using System.Collections.Generic;
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnitySim.Core;
+
+namespace UnitySim.DataVisualization
+{
+    // Line chart of DataVisualizationSystem series, drawn as one dynamic mesh in the XY plane of
+    // this transform with its origin at the bottom-left. Each segment is a quad with vertex
+    // colours, so a chart is a single draw call. Series are decimated to about two points per
+    // column before meshing, and the mesh is only rebuilt when a plotted series changes.
+    [RequireComponent(typeof(MeshFilter), typeof(MeshRenderer))]
+    public class TimeSeriesChart : MonoBehaviour
+    {
+        private static readonly List<TimeSeriesChart> active = new List<TimeSeriesChart>();
+
+        // Enabled charts, for DataVisualizationSystem's stats
+        public static IReadOnlyList<TimeSeriesChart> Active => active;
+
+        [Header("Data")]
+        public DataVisualizationSystem source;
+        public string[] metrics = new string[0];
+        public float timeSpan = 300f;       // seconds back from the newest sample; 0 plots everything
+        public bool autoScale = true;
+        public float minValue = 0f;
+        public float maxValue = 1f;
+
+        [Header("Rendering")]
+        public Vector2 size = new Vector2(8f, 3f);
+        public int columns = 512;
+        public float lineWidth = 0.03f;
+        public TimeSeriesDecimation decimation = TimeSeriesDecimation.MinMax;
+        public Color[] colors =
+        {
+            new Color(0.30f, 0.75f, 0.93f), new Color(0.93f, 0.53f, 0.18f),
+            new Color(0.47f, 0.79f, 0.30f), new Color(0.87f, 0.30f, 0.45f)
+        };
+        [SerializeField] private int plottedPoints = 0;
+        [SerializeField] private long historyPoints = 0;
+
+        private Mesh mesh;
+        private TimeSeries[] series = new TimeSeries[0];
+        private int[] seriesVersions = new int[0];
+        private List<Vector2>[] decimated = new List<Vector2>[0];
+        private Vector3[] vertices = new Vector3[0];
+        private Color[] vertexColors = new Color[0];
+        private int[] indices = new int[0];
+        private bool dirty = true;
+
+        public int PlottedPoints => plottedPoints;
+        public long HistoryPoints => historyPoints;
+
+        #region Unity Lifecycle
+
+        void Awake()
+        {
+            mesh = new Mesh();
+            mesh.MarkDynamic();
+            GetComponent<MeshFilter>().sharedMesh = mesh;
+
+            var meshRenderer = GetComponent<MeshRenderer>();
+            if (meshRenderer.sharedMaterial == null) meshRenderer.sharedMaterial = new Material(Shader.Find("Sprites/Default"));
+        }
+
+        void OnEnable()
+        {
+            if (!active.Contains(this)) active.Add(this);
+            dirty = true;
+        }
+
+        void OnDisable()
+        {
+            active.Remove(this);
+        }
+
+        void LateUpdate()
+        {
+            if (source == null) source = SimulationRegistry.Find<DataVisualizationSystem>();
+            if (source == null || mesh == null) return;
+
+            ResolveSeries();
+            if (!dirty && !SeriesChanged()) return;
+
+            Rebuild();
+            dirty = false;
+        }
+
+        void OnValidate()
+        {
+            timeSpan = Mathf.Max(0f, timeSpan);
+            columns = Mathf.Clamp(columns, 2, 8192);
+            lineWidth = Mathf.Max(0.0001f, lineWidth);
+            if (maxValue <= minValue) maxValue = minValue + 1f;
+            dirty = true;
+        }
+
+        #endregion
+
+        #region Meshing
+
+        private void ResolveSeries()
+        {
+            if (series.Length != metrics.Length)
+            {
+                series = new TimeSeries[metrics.Length];
+                seriesVersions = new int[metrics.Length];
+                decimated = new List<Vector2>[metrics.Length];
+                for (int i = 0; i < decimated.Length; i++) decimated[i] = new List<Vector2>();
+                dirty = true;
+            }
+
+            // Looked up every frame: a reset replaces the series objects under the same names
+            for (int i = 0; i < metrics.Length; i++)
+            {
+                var resolved = source.GetSeries(metrics[i]);
+                if (ReferenceEquals(resolved, series[i])) continue;
+                series[i] = resolved;
+                dirty = true;
+            }
+        }
+
+        private bool SeriesChanged()
+        {
+            for (int i = 0; i < series.Length; i++)
+            {
+                if (series[i] != null && series[i].Version != seriesVersions[i]) return true;
+            }
+            return false;
+        }
+
+        private void Rebuild()
+        {
+            // One shared time axis ending at the newest sample of any plotted series
+            double end = double.MinValue, first = double.MaxValue;
+            historyPoints = 0;
+            for (int i = 0; i < series.Length; i++)
+            {
+                if (series[i] == null || series[i].Count == 0) continue;
+                end = System.Math.Max(end, series[i].LastTime);
+                first = System.Math.Min(first, series[i].FirstTime);
+                historyPoints += series[i].Count;
+            }
+
+            mesh.Clear();
+            plottedPoints = 0;
+            if (end == double.MinValue) return;
+
+            double start = timeSpan > 0f ? end - timeSpan : first;
+            float span = (float)System.Math.Max(1e-6, end - start);
+
+            float low = float.PositiveInfinity, high = float.NegativeInfinity;
+            int segments = 0;
+            for (int i = 0; i < series.Length; i++)
+            {
+                var points = decimated[i];
+                points.Clear();
+                if (series[i] == null) continue;
+
+                seriesVersions[i] = series[i].Version;
+                series[i].Decimate(start, end, columns, decimation, points);
+                plottedPoints += points.Count;
+                segments += Mathf.Max(0, points.Count - 1);
+                for (int p = 0; p < points.Count; p++)
+                {
+                    low = Mathf.Min(low, points[p].y);
+                    high = Mathf.Max(high, points[p].y);
+                }
+            }
+
+            if (!autoScale || low > high)
+            {
+                low = minValue;
+                high = maxValue;
+            }
+            if (high - low < 1e-6f)
+            {
+                low -= 0.5f;
+                high += 0.5f;
+            }
+
+            EnsureCapacity(segments);
+
+            float xScale = size.x / span;
+            float yScale = size.y / (high - low);
+            float halfWidth = lineWidth * 0.5f;
+            int vertex = 0, index = 0;
+
+            for (int i = 0; i < series.Length; i++)
+            {
+                var points = decimated[i];
+                var color = colors.Length > 0 ? colors[i % colors.Length] : Color.white;
+
+                for (int p = 0; p + 1 < points.Count; p++)
+                {
+                    float x0 = Mathf.Clamp(points[p].x * xScale, 0f, size.x);
+                    float y0 = (points[p].y - low) * yScale;
+                    float x1 = Mathf.Clamp(points[p + 1].x * xScale, 0f, size.x);
+                    float y1 = (points[p + 1].y - low) * yScale;
+
+                    // Offset both ends along the segment's normal
+                    float dx = x1 - x0, dy = y1 - y0;
+                    float length = Mathf.Sqrt(dx * dx + dy * dy);
+                    float nx = length > 1e-6f ? -dy / length * halfWidth : 0f;
+                    float ny = length > 1e-6f ? dx / length * halfWidth : halfWidth;
+
+                    vertices[vertex] = new Vector3(x0 + nx, y0 + ny, 0f);
+                    vertices[vertex + 1] = new Vector3(x0 - nx, y0 - ny, 0f);
+                    vertices[vertex + 2] = new Vector3(x1 + nx, y1 + ny, 0f);
+                    vertices[vertex + 3] = new Vector3(x1 - nx, y1 - ny, 0f);
+                    for (int k = 0; k < 4; k++) vertexColors[vertex + k] = color;
+
+                    indices[index++] = vertex;
+                    indices[index++] = vertex + 1;
+                    indices[index++] = vertex + 2;
+                    indices[index++] = vertex + 2;
+                    indices[index++] = vertex + 1;
+                    indices[index++] = vertex + 3;
+                    vertex += 4;
+                }
+            }
+
+            mesh.indexFormat = vertex > 65535 ? IndexFormat.UInt32 : IndexFormat.UInt16;
+            mesh.SetVertices(vertices, 0, vertex);
+            mesh.SetColors(vertexColors, 0, vertex);
+            mesh.SetIndices(indices, 0, index, MeshTopology.Triangles, 0, false);
+            mesh.bounds = new Bounds(new Vector3(size.x * 0.5f, size.y * 0.5f, 0f), new Vector3(size.x + lineWidth, size.y + lineWidth, 0.01f));
+        }
+
+        // Grows the reusable buffers; steady state allocates nothing
+        private void EnsureCapacity(int segments)
+        {
+            if (vertices.Length >= segments * 4) return;
+
+            int capacity = Mathf.Max(segments, vertices.Length / 2);
+            vertices = new Vector3[capacity * 4];
+            vertexColors = new Color[capacity * 4];
+            indices = new int[capacity * 6];
+        }
+
+        #endregion
+
+        [ContextMenu("Rebuild Chart")]
+        public void ForceRebuild()
+        {
+            dirty = true;
+        }
+    }
+}
@@ -0,0 +1,153 @@
+using System;
+using System.Collections.Generic;
+using System.Text;
+using UnityEngine;
+using UnitySim.Core;
+
+namespace UnitySim.DataVisualization
+{
+    // Appends every numeric field a state source writes to a series named
+    // "<SystemName>.<object>.<field>". WriteState emits fields in a stable order, so each
+    // source remembers its sequence of names and series and a sample only compares the name
+    // (by reference, for literals); a path string is built only when the shape changes.
+    public class TimeSeriesRecorder : IStateWriter
+    {
+        private enum StepKind
+        {
+            Object,
+            Field,
+            X,
+            Y
+        }
+
+        private struct Step
+        {
+            public string name;
+            public StepKind kind;
+            public TimeSeries series;
+        }
+
+        private class Layout
+        {
+            public readonly List<Step> steps = new List<Step>();
+        }
+
+        private readonly Func<string, TimeSeries> resolve;
+        private readonly Dictionary<IStateSource, Layout> layouts = new Dictionary<IStateSource, Layout>();
+        private readonly List<string> path = new List<string>();
+        private readonly StringBuilder pathBuilder = new StringBuilder(128);
+        private Layout layout;
+        private string systemName;
+        private int cursor;
+        private double time;
+
+        // resolve returns the series for a full metric name, or null to skip that field
+        public TimeSeriesRecorder(Func<string, TimeSeries> resolve)
+        {
+            this.resolve = resolve ?? throw new ArgumentNullException(nameof(resolve));
+        }
+
+        // Appends one sample per numeric field at time (seconds)
+        public bool Record(IStateSource source, double time)
+        {
+            if (source == null) return false;
+
+            if (!layouts.TryGetValue(source, out layout))
+            {
+                layout = new Layout();
+                layouts[source] = layout;
+            }
+
+            systemName = source.SystemName;
+            this.time = time;
+            cursor = 0;
+            path.Clear();
+
+            bool written = source.WriteState(this);
+
+            // Fields that stopped being written drop out of the layout
+            if (written && cursor < layout.steps.Count) layout.steps.RemoveRange(cursor, layout.steps.Count - cursor);
+            layout = null;
+            return written;
+        }
+
+        public void Forget(IStateSource source)
+        {
+            if (source != null) layouts.Remove(source);
+        }
+
+        #region IStateWriter
+
+        public void BeginObject(string name)
+        {
+            Match(name, StepKind.Object);
+            path.Add(name);
+        }
+
+        public void EndObject()
+        {
+            if (path.Count > 0) path.RemoveAt(path.Count - 1);
+        }
+
+        public void Write(string name, int value) => Sample(name, StepKind.Field, value);
+        public void Write(string name, long value) => Sample(name, StepKind.Field, value);
+        public void Write(string name, float value) => Sample(name, StepKind.Field, value);
+        public void Write(string name, bool value) => Sample(name, StepKind.Field, value ? 1f : 0f);
+        public void Write(string name, string value) { }
+
+        public void Write(string name, Vector2Int value)
+        {
+            Sample(name, StepKind.X, value.x);
+            Sample(name, StepKind.Y, value.y);
+        }
+
+        #endregion
+
+        private void Sample(string name, StepKind kind, float value)
+        {
+            // Wall-clock stamps at the top level duplicate the time axis
+            if (path.Count <= 1 && (name == "timestamp" || name == "currentTime")) return;
+
+            var series = Match(name, kind);
+            series?.Append(time, value);
+        }
+
+        private TimeSeries Match(string name, StepKind kind)
+        {
+            var steps = layout.steps;
+            if (cursor < steps.Count)
+            {
+                var step = steps[cursor];
+                if (step.name == name && step.kind == kind)
+                {
+                    cursor++;
+                    return step.series;
+                }
+
+                // The shape changed from here on; relearn the rest
+                steps.RemoveRange(cursor, steps.Count - cursor);
+            }
+
+            var added = new Step { name = name, kind = kind, series = kind == StepKind.Object ? null : resolve(BuildPath(name, kind)) };
+            steps.Add(added);
+            cursor++;
+            return added.series;
+        }
+
+        private string BuildPath(string name, StepKind kind)
+        {
+            pathBuilder.Clear();
+            pathBuilder.Append(systemName);
+            for (int i = 0; i < path.Count; i++)
+            {
+                if (string.IsNullOrEmpty(path[i])) continue;
+                pathBuilder.Append('.').Append(path[i]);
+            }
+            pathBuilder.Append('.').Append(name);
+
+            if (kind == StepKind.X) pathBuilder.Append(".x");
+            else if (kind == StepKind.Y) pathBuilder.Append(".y");
+            return pathBuilder.ToString();
+        }
+    }
+}
@@ -0,0 +1,79 @@
+using System;
+using UnitySim.Core;
+
+namespace UnitySim.DisasterManagement
+{
+    // Disaster state and step logic with no MonoBehaviour, so it can run off the main thread
+    public class DisasterManagementModel : ISimulationModel
+    {
+        public const float EventChance = 0.1f;
+
+        private readonly DisasterManagementInfo state;
+        private Unity.Mathematics.Random random;
+        private WeatherSample conditions;
+        private bool hasConditions = false;
+
+        public DisasterManagementInfo State => state;
+
+        public DisasterManagementModel(uint seed) : this(new DisasterManagementInfo(), seed)
+        {
+        }
+
+        public DisasterManagementModel(DisasterManagementInfo state, uint seed)
+        {
+            this.state = state ?? new DisasterManagementInfo();
+            random = new Unity.Mathematics.Random(seed == 0 ? 1u : seed);
+        }
+
+        // Local weather for the next steps; without it the model keeps its flat event chance
+        public void SetConditions(in WeatherSample sample)
+        {
+            conditions = sample;
+            hasConditions = true;
+        }
+
+        public void ClearConditions()
+        {
+            hasConditions = false;
+        }
+
+        public void Step(float deltaTime)
+        {
+            // Severe weather only raises the chance of an emergency starting, not of one ending
+            float chance = EventChance;
+            if (hasConditions && !state.emergencyActive)
+                chance = Math.Min(1f, chance * Risk(conditions));
+
+            if (random.NextFloat() < chance)
+            {
+                state.emergencyActive = !state.emergencyActive;
+                state.intensity = random.NextFloat(1f, 10f);
+
+                if (hasConditions)
+                    state.disasterType = state.emergencyActive ? Classify(conditions) : "none";
+            }
+        }
+
+        private static float Risk(in WeatherSample weather)
+        {
+            return 1f
+                + Math.Max(0f, weather.windSpeed - 15f) / 10f
+                + weather.precipitation * 2f
+                + Math.Max(0f, weather.temperature - 35f) / 5f;
+        }
+
+        private static string Classify(in WeatherSample weather)
+        {
+            if (weather.windSpeed >= 20f) return "storm";
+            if (weather.precipitation >= 0.5f) return "flood";
+            if (weather.temperature >= 35f) return "heatwave";
+            if (weather.humidity < 30f) return "wildfire";
+            return "earthquake";
+        }
+
+        public void WriteState(IStateWriter writer)
+        {
+            state.WriteState(writer, "disastermanagement");
+        }
+    }
+}
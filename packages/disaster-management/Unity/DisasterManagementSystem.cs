@@ -1,6 +1,9 @@
 using System;
+using System.Buffers;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.DisasterManagement
 {
@@ -13,10 +16,22 @@ namespace UnitySim.DisasterManagement
 
         public DisasterManagementData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             disastermanagement = new DisasterManagementInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (disastermanagement != null)
+                disastermanagement.WriteState(writer, "disastermanagement");
+            else
+                writer.Write("disastermanagement", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +45,93 @@ namespace UnitySim.DisasterManagement
         public float responseTime = 0f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-disaster-management";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("disasterType", disasterType);
+            writer.Write("intensity", intensity);
+            writer.Write("radius", radius);
+            writer.Write("emergencyActive", emergencyActive);
+            writer.Write("evacuatedPeople", evacuatedPeople);
+            writer.Write("responseTime", responseTime);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public DisasterManagementField Diff(DisasterManagementInfo other)
+        {
+            var changed = DisasterManagementField.None;
+            if (disasterType != other.disasterType) changed |= DisasterManagementField.DisasterType;
+            if (intensity != other.intensity) changed |= DisasterManagementField.Intensity;
+            if (radius != other.radius) changed |= DisasterManagementField.Radius;
+            if (emergencyActive != other.emergencyActive) changed |= DisasterManagementField.EmergencyActive;
+            if (evacuatedPeople != other.evacuatedPeople) changed |= DisasterManagementField.EvacuatedPeople;
+            if (responseTime != other.responseTime) changed |= DisasterManagementField.ResponseTime;
+            if (systemHealth != other.systemHealth) changed |= DisasterManagementField.SystemHealth;
+            if (framework != other.framework) changed |= DisasterManagementField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(DisasterManagementInfo target)
+        {
+            target.disasterType = disasterType;
+            target.intensity = intensity;
+            target.radius = radius;
+            target.emergencyActive = emergencyActive;
+            target.evacuatedPeople = evacuatedPeople;
+            target.responseTime = responseTime;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
     }
 
-    public class DisasterManagementSystem : MonoBehaviour
+    [System.Flags]
+    public enum DisasterManagementField
+    {
+        None = 0,
+        DisasterType = 1 << 0,
+        Intensity = 1 << 1,
+        Radius = 1 << 2,
+        EmergencyActive = 1 << 3,
+        EvacuatedPeople = 1 << 4,
+        ResponseTime = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct DisasterManagementDelta
+    {
+        public readonly long timestamp;
+        public readonly DisasterManagementField changed;
+        public readonly DisasterManagementInfo values;
+
+        public DisasterManagementDelta(long timestamp, DisasterManagementField changed, DisasterManagementInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(DisasterManagementField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class DisasterManagementSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("DisasterManagement Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Local Weather")]
+        public bool useLocalWeather = true;
+
         [Header("Current Data")]
         [SerializeField] private DisasterManagementData currentData;
 
@@ -48,12 +141,19 @@ namespace UnitySim.DisasterManagement
 
         // Events
         public System.Action<DisasterManagementData> OnDisasterManagementChanged;
+        public System.Action<DisasterManagementDelta> OnDisasterManagementDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.DisasterManagementSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly DisasterManagementInfo publishedInfo = new DisasterManagementInfo();
+        private bool publishFullDelta = true;
+        private DisasterManagementModel model;
 
         #region Unity Lifecycle
 
@@ -62,18 +162,16 @@ namespace UnitySim.DisasterManagement
             InitializeDisasterManagement();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +181,8 @@ namespace UnitySim.DisasterManagement
         private void InitializeDisasterManagement()
         {
             currentData = new DisasterManagementData();
+            model = new DisasterManagementModel(currentData.disastermanagement, (uint)UnityEngine.Random.Range(1, int.MaxValue));
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,24 +193,27 @@ namespace UnitySim.DisasterManagement
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        if (UnityEngine.Random.Range(0f, 1f) < 0.1f) {
-              currentData.disastermanagement.emergencyActive = !currentData.disastermanagement.emergencyActive;
-              currentData.disastermanagement.intensity = UnityEngine.Random.Range(1f, 10f);
-            }
+            var weather = useLocalWeather ? SimulationRegistry.Find<IWeatherProvider>() : null;
+            if (weather != null)
+                model.SetConditions(weather.SampleWeather(transform.position));
+            else
+                model.ClearConditions();
+
+            model.Step(deltaTime);
         }
 
         private void ProcessUpdate()
@@ -123,6 +226,12 @@ namespace UnitySim.DisasterManagement
                 OnDisasterManagementChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -130,10 +239,67 @@ namespace UnitySim.DisasterManagement
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.disastermanagement;
+            var changed = publishFullDelta ? DisasterManagementField.All : info.Diff(publishedInfo);
+            if (changed == DisasterManagementField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnDisasterManagementDelta?.Invoke(new DisasterManagementDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(DisasterManagementSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("DisasterManagementSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -144,7 +310,9 @@ namespace UnitySim.DisasterManagement
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -196,7 +364,7 @@ namespace UnitySim.DisasterManagement
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -219,6 +387,7 @@ namespace UnitySim.DisasterManagement
             Debug.Log($"DisasterManagementSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -0,0 +1,53 @@
+using System.Collections.Generic;
+using UnitySim.Core;
+
+namespace UnitySim.Economy
+{
+    // Economy state and step logic with no MonoBehaviour, so it can run off the main thread.
+    // The step is defined by the same channels the job backend runs.
+    public class EconomyModel : ISimulationModel
+    {
+        private static readonly SimulationChannel[] Channels = CreateChannels();
+
+        private readonly EconomyInfo state;
+        private Unity.Mathematics.Random random;
+
+        public EconomyInfo State => state;
+
+        public EconomyModel(uint seed) : this(new EconomyInfo(), seed)
+        {
+        }
+
+        public EconomyModel(EconomyInfo state, uint seed)
+        {
+            this.state = state ?? new EconomyInfo();
+            random = new Unity.Mathematics.Random(seed == 0 ? 1u : seed);
+        }
+
+        public static void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.Multiply(-0.01f, 0.02f));
+            channels.Add(SimulationChannel.Add(-0.1f, 0.1f));
+            channels.Add(SimulationChannel.Add(-0.2f, 0.2f).Clamp(0f, 25f));
+        }
+
+        public void Step(float deltaTime)
+        {
+            state.gdp = (float)Channels[0].Step(state.gdp, ref random);
+            state.inflation = (float)Channels[1].Step(state.inflation, ref random);
+            state.unemployment = (float)Channels[2].Step(state.unemployment, ref random);
+        }
+
+        public void WriteState(IStateWriter writer)
+        {
+            state.WriteState(writer, "economy");
+        }
+
+        private static SimulationChannel[] CreateChannels()
+        {
+            var channels = new List<SimulationChannel>();
+            DescribeChannels(channels);
+            return channels.ToArray();
+        }
+    }
+}
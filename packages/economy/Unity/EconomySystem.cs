@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Economy
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Economy
 
         public EconomyData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             economy = new EconomyInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (economy != null)
+                economy.WriteState(writer, "economy");
+            else
+                writer.Write("economy", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,9 +46,84 @@ namespace UnitySim.Economy
         public float businessInvestment = 23f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-economy";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("gdp", gdp);
+            writer.Write("inflation", inflation);
+            writer.Write("unemployment", unemployment);
+            writer.Write("marketValue", marketValue);
+            writer.Write("consumerSpending", consumerSpending);
+            writer.Write("businessInvestment", businessInvestment);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public EconomyField Diff(EconomyInfo other)
+        {
+            var changed = EconomyField.None;
+            if (gdp != other.gdp) changed |= EconomyField.Gdp;
+            if (inflation != other.inflation) changed |= EconomyField.Inflation;
+            if (unemployment != other.unemployment) changed |= EconomyField.Unemployment;
+            if (marketValue != other.marketValue) changed |= EconomyField.MarketValue;
+            if (consumerSpending != other.consumerSpending) changed |= EconomyField.ConsumerSpending;
+            if (businessInvestment != other.businessInvestment) changed |= EconomyField.BusinessInvestment;
+            if (systemHealth != other.systemHealth) changed |= EconomyField.SystemHealth;
+            if (framework != other.framework) changed |= EconomyField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(EconomyInfo target)
+        {
+            target.gdp = gdp;
+            target.inflation = inflation;
+            target.unemployment = unemployment;
+            target.marketValue = marketValue;
+            target.consumerSpending = consumerSpending;
+            target.businessInvestment = businessInvestment;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum EconomyField
+    {
+        None = 0,
+        Gdp = 1 << 0,
+        Inflation = 1 << 1,
+        Unemployment = 1 << 2,
+        MarketValue = 1 << 3,
+        ConsumerSpending = 1 << 4,
+        BusinessInvestment = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct EconomyDelta
+    {
+        public readonly long timestamp;
+        public readonly EconomyField changed;
+        public readonly EconomyInfo values;
+
+        public EconomyDelta(long timestamp, EconomyField changed, EconomyInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(EconomyField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class EconomySystem : MonoBehaviour
+    public class EconomySystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem
     {
         [Header("Economy Settings")]
         public float updateInterval = 1f;
@@ -48,12 +139,20 @@ namespace UnitySim.Economy
 
         // Events
         public System.Action<EconomyData> OnEconomyChanged;
+        public System.Action<EconomyDelta> OnEconomyDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.EconomySystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly EconomyInfo publishedInfo = new EconomyInfo();
+        private bool publishFullDelta = true;
+        private EconomyModel model;
+        private int stateVersion = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +161,16 @@ namespace UnitySim.Economy
             InitializeEconomy();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +180,9 @@ namespace UnitySim.Economy
         private void InitializeEconomy()
         {
             currentData = new EconomyData();
+            model = new EconomyModel(currentData.economy, (uint)UnityEngine.Random.Range(1, int.MaxValue));
+            stateVersion++;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +193,21 @@ namespace UnitySim.Economy
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.economy.gdp *= (1 + UnityEngine.Random.Range(-0.01f, 0.02f));
-            currentData.economy.inflation += UnityEngine.Random.Range(-0.1f, 0.1f);
-            currentData.economy.unemployment = Mathf.Clamp(currentData.economy.unemployment + UnityEngine.Random.Range(-0.2f, 0.2f), 0f, 25f);
+            model.Step(deltaTime);
         }
 
         private void ProcessUpdate()
@@ -122,6 +220,12 @@ namespace UnitySim.Economy
                 OnEconomyChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +233,94 @@ namespace UnitySim.Economy
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.economy;
+            var changed = publishFullDelta ? EconomyField.All : info.Diff(publishedInfo);
+            if (changed == EconomyField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnEconomyDelta?.Invoke(new EconomyDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(EconomySystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            EconomyModel.DescribeChannels(channels);
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.economy.gdp;
+            values[1] = currentData.economy.inflation;
+            values[2] = currentData.economy.unemployment;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.economy.gdp = (float)values[0];
+            currentData.economy.inflation = (float)values[1];
+            currentData.economy.unemployment = (float)values[2];
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("EconomySystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +331,9 @@ namespace UnitySim.Economy
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +385,7 @@ namespace UnitySim.Economy
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -218,6 +408,7 @@ namespace UnitySim.Economy
             Debug.Log($"EconomySystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Ecosystem
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Ecosystem
 
         public EcosystemData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             ecosystem = new EcosystemInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (ecosystem != null)
+                ecosystem.WriteState(writer, "ecosystem");
+            else
+                writer.Write("ecosystem", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,9 +46,84 @@ namespace UnitySim.Ecosystem
         public float oxygenLevel = 21f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-ecosystem";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("species", species);
+            writer.Write("biodiversity", biodiversity);
+            writer.Write("predators", predators);
+            writer.Write("prey", prey);
+            writer.Write("carbonLevel", carbonLevel);
+            writer.Write("oxygenLevel", oxygenLevel);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public EcosystemField Diff(EcosystemInfo other)
+        {
+            var changed = EcosystemField.None;
+            if (species != other.species) changed |= EcosystemField.Species;
+            if (biodiversity != other.biodiversity) changed |= EcosystemField.Biodiversity;
+            if (predators != other.predators) changed |= EcosystemField.Predators;
+            if (prey != other.prey) changed |= EcosystemField.Prey;
+            if (carbonLevel != other.carbonLevel) changed |= EcosystemField.CarbonLevel;
+            if (oxygenLevel != other.oxygenLevel) changed |= EcosystemField.OxygenLevel;
+            if (systemHealth != other.systemHealth) changed |= EcosystemField.SystemHealth;
+            if (framework != other.framework) changed |= EcosystemField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(EcosystemInfo target)
+        {
+            target.species = species;
+            target.biodiversity = biodiversity;
+            target.predators = predators;
+            target.prey = prey;
+            target.carbonLevel = carbonLevel;
+            target.oxygenLevel = oxygenLevel;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum EcosystemField
+    {
+        None = 0,
+        Species = 1 << 0,
+        Biodiversity = 1 << 1,
+        Predators = 1 << 2,
+        Prey = 1 << 3,
+        CarbonLevel = 1 << 4,
+        OxygenLevel = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct EcosystemDelta
+    {
+        public readonly long timestamp;
+        public readonly EcosystemField changed;
+        public readonly EcosystemInfo values;
+
+        public EcosystemDelta(long timestamp, EcosystemField changed, EcosystemInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(EcosystemField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class EcosystemSystem : MonoBehaviour
+    public class EcosystemSystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem
     {
         [Header("Ecosystem Settings")]
         public float updateInterval = 1f;
@@ -48,12 +139,19 @@ namespace UnitySim.Ecosystem
 
         // Events
         public System.Action<EcosystemData> OnEcosystemChanged;
+        public System.Action<EcosystemDelta> OnEcosystemDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.EcosystemSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly EcosystemInfo publishedInfo = new EcosystemInfo();
+        private bool publishFullDelta = true;
+        private int stateVersion = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +160,16 @@ namespace UnitySim.Ecosystem
             InitializeEcosystem();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +179,8 @@ namespace UnitySim.Ecosystem
         private void InitializeEcosystem()
         {
             currentData = new EcosystemData();
+            stateVersion++;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,19 +191,19 @@ namespace UnitySim.Ecosystem
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
                         currentData.ecosystem.biodiversity += UnityEngine.Random.Range(-1f, 1f);
             currentData.ecosystem.carbonLevel += UnityEngine.Random.Range(-0.5f, 0.5f);
@@ -122,6 +220,12 @@ namespace UnitySim.Ecosystem
                 OnEcosystemChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +233,96 @@ namespace UnitySim.Ecosystem
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.ecosystem;
+            var changed = publishFullDelta ? EcosystemField.All : info.Diff(publishedInfo);
+            if (changed == EcosystemField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnEcosystemDelta?.Invoke(new EcosystemDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(EcosystemSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.Add(-1f, 1f));
+            channels.Add(SimulationChannel.Add(-0.5f, 0.5f));
+            channels.Add(SimulationChannel.AddInt(-1, 2).WithMin(1f));
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.ecosystem.biodiversity;
+            values[1] = currentData.ecosystem.carbonLevel;
+            values[2] = currentData.ecosystem.species;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.ecosystem.biodiversity = (float)values[0];
+            currentData.ecosystem.carbonLevel = (float)values[1];
+            currentData.ecosystem.species = (int)values[2];
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("EcosystemSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +333,9 @@ namespace UnitySim.Ecosystem
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +387,7 @@ namespace UnitySim.Ecosystem
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -218,6 +410,7 @@ namespace UnitySim.Ecosystem
             Debug.Log($"EcosystemSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -1,6 +1,11 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Mathematics;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.ElectricalGrid
 {
@@ -13,10 +18,22 @@ namespace UnitySim.ElectricalGrid
 
         public ElectricalGridData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             electricalgrid = new ElectricalGridInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (electricalgrid != null)
+                electricalgrid.WriteState(writer, "electricalgrid");
+            else
+                writer.Write("electricalgrid", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +47,118 @@ namespace UnitySim.ElectricalGrid
         public float efficiency = 85f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-electrical-grid";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("totalGeneration", totalGeneration);
+            writer.Write("totalConsumption", totalConsumption);
+            writer.Write("gridFrequency", gridFrequency);
+            writer.Write("voltage", voltage);
+            writer.Write("powerPlants", powerPlants);
+            writer.Write("efficiency", efficiency);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public ElectricalGridField Diff(ElectricalGridInfo other)
+        {
+            var changed = ElectricalGridField.None;
+            if (totalGeneration != other.totalGeneration) changed |= ElectricalGridField.TotalGeneration;
+            if (totalConsumption != other.totalConsumption) changed |= ElectricalGridField.TotalConsumption;
+            if (gridFrequency != other.gridFrequency) changed |= ElectricalGridField.GridFrequency;
+            if (voltage != other.voltage) changed |= ElectricalGridField.Voltage;
+            if (powerPlants != other.powerPlants) changed |= ElectricalGridField.PowerPlants;
+            if (efficiency != other.efficiency) changed |= ElectricalGridField.Efficiency;
+            if (systemHealth != other.systemHealth) changed |= ElectricalGridField.SystemHealth;
+            if (framework != other.framework) changed |= ElectricalGridField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(ElectricalGridInfo target)
+        {
+            target.totalGeneration = totalGeneration;
+            target.totalConsumption = totalConsumption;
+            target.gridFrequency = gridFrequency;
+            target.voltage = voltage;
+            target.powerPlants = powerPlants;
+            target.efficiency = efficiency;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum ElectricalGridField
+    {
+        None = 0,
+        TotalGeneration = 1 << 0,
+        TotalConsumption = 1 << 1,
+        GridFrequency = 1 << 2,
+        Voltage = 1 << 3,
+        PowerPlants = 1 << 4,
+        Efficiency = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
     }
 
-    public class ElectricalGridSystem : MonoBehaviour
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct ElectricalGridDelta
+    {
+        public readonly long timestamp;
+        public readonly ElectricalGridField changed;
+        public readonly ElectricalGridInfo values;
+
+        public ElectricalGridDelta(long timestamp, ElectricalGridField changed, ElectricalGridInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(ElectricalGridField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class ElectricalGridSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("ElectricalGrid Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Network")]
+        public Vector2Int busGrid = new Vector2Int(120, 120);
+        public Vector2 lineReactance = new Vector2(0.01f, 0.05f);
+        public float resistanceRatio = 0.2f;
+        public float averageBusLoadMw = 0.15f;
+        public float capacityMargin = 1.3f;
+        public int randomSeed = 0;
+
+        [Header("Demand")]
+        public float dailyLoadSwing = 0.2f;
+        public int loadUpdatesPerTick = 64;
+        public float loadNoise = 0.1f;
+        public float breakerTripChance = 0.01f;
+        public float reclosureSeconds = 30f;
+
+        [Header("Frequency Control")]
+        public float nominalFrequency = 60f;
+        public float inertiaSeconds = 5f;
+        public float droop = 0.05f;
+        public float loadDamping = 1f;
+        public float agcTimeConstant = 30f;
+
+        [Header("Solver")]
+        public float solverTolerance = 1e-4f;
+        public int maxSolverIterations = 500;
+        [SerializeField] private int lastIterations = 0;
+        [SerializeField] private float lastSolveMs = 0f;
+
         [Header("Current Data")]
         [SerializeField] private ElectricalGridData currentData;
 
@@ -48,12 +168,29 @@ namespace UnitySim.ElectricalGrid
 
         // Events
         public System.Action<ElectricalGridData> OnElectricalGridChanged;
+        public System.Action<ElectricalGridDelta> OnElectricalGridDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.ElectricalGridSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly ElectricalGridInfo publishedInfo = new ElectricalGridInfo();
+        private bool publishFullDelta = true;
+        private PowerNetwork network;
+        private float[] baseLoad;
+        private int[] plantBus;
+        private float[] plantCapacity;
+        private float totalCapacity = 0f;
+        private float generationSetpoint = 0f;
+        private float generationOutput = 0f;
+        private float frequencyDeviation = 0f;
+        private int trippedLine = -1;
+        private float trippedFor = 0f;
+        private Unity.Mathematics.Random random;
 
         #region Unity Lifecycle
 
@@ -62,18 +199,22 @@ namespace UnitySim.ElectricalGrid
             InitializeElectricalGrid();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            network?.Dispose();
+            network = null;
         }
 
         #endregion
@@ -83,33 +224,180 @@ namespace UnitySim.ElectricalGrid
         private void InitializeElectricalGrid()
         {
             currentData = new ElectricalGridData();
+            BuildNetwork();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
                 Debug.Log($"ElectricalGridSystem initialized successfully");
         }
 
+        // A meshed grid of buses with randomised line impedances and plants spread over it
+        private void BuildNetwork()
+        {
+            network?.Dispose();
+
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            random = new Unity.Mathematics.Random(seed);
+
+            int columns = Mathf.Max(2, busGrid.x);
+            int rows = Mathf.Max(2, busGrid.y);
+            int buses = columns * rows;
+
+            var lines = new List<int2>(buses * 2);
+            var reactance = new List<float>(buses * 2);
+            var resistance = new List<float>(buses * 2);
+            for (int y = 0; y < rows; y++)
+            {
+                for (int x = 0; x < columns; x++)
+                {
+                    int bus = x + y * columns;
+                    if (x + 1 < columns) AddLine(lines, reactance, resistance, bus, bus + 1);
+                    if (y + 1 < rows) AddLine(lines, reactance, resistance, bus, bus + columns);
+                }
+            }
+
+            int plants = Mathf.Max(1, currentData.electricalgrid.powerPlants);
+            plantBus = new int[plants];
+            plantCapacity = new float[plants];
+            for (int i = 0; i < plants; i++) plantBus[i] = random.NextInt(0, buses);
+
+            // The first plant is the slack bus and balances whatever the others do not cover
+            network = new PowerNetwork(buses, lines, reactance, resistance, plantBus[0]);
+            network.Tolerance = solverTolerance;
+            network.MaxIterations = maxSolverIterations;
+
+            baseLoad = new float[buses];
+            float totalLoad = 0f;
+            for (int b = 0; b < buses; b++)
+            {
+                baseLoad[b] = averageBusLoadMw * random.NextFloat(0.2f, 1.8f);
+                network.SetLoadMw(b, baseLoad[b]);
+                totalLoad += baseLoad[b];
+            }
+
+            totalCapacity = totalLoad * (1f + dailyLoadSwing) * capacityMargin;
+            for (int i = 0; i < plants; i++) plantCapacity[i] = totalCapacity / plants;
+
+            generationSetpoint = totalLoad;
+            generationOutput = totalLoad;
+            frequencyDeviation = 0f;
+            trippedLine = -1;
+        }
+
+        private void AddLine(List<int2> lines, List<float> reactance, List<float> resistance, int from, int to)
+        {
+            float x = random.NextFloat(lineReactance.x, Mathf.Max(lineReactance.x, lineReactance.y));
+            lines.Add(new int2(from, to));
+            reactance.Add(x);
+            resistance.Add(x * resistanceRatio);
+        }
+
         #endregion
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
+        }
+
+        private void UpdateSpecificData(float deltaTime)
+        {
+            if (network == null) return;
+
+            UpdateDemand(deltaTime);
+            UpdateBreakers(deltaTime);
+            UpdateFrequency(deltaTime);
+
+            // Plants share the output by capacity; the slack absorbs the flow mismatch
+            float share = totalCapacity > 0f ? generationOutput / totalCapacity : 0f;
+            for (int i = 0; i < plantBus.Length; i++) network.SetGenerationMw(plantBus[i], 0f);
+            for (int i = 0; i < plantBus.Length; i++)
+                network.SetGenerationMw(plantBus[i], network.GetGenerationMw(plantBus[i]) + plantCapacity[i] * share);
+
+            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+            lastIterations = network.Solve();
+            lastSolveMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+
+            var info = currentData.electricalgrid;
+            float served = network.ServedLoadMw;
+            info.totalGeneration = generationOutput;
+            info.totalConsumption = served;
+            info.gridFrequency = nominalFrequency + frequencyDeviation;
+            info.powerPlants = plantBus.Length;
+            info.efficiency = served + network.LossesMw > 0f ? 100f * served / (served + network.LossesMw) : 0f;
+        }
+
+        // A daily profile scales every load; a few buses also drift each tick
+        private void UpdateDemand(float deltaTime)
+        {
+            double hours = SimulationClock.Now / 3600000.0;
+            float dayPhase = (float)(hours % 24.0) / 24f;
+            network.LoadScale = 1f + dailyLoadSwing * Mathf.Sin((dayPhase - 0.375f) * 2f * Mathf.PI);
+
+            for (int i = 0; i < loadUpdatesPerTick; i++)
+            {
+                int bus = random.NextInt(0, baseLoad.Length);
+                network.SetLoadMw(bus, baseLoad[bus] * (1f + random.NextFloat(-loadNoise, loadNoise)));
+            }
         }
 
-        private void UpdateSpecificData()
+        // Occasionally trips one line and recloses it later, islanding buses on the way
+        private void UpdateBreakers(float deltaTime)
         {
-                        currentData.electricalgrid.totalConsumption += UnityEngine.Random.Range(-100f, 100f);
-            currentData.electricalgrid.gridFrequency = 60f + UnityEngine.Random.Range(-0.1f, 0.1f);
-            currentData.electricalgrid.efficiency = Mathf.Clamp(currentData.electricalgrid.efficiency + UnityEngine.Random.Range(-1f, 1f), 70f, 95f);
+            if (trippedLine >= 0)
+            {
+                trippedFor += deltaTime;
+                if (trippedFor >= reclosureSeconds)
+                {
+                    network.SetBreaker(trippedLine, true);
+                    trippedLine = -1;
+                }
+            }
+            else if (random.NextFloat() < breakerTripChance)
+            {
+                trippedLine = random.NextInt(0, network.LineCount);
+                trippedFor = 0f;
+                network.SetBreaker(trippedLine, false);
+            }
+        }
+
+        // Aggregate swing equation with droop and AGC; substepped because the droop loop
+        // settles in well under a second
+        private void UpdateFrequency(float deltaTime)
+        {
+            float demand = network.ServedLoadMw + network.LossesMw;
+            if (demand <= 0f) demand = network.LoadScale * SumBaseLoad();
+
+            int substeps = Mathf.Max(1, Mathf.CeilToInt(deltaTime / 0.05f));
+            float step = deltaTime / substeps;
+            float inertia = 2f * Mathf.Max(0.1f, inertiaSeconds) * Mathf.Max(1f, totalCapacity) / nominalFrequency;
+            float agc = 1f - Mathf.Exp(-step / Mathf.Max(0.1f, agcTimeConstant));
+
+            for (int i = 0; i < substeps; i++)
+            {
+                generationSetpoint += (demand - generationSetpoint) * agc;
+                float primary = -totalCapacity * (frequencyDeviation / nominalFrequency) / Mathf.Max(0.001f, droop);
+                generationOutput = Mathf.Clamp(generationSetpoint + primary, 0f, totalCapacity);
+
+                float damping = loadDamping * demand * frequencyDeviation / nominalFrequency;
+                frequencyDeviation += (generationOutput - demand - damping) / inertia * step;
+            }
+        }
+
+        private float SumBaseLoad()
+        {
+            float total = 0f;
+            for (int b = 0; b < baseLoad.Length; b++) total += baseLoad[b];
+            return total;
         }
 
         private void ProcessUpdate()
@@ -122,6 +410,12 @@ namespace UnitySim.ElectricalGrid
                 OnElectricalGridChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +423,67 @@ namespace UnitySim.ElectricalGrid
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.electricalgrid;
+            var changed = publishFullDelta ? ElectricalGridField.All : info.Diff(publishedInfo);
+            if (changed == ElectricalGridField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnElectricalGridDelta?.Invoke(new ElectricalGridDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(ElectricalGridSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("ElectricalGridSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +494,9 @@ namespace UnitySim.ElectricalGrid
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +517,27 @@ namespace UnitySim.ElectricalGrid
             return currentData;
         }
 
+        public PowerNetwork GetNetwork()
+        {
+            return network;
+        }
+
+        public void SetBusLoad(int bus, float megawatts)
+        {
+            if (network == null || bus < 0 || bus >= baseLoad.Length) return;
+
+            baseLoad[bus] = Mathf.Max(0f, megawatts);
+            network.SetLoadMw(bus, baseLoad[bus]);
+        }
+
+        public void SetBreaker(int line, bool closed)
+        {
+            if (network == null || line < 0 || line >= network.LineCount) return;
+
+            if (line == trippedLine) trippedLine = -1;
+            network.SetBreaker(line, closed);
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +569,7 @@ namespace UnitySim.ElectricalGrid
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +581,17 @@ namespace UnitySim.ElectricalGrid
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            busGrid = Vector2Int.Max(busGrid, new Vector2Int(2, 2));
+            lineReactance.x = Mathf.Max(0.0001f, lineReactance.x);
+            lineReactance.y = Mathf.Max(lineReactance.x, lineReactance.y);
+            loadUpdatesPerTick = Mathf.Max(0, loadUpdatesPerTick);
+            maxSolverIterations = Mathf.Max(1, maxSolverIterations);
+
+            if (network != null)
+            {
+                network.Tolerance = solverTolerance;
+                network.MaxIterations = maxSolverIterations;
+            }
         }
 
         #endregion
@@ -218,7 +603,10 @@ namespace UnitySim.ElectricalGrid
             Debug.Log($"ElectricalGridSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (network != null)
+                Debug.Log($"- Network: {network.BusCount} buses, {network.LineCount} lines, {network.EnergizedBuses} energized, last solve {lastIterations} iterations in {lastSolveMs:F2}ms");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -0,0 +1,605 @@
+using System;
+using System.Collections.Generic;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+
+namespace UnitySim.ElectricalGrid
+{
+    // DC power flow on a bus/line network. The susceptance matrix B is stored once in CSR
+    // form with a fixed pattern; loads and generation only change the right-hand side and
+    // breakers only rewrite values. Each solve is a conjugate gradient warm-started from the
+    // previous angles, so a tick where a few injections moved costs a few iterations.
+    // The preconditioner is an incomplete Cholesky factor on the same pattern, recomputed
+    // only when breakers change the topology; there is never a full factorisation.
+    public class PowerNetwork : IDisposable
+    {
+        public const float BaseMva = 100f;
+
+        private readonly int busCount;
+        private readonly int lineCount;
+        private readonly int slackBus;
+
+        // Lines
+        private NativeArray<int> lineFrom;
+        private NativeArray<int> lineTo;
+        private NativeArray<float> lineSusceptance;
+        private NativeArray<float> lineResistance;
+        private NativeArray<byte> lineClosed;
+        private NativeArray<int> lineEntryFrom;
+        private NativeArray<int> lineEntryTo;
+
+        // CSR matrix: row r spans rowStart[r]..rowStart[r + 1], diagonal first
+        private NativeArray<int> rowStart;
+        private NativeArray<int> column;
+        private NativeArray<float> value;
+
+        // IC(0) factor L: per row the distinct lower columns ascending, then the diagonal.
+        // entrySlot maps each off-diagonal matrix entry below the diagonal to its slot.
+        private NativeArray<int> lowerStart;
+        private NativeArray<int> lowerColumn;
+        private NativeArray<int> entrySlot;
+        private NativeArray<double> factor;
+
+        // Buses; injections in per unit, angles in radians
+        private NativeArray<float> load;
+        private NativeArray<float> generation;
+        private NativeArray<byte> energized;
+        private NativeArray<double> theta;
+
+        // CG scratch and results
+        private NativeArray<double> rhs;
+        private NativeArray<double> residual;
+        private NativeArray<double> preconditioned;
+        private NativeArray<double> direction;
+        private NativeArray<double> product;
+        private NativeArray<float> results;
+
+        private readonly List<int>[] incident;
+        private bool topologyDirty = true;
+        private bool disposed = false;
+
+        public int BusCount => busCount;
+        public int LineCount => lineCount;
+        public int SlackBus => slackBus;
+        public int NonZeros => column.Length;
+
+        // Multiplies every bus load, e.g. a daily demand profile, without touching the buses
+        public float LoadScale { get; set; } = 1f;
+
+        // Relative residual at which a solve stops
+        public float Tolerance { get; set; } = 1e-4f;
+        public int MaxIterations { get; set; } = 500;
+
+        // Results of the last solve
+        public int LastIterations { get; private set; }
+        public float LastResidual { get; private set; }
+        public float LossesMw => results[2] * BaseMva;
+        public float ServedLoadMw => results[3] * BaseMva;
+        public float ShedLoadMw => results[4] * BaseMva;
+        public float MaxLineFlowMw => results[5] * BaseMva;
+        public int EnergizedBuses { get; private set; }
+
+        public PowerNetwork(int busCount, IList<int2> lines, IList<float> reactance, IList<float> resistance, int slackBus)
+        {
+            this.busCount = Math.Max(1, busCount);
+            lineCount = lines.Count;
+            this.slackBus = Math.Min(Math.Max(0, slackBus), this.busCount - 1);
+
+            lineFrom = new NativeArray<int>(lineCount, Allocator.Persistent);
+            lineTo = new NativeArray<int>(lineCount, Allocator.Persistent);
+            lineSusceptance = new NativeArray<float>(lineCount, Allocator.Persistent);
+            lineResistance = new NativeArray<float>(lineCount, Allocator.Persistent);
+            lineClosed = new NativeArray<byte>(lineCount, Allocator.Persistent);
+            lineEntryFrom = new NativeArray<int>(lineCount, Allocator.Persistent);
+            lineEntryTo = new NativeArray<int>(lineCount, Allocator.Persistent);
+
+            incident = new List<int>[this.busCount];
+            for (int b = 0; b < this.busCount; b++) incident[b] = new List<int>(4);
+
+            for (int l = 0; l < lineCount; l++)
+            {
+                lineFrom[l] = lines[l].x;
+                lineTo[l] = lines[l].y;
+                lineSusceptance[l] = 1f / Math.Max(1e-5f, reactance[l]);
+                lineResistance[l] = Math.Max(0f, resistance[l]);
+                lineClosed[l] = 1;
+                incident[lines[l].x].Add(l);
+                incident[lines[l].y].Add(l);
+            }
+
+            load = new NativeArray<float>(this.busCount, Allocator.Persistent);
+            generation = new NativeArray<float>(this.busCount, Allocator.Persistent);
+            energized = new NativeArray<byte>(this.busCount, Allocator.Persistent);
+            theta = new NativeArray<double>(this.busCount, Allocator.Persistent);
+            rhs = new NativeArray<double>(this.busCount, Allocator.Persistent);
+            residual = new NativeArray<double>(this.busCount, Allocator.Persistent);
+            preconditioned = new NativeArray<double>(this.busCount, Allocator.Persistent);
+            direction = new NativeArray<double>(this.busCount, Allocator.Persistent);
+            product = new NativeArray<double>(this.busCount, Allocator.Persistent);
+            results = new NativeArray<float>(6, Allocator.Persistent);
+
+            BuildStructure();
+        }
+
+        #region Structure
+
+        // One diagonal plus one entry per incident line; the pattern never changes afterwards
+        private void BuildStructure()
+        {
+            rowStart = new NativeArray<int>(busCount + 1, Allocator.Persistent);
+            int entries = 0;
+            for (int b = 0; b < busCount; b++)
+            {
+                rowStart[b] = entries;
+                entries += 1 + incident[b].Count;
+            }
+            rowStart[busCount] = entries;
+
+            column = new NativeArray<int>(entries, Allocator.Persistent);
+            value = new NativeArray<float>(entries, Allocator.Persistent);
+            entrySlot = new NativeArray<int>(entries, Allocator.Persistent);
+
+            for (int b = 0; b < busCount; b++)
+            {
+                int entry = rowStart[b];
+                column[entry++] = b;
+                foreach (int l in incident[b])
+                {
+                    bool from = lineFrom[l] == b;
+                    column[entry] = from ? lineTo[l] : lineFrom[l];
+                    if (from) lineEntryFrom[l] = entry;
+                    else lineEntryTo[l] = entry;
+                    entry++;
+                }
+            }
+
+            // Lower pattern of the factor; parallel lines share one slot
+            var lowerColumns = new List<int>();
+            var starts = new int[busCount + 1];
+            var row = new SortedSet<int>();
+            for (int b = 0; b < busCount; b++)
+            {
+                starts[b] = lowerColumns.Count;
+                row.Clear();
+                for (int e = rowStart[b] + 1; e < rowStart[b + 1]; e++)
+                {
+                    if (column[e] < b) row.Add(column[e]);
+                }
+                lowerColumns.AddRange(row);
+                lowerColumns.Add(b);
+            }
+            starts[busCount] = lowerColumns.Count;
+
+            lowerStart = new NativeArray<int>(starts, Allocator.Persistent);
+            lowerColumn = new NativeArray<int>(lowerColumns.ToArray(), Allocator.Persistent);
+            factor = new NativeArray<double>(lowerColumns.Count, Allocator.Persistent);
+
+            for (int b = 0; b < busCount; b++)
+            {
+                for (int e = rowStart[b]; e < rowStart[b + 1]; e++)
+                {
+                    int c = column[e];
+                    entrySlot[e] = -1;
+                    if (c >= b) continue;
+
+                    for (int slot = starts[b]; slot < starts[b + 1] - 1; slot++)
+                    {
+                        if (lowerColumns[slot] == c)
+                        {
+                            entrySlot[e] = slot;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Rewrites matrix values after breaker changes and refactors the preconditioner.
+        // Buses cut off from the slack become identity rows so the matrix stays positive definite.
+        private void RefreshTopology()
+        {
+            for (int b = 0; b < busCount; b++) energized[b] = 0;
+
+            var stack = new Stack<int>();
+            stack.Push(slackBus);
+            energized[slackBus] = 1;
+            int count = 1;
+            while (stack.Count > 0)
+            {
+                int b = stack.Pop();
+                foreach (int l in incident[b])
+                {
+                    if (lineClosed[l] == 0) continue;
+
+                    int other = lineFrom[l] == b ? lineTo[l] : lineFrom[l];
+                    if (energized[other] != 0) continue;
+
+                    energized[other] = 1;
+                    count++;
+                    stack.Push(other);
+                }
+            }
+            EnergizedBuses = count;
+
+            for (int b = 0; b < busCount; b++) value[rowStart[b]] = 0f;
+
+            for (int l = 0; l < lineCount; l++)
+            {
+                int from = lineFrom[l];
+                int to = lineTo[l];
+                bool live = lineClosed[l] != 0 && energized[from] != 0;
+
+                float b = live ? lineSusceptance[l] : 0f;
+                if (from != slackBus) value[rowStart[from]] += b;
+                if (to != slackBus) value[rowStart[to]] += b;
+
+                // Couplings to the slack drop out because its angle is fixed at zero
+                float off = live && from != slackBus && to != slackBus ? -b : 0f;
+                value[lineEntryFrom[l]] = off;
+                value[lineEntryTo[l]] = off;
+            }
+
+            for (int b = 0; b < busCount; b++)
+            {
+                if (b == slackBus || energized[b] == 0) value[rowStart[b]] = 1f;
+                if (energized[b] == 0) theta[b] = 0.0;
+            }
+            theta[slackBus] = 0.0;
+
+            new IncompleteCholeskyJob
+            {
+                rowStart = rowStart,
+                value = value,
+                entrySlot = entrySlot,
+                lowerStart = lowerStart,
+                lowerColumn = lowerColumn,
+                factor = factor
+            }.Schedule().Complete();
+
+            topologyDirty = false;
+        }
+
+        #endregion
+
+        #region Inputs
+
+        public float GetLoadMw(int bus) => load[bus] * BaseMva;
+        public float GetGenerationMw(int bus) => generation[bus] * BaseMva;
+        public bool IsEnergized(int bus) => energized[bus] != 0;
+        public float GetAngle(int bus) => (float)theta[bus];
+        public bool IsClosed(int line) => lineClosed[line] != 0;
+
+        public void SetLoadMw(int bus, float megawatts)
+        {
+            load[bus] = megawatts / BaseMva;
+        }
+
+        public void SetGenerationMw(int bus, float megawatts)
+        {
+            generation[bus] = megawatts / BaseMva;
+        }
+
+        public void SetBreaker(int line, bool closed)
+        {
+            byte state = closed ? (byte)1 : (byte)0;
+            if (lineClosed[line] == state) return;
+
+            lineClosed[line] = state;
+            topologyDirty = true;
+        }
+
+        public float GetLineFlowMw(int line)
+        {
+            if (lineClosed[line] == 0 || energized[lineFrom[line]] == 0) return 0f;
+            return (float)(lineSusceptance[line] * (theta[lineFrom[line]] - theta[lineTo[line]])) * BaseMva;
+        }
+
+        #endregion
+
+        #region Solve
+
+        // Solves for bus angles and line flows; returns the CG iterations used
+        public int Solve()
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(PowerNetwork));
+            if (topologyDirty) RefreshTopology();
+
+            var handle = new ConjugateGradientJob
+            {
+                slackBus = slackBus,
+                loadScale = LoadScale,
+                tolerance = Tolerance,
+                maxIterations = MaxIterations,
+                rowStart = rowStart,
+                column = column,
+                value = value,
+                lowerStart = lowerStart,
+                lowerColumn = lowerColumn,
+                factor = factor,
+                load = load,
+                generation = generation,
+                energized = energized,
+                rhs = rhs,
+                theta = theta,
+                residual = residual,
+                preconditioned = preconditioned,
+                direction = direction,
+                product = product,
+                results = results
+            }.Schedule();
+
+            new FlowJob
+            {
+                loadScale = LoadScale,
+                lineFrom = lineFrom,
+                lineTo = lineTo,
+                lineSusceptance = lineSusceptance,
+                lineResistance = lineResistance,
+                lineClosed = lineClosed,
+                load = load,
+                energized = energized,
+                theta = theta,
+                results = results
+            }.Schedule(handle).Complete();
+
+            LastIterations = (int)results[0];
+            LastResidual = results[1];
+            return LastIterations;
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            disposed = true;
+
+            lineFrom.Dispose();
+            lineTo.Dispose();
+            lineSusceptance.Dispose();
+            lineResistance.Dispose();
+            lineClosed.Dispose();
+            lineEntryFrom.Dispose();
+            lineEntryTo.Dispose();
+            rowStart.Dispose();
+            column.Dispose();
+            value.Dispose();
+            lowerStart.Dispose();
+            lowerColumn.Dispose();
+            entrySlot.Dispose();
+            factor.Dispose();
+            load.Dispose();
+            generation.Dispose();
+            energized.Dispose();
+            theta.Dispose();
+            rhs.Dispose();
+            residual.Dispose();
+            preconditioned.Dispose();
+            direction.Dispose();
+            product.Dispose();
+            results.Dispose();
+        }
+
+        #endregion
+
+        #region Jobs
+
+        // Row-wise IC(0): L keeps the lower pattern of B, so no fill-in is created
+        [BurstCompile]
+        private struct IncompleteCholeskyJob : IJob
+        {
+            [ReadOnly] public NativeArray<int> rowStart;
+            [ReadOnly] public NativeArray<float> value;
+            [ReadOnly] public NativeArray<int> entrySlot;
+            [ReadOnly] public NativeArray<int> lowerStart;
+            [ReadOnly] public NativeArray<int> lowerColumn;
+            public NativeArray<double> factor;
+
+            public void Execute()
+            {
+                int n = rowStart.Length - 1;
+                for (int i = 0; i < n; i++)
+                {
+                    int start = lowerStart[i];
+                    int diagonal = lowerStart[i + 1] - 1;
+
+                    for (int slot = start; slot <= diagonal; slot++) factor[slot] = 0.0;
+                    factor[diagonal] = value[rowStart[i]];
+                    for (int e = rowStart[i] + 1; e < rowStart[i + 1]; e++)
+                    {
+                        int slot = entrySlot[e];
+                        if (slot >= 0) factor[slot] += value[e];
+                    }
+
+                    double sumSquares = 0.0;
+                    for (int slot = start; slot < diagonal; slot++)
+                    {
+                        int k = lowerColumn[slot];
+                        int kStart = lowerStart[k];
+                        int kDiagonal = lowerStart[k + 1] - 1;
+
+                        // Dot product of rows i and k over shared columns below k
+                        double dot = 0.0;
+                        int a = start, b = kStart;
+                        while (a < slot && b < kDiagonal)
+                        {
+                            int ca = lowerColumn[a], cb = lowerColumn[b];
+                            if (ca == cb) { dot += factor[a] * factor[b]; a++; b++; }
+                            else if (ca < cb) a++;
+                            else b++;
+                        }
+
+                        double l = (factor[slot] - dot) / factor[kDiagonal];
+                        factor[slot] = l;
+                        sumSquares += l * l;
+                    }
+
+                    // Guard against breakdown; B is an M-matrix so this only trips on round-off
+                    double pivot = factor[diagonal] - sumSquares;
+                    factor[diagonal] = math.sqrt(math.max(pivot, 1e-12 * math.max(1.0, factor[diagonal])));
+                }
+            }
+        }
+
+        [BurstCompile]
+        private struct ConjugateGradientJob : IJob
+        {
+            public int slackBus;
+            public float loadScale;
+            public float tolerance;
+            public int maxIterations;
+
+            [ReadOnly] public NativeArray<int> rowStart;
+            [ReadOnly] public NativeArray<int> column;
+            [ReadOnly] public NativeArray<float> value;
+            [ReadOnly] public NativeArray<int> lowerStart;
+            [ReadOnly] public NativeArray<int> lowerColumn;
+            [ReadOnly] public NativeArray<double> factor;
+            [ReadOnly] public NativeArray<float> load;
+            [ReadOnly] public NativeArray<float> generation;
+            [ReadOnly] public NativeArray<byte> energized;
+            public NativeArray<double> rhs;
+            public NativeArray<double> theta;
+            public NativeArray<double> residual;
+            public NativeArray<double> preconditioned;
+            public NativeArray<double> direction;
+            public NativeArray<double> product;
+            public NativeArray<float> results;
+
+            public void Execute()
+            {
+                int n = theta.Length;
+
+                // Net injections; the slack row is pinned to zero and balances the rest
+                double rhsNorm = 0.0;
+                for (int b = 0; b < n; b++)
+                {
+                    double p = b != slackBus && energized[b] != 0 ? generation[b] - load[b] * loadScale : 0.0;
+                    rhs[b] = p;
+                    rhsNorm += p * p;
+                }
+                double threshold = tolerance * math.sqrt(math.max(rhsNorm, 1e-30));
+
+                // Warm start: r = b - A x from the previous angles
+                Multiply(theta, product);
+                double rr = 0.0;
+                for (int b = 0; b < n; b++)
+                {
+                    double r = rhs[b] - product[b];
+                    residual[b] = r;
+                    rr += r * r;
+                }
+
+                int iteration = 0;
+                double rz = 0.0;
+                while (iteration < maxIterations && math.sqrt(rr) > threshold)
+                {
+                    Precondition();
+
+                    double rzNext = 0.0;
+                    for (int b = 0; b < n; b++) rzNext += residual[b] * preconditioned[b];
+
+                    double beta = iteration == 0 ? 0.0 : rzNext / rz;
+                    rz = rzNext;
+                    for (int b = 0; b < n; b++) direction[b] = preconditioned[b] + beta * direction[b];
+
+                    Multiply(direction, product);
+                    double pAp = 0.0;
+                    for (int b = 0; b < n; b++) pAp += direction[b] * product[b];
+                    if (pAp <= 0.0) break;
+
+                    double alpha = rz / pAp;
+                    rr = 0.0;
+                    for (int b = 0; b < n; b++)
+                    {
+                        theta[b] += alpha * direction[b];
+                        double r = residual[b] - alpha * product[b];
+                        residual[b] = r;
+                        rr += r * r;
+                    }
+                    iteration++;
+                }
+
+                results[0] = iteration;
+                results[1] = (float)(math.sqrt(rr) / math.sqrt(math.max(rhsNorm, 1e-30)));
+            }
+
+            private void Multiply(NativeArray<double> x, NativeArray<double> y)
+            {
+                int n = x.Length;
+                for (int row = 0; row < n; row++)
+                {
+                    double sum = 0.0;
+                    int end = rowStart[row + 1];
+                    for (int e = rowStart[row]; e < end; e++) sum += value[e] * x[column[e]];
+                    y[row] = sum;
+                }
+            }
+
+            // z = (L L^T)^-1 r: forward substitution, then backward by scattering along rows of L
+            private void Precondition()
+            {
+                int n = residual.Length;
+                for (int i = 0; i < n; i++)
+                {
+                    int diagonal = lowerStart[i + 1] - 1;
+                    double sum = residual[i];
+                    for (int slot = lowerStart[i]; slot < diagonal; slot++) sum -= factor[slot] * preconditioned[lowerColumn[slot]];
+                    preconditioned[i] = sum / factor[diagonal];
+                }
+
+                for (int i = n - 1; i >= 0; i--)
+                {
+                    int diagonal = lowerStart[i + 1] - 1;
+                    double z = preconditioned[i] / factor[diagonal];
+                    preconditioned[i] = z;
+                    for (int slot = lowerStart[i]; slot < diagonal; slot++) preconditioned[lowerColumn[slot]] -= factor[slot] * z;
+                }
+            }
+        }
+
+        [BurstCompile]
+        private struct FlowJob : IJob
+        {
+            public float loadScale;
+            [ReadOnly] public NativeArray<int> lineFrom;
+            [ReadOnly] public NativeArray<int> lineTo;
+            [ReadOnly] public NativeArray<float> lineSusceptance;
+            [ReadOnly] public NativeArray<float> lineResistance;
+            [ReadOnly] public NativeArray<byte> lineClosed;
+            [ReadOnly] public NativeArray<float> load;
+            [ReadOnly] public NativeArray<byte> energized;
+            [ReadOnly] public NativeArray<double> theta;
+            public NativeArray<float> results;
+
+            public void Execute()
+            {
+                // Losses are estimated as r * f^2 from the lossless flows
+                double losses = 0.0;
+                float maxFlow = 0f;
+                for (int l = 0; l < lineFrom.Length; l++)
+                {
+                    if (lineClosed[l] == 0 || energized[lineFrom[l]] == 0) continue;
+
+                    float flow = (float)(lineSusceptance[l] * (theta[lineFrom[l]] - theta[lineTo[l]]));
+                    losses += lineResistance[l] * flow * flow;
+                    maxFlow = math.max(maxFlow, math.abs(flow));
+                }
+
+                double served = 0.0, shed = 0.0;
+                for (int b = 0; b < load.Length; b++)
+                {
+                    if (energized[b] != 0) served += load[b];
+                    else shed += load[b];
+                }
+
+                results[2] = (float)losses;
+                results[3] = (float)(served * loadScale);
+                results[4] = (float)(shed * loadScale);
+                results[5] = maxFlow;
+            }
+        }
+
+        #endregion
+    }
+}
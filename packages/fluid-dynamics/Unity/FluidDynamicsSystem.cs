@@ -1,6 +1,11 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Jobs;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.FluidDynamics
 {
@@ -13,10 +18,22 @@ namespace UnitySim.FluidDynamics
 
         public FluidDynamicsData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             fluiddynamics = new FluidDynamicsInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (fluiddynamics != null)
+                fluiddynamics.WriteState(writer, "fluiddynamics");
+            else
+                writer.Write("fluiddynamics", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +47,107 @@ namespace UnitySim.FluidDynamics
         public float temperature = 20f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-fluid-dynamics";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("velocity", velocity);
+            writer.Write("pressure", pressure);
+            writer.Write("density", density);
+            writer.Write("viscosity", viscosity);
+            writer.Write("flowType", flowType);
+            writer.Write("temperature", temperature);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public FluidDynamicsField Diff(FluidDynamicsInfo other)
+        {
+            var changed = FluidDynamicsField.None;
+            if (velocity != other.velocity) changed |= FluidDynamicsField.Velocity;
+            if (pressure != other.pressure) changed |= FluidDynamicsField.Pressure;
+            if (density != other.density) changed |= FluidDynamicsField.Density;
+            if (viscosity != other.viscosity) changed |= FluidDynamicsField.Viscosity;
+            if (flowType != other.flowType) changed |= FluidDynamicsField.FlowType;
+            if (temperature != other.temperature) changed |= FluidDynamicsField.Temperature;
+            if (systemHealth != other.systemHealth) changed |= FluidDynamicsField.SystemHealth;
+            if (framework != other.framework) changed |= FluidDynamicsField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(FluidDynamicsInfo target)
+        {
+            target.velocity = velocity;
+            target.pressure = pressure;
+            target.density = density;
+            target.viscosity = viscosity;
+            target.flowType = flowType;
+            target.temperature = temperature;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum FluidDynamicsField
+    {
+        None = 0,
+        Velocity = 1 << 0,
+        Pressure = 1 << 1,
+        Density = 1 << 2,
+        Viscosity = 1 << 3,
+        FlowType = 1 << 4,
+        Temperature = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
     }
 
-    public class FluidDynamicsSystem : MonoBehaviour
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct FluidDynamicsDelta
+    {
+        public readonly long timestamp;
+        public readonly FluidDynamicsField changed;
+        public readonly FluidDynamicsInfo values;
+
+        public FluidDynamicsDelta(long timestamp, FluidDynamicsField changed, FluidDynamicsInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(FluidDynamicsField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class FluidDynamicsSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("FluidDynamics Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Solver Settings")]
+        public int gridResolution = 64;
+        public FluidRelaxation relaxation = FluidRelaxation.RedBlackGaussSeidel;
+        public int solverIterations = 20;
+        public float maxSolverStep = 0.05f;
+        public float viscosity = 0.0001f;
+        public float diffusion = 0.0001f;
+        public float domainSize = 10f;
+        public float ambientPressure = 101.3f;
+
+        [Header("Emitter")]
+        public bool enableEmitter = true;
+        public Vector2 emitterPosition = new Vector2(0.5f, 0.1f);
+        public int emitterRadius = 2;
+        public float emitterDensity = 100f;
+        public Vector2 emitterForce = new Vector2(0f, 0.2f);
+
         [Header("Current Data")]
         [SerializeField] private FluidDynamicsData currentData;
 
@@ -48,12 +157,19 @@ namespace UnitySim.FluidDynamics
 
         // Events
         public System.Action<FluidDynamicsData> OnFluidDynamicsChanged;
+        public System.Action<FluidDynamicsDelta> OnFluidDynamicsDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.FluidDynamicsSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly FluidDynamicsInfo publishedInfo = new FluidDynamicsInfo();
+        private bool publishFullDelta = true;
+        private FluidSolver solver;
 
         #region Unity Lifecycle
 
@@ -62,18 +178,22 @@ namespace UnitySim.FluidDynamics
             InitializeFluidDynamics();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            solver?.Dispose();
+            solver = null;
         }
 
         #endregion
@@ -83,6 +203,11 @@ namespace UnitySim.FluidDynamics
         private void InitializeFluidDynamics()
         {
             currentData = new FluidDynamicsData();
+
+            solver?.Dispose();
+            solver = new FluidSolver(gridResolution);
+            ApplySolverSettings();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +218,67 @@ namespace UnitySim.FluidDynamics
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
+        }
+
+        private void UpdateSpecificData(float deltaTime)
+        {
+            if (solver == null) return;
+
+            // The previous tick's steps ran on the workers since; publish what they produced
+            solver.Complete();
+            UpdateAggregates();
+
+            // Long scheduler intervals are split so advection never traces back more than a few
+            // cells; the substeps are one job chain, completed at the start of the next tick
+            int substeps = Mathf.Max(1, Mathf.CeilToInt(deltaTime / Mathf.Max(0.001f, maxSolverStep)));
+            float step = deltaTime / substeps;
+            var handle = default(JobHandle);
+            for (int i = 0; i < substeps; i++)
+            {
+                if (enableEmitter) handle = ScheduleEmitter(handle);
+                handle = solver.Schedule(step, handle);
+            }
+            JobHandle.ScheduleBatchedJobs();
+        }
+
+        private JobHandle ScheduleEmitter(JobHandle dependency)
+        {
+            int cx = Mathf.Clamp(Mathf.RoundToInt(emitterPosition.x * gridResolution), 1, solver.Size);
+            int cy = Mathf.Clamp(Mathf.RoundToInt(emitterPosition.y * gridResolution), 1, solver.Size);
+            return solver.ScheduleSplat(cx, cy, emitterRadius, emitterDensity, emitterForce.x, emitterForce.y, dependency);
+        }
+
+        private void UpdateAggregates()
+        {
+            var info = currentData.fluiddynamics;
+            info.velocity = solver.MeanSpeed * domainSize;
+            info.pressure = ambientPressure + solver.MeanAbsPressure;
+            info.density = solver.MeanDensity;
+            info.viscosity = viscosity;
+
+            // In grid units Re = U * L / nu reduces to maxSpeed / viscosity, with L = 1
+            float reynolds = viscosity > 0f ? solver.MaxSpeed / viscosity : float.PositiveInfinity;
+            info.flowType = reynolds < 2300f ? "laminar" : reynolds < 4000f ? "transitional" : "turbulent";
         }
 
-        private void UpdateSpecificData()
+        private void ApplySolverSettings()
         {
-                        currentData.fluiddynamics.velocity += UnityEngine.Random.Range(-0.5f, 0.5f);
-            currentData.fluiddynamics.pressure += UnityEngine.Random.Range(-2f, 2f);
-            currentData.fluiddynamics.temperature += UnityEngine.Random.Range(-1f, 1f);
+            if (solver == null) return;
+
+            solver.Viscosity = viscosity;
+            solver.Diffusion = diffusion;
+            solver.Iterations = solverIterations;
+            solver.Relaxation = relaxation;
         }
 
         private void ProcessUpdate()
@@ -122,6 +291,12 @@ namespace UnitySim.FluidDynamics
                 OnFluidDynamicsChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +304,67 @@ namespace UnitySim.FluidDynamics
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.fluiddynamics;
+            var changed = publishFullDelta ? FluidDynamicsField.All : info.Diff(publishedInfo);
+            if (changed == FluidDynamicsField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnFluidDynamicsDelta?.Invoke(new FluidDynamicsDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(FluidDynamicsSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("FluidDynamicsSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +375,9 @@ namespace UnitySim.FluidDynamics
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +398,30 @@ namespace UnitySim.FluidDynamics
             return currentData;
         }
 
+        // Grid fields for rendering; reading a field waits for the steps in flight
+        public FluidSolver GetSolver()
+        {
+            return solver;
+        }
+
+        // Positions are normalized to the domain (0..1); amounts and forces are per second
+        public void AddDensity(Vector2 position, float amount)
+        {
+            if (solver == null) return;
+            solver.AddDensity(ToCell(position.x), ToCell(position.y), amount);
+        }
+
+        public void AddForce(Vector2 position, Vector2 force)
+        {
+            if (solver == null) return;
+            solver.AddVelocity(ToCell(position.x), ToCell(position.y), force.x, force.y);
+        }
+
+        private int ToCell(float normalized)
+        {
+            return Mathf.Clamp(Mathf.RoundToInt(normalized * solver.Size), 1, solver.Size);
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +453,7 @@ namespace UnitySim.FluidDynamics
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +465,13 @@ namespace UnitySim.FluidDynamics
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            gridResolution = Mathf.Clamp(gridResolution, 8, 1024);
+            solverIterations = Mathf.Max(1, solverIterations);
+            maxSolverStep = Mathf.Max(0.001f, maxSolverStep);
+            viscosity = Mathf.Max(0f, viscosity);
+            diffusion = Mathf.Max(0f, diffusion);
+
+            ApplySolverSettings();
         }
 
         #endregion
@@ -218,6 +483,8 @@ namespace UnitySim.FluidDynamics
             Debug.Log($"FluidDynamicsSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
+            Debug.Log($"- Grid: {gridResolution}x{gridResolution}, {relaxation} x{solverIterations}");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -0,0 +1,592 @@
+using System;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+
+namespace UnitySim.FluidDynamics
+{
+    public enum FluidRelaxation
+    {
+        Jacobi,
+        RedBlackGaussSeidel
+    }
+
+    // Stable-fluids solver (Stam 1999) on a square 2D grid with a one-cell boundary.
+    // Every field is its own flat NativeArray (structure of arrays) and every pass is a
+    // Burst job over rows, so the inner loop walks contiguous memory and vectorizes.
+    public class FluidSolver : IDisposable
+    {
+        private const int RowBatchCount = 4;
+
+        private readonly int size;
+        private readonly int stride;
+
+        private NativeArray<float> u, v, uPrev, vPrev;
+        private NativeArray<float> density, densityPrev;
+        private NativeArray<float> uSource, vSource, densitySource;
+        private NativeArray<float> pressure, divergence, scratch;
+        private NativeArray<float> stats;
+        private JobHandle pending;
+        private bool scheduled = false;
+        private bool disposed = false;
+
+        public int Size => size;
+        public int Stride => stride;
+        public float Viscosity { get; set; } = 0.0001f;
+        public float Diffusion { get; set; } = 0.0001f;
+        public int Iterations { get; set; } = 20;
+        public FluidRelaxation Relaxation { get; set; } = FluidRelaxation.RedBlackGaussSeidel;
+        public bool IsStepping => scheduled && !pending.IsCompleted;
+
+        // Row-major, (size + 2)^2 cells including the boundary; reading one completes scheduled steps
+        public NativeArray<float> Density { get { Complete(); return density; } }
+        public NativeArray<float> VelocityX { get { Complete(); return u; } }
+        public NativeArray<float> VelocityY { get { Complete(); return v; } }
+        public NativeArray<float> Pressure { get { Complete(); return pressure; } }
+
+        // Aggregates of the last step, over interior cells
+        public float MeanSpeed { get { Complete(); return stats[0]; } }
+        public float MaxSpeed { get { Complete(); return stats[1]; } }
+        public float MeanDensity { get { Complete(); return stats[2]; } }
+
+        // Projection pressure averages to roughly zero, so the magnitude is reported instead
+        public float MeanAbsPressure { get { Complete(); return stats[3]; } }
+
+        public FluidSolver(int size)
+        {
+            this.size = Math.Max(4, size);
+            stride = this.size + 2;
+
+            int cells = stride * stride;
+            u = Allocate(cells);
+            v = Allocate(cells);
+            uPrev = Allocate(cells);
+            vPrev = Allocate(cells);
+            density = Allocate(cells);
+            densityPrev = Allocate(cells);
+            uSource = Allocate(cells);
+            vSource = Allocate(cells);
+            densitySource = Allocate(cells);
+            pressure = Allocate(cells);
+            divergence = Allocate(cells);
+            scratch = Allocate(cells);
+            stats = Allocate(4);
+        }
+
+        public int Index(int x, int y) => x + y * stride;
+
+        #region Sources
+
+        // Sources are per second and are consumed by the next step; x and y are 1..Size
+        public void AddDensity(int x, int y, float amount)
+        {
+            if (!InRange(x, y)) return;
+            Complete();
+            int index = Index(x, y);
+            densitySource[index] += amount;
+        }
+
+        public void AddVelocity(int x, int y, float forceX, float forceY)
+        {
+            if (!InRange(x, y)) return;
+            Complete();
+            int index = Index(x, y);
+            uSource[index] += forceX;
+            vSource[index] += forceY;
+        }
+
+        // Adds density and force to every cell within radius of (x, y) as part of the job chain,
+        // so sources can be fed between substeps without completing them
+        public JobHandle ScheduleSplat(int x, int y, int radius, float amount, float forceX, float forceY, JobHandle dependency = default)
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(FluidSolver));
+
+            pending = new SplatJob
+            {
+                size = size,
+                stride = stride,
+                x = x,
+                y = y,
+                radius = Math.Max(0, radius),
+                amount = amount,
+                forceX = forceX,
+                forceY = forceY,
+                density = densitySource,
+                u = uSource,
+                v = vSource
+            }.Schedule(JobHandle.CombineDependencies(dependency, pending));
+            scheduled = true;
+            return pending;
+        }
+
+        public void Clear()
+        {
+            Complete();
+            Fill(u); Fill(v); Fill(uPrev); Fill(vPrev);
+            Fill(density); Fill(densityPrev);
+            Fill(uSource); Fill(vSource); Fill(densitySource);
+            Fill(pressure); Fill(divergence); Fill(stats);
+        }
+
+        #endregion
+
+        #region Step
+
+        // Schedules one full velocity + density step after any step already scheduled, so
+        // substeps chain without waiting; the fields are read back through Complete
+        public JobHandle Schedule(float deltaTime, JobHandle dependency = default)
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(FluidSolver));
+
+            var handle = JobHandle.CombineDependencies(dependency, pending);
+
+            // Velocity: add forces, diffuse, project, self-advect, project
+            handle = AddSource(u, uSource, deltaTime, handle);
+            handle = AddSource(v, vSource, deltaTime, handle);
+            Swap(ref u, ref uPrev);
+            Swap(ref v, ref vPrev);
+            handle = Diffuse(BoundaryMode.VelocityX, u, uPrev, Viscosity, deltaTime, handle);
+            handle = Diffuse(BoundaryMode.VelocityY, v, vPrev, Viscosity, deltaTime, handle);
+            handle = Project(handle);
+            Swap(ref u, ref uPrev);
+            Swap(ref v, ref vPrev);
+            handle = Advect(BoundaryMode.VelocityX, u, uPrev, uPrev, vPrev, deltaTime, handle);
+            handle = Advect(BoundaryMode.VelocityY, v, vPrev, uPrev, vPrev, deltaTime, handle);
+            handle = Project(handle);
+
+            // Density: add sources, diffuse, advect along the new velocity
+            handle = AddSource(density, densitySource, deltaTime, handle);
+            Swap(ref density, ref densityPrev);
+            handle = Diffuse(BoundaryMode.Scalar, density, densityPrev, Diffusion, deltaTime, handle);
+            Swap(ref density, ref densityPrev);
+            handle = Advect(BoundaryMode.Scalar, density, densityPrev, u, v, deltaTime, handle);
+
+            pending = new StatsJob
+            {
+                size = size,
+                stride = stride,
+                u = u,
+                v = v,
+                density = density,
+                pressure = pressure,
+                stats = stats
+            }.Schedule(handle);
+            scheduled = true;
+            return pending;
+        }
+
+        // Waits for every scheduled step
+        public void Complete()
+        {
+            if (!scheduled) return;
+
+            pending.Complete();
+            scheduled = false;
+        }
+
+        public void Step(float deltaTime)
+        {
+            Schedule(deltaTime);
+            Complete();
+        }
+
+        private JobHandle AddSource(NativeArray<float> target, NativeArray<float> source, float deltaTime, JobHandle dependency)
+        {
+            return new AddSourceJob { target = target, source = source, deltaTime = deltaTime }
+                .Schedule(target.Length, 256, dependency);
+        }
+
+        private JobHandle Diffuse(BoundaryMode mode, NativeArray<float> x, NativeArray<float> x0, float rate, float deltaTime, JobHandle dependency)
+        {
+            float a = deltaTime * rate * size * size;
+            return LinearSolve(mode, x, x0, a, 1f + 4f * a, dependency);
+        }
+
+        private JobHandle Project(JobHandle dependency)
+        {
+            var handle = new DivergenceJob
+            {
+                stride = stride,
+                h = 1f / size,
+                u = u,
+                v = v,
+                divergence = divergence,
+                pressure = pressure
+            }.Schedule(size, RowBatchCount, dependency);
+            handle = SetBoundary(BoundaryMode.Scalar, divergence, handle);
+            handle = SetBoundary(BoundaryMode.Scalar, pressure, handle);
+
+            handle = LinearSolve(BoundaryMode.Scalar, pressure, divergence, 1f, 4f, handle);
+
+            handle = new GradientJob
+            {
+                stride = stride,
+                scale = 0.5f * size,
+                u = u,
+                v = v,
+                pressure = pressure
+            }.Schedule(size, RowBatchCount, handle);
+            handle = SetBoundary(BoundaryMode.VelocityX, u, handle);
+            return SetBoundary(BoundaryMode.VelocityY, v, handle);
+        }
+
+        private JobHandle Advect(BoundaryMode mode, NativeArray<float> d, NativeArray<float> d0, NativeArray<float> velocityX, NativeArray<float> velocityY, float deltaTime, JobHandle dependency)
+        {
+            var handle = new AdvectJob
+            {
+                size = size,
+                stride = stride,
+                dt0 = deltaTime * size,
+                d = d,
+                d0 = d0,
+                u = velocityX,
+                v = velocityY
+            }.Schedule(size, RowBatchCount, dependency);
+            return SetBoundary(mode, d, handle);
+        }
+
+        // Solves x = (x0 + a * neighbours(x)) / c in place
+        private JobHandle LinearSolve(BoundaryMode mode, NativeArray<float> x, NativeArray<float> x0, float a, float c, JobHandle dependency)
+        {
+            var handle = dependency;
+            float invC = 1f / c;
+
+            for (int k = 0; k < Iterations; k++)
+            {
+                if (Relaxation == FluidRelaxation.Jacobi)
+                {
+                    // Reads only the previous iterate, so the whole row is one vector loop
+                    handle = new JacobiJob { stride = stride, size = size, a = a, invC = invC, x = scratch, xOld = x, x0 = x0 }
+                        .Schedule(size, RowBatchCount, handle);
+                    handle = SetBoundary(mode, scratch, handle);
+                    handle = new CopyJob { source = scratch, target = x }.Schedule(x.Length, 256, handle);
+                }
+                else
+                {
+                    // Red cells only read black ones and vice versa, so rows of one colour run in parallel
+                    handle = new RedBlackJob { stride = stride, size = size, a = a, invC = invC, color = 0, x = x, x0 = x0 }
+                        .Schedule(size, RowBatchCount, handle);
+                    handle = new RedBlackJob { stride = stride, size = size, a = a, invC = invC, color = 1, x = x, x0 = x0 }
+                        .Schedule(size, RowBatchCount, handle);
+                    handle = SetBoundary(mode, x, handle);
+                }
+            }
+
+            return handle;
+        }
+
+        private JobHandle SetBoundary(BoundaryMode mode, NativeArray<float> x, JobHandle dependency)
+        {
+            return new BoundaryJob { size = size, stride = stride, mode = mode, x = x }.Schedule(dependency);
+        }
+
+        #endregion
+
+        #region Helpers
+
+        private bool InRange(int x, int y)
+        {
+            return x >= 1 && x <= size && y >= 1 && y <= size;
+        }
+
+        private static NativeArray<float> Allocate(int length)
+        {
+            return new NativeArray<float>(length, Allocator.Persistent, NativeArrayOptions.ClearMemory);
+        }
+
+        private static void Fill(NativeArray<float> array)
+        {
+            for (int i = 0; i < array.Length; i++)
+                array[i] = 0f;
+        }
+
+        private static void Swap(ref NativeArray<float> a, ref NativeArray<float> b)
+        {
+            var temp = a;
+            a = b;
+            b = temp;
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            Complete();
+            disposed = true;
+
+            u.Dispose(); v.Dispose(); uPrev.Dispose(); vPrev.Dispose();
+            density.Dispose(); densityPrev.Dispose();
+            uSource.Dispose(); vSource.Dispose(); densitySource.Dispose();
+            pressure.Dispose(); divergence.Dispose(); scratch.Dispose();
+            stats.Dispose();
+        }
+
+        #endregion
+
+        #region Jobs
+
+        private enum BoundaryMode
+        {
+            Scalar,
+            VelocityX,
+            VelocityY
+        }
+
+        [BurstCompile]
+        private struct AddSourceJob : IJobParallelFor
+        {
+            public NativeArray<float> target;
+            public NativeArray<float> source;
+            public float deltaTime;
+
+            public void Execute(int index)
+            {
+                target[index] += deltaTime * source[index];
+                source[index] = 0f;
+            }
+        }
+
+        [BurstCompile]
+        private struct SplatJob : IJob
+        {
+            public int size;
+            public int stride;
+            public int x;
+            public int y;
+            public int radius;
+            public float amount;
+            public float forceX;
+            public float forceY;
+            public NativeArray<float> density;
+            public NativeArray<float> u;
+            public NativeArray<float> v;
+
+            public void Execute()
+            {
+                int minX = math.max(1, x - radius), maxX = math.min(size, x + radius);
+                int minY = math.max(1, y - radius), maxY = math.min(size, y + radius);
+                for (int cy = minY; cy <= maxY; cy++)
+                {
+                    for (int cx = minX; cx <= maxX; cx++)
+                    {
+                        int i = cx + cy * stride;
+                        density[i] += amount;
+                        u[i] += forceX;
+                        v[i] += forceY;
+                    }
+                }
+            }
+        }
+
+        [BurstCompile]
+        private struct CopyJob : IJobParallelFor
+        {
+            [ReadOnly] public NativeArray<float> source;
+            [WriteOnly] public NativeArray<float> target;
+
+            public void Execute(int index)
+            {
+                target[index] = source[index];
+            }
+        }
+
+        [BurstCompile]
+        private struct JacobiJob : IJobParallelFor
+        {
+            public int stride;
+            public int size;
+            public float a;
+            public float invC;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<float> x;
+            [ReadOnly] public NativeArray<float> xOld;
+            [ReadOnly] public NativeArray<float> x0;
+
+            public void Execute(int row)
+            {
+                int start = (row + 1) * stride + 1;
+                int end = start + size;
+                for (int i = start; i < end; i++)
+                {
+                    x[i] = (x0[i] + a * (xOld[i - 1] + xOld[i + 1] + xOld[i - stride] + xOld[i + stride])) * invC;
+                }
+            }
+        }
+
+        [BurstCompile]
+        private struct RedBlackJob : IJobParallelFor
+        {
+            public int stride;
+            public int size;
+            public float a;
+            public float invC;
+            public int color;
+            [NativeDisableParallelForRestriction] public NativeArray<float> x;
+            [ReadOnly] public NativeArray<float> x0;
+
+            public void Execute(int row)
+            {
+                int y = row + 1;
+                int first = 1 + ((y + 1 + color) & 1);
+                int rowStart = y * stride;
+                for (int xi = first; xi <= size; xi += 2)
+                {
+                    int i = rowStart + xi;
+                    x[i] = (x0[i] + a * (x[i - 1] + x[i + 1] + x[i - stride] + x[i + stride])) * invC;
+                }
+            }
+        }
+
+        [BurstCompile]
+        private struct AdvectJob : IJobParallelFor
+        {
+            public int size;
+            public int stride;
+            public float dt0;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<float> d;
+            [ReadOnly] public NativeArray<float> d0;
+            [ReadOnly] public NativeArray<float> u;
+            [ReadOnly] public NativeArray<float> v;
+
+            public void Execute(int row)
+            {
+                int y = row + 1;
+                float limit = size + 0.5f;
+
+                for (int xi = 1; xi <= size; xi++)
+                {
+                    int i = xi + y * stride;
+
+                    // Trace the cell centre back along the velocity and sample bilinearly
+                    float px = math.clamp(xi - dt0 * u[i], 0.5f, limit);
+                    float py = math.clamp(y - dt0 * v[i], 0.5f, limit);
+
+                    int i0 = (int)px;
+                    int j0 = (int)py;
+                    float s1 = px - i0;
+                    float t1 = py - j0;
+                    float s0 = 1f - s1;
+                    float t0 = 1f - t1;
+
+                    int b = i0 + j0 * stride;
+                    d[i] = s0 * (t0 * d0[b] + t1 * d0[b + stride]) +
+                           s1 * (t0 * d0[b + 1] + t1 * d0[b + 1 + stride]);
+                }
+            }
+        }
+
+        [BurstCompile]
+        private struct DivergenceJob : IJobParallelFor
+        {
+            public int stride;
+            public float h;
+            [ReadOnly] public NativeArray<float> u;
+            [ReadOnly] public NativeArray<float> v;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<float> divergence;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<float> pressure;
+
+            public void Execute(int row)
+            {
+                int start = (row + 1) * stride + 1;
+                int end = start + stride - 2;
+                for (int i = start; i < end; i++)
+                {
+                    divergence[i] = -0.5f * h * (u[i + 1] - u[i - 1] + v[i + stride] - v[i - stride]);
+                    pressure[i] = 0f;
+                }
+            }
+        }
+
+        [BurstCompile]
+        private struct GradientJob : IJobParallelFor
+        {
+            public int stride;
+            public float scale;
+            [NativeDisableParallelForRestriction] public NativeArray<float> u;
+            [NativeDisableParallelForRestriction] public NativeArray<float> v;
+            [ReadOnly] public NativeArray<float> pressure;
+
+            public void Execute(int row)
+            {
+                int start = (row + 1) * stride + 1;
+                int end = start + stride - 2;
+                for (int i = start; i < end; i++)
+                {
+                    u[i] -= scale * (pressure[i + 1] - pressure[i - 1]);
+                    v[i] -= scale * (pressure[i + stride] - pressure[i - stride]);
+                }
+            }
+        }
+
+        // Walls: velocity is reflected at the faces it is normal to, scalars are copied
+        [BurstCompile]
+        private struct BoundaryJob : IJob
+        {
+            public int size;
+            public int stride;
+            public BoundaryMode mode;
+            public NativeArray<float> x;
+
+            public void Execute()
+            {
+                float signX = mode == BoundaryMode.VelocityX ? -1f : 1f;
+                float signY = mode == BoundaryMode.VelocityY ? -1f : 1f;
+                int last = size + 1;
+
+                for (int k = 1; k <= size; k++)
+                {
+                    x[0 + k * stride] = signX * x[1 + k * stride];
+                    x[last + k * stride] = signX * x[size + k * stride];
+                    x[k] = signY * x[k + stride];
+                    x[k + last * stride] = signY * x[k + size * stride];
+                }
+
+                x[0] = 0.5f * (x[1] + x[stride]);
+                x[last * stride] = 0.5f * (x[1 + last * stride] + x[size * stride]);
+                x[last] = 0.5f * (x[size] + x[last + stride]);
+                x[last + last * stride] = 0.5f * (x[size + last * stride] + x[last + size * stride]);
+            }
+        }
+
+        [BurstCompile]
+        private struct StatsJob : IJob
+        {
+            public int size;
+            public int stride;
+            [ReadOnly] public NativeArray<float> u;
+            [ReadOnly] public NativeArray<float> v;
+            [ReadOnly] public NativeArray<float> density;
+            [ReadOnly] public NativeArray<float> pressure;
+            public NativeArray<float> stats;
+
+            public void Execute()
+            {
+                float speedSum = 0f;
+                float speedMax = 0f;
+                float densitySum = 0f;
+                float pressureSum = 0f;
+
+                for (int y = 1; y <= size; y++)
+                {
+                    int i = 1 + y * stride;
+                    int end = i + size;
+                    for (; i < end; i++)
+                    {
+                        float speed = math.sqrt(u[i] * u[i] + v[i] * v[i]);
+                        speedSum += speed;
+                        speedMax = math.max(speedMax, speed);
+                        densitySum += density[i];
+                        pressureSum += math.abs(pressure[i]);
+                    }
+                }
+
+                float inv = 1f / (size * size);
+                stats[0] = speedSum * inv;
+                stats[1] = speedMax;
+                stats[2] = densitySum * inv;
+                stats[3] = pressureSum * inv;
+            }
+        }
+
+        #endregion
+    }
+}
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Manufacturing
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Manufacturing
 
         public ManufacturingData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             manufacturing = new ManufacturingInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (manufacturing != null)
+                manufacturing.WriteState(writer, "manufacturing");
+            else
+                writer.Write("manufacturing", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,96 @@ namespace UnitySim.Manufacturing
         public int workersActive = 45;
         public string systemHealth = "operational";
         public string framework = "unity-sim-manufacturing";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("unitsProduced", unitsProduced);
+            writer.Write("efficiency", efficiency);
+            writer.Write("qualityScore", qualityScore);
+            writer.Write("defectRate", defectRate);
+            writer.Write("machineUptime", machineUptime);
+            writer.Write("workersActive", workersActive);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public ManufacturingField Diff(ManufacturingInfo other)
+        {
+            var changed = ManufacturingField.None;
+            if (unitsProduced != other.unitsProduced) changed |= ManufacturingField.UnitsProduced;
+            if (efficiency != other.efficiency) changed |= ManufacturingField.Efficiency;
+            if (qualityScore != other.qualityScore) changed |= ManufacturingField.QualityScore;
+            if (defectRate != other.defectRate) changed |= ManufacturingField.DefectRate;
+            if (machineUptime != other.machineUptime) changed |= ManufacturingField.MachineUptime;
+            if (workersActive != other.workersActive) changed |= ManufacturingField.WorkersActive;
+            if (systemHealth != other.systemHealth) changed |= ManufacturingField.SystemHealth;
+            if (framework != other.framework) changed |= ManufacturingField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(ManufacturingInfo target)
+        {
+            target.unitsProduced = unitsProduced;
+            target.efficiency = efficiency;
+            target.qualityScore = qualityScore;
+            target.defectRate = defectRate;
+            target.machineUptime = machineUptime;
+            target.workersActive = workersActive;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum ManufacturingField
+    {
+        None = 0,
+        UnitsProduced = 1 << 0,
+        Efficiency = 1 << 1,
+        QualityScore = 1 << 2,
+        DefectRate = 1 << 3,
+        MachineUptime = 1 << 4,
+        WorkersActive = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct ManufacturingDelta
+    {
+        public readonly long timestamp;
+        public readonly ManufacturingField changed;
+        public readonly ManufacturingInfo values;
+
+        public ManufacturingDelta(long timestamp, ManufacturingField changed, ManufacturingInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(ManufacturingField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class ManufacturingSystem : MonoBehaviour
+    public class ManufacturingSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Manufacturing Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Production")]
+        public ProductionSettings production = new ProductionSettings();
+        public int randomSeed = 0;
+        [SerializeField] private long failures = 0;
+        [SerializeField] private int machinesDown = 0;
+
         [Header("Current Data")]
         [SerializeField] private ManufacturingData currentData;
 
@@ -48,12 +145,19 @@ namespace UnitySim.Manufacturing
 
         // Events
         public System.Action<ManufacturingData> OnManufacturingChanged;
+        public System.Action<ManufacturingDelta> OnManufacturingDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.ManufacturingSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly ManufacturingInfo publishedInfo = new ManufacturingInfo();
+        private bool publishFullDelta = true;
+        private ProductionLine line;
 
         #region Unity Lifecycle
 
@@ -62,18 +166,22 @@ namespace UnitySim.Manufacturing
             InitializeManufacturing();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            line?.Stop();
+            line = null;
         }
 
         #endregion
@@ -83,6 +191,13 @@ namespace UnitySim.Manufacturing
         private void InitializeManufacturing()
         {
             currentData = new ManufacturingData();
+
+            // Machine cycles, breakdowns and shifts live on the scheduler's event calendar
+            line?.Stop();
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            line = new ProductionLine(production, seed);
+            line.Start(SimulationScheduler.Instance.Events);
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +208,33 @@ namespace UnitySim.Manufacturing
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.manufacturing.unitsProduced += UnityEngine.Random.Range(10, 50);
-            currentData.manufacturing.efficiency = Mathf.Clamp(currentData.manufacturing.efficiency + UnityEngine.Random.Range(-2f, 2f), 60f, 100f);
-            currentData.manufacturing.qualityScore = UnityEngine.Random.Range(85, 100);
+            if (line == null) return;
+
+            // The line advanced as its events fired; publishing only reads its counters
+            var info = currentData.manufacturing;
+            info.unitsProduced = (int)Math.Min(int.MaxValue, line.UnitsProduced);
+            info.efficiency = line.Efficiency * 100f;
+            info.defectRate = Mathf.RoundToInt(line.DefectShare * 100f);
+            info.qualityScore = 100 - info.defectRate;
+            info.machineUptime = line.Uptime * 100f;
+            info.workersActive = line.BusyWorkers;
+
+            failures = line.Failures;
+            machinesDown = line.DownMachines;
         }
 
         private void ProcessUpdate()
@@ -122,6 +247,12 @@ namespace UnitySim.Manufacturing
                 OnManufacturingChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +260,67 @@ namespace UnitySim.Manufacturing
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.manufacturing;
+            var changed = publishFullDelta ? ManufacturingField.All : info.Diff(publishedInfo);
+            if (changed == ManufacturingField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnManufacturingDelta?.Invoke(new ManufacturingDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(ManufacturingSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("ManufacturingSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +331,9 @@ namespace UnitySim.Manufacturing
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +354,11 @@ namespace UnitySim.Manufacturing
             return currentData;
         }
 
+        public ProductionLine GetLine()
+        {
+            return line;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +390,7 @@ namespace UnitySim.Manufacturing
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +402,12 @@ namespace UnitySim.Manufacturing
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            production.machines = Mathf.Max(1, production.machines);
+            production.workers = Mathf.Max(1, production.workers);
+            production.cycleSeconds = Mathf.Max(0.1f, production.cycleSeconds);
+            production.cycleVariation = Mathf.Clamp(production.cycleVariation, 0f, 0.9f);
+            production.defectProbability = Mathf.Clamp01(production.defectProbability);
+            production.shiftHours = Mathf.Clamp(production.shiftHours, 0f, 24f);
         }
 
         #endregion
@@ -218,7 +419,10 @@ namespace UnitySim.Manufacturing
             Debug.Log($"ManufacturingSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (line != null)
+                Debug.Log($"- Production: {line.RunningMachines}/{line.Machines} machines running, {line.DownMachines} down, {line.BusyWorkers}/{line.Workers} workers busy{(line.OnShift ? "" : " (off shift)")}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -0,0 +1,293 @@
+using System;
+using System.Collections.Generic;
+using UnitySim.Core;
+
+namespace UnitySim.Manufacturing
+{
+    [System.Serializable]
+    public class ProductionSettings
+    {
+        public int machines = 40;
+        public int workers = 45;
+
+        // Ideal seconds per unit; actual cycles vary by up to cycleVariation either way
+        public float cycleSeconds = 45f;
+        public float cycleVariation = 0.2f;
+        public float defectProbability = 0.02f;
+
+        // Mean running hours between failures and mean hours to repair
+        public float mtbfHours = 8f;
+        public float mttrHours = 0.75f;
+
+        // Daily operating window; 24 hours runs around the clock
+        public float shiftStartHour = 6f;
+        public float shiftHours = 16f;
+    }
+
+    // A machine shop driven by discrete events: cycle completions, breakdowns, repairs and
+    // shift changes. A running machine holds one worker, and a repair takes one worker from the
+    // same pool, so breakdowns compete with production for labour. Outside the shift pattern
+    // nothing is scheduled but the next shift start.
+    public class ProductionLine : ISimulationEventHandler
+    {
+        private const int CycleEvent = 0;
+        private const int FailureEvent = 1;
+        private const int RepairEvent = 2;
+        private const int ShiftStartEvent = 3;
+        private const int ShiftEndEvent = 4;
+
+        private const double SecondsPerDay = 86400.0;
+
+        private enum MachineState : byte
+        {
+            Idle,
+            Running,
+            Down,
+            Repairing
+        }
+
+        private readonly ProductionSettings settings;
+        private Unity.Mathematics.Random random;
+        private SimulationEventQueue queue;
+
+        private readonly MachineState[] state;
+        private readonly Queue<int> awaitingRepair = new Queue<int>();
+        private int idleWorkers;
+        private bool onShift;
+
+        // Machine-seconds integrated at every state change
+        private double lastChange;
+        private int running;
+        private int down;
+        private double downSeconds;
+        private double scheduledSeconds;
+
+        public int Machines => state.Length;
+        public int Workers => settings.workers;
+        public int BusyWorkers => settings.workers - idleWorkers;
+        public int RunningMachines => running;
+        public int DownMachines => down;
+        public bool OnShift => onShift;
+
+        public long UnitsProduced { get; private set; }
+        public long DefectiveUnits { get; private set; }
+        public long Failures { get; private set; }
+
+        public float DefectShare => UnitsProduced > 0 ? DefectiveUnits / (float)UnitsProduced : 0f;
+
+        // Share of scheduled machine time not lost to breakdowns
+        public float Uptime
+        {
+            get
+            {
+                Integrate();
+                return scheduledSeconds > 0.0 ? (float)Math.Max(0.0, 1.0 - downSeconds / scheduledSeconds) : 1f;
+            }
+        }
+
+        // Good output against ideal-cycle output over scheduled machine time
+        public float Efficiency
+        {
+            get
+            {
+                Integrate();
+                if (scheduledSeconds <= 0.0) return 1f;
+                return (float)Math.Min(1.0, (UnitsProduced - DefectiveUnits) * settings.cycleSeconds / scheduledSeconds);
+            }
+        }
+
+        public ProductionLine(ProductionSettings settings, uint seed)
+        {
+            this.settings = settings ?? new ProductionSettings();
+            this.settings.machines = Math.Max(1, this.settings.machines);
+            this.settings.workers = Math.Max(1, this.settings.workers);
+            this.settings.cycleSeconds = Math.Max(0.1f, this.settings.cycleSeconds);
+            this.settings.shiftHours = Math.Min(24f, Math.Max(0f, this.settings.shiftHours));
+
+            random = new Unity.Mathematics.Random(seed != 0 ? seed : 1u);
+            state = new MachineState[this.settings.machines];
+            idleWorkers = this.settings.workers;
+        }
+
+        #region Lifetime
+
+        public bool IsRunning => queue != null;
+
+        public void Start(SimulationEventQueue events)
+        {
+            if (queue != null) return;
+            queue = events ?? throw new ArgumentNullException(nameof(events));
+            queue.Rebased += OnRebased;
+            lastChange = queue.Now;
+
+            if (settings.shiftHours <= 0f) return;
+            if (settings.shiftHours >= 24f)
+            {
+                BeginShift();
+                return;
+            }
+
+            // Join the shift pattern wherever the clock currently is
+            double dayTime = queue.Now % SecondsPerDay;
+            double start = settings.shiftStartHour * 3600.0 % SecondsPerDay;
+            double sinceStart = (dayTime - start + SecondsPerDay) % SecondsPerDay;
+            if (sinceStart < settings.shiftHours * 3600.0)
+            {
+                BeginShift();
+                queue.Schedule(settings.shiftHours * 3600.0 - sinceStart, this, ShiftEndEvent);
+            }
+            else
+            {
+                queue.Schedule(SecondsPerDay - sinceStart, this, ShiftStartEvent);
+            }
+        }
+
+        // Cancels every pending event; the line keeps its state
+        public void Stop()
+        {
+            if (queue == null) return;
+
+            Integrate();
+            queue.CancelAll(this);
+            queue.Rebased -= OnRebased;
+            queue = null;
+        }
+
+        // Keeps the time since the last state change intact across the new origin
+        private void OnRebased(double shift)
+        {
+            lastChange += shift;
+        }
+
+        #endregion
+
+        #region Events
+
+        void ISimulationEventHandler.HandleEvent(SimulationEventQueue events, SimulationEvent e)
+        {
+            Integrate();
+
+            switch (e.kind)
+            {
+                case CycleEvent: OnCycleComplete(e.a); break;
+                case FailureEvent: OnFailure(e.a); break;
+                case RepairEvent: OnRepaired(e.a); break;
+                case ShiftStartEvent:
+                    BeginShift();
+                    queue.Schedule(settings.shiftHours * 3600.0, this, ShiftEndEvent);
+                    break;
+                case ShiftEndEvent:
+                    // Running machines finish their current cycle and then stop
+                    onShift = false;
+                    queue.Schedule(SecondsPerDay - settings.shiftHours * 3600.0, this, ShiftStartEvent);
+                    break;
+            }
+        }
+
+        private void BeginShift()
+        {
+            onShift = true;
+            AssignWorkers();
+        }
+
+        private void StartCycle(int machine)
+        {
+            if (state[machine] != MachineState.Running)
+            {
+                idleWorkers--;
+                state[machine] = MachineState.Running;
+                running++;
+            }
+
+            double cycle = settings.cycleSeconds * (1.0 + settings.cycleVariation * (2.0 * random.NextDouble() - 1.0));
+
+            // Breakdowns are memoryless, so the chance of one inside this cycle is all that matters
+            double failureChance = 1.0 - Math.Exp(-cycle / Math.Max(1.0, settings.mtbfHours * 3600.0));
+            if (random.NextDouble() < failureChance)
+                queue.Schedule(cycle * random.NextDouble(), this, FailureEvent, machine);
+            else
+                queue.Schedule(cycle, this, CycleEvent, machine);
+        }
+
+        private void OnCycleComplete(int machine)
+        {
+            UnitsProduced++;
+            if (random.NextDouble() < settings.defectProbability) DefectiveUnits++;
+
+            if (onShift)
+            {
+                StartCycle(machine);
+                return;
+            }
+
+            StopMachine(machine, MachineState.Idle);
+        }
+
+        private void OnFailure(int machine)
+        {
+            // The cycle in progress is scrapped and the operator joins the repair pool
+            Failures++;
+            down++;
+            awaitingRepair.Enqueue(machine);
+            StopMachine(machine, MachineState.Down);
+        }
+
+        private void OnRepaired(int machine)
+        {
+            state[machine] = MachineState.Idle;
+            down--;
+            idleWorkers++;
+            AssignWorkers();
+        }
+
+        private void StopMachine(int machine, MachineState next)
+        {
+            state[machine] = next;
+            running--;
+            idleWorkers++;
+            AssignWorkers();
+        }
+
+        // Free workers repair first, then restaff idle machines during the shift
+        private void AssignWorkers()
+        {
+            while (idleWorkers > 0 && awaitingRepair.Count > 0)
+            {
+                int machine = awaitingRepair.Dequeue();
+                idleWorkers--;
+                state[machine] = MachineState.Repairing;
+
+                double repair = settings.mttrHours * 3600.0 * (0.5 + random.NextDouble());
+                queue.Schedule(repair, this, RepairEvent, machine);
+            }
+
+            if (!onShift) return;
+            for (int m = 0; m < state.Length && idleWorkers > 0; m++)
+            {
+                if (state[m] == MachineState.Idle) StartCycle(m);
+            }
+        }
+
+        #endregion
+
+        #region Accounting
+
+        private void Integrate()
+        {
+            if (queue == null) return;
+
+            double now = queue.Now;
+            double elapsed = now - lastChange;
+            if (elapsed <= 0.0) return;
+
+            if (onShift)
+            {
+                scheduledSeconds += state.Length * elapsed;
+                downSeconds += down * elapsed;
+            }
+            lastChange = now;
+        }
+
+        #endregion
+    }
+}
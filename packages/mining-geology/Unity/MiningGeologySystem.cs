@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.MiningGeology
 {
@@ -13,10 +17,22 @@ namespace UnitySim.MiningGeology
 
         public MiningGeologyData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             mininggeology = new MiningGeologyInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (mininggeology != null)
+                mininggeology.WriteState(writer, "mininggeology");
+            else
+                writer.Write("mininggeology", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,9 +46,84 @@ namespace UnitySim.MiningGeology
         public int minersActive = 120;
         public string systemHealth = "operational";
         public string framework = "unity-sim-mining-geology";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("coalExtracted", coalExtracted);
+            writer.Write("ironOreExtracted", ironOreExtracted);
+            writer.Write("activeMines", activeMines);
+            writer.Write("safetyScore", safetyScore);
+            writer.Write("environmentalImpact", environmentalImpact);
+            writer.Write("minersActive", minersActive);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public MiningGeologyField Diff(MiningGeologyInfo other)
+        {
+            var changed = MiningGeologyField.None;
+            if (coalExtracted != other.coalExtracted) changed |= MiningGeologyField.CoalExtracted;
+            if (ironOreExtracted != other.ironOreExtracted) changed |= MiningGeologyField.IronOreExtracted;
+            if (activeMines != other.activeMines) changed |= MiningGeologyField.ActiveMines;
+            if (safetyScore != other.safetyScore) changed |= MiningGeologyField.SafetyScore;
+            if (environmentalImpact != other.environmentalImpact) changed |= MiningGeologyField.EnvironmentalImpact;
+            if (minersActive != other.minersActive) changed |= MiningGeologyField.MinersActive;
+            if (systemHealth != other.systemHealth) changed |= MiningGeologyField.SystemHealth;
+            if (framework != other.framework) changed |= MiningGeologyField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(MiningGeologyInfo target)
+        {
+            target.coalExtracted = coalExtracted;
+            target.ironOreExtracted = ironOreExtracted;
+            target.activeMines = activeMines;
+            target.safetyScore = safetyScore;
+            target.environmentalImpact = environmentalImpact;
+            target.minersActive = minersActive;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum MiningGeologyField
+    {
+        None = 0,
+        CoalExtracted = 1 << 0,
+        IronOreExtracted = 1 << 1,
+        ActiveMines = 1 << 2,
+        SafetyScore = 1 << 3,
+        EnvironmentalImpact = 1 << 4,
+        MinersActive = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct MiningGeologyDelta
+    {
+        public readonly long timestamp;
+        public readonly MiningGeologyField changed;
+        public readonly MiningGeologyInfo values;
+
+        public MiningGeologyDelta(long timestamp, MiningGeologyField changed, MiningGeologyInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(MiningGeologyField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class MiningGeologySystem : MonoBehaviour
+    public class MiningGeologySystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem
     {
         [Header("MiningGeology Settings")]
         public float updateInterval = 1f;
@@ -48,12 +139,19 @@ namespace UnitySim.MiningGeology
 
         // Events
         public System.Action<MiningGeologyData> OnMiningGeologyChanged;
+        public System.Action<MiningGeologyDelta> OnMiningGeologyDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.MiningGeologySystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly MiningGeologyInfo publishedInfo = new MiningGeologyInfo();
+        private bool publishFullDelta = true;
+        private int stateVersion = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +160,16 @@ namespace UnitySim.MiningGeology
             InitializeMiningGeology();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +179,8 @@ namespace UnitySim.MiningGeology
         private void InitializeMiningGeology()
         {
             currentData = new MiningGeologyData();
+            stateVersion++;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,19 +191,19 @@ namespace UnitySim.MiningGeology
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
                         currentData.mininggeology.coalExtracted += UnityEngine.Random.Range(10f, 100f);
             currentData.mininggeology.ironOreExtracted += UnityEngine.Random.Range(5f, 50f);
@@ -122,6 +220,12 @@ namespace UnitySim.MiningGeology
                 OnMiningGeologyChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +233,96 @@ namespace UnitySim.MiningGeology
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.mininggeology;
+            var changed = publishFullDelta ? MiningGeologyField.All : info.Diff(publishedInfo);
+            if (changed == MiningGeologyField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnMiningGeologyDelta?.Invoke(new MiningGeologyDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(MiningGeologySystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.Add(10f, 100f));
+            channels.Add(SimulationChannel.Add(5f, 50f));
+            channels.Add(SimulationChannel.Add(-1f, 1f).Clamp(80f, 100f));
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.mininggeology.coalExtracted;
+            values[1] = currentData.mininggeology.ironOreExtracted;
+            values[2] = currentData.mininggeology.safetyScore;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.mininggeology.coalExtracted = (float)values[0];
+            currentData.mininggeology.ironOreExtracted = (float)values[1];
+            currentData.mininggeology.safetyScore = (float)values[2];
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("MiningGeologySystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +333,9 @@ namespace UnitySim.MiningGeology
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +387,7 @@ namespace UnitySim.MiningGeology
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -218,6 +410,7 @@ namespace UnitySim.MiningGeology
             Debug.Log($"MiningGeologySystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.MLIntegration
 {
@@ -13,10 +17,22 @@ namespace UnitySim.MLIntegration
 
         public MLIntegrationData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             mlintegration = new MLIntegrationInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (mlintegration != null)
+                mlintegration.WriteState(writer, "mlintegration");
+            else
+                writer.Write("mlintegration", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -27,18 +43,118 @@ namespace UnitySim.MLIntegration
         public float inferenceTime = 0.05f;
         public int predictions = 0;
         public float modelAccuracy = 94.2f;
-        public string framework = "TensorFlow";
+        public string mlFramework = "TensorFlow";
         public string systemHealth = "operational";
         public string framework = "unity-sim-ml-integration";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("modelsLoaded", modelsLoaded);
+            writer.Write("trainingActive", trainingActive);
+            writer.Write("inferenceTime", inferenceTime);
+            writer.Write("predictions", predictions);
+            writer.Write("modelAccuracy", modelAccuracy);
+            writer.Write("mlFramework", mlFramework);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public MLIntegrationField Diff(MLIntegrationInfo other)
+        {
+            var changed = MLIntegrationField.None;
+            if (modelsLoaded != other.modelsLoaded) changed |= MLIntegrationField.ModelsLoaded;
+            if (trainingActive != other.trainingActive) changed |= MLIntegrationField.TrainingActive;
+            if (inferenceTime != other.inferenceTime) changed |= MLIntegrationField.InferenceTime;
+            if (predictions != other.predictions) changed |= MLIntegrationField.Predictions;
+            if (modelAccuracy != other.modelAccuracy) changed |= MLIntegrationField.ModelAccuracy;
+            if (mlFramework != other.mlFramework) changed |= MLIntegrationField.MlFramework;
+            if (systemHealth != other.systemHealth) changed |= MLIntegrationField.SystemHealth;
+            if (framework != other.framework) changed |= MLIntegrationField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(MLIntegrationInfo target)
+        {
+            target.modelsLoaded = modelsLoaded;
+            target.trainingActive = trainingActive;
+            target.inferenceTime = inferenceTime;
+            target.predictions = predictions;
+            target.modelAccuracy = modelAccuracy;
+            target.mlFramework = mlFramework;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum MLIntegrationField
+    {
+        None = 0,
+        ModelsLoaded = 1 << 0,
+        TrainingActive = 1 << 1,
+        InferenceTime = 1 << 2,
+        Predictions = 1 << 3,
+        ModelAccuracy = 1 << 4,
+        MlFramework = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct MLIntegrationDelta
+    {
+        public readonly long timestamp;
+        public readonly MLIntegrationField changed;
+        public readonly MLIntegrationInfo values;
+
+        public MLIntegrationDelta(long timestamp, MLIntegrationField changed, MLIntegrationInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(MLIntegrationField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    [System.Serializable]
+    public class InferenceModelDefinition
+    {
+        public string name = "model";
+        public int[] layers = { 16, 64, 64, 4 };
+        public int capacity = 4096;
+        public Activation hidden = Activation.ReLU;
+        public Activation output = Activation.Linear;
     }
 
-    public class MLIntegrationSystem : MonoBehaviour
+    public class MLIntegrationSystem : MonoBehaviour, ISimulationSystem, IInferenceService
     {
         [Header("MLIntegration Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Models")]
+        public InferenceModelDefinition[] models =
+        {
+            new InferenceModelDefinition { name = "demand-forecast", layers = new[] { 16, 64, 64, 1 } },
+            new InferenceModelDefinition { name = "anomaly-detector", layers = new[] { 32, 32, 2 }, output = Activation.Tanh },
+            new InferenceModelDefinition { name = "route-eta", layers = new[] { 12, 48, 1 } }
+        };
+        public int randomSeed = 0;
+
+        [Header("Inference")]
+        [SerializeField] private float inferenceP50Ms = 0f;
+        [SerializeField] private float inferenceP95Ms = 0f;
+        [SerializeField] private float inferenceP99Ms = 0f;
+        [SerializeField] private long rowsEvaluated = 0;
+
         [Header("Current Data")]
         [SerializeField] private MLIntegrationData currentData;
 
@@ -48,12 +164,21 @@ namespace UnitySim.MLIntegration
 
         // Events
         public System.Action<MLIntegrationData> OnMLIntegrationChanged;
+        public System.Action<MLIntegrationDelta> OnMLIntegrationDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.MLIntegrationSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly MLIntegrationInfo publishedInfo = new MLIntegrationInfo();
+        private bool publishFullDelta = true;
+        private readonly List<PolicyNetwork> loaded = new List<PolicyNetwork>();
+        private readonly InferenceTimings tickTimings = new InferenceTimings();
+        private readonly System.Diagnostics.Stopwatch tickStopwatch = new System.Diagnostics.Stopwatch();
 
         #region Unity Lifecycle
 
@@ -62,18 +187,22 @@ namespace UnitySim.MLIntegration
             InitializeMLIntegration();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            for (int i = 0; i < loaded.Count; i++) loaded[i].Dispose();
+            loaded.Clear();
         }
 
         #endregion
@@ -83,6 +212,19 @@ namespace UnitySim.MLIntegration
         private void InitializeMLIntegration()
         {
             currentData = new MLIntegrationData();
+
+            // Models loaded by clients survive a reset; the defined ones are loaded once
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            for (int i = 0; i < models.Length; i++)
+            {
+                var definition = models[i];
+                if (definition == null || string.IsNullOrEmpty(definition.name)) continue;
+
+                LoadModel(definition.name, definition.layers, definition.capacity, seed + (uint)i * 7919u, definition.hidden, definition.output);
+            }
+            tickTimings.Clear();
+            rowsEvaluated = 0;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +235,105 @@ namespace UnitySim.MLIntegration
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
+        }
+
+        private void UpdateSpecificData(float deltaTime)
+        {
+            int rows = RunModels();
+            rowsEvaluated += rows;
+
+            var info = currentData.mlintegration;
+            info.modelsLoaded = loaded.Count;
+            info.predictions = (int)Math.Min(int.MaxValue, rowsEvaluated);
+            info.inferenceTime = tickTimings.Percentile(50f);
+
+            inferenceP50Ms = info.inferenceTime;
+            inferenceP95Ms = tickTimings.Percentile(95f);
+            inferenceP99Ms = tickTimings.Percentile(99f);
+        }
+
+        #endregion
+
+        #region Inference
+
+        // Every model with rows waiting is scheduled before any is completed, so the batches
+        // share the worker threads; the tick time is the wall time of the whole pass
+        private int RunModels()
+        {
+            int rows = 0;
+            tickStopwatch.Restart();
+
+            for (int i = 0; i < loaded.Count; i++)
+            {
+                if (loaded[i].BatchSize == 0) continue;
+
+                loaded[i].Schedule();
+                rows += loaded[i].BatchSize;
+            }
+            if (rows == 0) return 0;
+
+            Unity.Jobs.JobHandle.ScheduleBatchedJobs();
+            for (int i = 0; i < loaded.Count; i++)
+            {
+                loaded[i].Complete();
+            }
+
+            tickStopwatch.Stop();
+            tickTimings.Record((float)tickStopwatch.Elapsed.TotalMilliseconds);
+            return rows;
+        }
+
+        public PolicyNetwork LoadModel(string name, int[] layerSizes, int capacity, uint seed,
+            Activation hidden = Activation.ReLU, Activation output = Activation.Linear)
+        {
+            var existing = GetModel(name);
+            if (existing != null) return existing;
+
+            var model = new PolicyNetwork(name, layerSizes, capacity, seed, hidden, output);
+            loaded.Add(model);
+
+            if (enableLogging)
+                Debug.Log($"MLIntegrationSystem: Loaded {name} ({model.Parameters} parameters, {model.Capacity} rows)");
+            return model;
         }
 
-        private void UpdateSpecificData()
+        public PolicyNetwork GetModel(string name)
         {
-                        currentData.mlintegration.predictions += UnityEngine.Random.Range(1, 10);
-            currentData.mlintegration.inferenceTime += UnityEngine.Random.Range(-0.01f, 0.01f);
-            currentData.mlintegration.modelAccuracy = Mathf.Clamp(currentData.mlintegration.modelAccuracy + UnityEngine.Random.Range(-0.2f, 0.2f), 85f, 99f);
+            for (int i = 0; i < loaded.Count; i++)
+            {
+                if (loaded[i].Name == name) return loaded[i];
+            }
+            return null;
+        }
+
+        public bool UnloadModel(string name)
+        {
+            var model = GetModel(name);
+            if (model == null) return false;
+
+            loaded.Remove(model);
+            model.Dispose();
+            return true;
+        }
+
+        public IReadOnlyList<PolicyNetwork> GetModels()
+        {
+            return loaded;
+        }
+
+        public InferenceTimings GetTimings()
+        {
+            return tickTimings;
         }
 
         private void ProcessUpdate()
@@ -122,6 +346,12 @@ namespace UnitySim.MLIntegration
                 OnMLIntegrationChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +359,67 @@ namespace UnitySim.MLIntegration
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.mlintegration;
+            var changed = publishFullDelta ? MLIntegrationField.All : info.Diff(publishedInfo);
+            if (changed == MLIntegrationField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnMLIntegrationDelta?.Invoke(new MLIntegrationDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(MLIntegrationSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("MLIntegrationSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +430,9 @@ namespace UnitySim.MLIntegration
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +484,7 @@ namespace UnitySim.MLIntegration
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +496,12 @@ namespace UnitySim.MLIntegration
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            if (models == null) models = new InferenceModelDefinition[0];
+            foreach (var definition in models)
+            {
+                if (definition == null) continue;
+                definition.capacity = Mathf.Max(1, definition.capacity);
+            }
         }
 
         #endregion
@@ -218,7 +513,9 @@ namespace UnitySim.MLIntegration
             Debug.Log($"MLIntegrationSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Inference: {loaded.Count} models, {rowsEvaluated} rows, p50 {inferenceP50Ms:F3}ms p95 {inferenceP95Ms:F3}ms p99 {inferenceP99Ms:F3}ms");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
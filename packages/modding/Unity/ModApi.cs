@@ -0,0 +1,271 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using UnityEngine;
+
+namespace UnitySim.Modding
+{
+    // Entry point of a managed mod; mods without an assembly load as a DataMod
+    public interface IMod
+    {
+        void OnLoad(IModApi api);
+        void OnUnload();
+    }
+
+    // Everything a mod may touch. Each call is counted against the calling mod.
+    public interface IModApi
+    {
+        string ModId { get; }
+        ModManifest Manifest { get; }
+        IReadOnlyList<ModAsset> Assets { get; }
+
+        ModAsset GetAsset(string relativePath);
+        string ReadText(string relativePath);       // files inside the mod's own folder only
+        bool TryGetValue(string key, out float value);
+        float GetValue(string key, float fallback = 0f);
+        void SetValue(string key, float value);
+        void OnTick(Action<float> handler);         // every frame, timed against the mod's budget
+        void Log(string message);
+    }
+
+    // Per-mod cost accounting, updated on the main thread
+    public class ModStats
+    {
+        public long apiCalls;
+        public long ticks;
+        public double totalTickMs;
+        public float lastTickMs;
+        public float averageTickMs;     // smoothed over roughly the last 30 ticks
+        public float maxTickMs;
+        public float loadMs;
+        public int overBudgetTicks;     // consecutive
+        public int faults;
+        public bool slow;
+    }
+
+    public static class ModSandbox
+    {
+        // Full path of relativePath, refusing anything that escapes root
+        public static string Resolve(string root, string relativePath)
+        {
+            if (string.IsNullOrEmpty(relativePath) || Path.IsPathRooted(relativePath))
+                throw new UnauthorizedAccessException($"{relativePath} is not a path inside the mod folder");
+
+            string rootPath = Path.GetFullPath(root).TrimEnd(Path.DirectorySeparatorChar, Path.AltDirectorySeparatorChar) + Path.DirectorySeparatorChar;
+            string fullPath = Path.GetFullPath(Path.Combine(rootPath, relativePath));
+            if (!fullPath.StartsWith(rootPath, StringComparison.Ordinal))
+                throw new UnauthorizedAccessException($"{relativePath} is outside the mod folder");
+
+            return fullPath;
+        }
+    }
+
+    // Values mods publish for the simulation. Each mod writes its own layer; reads see the
+    // layer of the latest mod in load order, so dependents override their dependencies and
+    // unloading a mod uncovers whatever it had overridden.
+    public class ModValueStore
+    {
+        private struct Layer
+        {
+            public string mod;
+            public int order;
+            public float value;
+        }
+
+        private readonly Dictionary<string, List<Layer>> layers = new Dictionary<string, List<Layer>>(StringComparer.Ordinal);
+        private readonly Dictionary<string, List<string>> keysByMod = new Dictionary<string, List<string>>(StringComparer.Ordinal);
+
+        public int Count => layers.Count;
+        public int Version { get; private set; }
+
+        public bool TryGet(string key, out float value)
+        {
+            value = 0f;
+            if (key == null || !layers.TryGetValue(key, out var list) || list.Count == 0) return false;
+
+            int top = 0;
+            for (int i = 1; i < list.Count; i++)
+            {
+                if (list[i].order > list[top].order) top = i;
+            }
+            value = list[top].value;
+            return true;
+        }
+
+        public void Set(string mod, int order, string key, float value)
+        {
+            if (!layers.TryGetValue(key, out var list))
+            {
+                list = new List<Layer>(1);
+                layers[key] = list;
+            }
+
+            for (int i = 0; i < list.Count; i++)
+            {
+                if (list[i].mod != mod) continue;
+                list[i] = new Layer { mod = mod, order = order, value = value };
+                Version++;
+                return;
+            }
+            list.Add(new Layer { mod = mod, order = order, value = value });
+            if (!keysByMod.TryGetValue(mod, out var keys))
+            {
+                keys = new List<string>();
+                keysByMod[mod] = keys;
+            }
+            keys.Add(key);
+            Version++;
+        }
+
+        public void RemoveMod(string mod)
+        {
+            if (mod == null || !keysByMod.TryGetValue(mod, out var keys)) return;
+            keysByMod.Remove(mod);
+
+            for (int k = 0; k < keys.Count; k++)
+            {
+                var list = layers[keys[k]];
+                for (int i = 0; i < list.Count; i++)
+                {
+                    if (list[i].mod != mod) continue;
+                    list.RemoveAt(i);
+                    break;
+                }
+                if (list.Count == 0) layers.Remove(keys[k]);
+            }
+            Version++;
+        }
+
+        // Keeps layers in step with a new load order
+        public void Reorder(string mod, int order)
+        {
+            if (mod == null || !keysByMod.TryGetValue(mod, out var keys)) return;
+
+            for (int k = 0; k < keys.Count; k++)
+            {
+                var list = layers[keys[k]];
+                for (int i = 0; i < list.Count; i++)
+                {
+                    if (list[i].mod == mod) list[i] = new Layer { mod = mod, order = order, value = list[i].value };
+                }
+            }
+        }
+    }
+
+    // The IModApi handed to one mod. Closed on unload, after which calls are ignored.
+    public class ModApi : IModApi
+    {
+        private readonly ModDescriptor descriptor;
+        private readonly ModStats stats;
+        private readonly ModValueStore values;
+        private readonly bool sandboxed;
+        private readonly long maxReadBytes;
+        private readonly List<Action<float>> tickHandlers = new List<Action<float>>();
+        private bool closed = false;
+
+        public int Order { get; set; }
+        public bool HasTickHandlers => tickHandlers.Count > 0;
+
+        public string ModId => descriptor.manifest.id;
+        public ModManifest Manifest => descriptor.manifest;
+        public IReadOnlyList<ModAsset> Assets => descriptor.assets;
+
+        public ModApi(ModDescriptor descriptor, ModStats stats, ModValueStore values, int order, bool sandboxed, long maxReadBytes)
+        {
+            this.descriptor = descriptor;
+            this.stats = stats;
+            this.values = values;
+            this.sandboxed = sandboxed;
+            this.maxReadBytes = maxReadBytes;
+            Order = order;
+        }
+
+        public ModAsset GetAsset(string relativePath)
+        {
+            stats.apiCalls++;
+            var assets = descriptor.assets;
+            for (int i = 0; i < assets.Length; i++)
+            {
+                if (assets[i].path == relativePath) return assets[i];
+            }
+            return null;
+        }
+
+        public string ReadText(string relativePath)
+        {
+            stats.apiCalls++;
+            string path = ModSandbox.Resolve(descriptor.directory, relativePath);
+            if (sandboxed && new FileInfo(path).Length > maxReadBytes)
+                throw new UnauthorizedAccessException($"{relativePath} is larger than the sandbox read limit of {maxReadBytes} bytes");
+
+            return File.ReadAllText(path, Encoding.UTF8);
+        }
+
+        public bool TryGetValue(string key, out float value)
+        {
+            stats.apiCalls++;
+            return values.TryGet(key, out value);
+        }
+
+        public float GetValue(string key, float fallback = 0f)
+        {
+            stats.apiCalls++;
+            return values.TryGet(key, out float value) ? value : fallback;
+        }
+
+        public void SetValue(string key, float value)
+        {
+            stats.apiCalls++;
+            if (closed || string.IsNullOrEmpty(key)) return;
+            values.Set(ModId, Order, key, value);
+        }
+
+        public void OnTick(Action<float> handler)
+        {
+            stats.apiCalls++;
+            if (!closed && handler != null) tickHandlers.Add(handler);
+        }
+
+        public void Log(string message)
+        {
+            stats.apiCalls++;
+            Debug.Log($"[{ModId}] {message}");
+        }
+
+        // Called by ModLoader; exceptions propagate to it so they are charged to this mod
+        internal void RunTick(float deltaTime)
+        {
+            for (int i = 0; i < tickHandlers.Count; i++) tickHandlers[i](deltaTime);
+        }
+
+        internal void Close()
+        {
+            closed = true;
+            tickHandlers.Clear();
+        }
+    }
+
+    // Publishes every numeric entry of the mod's assets as "<asset>.<key>", where the asset
+    // name is its folder-relative path without extension and with '/' as '.'
+    public class DataMod : IMod
+    {
+        public void OnLoad(IModApi api)
+        {
+            var assets = api.Assets;
+            for (int a = 0; a < assets.Count; a++)
+            {
+                var asset = assets[a];
+                string prefix = Path.ChangeExtension(asset.path, null).Replace('/', '.').Replace('\\', '.');
+                for (int i = 0; i < asset.Count; i++)
+                {
+                    if (asset.IsNumber(i)) api.SetValue(prefix + "." + asset.GetKey(i), asset.GetNumber(i));
+                }
+            }
+        }
+
+        public void OnUnload()
+        {
+        }
+    }
+}
@@ -0,0 +1,307 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using System.Threading;
+using Newtonsoft.Json;
+
+namespace UnitySim.Modding
+{
+    // A JSON asset compiled to a flat table: nested keys are joined with '.', array items by
+    // index ("waves.2.count"). Numbers and booleans are stored as floats, strings as text.
+    public class ModAsset
+    {
+        public readonly string path;
+        public readonly ulong hash;
+        private readonly string[] keys;
+        private readonly float[] numbers;
+        private readonly string[] strings;      // null where the entry is numeric
+        private readonly Dictionary<string, int> lookup;
+
+        public int Count => keys.Length;
+
+        public ModAsset(string path, ulong hash, string[] keys, float[] numbers, string[] strings)
+        {
+            this.path = path;
+            this.hash = hash;
+            this.keys = keys;
+            this.numbers = numbers;
+            this.strings = strings;
+
+            lookup = new Dictionary<string, int>(keys.Length, StringComparer.Ordinal);
+            for (int i = 0; i < keys.Length; i++) lookup[keys[i]] = i;
+        }
+
+        public string GetKey(int entry) => keys[entry];
+        public bool IsNumber(int entry) => strings[entry] == null;
+        public float GetNumber(int entry) => numbers[entry];
+        public string GetString(int entry) => strings[entry];
+
+        public bool TryGetNumber(string key, out float value)
+        {
+            value = 0f;
+            if (!lookup.TryGetValue(key, out int entry) || strings[entry] != null) return false;
+            value = numbers[entry];
+            return true;
+        }
+
+        public bool TryGetString(string key, out string value)
+        {
+            value = null;
+            if (!lookup.TryGetValue(key, out int entry)) return false;
+            value = strings[entry];
+            return value != null;
+        }
+
+        #region Compile
+
+        private struct Frame
+        {
+            public string key;      // full key of the container, "" for the root
+            public bool isArray;
+            public int nextIndex;
+        }
+
+        public static ModAsset Compile(string path, ulong hash, Stream json)
+        {
+            var keys = new List<string>();
+            var numbers = new List<float>();
+            var strings = new List<string>();
+            var frames = new Stack<Frame>();
+
+            using (var reader = new JsonTextReader(new StreamReader(json, Encoding.UTF8)) { DateParseHandling = DateParseHandling.None })
+            {
+                string property = null;
+                while (reader.Read())
+                {
+                    switch (reader.TokenType)
+                    {
+                        case JsonToken.PropertyName:
+                            property = (string)reader.Value;
+                            break;
+                        case JsonToken.StartObject:
+                        case JsonToken.StartArray:
+                            string key = frames.Count > 0 ? NextKey(frames, ref property) : "";
+                            frames.Push(new Frame { key = key, isArray = reader.TokenType == JsonToken.StartArray });
+                            break;
+                        case JsonToken.EndObject:
+                        case JsonToken.EndArray:
+                            frames.Pop();
+                            break;
+                        case JsonToken.Integer:
+                        case JsonToken.Float:
+                            Add(keys, numbers, strings, NextKey(frames, ref property), ToSingle(reader.Value), null);
+                            break;
+                        case JsonToken.Boolean:
+                            Add(keys, numbers, strings, NextKey(frames, ref property), (bool)reader.Value ? 1f : 0f, null);
+                            break;
+                        case JsonToken.String:
+                            Add(keys, numbers, strings, NextKey(frames, ref property), 0f, (string)reader.Value);
+                            break;
+                        case JsonToken.Null:
+                            NextKey(frames, ref property);
+                            break;
+                    }
+                }
+            }
+
+            return new ModAsset(path, hash, keys.ToArray(), numbers.ToArray(), strings.ToArray());
+        }
+
+        // Key of the next value: the pending property name, or the next index inside an array
+        private static string NextKey(Stack<Frame> frames, ref string property)
+        {
+            if (frames.Count == 0) return "";
+
+            var frame = frames.Pop();
+            string name;
+            if (frame.isArray)
+            {
+                name = frame.nextIndex.ToString();
+                frame.nextIndex++;
+            }
+            else
+            {
+                name = property ?? "";
+                property = null;
+            }
+            frames.Push(frame);
+
+            return frame.key.Length == 0 ? name : frame.key + "." + name;
+        }
+
+        // Integers beyond long come back as BigInteger and compile to NaN
+        private static float ToSingle(object number)
+        {
+            switch (number)
+            {
+                case long integer: return integer;
+                case double real: return (float)real;
+                case decimal exact: return (float)exact;
+                default: return float.NaN;
+            }
+        }
+
+        private static void Add(List<string> keys, List<float> numbers, List<string> strings, string key, float number, string text)
+        {
+            keys.Add(key);
+            numbers.Add(number);
+            strings.Add(text);
+        }
+
+        #endregion
+
+        #region Binary Form
+
+        private const int Magic = 0x4D415331;     // "MAS1"
+
+        public void Write(BinaryWriter writer)
+        {
+            writer.Write(Magic);
+            writer.Write(hash);
+            writer.Write(keys.Length);
+            for (int i = 0; i < keys.Length; i++)
+            {
+                writer.Write(keys[i]);
+                writer.Write(strings[i] != null);
+                if (strings[i] != null) writer.Write(strings[i]);
+                else writer.Write(numbers[i]);
+            }
+        }
+
+        // Null when the data is not a compiled asset with this hash
+        public static ModAsset Read(BinaryReader reader, string path, ulong hash)
+        {
+            if (reader.ReadInt32() != Magic || reader.ReadUInt64() != hash) return null;
+
+            int count = reader.ReadInt32();
+            if (count < 0) return null;
+
+            var keys = new string[count];
+            var numbers = new float[count];
+            var strings = new string[count];
+            for (int i = 0; i < count; i++)
+            {
+                keys[i] = reader.ReadString();
+                if (reader.ReadBoolean()) strings[i] = reader.ReadString();
+                else numbers[i] = reader.ReadSingle();
+            }
+            return new ModAsset(path, hash, keys, numbers, strings);
+        }
+
+        #endregion
+    }
+
+    // Compiled assets keyed by content hash, in memory and as files on disk. An edited file
+    // gets a new hash, so entries are never invalidated, only pruned, and a warm start reads
+    // compiled tables instead of parsing JSON. Thread-safe.
+    public class ModAssetCache
+    {
+        private readonly string directory;
+        private readonly Dictionary<ulong, ModAsset> memory = new Dictionary<ulong, ModAsset>();
+        private long memoryHits = 0;
+        private long diskHits = 0;
+        private long compiled = 0;
+
+        public long MemoryHits => Interlocked.Read(ref memoryHits);
+        public long DiskHits => Interlocked.Read(ref diskHits);
+        public long Compiled => Interlocked.Read(ref compiled);
+
+        public int Count
+        {
+            get { lock (memory) return memory.Count; }
+        }
+
+        public ModAssetCache(string directory)
+        {
+            this.directory = directory;
+            Directory.CreateDirectory(directory);
+        }
+
+        public ModAsset GetOrCompile(string fullPath, ModFile file)
+        {
+            lock (memory)
+            {
+                if (memory.TryGetValue(file.hash, out var cached) && cached.path == file.relativePath)
+                {
+                    Interlocked.Increment(ref memoryHits);
+                    return cached;
+                }
+            }
+
+            string cachePath = Path.Combine(directory, file.hash.ToString("x16") + ".asset");
+            var asset = TryReadDisk(cachePath, file);
+            if (asset != null)
+            {
+                Interlocked.Increment(ref diskHits);
+            }
+            else
+            {
+                using (var stream = new FileStream(fullPath, FileMode.Open, FileAccess.Read, FileShare.ReadWrite, 16 * 1024, FileOptions.SequentialScan))
+                {
+                    asset = ModAsset.Compile(file.relativePath, file.hash, stream);
+                }
+                Interlocked.Increment(ref compiled);
+
+                // A write since the file was hashed means these bytes don't match the hash; use them,
+                // but don't cache them under it; the next scan hashes the file again
+                var info = new FileInfo(fullPath);
+                if (!info.Exists || info.Length != file.size || info.LastWriteTimeUtc.Ticks != file.modifiedTicks) return asset;
+
+                WriteDisk(cachePath, asset);
+            }
+
+            lock (memory) memory[file.hash] = asset;
+            return asset;
+        }
+
+        // Drops in-memory entries no loaded mod uses; disk entries stay for the next start
+        public void Retain(HashSet<ulong> live)
+        {
+            lock (memory)
+            {
+                var stale = new List<ulong>();
+                foreach (var hash in memory.Keys)
+                {
+                    if (!live.Contains(hash)) stale.Add(hash);
+                }
+                for (int i = 0; i < stale.Count; i++) memory.Remove(stale[i]);
+            }
+        }
+
+        private static ModAsset TryReadDisk(string cachePath, ModFile file)
+        {
+            try
+            {
+                if (!File.Exists(cachePath)) return null;
+                using (var reader = new BinaryReader(File.OpenRead(cachePath), Encoding.UTF8))
+                {
+                    return ModAsset.Read(reader, file.relativePath, file.hash);
+                }
+            }
+            catch (IOException)
+            {
+                return null;
+            }
+        }
+
+        // Another thread may be writing the same hash; either copy is correct
+        private static void WriteDisk(string cachePath, ModAsset asset)
+        {
+            string temporary = $"{cachePath}.{Thread.CurrentThread.ManagedThreadId}.tmp";
+            try
+            {
+                using (var writer = new BinaryWriter(File.Create(temporary), Encoding.UTF8))
+                {
+                    asset.Write(writer);
+                }
+                if (File.Exists(cachePath)) File.Delete(cachePath);
+                File.Move(temporary, cachePath);
+            }
+            catch (IOException)
+            {
+                if (File.Exists(temporary)) File.Delete(temporary);
+            }
+        }
+    }
+}
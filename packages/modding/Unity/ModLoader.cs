@@ -0,0 +1,573 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Reflection;
+using System.Threading.Tasks;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.Modding
+{
+    public enum ModState
+    {
+        Loaded,
+        Failed,     // bad manifest, missing or failed dependency, or OnLoad threw
+        Disabled    // unloaded after maxFaults tick exceptions
+    }
+
+    public class ModLoaderSettings
+    {
+        public string modsDirectory = "./mods";
+        public string cacheDirectory;
+        public int parallelism = 0;             // scan threads; 0 uses every core
+        public bool sandbox = true;             // data mods only, and mod file reads capped at maxReadBytes
+        public bool hotReload = true;
+        public float reloadDebounce = 0.25f;    // seconds of quiet after a file change before rescanning
+        public float tickBudgetMs = 2f;
+        public int slowTickLimit = 30;          // consecutive over-budget ticks before a mod is reported slow
+        public int maxFaults = 3;               // tick exceptions before a mod is unloaded
+        public long maxReadBytes = 4 * 1024 * 1024;
+    }
+
+    public class ModRecord
+    {
+        public ModDescriptor descriptor;
+        public ModState state;
+        public string error;
+        public int order;
+        public readonly ModStats stats = new ModStats();
+        internal IMod instance;
+        internal ModApi api;
+
+        public string Id => descriptor.Id;
+    }
+
+    // Loads every mod under modsDirectory in dependency order. Scanning (manifests, hashes,
+    // compiled assets) runs on background threads; mods are instantiated and ticked on the
+    // main thread. With hot reload, changed folders are rescanned after reloadDebounce and a
+    // mod reloads only if its content hash changed, together with every mod depending on it.
+    public class ModLoader : IDisposable
+    {
+        private const float TickSmoothing = 1f / 30f;
+
+        private readonly ModLoaderSettings settings;
+        private readonly string modsRoot;
+        private readonly ModAssetCache assets;
+        private readonly ModScanner scanner;
+        private readonly ModValueStore values = new ModValueStore();
+        private readonly Dictionary<string, ModRecord> mods = new Dictionary<string, ModRecord>(StringComparer.Ordinal);
+        private readonly List<ModRecord> loadOrder = new List<ModRecord>();
+
+        private Task<List<ModDescriptor>> scanTask;
+        private List<string> scanDirectories;   // null for a full scan
+        private FileSystemWatcher watcher;
+        private readonly HashSet<string> dirtyDirectories = new HashSet<string>(StringComparer.Ordinal);
+        private long lastChangeTicks = 0;
+        private bool rescanAll = false;
+        private readonly HashSet<string> forcedReloads = new HashSet<string>(StringComparer.Ordinal);
+        private bool initialLoadApplied = false;
+        private long retiredApiCalls = 0;
+
+        public IReadOnlyList<ModRecord> Mods => loadOrder;
+        public ModValueStore Values => values;
+        public ModAssetCache Assets => assets;
+        public ModScanner Scanner => scanner;
+        public bool IsScanning => scanTask != null;
+        public long Reloads { get; private set; }
+        public float LastScanMs { get; private set; }
+
+        // Raised on the main thread once a scan has been applied, with the ids that (re)loaded
+        public event Action<IReadOnlyList<string>> ModsReloaded;
+
+        public ModLoader(ModLoaderSettings settings)
+        {
+            this.settings = settings ?? new ModLoaderSettings();
+            modsRoot = Path.GetFullPath(this.settings.modsDirectory).TrimEnd(Path.DirectorySeparatorChar, Path.AltDirectorySeparatorChar);
+
+            string cacheDirectory = this.settings.cacheDirectory ?? Path.Combine(Path.GetTempPath(), "unity-sim-mod-cache");
+            assets = new ModAssetCache(cacheDirectory);
+            scanner = new ModScanner(assets, cacheDirectory);
+
+            if (this.settings.hotReload) StartWatcher();
+        }
+
+        #region Main Thread
+
+        public void BeginLoad()
+        {
+            if (scanTask != null) return;
+            StartScan(null);
+        }
+
+        // Applies a finished scan, starts a due rescan and ticks loaded mods
+        public void Update(float deltaTime)
+        {
+            if (scanTask != null && scanTask.IsCompleted)
+            {
+                var task = scanTask;
+                scanTask = null;
+                if (task.IsFaulted) Debug.LogError($"ModLoader: Scan failed - {task.Exception?.GetBaseException().Message}");
+                else Apply(task.Result, scanDirectories);
+            }
+
+            if (scanTask == null) StartDueRescan();
+            Tick(deltaTime);
+        }
+
+        // Rescans one mod and reloads it with its dependents, even if nothing changed on disk
+        public void Reload(string id)
+        {
+            if (id == null || !mods.TryGetValue(id, out var record)) return;
+            forcedReloads.Add(id);
+            MarkDirty(record.descriptor.directory);
+            lock (dirtyDirectories) lastChangeTicks = 0;
+        }
+
+        // Every API call since the loader started, including those of mods since reloaded or removed
+        public long ApiCalls
+        {
+            get
+            {
+                long total = retiredApiCalls;
+                for (int i = 0; i < loadOrder.Count; i++) total += loadOrder[i].stats.apiCalls;
+                return total;
+            }
+        }
+
+        public ModRecord Find(string id)
+        {
+            return id != null && mods.TryGetValue(id, out var record) ? record : null;
+        }
+
+        // Highest smoothed tick cost among loaded mods
+        public ModRecord FindSlowest()
+        {
+            ModRecord slowest = null;
+            for (int i = 0; i < loadOrder.Count; i++)
+            {
+                var record = loadOrder[i];
+                if (record.state != ModState.Loaded) continue;
+                if (slowest == null || record.stats.averageTickMs > slowest.stats.averageTickMs) slowest = record;
+            }
+            return slowest;
+        }
+
+        private void StartScan(List<string> directories)
+        {
+            scanDirectories = directories;
+            var stopwatch = Stopwatch.StartNew();
+            scanTask = Task.Run(() =>
+            {
+                var scanned = directories == null
+                    ? scanner.ScanAll(modsRoot, settings.parallelism)
+                    : scanner.Scan(directories, settings.parallelism);
+                scanner.SaveIndex();
+                LastScanMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+                return scanned;
+            });
+        }
+
+        private void StartDueRescan()
+        {
+            List<string> directories;
+            bool all;
+            lock (dirtyDirectories)
+            {
+                if (dirtyDirectories.Count == 0 && !rescanAll) return;
+
+                double quiet = (Stopwatch.GetTimestamp() - lastChangeTicks) / (double)Stopwatch.Frequency;
+                if (quiet < settings.reloadDebounce) return;
+
+                all = rescanAll;
+                directories = all ? null : new List<string>(dirtyDirectories);
+                dirtyDirectories.Clear();
+                rescanAll = false;
+            }
+
+            directories?.Sort(StringComparer.Ordinal);
+            StartScan(directories);
+        }
+
+        #endregion
+
+        #region Apply
+
+        // directories null: scanned is every mod. Otherwise scanned replaces the mods that were in those folders.
+        private void Apply(List<ModDescriptor> scanned, List<string> directories)
+        {
+            var rescanned = directories != null ? new HashSet<string>(directories, StringComparer.Ordinal) : null;
+
+            // The new set of descriptors by id; the first folder in name order wins a duplicate id
+            var next = new Dictionary<string, ModDescriptor>(StringComparer.Ordinal);
+            foreach (var record in loadOrder)
+            {
+                if (rescanned != null && !rescanned.Contains(record.descriptor.directory)) next[record.Id] = record.descriptor;
+            }
+            foreach (var descriptor in scanned)
+            {
+                if (descriptor.manifest == null)
+                {
+                    Debug.LogWarning($"ModLoader: Skipping {descriptor.directory} - {descriptor.error}");
+                    continue;
+                }
+                if (next.TryGetValue(descriptor.Id, out var existing) && existing.directory != descriptor.directory
+                    && string.CompareOrdinal(existing.directory, descriptor.directory) < 0)
+                {
+                    Debug.LogWarning($"ModLoader: Skipping {descriptor.directory} - id {descriptor.Id} is already used by {existing.directory}");
+                    continue;
+                }
+                next[descriptor.Id] = descriptor;
+            }
+
+            // Changed, added and removed mods, plus everything depending on them in either graph. A
+            // folder that still fails the same way is not a change, so it is not retried or re-reported.
+            var changed = new HashSet<string>(StringComparer.Ordinal);
+            foreach (var entry in next)
+            {
+                if (!mods.TryGetValue(entry.Key, out var record) || record.descriptor.contentHash != entry.Value.contentHash
+                    || record.descriptor.error != entry.Value.error || record.descriptor.directory != entry.Value.directory) changed.Add(entry.Key);
+            }
+            foreach (var id in mods.Keys)
+            {
+                if (!next.ContainsKey(id)) changed.Add(id);
+            }
+            changed.UnionWith(forcedReloads);
+            forcedReloads.Clear();
+            var affected = CloseOverDependents(changed, next);
+            if (affected.Count == 0) return;
+
+            // Dependents unload before what they depend on
+            for (int i = loadOrder.Count - 1; i >= 0; i--)
+            {
+                if (affected.Contains(loadOrder[i].Id)) Unload(loadOrder[i]);
+            }
+            foreach (var id in affected)
+            {
+                if (!mods.TryGetValue(id, out var record)) continue;
+                retiredApiCalls += record.stats.apiCalls;
+                mods.Remove(id);
+            }
+
+            var order = SortByDependencies(next, out var cyclic);
+            loadOrder.Clear();
+            var loaded = new List<string>();
+            for (int i = 0; i < order.Count; i++)
+            {
+                var descriptor = order[i];
+                if (!mods.TryGetValue(descriptor.Id, out var record))
+                {
+                    record = new ModRecord { descriptor = descriptor, order = i };
+                    mods[descriptor.Id] = record;
+                    Load(record, cyclic);
+                    loaded.Add(descriptor.Id);
+                }
+                else if (record.order != i)
+                {
+                    record.order = i;
+                    if (record.api != null) record.api.Order = i;
+                    values.Reorder(record.Id, i);
+                }
+                loadOrder.Add(record);
+            }
+
+            var live = new HashSet<ulong>();
+            foreach (var record in loadOrder)
+            {
+                foreach (var asset in record.descriptor.assets) live.Add(asset.hash);
+            }
+            assets.Retain(live);
+
+            if (initialLoadApplied) Reloads += loaded.Count;
+            initialLoadApplied = true;
+            ModsReloaded?.Invoke(loaded);
+        }
+
+        private static HashSet<string> CloseOverDependents(HashSet<string> changed, Dictionary<string, ModDescriptor> next)
+        {
+            var affected = new HashSet<string>(changed, StringComparer.Ordinal);
+            var pending = new Queue<string>(changed);
+            while (pending.Count > 0)
+            {
+                string id = pending.Dequeue();
+                foreach (var descriptor in next.Values)
+                {
+                    if (affected.Contains(descriptor.Id) || Array.IndexOf(descriptor.manifest.dependencies, id) < 0) continue;
+                    affected.Add(descriptor.Id);
+                    pending.Enqueue(descriptor.Id);
+                }
+            }
+            return affected;
+        }
+
+        // Kahn's algorithm, ties broken by id so the order is stable across reloads. Mods on a
+        // cycle, or depending on one, come last and are reported in cyclic.
+        private static List<ModDescriptor> SortByDependencies(Dictionary<string, ModDescriptor> descriptors, out HashSet<string> cyclic)
+        {
+            var remaining = new Dictionary<string, int>(StringComparer.Ordinal);
+            var dependents = new Dictionary<string, List<string>>(StringComparer.Ordinal);
+            foreach (var descriptor in descriptors.Values)
+            {
+                int count = 0;
+                foreach (var dependency in descriptor.manifest.dependencies)
+                {
+                    if (!descriptors.ContainsKey(dependency)) continue;     // reported as missing at load
+                    count++;
+                    if (!dependents.TryGetValue(dependency, out var list)) dependents[dependency] = list = new List<string>();
+                    list.Add(descriptor.Id);
+                }
+                remaining[descriptor.Id] = count;
+            }
+
+            var ready = new SortedSet<string>(StringComparer.Ordinal);
+            foreach (var entry in remaining)
+            {
+                if (entry.Value == 0) ready.Add(entry.Key);
+            }
+
+            var order = new List<ModDescriptor>(descriptors.Count);
+            while (ready.Count > 0)
+            {
+                string id = ready.Min;
+                ready.Remove(id);
+                order.Add(descriptors[id]);
+                if (!dependents.TryGetValue(id, out var list)) continue;
+                foreach (var dependent in list)
+                {
+                    if (--remaining[dependent] == 0) ready.Add(dependent);
+                }
+            }
+
+            cyclic = new HashSet<string>(StringComparer.Ordinal);
+            var unsorted = new List<string>();
+            foreach (var entry in remaining)
+            {
+                if (entry.Value > 0) unsorted.Add(entry.Key);
+            }
+            unsorted.Sort(StringComparer.Ordinal);
+            foreach (var id in unsorted)
+            {
+                cyclic.Add(id);
+                order.Add(descriptors[id]);
+            }
+            return order;
+        }
+
+        #endregion
+
+        #region Load and Unload
+
+        private void Load(ModRecord record, HashSet<string> cyclic)
+        {
+            var descriptor = record.descriptor;
+            string error = descriptor.error;
+            if (error == null && cyclic.Contains(record.Id)) error = "dependency cycle";
+            if (error == null) error = CheckDependencies(descriptor);
+
+            if (error == null)
+            {
+                var stopwatch = Stopwatch.StartNew();
+                try
+                {
+                    record.instance = CreateInstance(descriptor);
+                    record.api = new ModApi(descriptor, record.stats, values, record.order, settings.sandbox, settings.maxReadBytes);
+                    record.instance.OnLoad(record.api);
+                }
+                catch (Exception e)
+                {
+                    error = e is TargetInvocationException && e.InnerException != null ? e.InnerException.Message : e.Message;
+                    record.api?.Close();
+                    values.RemoveMod(record.Id);
+                    record.instance = null;
+                    record.api = null;
+                }
+                record.stats.loadMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+            }
+
+            record.state = error == null ? ModState.Loaded : ModState.Failed;
+            record.error = error;
+            if (error != null) Debug.LogWarning($"ModLoader: {record.Id} failed to load - {error}");
+        }
+
+        private string CheckDependencies(ModDescriptor descriptor)
+        {
+            foreach (var dependency in descriptor.manifest.dependencies)
+            {
+                if (!mods.TryGetValue(dependency, out var record)) return $"missing dependency {dependency}";
+                if (record.state != ModState.Loaded) return $"dependency {dependency} is not loaded";
+            }
+            return null;
+        }
+
+        // Assemblies stay loaded for the process lifetime; Mono cannot unload them
+        private IMod CreateInstance(ModDescriptor descriptor)
+        {
+            string assemblyName = descriptor.manifest.assembly;
+            if (string.IsNullOrEmpty(assemblyName)) return new DataMod();
+            if (settings.sandbox) throw new UnauthorizedAccessException("managed assemblies are disabled in sandbox mode");
+
+            var assembly = Assembly.Load(File.ReadAllBytes(ModSandbox.Resolve(descriptor.directory, assemblyName)));
+            foreach (var type in assembly.GetExportedTypes())
+            {
+                if (!type.IsAbstract && typeof(IMod).IsAssignableFrom(type)) return (IMod)Activator.CreateInstance(type);
+            }
+            throw new InvalidDataException($"{assemblyName} has no public IMod implementation");
+        }
+
+        private void Unload(ModRecord record)
+        {
+            if (record.instance != null)
+            {
+                try
+                {
+                    record.instance.OnUnload();
+                }
+                catch (Exception e)
+                {
+                    Debug.LogWarning($"ModLoader: {record.Id} threw on unload - {e.Message}");
+                }
+            }
+
+            record.api?.Close();
+            values.RemoveMod(record.Id);
+            record.instance = null;
+            record.api = null;
+        }
+
+        #endregion
+
+        #region Ticking
+
+        private void Tick(float deltaTime)
+        {
+            for (int i = 0; i < loadOrder.Count; i++)
+            {
+                var record = loadOrder[i];
+                if (record.state != ModState.Loaded || !record.api.HasTickHandlers) continue;
+
+                var stats = record.stats;
+                long started = Stopwatch.GetTimestamp();
+                try
+                {
+                    record.api.RunTick(deltaTime);
+                }
+                catch (Exception e)
+                {
+                    stats.faults++;
+                    Debug.LogWarning($"ModLoader: {record.Id} faulted in tick ({stats.faults}) - {e.Message}");
+                    if (stats.faults >= settings.maxFaults) Disable(record);
+                }
+
+                float elapsed = (float)((Stopwatch.GetTimestamp() - started) * 1000.0 / Stopwatch.Frequency);
+                stats.ticks++;
+                stats.totalTickMs += elapsed;
+                stats.lastTickMs = elapsed;
+                stats.maxTickMs = Math.Max(stats.maxTickMs, elapsed);
+                stats.averageTickMs = stats.ticks == 1 ? elapsed : stats.averageTickMs + (elapsed - stats.averageTickMs) * TickSmoothing;
+
+                if (elapsed <= settings.tickBudgetMs)
+                {
+                    stats.overBudgetTicks = 0;
+                    continue;
+                }
+
+                // Reported once; the flag clears when the mod reloads
+                if (++stats.overBudgetTicks >= settings.slowTickLimit && !stats.slow)
+                {
+                    stats.slow = true;
+                    Debug.LogWarning($"ModLoader: {record.Id} is slow - {stats.averageTickMs:F2}ms per tick against a {settings.tickBudgetMs:F2}ms budget");
+                }
+            }
+        }
+
+        // Its values are gone, so mods depending on it go down with it, as Load would refuse them
+        private void Disable(ModRecord record)
+        {
+            Unload(record);
+            record.state = ModState.Disabled;
+            record.error = $"disabled after {record.stats.faults} faults";
+            Debug.LogWarning($"ModLoader: {record.Id} {record.error}");
+
+            var descriptors = new Dictionary<string, ModDescriptor>(StringComparer.Ordinal);
+            foreach (var entry in loadOrder) descriptors[entry.Id] = entry.descriptor;
+            var affected = CloseOverDependents(new HashSet<string>(StringComparer.Ordinal) { record.Id }, descriptors);
+
+            for (int i = loadOrder.Count - 1; i >= 0; i--)
+            {
+                var dependent = loadOrder[i];
+                if (dependent != record && dependent.state == ModState.Loaded && affected.Contains(dependent.Id)) Unload(dependent);
+            }
+            foreach (var dependent in loadOrder)
+            {
+                if (dependent == record || dependent.state != ModState.Loaded || !affected.Contains(dependent.Id)) continue;
+
+                dependent.state = ModState.Failed;
+                dependent.error = CheckDependencies(dependent.descriptor);
+                Debug.LogWarning($"ModLoader: {dependent.Id} unloaded - {dependent.error}");
+            }
+        }
+
+        #endregion
+
+        #region Watching
+
+        private void StartWatcher()
+        {
+            if (!Directory.Exists(modsRoot)) return;
+
+            watcher = new FileSystemWatcher(modsRoot)
+            {
+                IncludeSubdirectories = true,
+                NotifyFilter = NotifyFilters.FileName | NotifyFilters.DirectoryName | NotifyFilters.LastWrite | NotifyFilters.Size
+            };
+            watcher.Changed += (sender, e) => MarkDirty(e.FullPath);
+            watcher.Created += (sender, e) => MarkDirty(e.FullPath);
+            watcher.Deleted += (sender, e) => MarkDirty(e.FullPath);
+            watcher.Renamed += (sender, e) =>
+            {
+                MarkDirty(e.OldFullPath);
+                MarkDirty(e.FullPath);
+            };
+
+            // Overflowed buffer: the changes are unknown, so rescan everything
+            watcher.Error += (sender, e) =>
+            {
+                lock (dirtyDirectories)
+                {
+                    rescanAll = true;
+                    lastChangeTicks = Stopwatch.GetTimestamp();
+                }
+            };
+            watcher.EnableRaisingEvents = true;
+        }
+
+        // Any thread; maps a path to the mod folder holding it
+        private void MarkDirty(string path)
+        {
+            string fullPath = Path.GetFullPath(path);
+            if (!fullPath.StartsWith(modsRoot, StringComparison.Ordinal) || fullPath.Length <= modsRoot.Length + 1) return;
+
+            string relative = fullPath.Substring(modsRoot.Length + 1);
+            int separator = relative.IndexOfAny(new[] { Path.DirectorySeparatorChar, Path.AltDirectorySeparatorChar });
+            string directory = Path.Combine(modsRoot, separator < 0 ? relative : relative.Substring(0, separator));
+
+            lock (dirtyDirectories)
+            {
+                dirtyDirectories.Add(directory);
+                lastChangeTicks = Stopwatch.GetTimestamp();
+            }
+        }
+
+        #endregion
+
+        // Unloads every mod in reverse order and stops watching
+        public void Dispose()
+        {
+            watcher?.Dispose();
+            watcher = null;
+
+            for (int i = loadOrder.Count - 1; i >= 0; i--) Unload(loadOrder[i]);
+            loadOrder.Clear();
+            mods.Clear();
+        }
+    }
+}
@@ -0,0 +1,39 @@
+using System;
+
+namespace UnitySim.Modding
+{
+    // mod.json at the root of a mod's folder
+    [Serializable]
+    public class ModManifest
+    {
+        public const string FileName = "mod.json";
+
+        public string id;
+        public string name;
+        public string version = "1.0.0";
+        public string[] dependencies = new string[0];   // ids of mods that load first
+        public string[] assets;                         // folder-relative; null loads every .json but the manifest
+        public string assembly;                         // optional managed entry point, refused in sandbox mode
+    }
+
+    public struct ModFile
+    {
+        public string relativePath;
+        public long size;
+        public long modifiedTicks;
+        public ulong hash;
+    }
+
+    // A mod folder as scanned: manifest, hashed files and compiled assets
+    public class ModDescriptor
+    {
+        public string directory;
+        public ModManifest manifest;
+        public ModFile[] files = new ModFile[0];
+        public ModAsset[] assets = new ModAsset[0];
+        public ulong contentHash;                       // manifest plus every file; equal hashes mean nothing to reload
+        public string error;                            // set when the folder could not be prepared
+
+        public string Id => manifest?.id;
+    }
+}
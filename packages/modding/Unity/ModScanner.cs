@@ -0,0 +1,237 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
+using Newtonsoft.Json;
+
+namespace UnitySim.Modding
+{
+    // 64-bit content hash, eight bytes per step
+    public static class ModContentHash
+    {
+        private const ulong Prime1 = 0x9E3779B185EBCA87UL;
+        private const ulong Prime2 = 0xC2B2AE3D27D4EB4FUL;
+
+        public const ulong Seed = 0x27D4EB2F165667C5UL;
+
+        public static ulong Append(ulong hash, ReadOnlySpan<byte> data)
+        {
+            var words = MemoryMarshal.Cast<byte, ulong>(data);
+            for (int i = 0; i < words.Length; i++) hash = Mix(hash, words[i]);
+            for (int i = words.Length * 8; i < data.Length; i++) hash = Mix(hash, data[i]);
+            return hash;
+        }
+
+        public static ulong Append(ulong hash, string text)
+        {
+            for (int i = 0; i < text.Length; i++) hash = Mix(hash, text[i]);
+            return Mix(hash, (ulong)text.Length);
+        }
+
+        public static ulong Mix(ulong hash, ulong value)
+        {
+            hash ^= value * Prime2;
+            hash = (hash << 31) | (hash >> 33);
+            return hash * Prime1;
+        }
+
+        public static ulong Finish(ulong hash)
+        {
+            hash ^= hash >> 33;
+            hash *= Prime2;
+            hash ^= hash >> 29;
+            return hash;
+        }
+    }
+
+    // Reads mod folders in parallel: manifest, content hashes and compiled assets. A file whose
+    // size and modification time match the persisted index keeps its hash without being read,
+    // so a warm start touches only file metadata and the asset cache. Thread-safe.
+    public class ModScanner
+    {
+        private const string IndexFileName = "scan-index.txt";
+        private const int ReadBufferSize = 64 * 1024;
+
+        private readonly ModAssetCache assets;
+        private readonly string indexPath;
+        private readonly ConcurrentDictionary<string, ModFile> index = new ConcurrentDictionary<string, ModFile>(StringComparer.Ordinal);
+        private long filesHashed = 0;
+        private long filesReused = 0;
+
+        public long FilesHashed => Interlocked.Read(ref filesHashed);
+        public long FilesReused => Interlocked.Read(ref filesReused);
+
+        public ModScanner(ModAssetCache assets, string cacheDirectory)
+        {
+            this.assets = assets;
+            indexPath = Path.Combine(cacheDirectory, IndexFileName);
+            LoadIndex();
+        }
+
+        // Every subfolder holding a mod.json, in folder-name order; parallelism 0 uses every core
+        public List<ModDescriptor> ScanAll(string modsDirectory, int parallelism)
+        {
+            var result = new List<ModDescriptor>();
+            if (!Directory.Exists(modsDirectory)) return result;
+
+            var directories = Directory.GetDirectories(modsDirectory);
+            Array.Sort(directories, StringComparer.Ordinal);
+            return Scan(directories, parallelism);
+        }
+
+        public List<ModDescriptor> Scan(IReadOnlyList<string> directories, int parallelism)
+        {
+            var scanned = new ModDescriptor[directories.Count];
+            var options = new ParallelOptions { MaxDegreeOfParallelism = parallelism > 0 ? parallelism : Environment.ProcessorCount };
+            Parallel.For(0, directories.Count, options, () => new byte[ReadBufferSize], (i, state, buffer) =>
+            {
+                scanned[i] = ScanMod(directories[i], buffer);
+                return buffer;
+            }, buffer => { });
+
+            var result = new List<ModDescriptor>(scanned.Length);
+            for (int i = 0; i < scanned.Length; i++)
+            {
+                if (scanned[i] != null) result.Add(scanned[i]);
+            }
+            return result;
+        }
+
+        // Null when the folder is not a mod (no manifest)
+        public ModDescriptor ScanMod(string directory, byte[] buffer = null)
+        {
+            string manifestPath = Path.Combine(directory, ModManifest.FileName);
+            if (!File.Exists(manifestPath)) return null;
+
+            buffer = buffer ?? new byte[ReadBufferSize];
+            var descriptor = new ModDescriptor { directory = Path.GetFullPath(directory) };
+            try
+            {
+                descriptor.manifest = JsonConvert.DeserializeObject<ModManifest>(File.ReadAllText(manifestPath, Encoding.UTF8));
+                if (descriptor.manifest == null || string.IsNullOrEmpty(descriptor.manifest.id))
+                    throw new InvalidDataException($"{ModManifest.FileName} has no id");
+                descriptor.manifest.dependencies = descriptor.manifest.dependencies ?? new string[0];
+
+                var paths = ListFiles(descriptor);
+                var files = new ModFile[paths.Count];
+                var compiled = new List<ModAsset>();
+                ulong content = ModContentHash.Seed;
+
+                for (int i = 0; i < paths.Count; i++)
+                {
+                    string fullPath = ModSandbox.Resolve(descriptor.directory, paths[i]);
+                    files[i] = HashFile(fullPath, paths[i], buffer);
+                    content = ModContentHash.Mix(ModContentHash.Append(content, files[i].relativePath), files[i].hash);
+
+                    if (paths[i] != ModManifest.FileName && paths[i].EndsWith(".json", StringComparison.OrdinalIgnoreCase))
+                        compiled.Add(assets.GetOrCompile(fullPath, files[i]));
+                }
+
+                descriptor.files = files;
+                descriptor.assets = compiled.ToArray();
+                descriptor.contentHash = ModContentHash.Finish(content);
+            }
+            catch (Exception e)
+            {
+                descriptor.error = e.Message;
+                descriptor.contentHash = 0;
+            }
+            return descriptor;
+        }
+
+        // Manifest first, then the listed or discovered files in ordinal order
+        private static List<string> ListFiles(ModDescriptor descriptor)
+        {
+            var manifest = descriptor.manifest;
+            var paths = new List<string>();
+
+            if (manifest.assets != null)
+            {
+                paths.AddRange(manifest.assets);
+            }
+            else
+            {
+                foreach (var path in Directory.GetFiles(descriptor.directory, "*.json", SearchOption.AllDirectories))
+                {
+                    string relative = path.Substring(descriptor.directory.Length).TrimStart(Path.DirectorySeparatorChar, Path.AltDirectorySeparatorChar).Replace('\\', '/');
+                    if (relative != ModManifest.FileName) paths.Add(relative);
+                }
+            }
+            if (!string.IsNullOrEmpty(manifest.assembly)) paths.Add(manifest.assembly);
+
+            paths.Sort(StringComparer.Ordinal);
+            paths.Insert(0, ModManifest.FileName);
+            return paths;
+        }
+
+        private ModFile HashFile(string fullPath, string relativePath, byte[] buffer)
+        {
+            var info = new FileInfo(fullPath);
+            if (!info.Exists) throw new FileNotFoundException($"{relativePath} is listed but missing");
+
+            var file = new ModFile { relativePath = relativePath, size = info.Length, modifiedTicks = info.LastWriteTimeUtc.Ticks };
+            if (index.TryGetValue(fullPath, out var known) && known.size == file.size && known.modifiedTicks == file.modifiedTicks)
+            {
+                Interlocked.Increment(ref filesReused);
+                file.hash = known.hash;
+                return file;
+            }
+
+            ulong hash = ModContentHash.Seed;
+            using (var stream = new FileStream(fullPath, FileMode.Open, FileAccess.Read, FileShare.ReadWrite, 1, FileOptions.SequentialScan))
+            {
+                int read;
+                while ((read = stream.Read(buffer, 0, buffer.Length)) > 0) hash = ModContentHash.Append(hash, new ReadOnlySpan<byte>(buffer, 0, read));
+            }
+            file.hash = ModContentHash.Finish(ModContentHash.Mix(hash, (ulong)file.size));
+
+            Interlocked.Increment(ref filesHashed);
+            index[fullPath] = file;
+            return file;
+        }
+
+        #region Index
+
+        // path, size, modified ticks and hash per line
+        private void LoadIndex()
+        {
+            try
+            {
+                if (!File.Exists(indexPath)) return;
+                foreach (var line in File.ReadLines(indexPath, Encoding.UTF8))
+                {
+                    var parts = line.Split('\t');
+                    if (parts.Length != 4 || !long.TryParse(parts[1], out long size) || !long.TryParse(parts[2], out long ticks)
+                        || !ulong.TryParse(parts[3], System.Globalization.NumberStyles.HexNumber, null, out ulong hash)) continue;
+
+                    index[parts[0]] = new ModFile { size = size, modifiedTicks = ticks, hash = hash };
+                }
+            }
+            catch (IOException)
+            {
+                index.Clear();
+            }
+        }
+
+        public void SaveIndex()
+        {
+            var text = new StringBuilder();
+            foreach (var entry in index)
+            {
+                text.Append(entry.Key).Append('\t').Append(entry.Value.size).Append('\t')
+                    .Append(entry.Value.modifiedTicks).Append('\t').Append(entry.Value.hash.ToString("x16")).Append('\n');
+            }
+
+            string temporary = indexPath + ".tmp";
+            File.WriteAllText(temporary, text.ToString(), Encoding.UTF8);
+            if (File.Exists(indexPath)) File.Delete(indexPath);
+            File.Move(temporary, indexPath);
+        }
+
+        #endregion
+    }
+}
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Modding
 {
@@ -13,32 +17,155 @@ namespace UnitySim.Modding
 
         public ModdingData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             modding = new ModdingInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (modding != null)
+                modding.WriteState(writer, "modding");
+            else
+                writer.Write("modding", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
     public class ModdingInfo
     {
-                public int loadedMods = 5;
+        public int loadedMods = 0;
         public bool hotReloadEnabled = true;
-        public int apiCalls = 0;
+        public long apiCalls = 0;
         public string modsDirectory = "./mods";
-        public int activeMods = 3;
+        public int activeMods = 0;
         public bool sandboxMode = true;
         public string systemHealth = "operational";
         public string framework = "unity-sim-modding";
+        public int failedMods = 0;
+        public long reloadCount = 0;
+        public string slowestMod = "";
+        public float slowestModMs = 0f;
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("loadedMods", loadedMods);
+            writer.Write("hotReloadEnabled", hotReloadEnabled);
+            writer.Write("apiCalls", apiCalls);
+            writer.Write("modsDirectory", modsDirectory);
+            writer.Write("activeMods", activeMods);
+            writer.Write("sandboxMode", sandboxMode);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.Write("failedMods", failedMods);
+            writer.Write("reloadCount", reloadCount);
+            writer.Write("slowestMod", slowestMod);
+            writer.Write("slowestModMs", slowestModMs);
+            writer.EndObject();
+        }
+
+        public ModdingField Diff(ModdingInfo other)
+        {
+            var changed = ModdingField.None;
+            if (loadedMods != other.loadedMods) changed |= ModdingField.LoadedMods;
+            if (hotReloadEnabled != other.hotReloadEnabled) changed |= ModdingField.HotReloadEnabled;
+            if (apiCalls != other.apiCalls) changed |= ModdingField.ApiCalls;
+            if (modsDirectory != other.modsDirectory) changed |= ModdingField.ModsDirectory;
+            if (activeMods != other.activeMods) changed |= ModdingField.ActiveMods;
+            if (sandboxMode != other.sandboxMode) changed |= ModdingField.SandboxMode;
+            if (systemHealth != other.systemHealth) changed |= ModdingField.SystemHealth;
+            if (framework != other.framework) changed |= ModdingField.Framework;
+            if (failedMods != other.failedMods) changed |= ModdingField.FailedMods;
+            if (reloadCount != other.reloadCount) changed |= ModdingField.ReloadCount;
+            if (slowestMod != other.slowestMod) changed |= ModdingField.SlowestMod;
+            if (slowestModMs != other.slowestModMs) changed |= ModdingField.SlowestModMs;
+            return changed;
+        }
+
+        public void CopyTo(ModdingInfo target)
+        {
+            target.loadedMods = loadedMods;
+            target.hotReloadEnabled = hotReloadEnabled;
+            target.apiCalls = apiCalls;
+            target.modsDirectory = modsDirectory;
+            target.activeMods = activeMods;
+            target.sandboxMode = sandboxMode;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+            target.failedMods = failedMods;
+            target.reloadCount = reloadCount;
+            target.slowestMod = slowestMod;
+            target.slowestModMs = slowestModMs;
+        }
     }
 
-    public class ModdingSystem : MonoBehaviour
+    [System.Flags]
+    public enum ModdingField
+    {
+        None = 0,
+        LoadedMods = 1 << 0,
+        HotReloadEnabled = 1 << 1,
+        ApiCalls = 1 << 2,
+        ModsDirectory = 1 << 3,
+        ActiveMods = 1 << 4,
+        SandboxMode = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        FailedMods = 1 << 8,
+        ReloadCount = 1 << 9,
+        SlowestMod = 1 << 10,
+        SlowestModMs = 1 << 11,
+        All = (1 << 12) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct ModdingDelta
+    {
+        public readonly long timestamp;
+        public readonly ModdingField changed;
+        public readonly ModdingInfo values;
+
+        public ModdingDelta(long timestamp, ModdingField changed, ModdingInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(ModdingField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class ModdingSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Modding Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Mods")]
+        public string modsDirectory = "mods";                   // relative paths are under persistentDataPath
+        public string cacheFolder = "mod-cache";                // under persistentDataPath
+        public bool hotReloadEnabled = true;
+        public bool sandboxMode = true;
+        public int scanParallelism = 0;                         // 0 uses every core
+        public float reloadDebounce = 0.25f;
+
+        [Header("Mod Budget")]
+        public float tickBudgetMs = 2f;
+        public int slowTickLimit = 30;
+        public int maxFaults = 3;
+        public int maxReadKilobytes = 4096;
+        [SerializeField] private int scannedMods = 0;
+        [SerializeField] private float lastScanMs = 0f;
+
         [Header("Current Data")]
         [SerializeField] private ModdingData currentData;
 
@@ -48,12 +175,23 @@ namespace UnitySim.Modding
 
         // Events
         public System.Action<ModdingData> OnModdingChanged;
+        public System.Action<ModdingDelta> OnModdingDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.ModdingSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly ModdingInfo publishedInfo = new ModdingInfo();
+        private bool publishFullDelta = true;
+
+        // Loader
+        private ModLoader loader;
+        private bool loaderChanged = false;
+        private long retiredApiCalls = 0;      // from loaders replaced after a settings change
 
         #region Unity Lifecycle
 
@@ -62,18 +200,36 @@ namespace UnitySim.Modding
             InitializeModding();
         }
 
-        void Update()
+        void OnEnable()
+        {
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
+
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
+
+        void OnDestroy()
         {
-            if (!isInitialized) return;
+            loader?.Dispose();
+            loader = null;
+        }
 
-            UpdateSystem();
+        // Mods tick every frame against their budget; the scheduled update only publishes counts
+        void Update()
+        {
+            if (loader == null) return;
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
+            // Edited settings apply between scans, so a tweak never discards one in flight
+            if (loaderChanged && !loader.IsScanning)
             {
-                ProcessUpdate();
-                updateTimer = 0f;
+                retiredApiCalls += loader.ApiCalls;
+                CreateLoader();
             }
+            loader.Update(UnityEngine.Time.deltaTime);
         }
 
         #endregion
@@ -83,32 +239,96 @@ namespace UnitySim.Modding
         private void InitializeModding()
         {
             currentData = new ModdingData();
+            retiredApiCalls = 0;
+            CreateLoader();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
                 Debug.Log($"ModdingSystem initialized successfully");
         }
 
+        // The scan index and compiled assets persist in cacheFolder, so a new loader only
+        // rehashes and recompiles files that changed since the last run
+        private void CreateLoader()
+        {
+            loader?.Dispose();
+            loaderChanged = false;
+
+            string root = Application.persistentDataPath;
+            loader = new ModLoader(new ModLoaderSettings
+            {
+                modsDirectory = System.IO.Path.Combine(root, modsDirectory),
+                cacheDirectory = System.IO.Path.Combine(root, cacheFolder),
+                parallelism = scanParallelism,
+                sandbox = sandboxMode,
+                hotReload = hotReloadEnabled,
+                reloadDebounce = reloadDebounce,
+                tickBudgetMs = tickBudgetMs,
+                slowTickLimit = slowTickLimit,
+                maxFaults = maxFaults,
+                maxReadBytes = maxReadKilobytes * 1024L
+            });
+            loader.ModsReloaded += HandleModsReloaded;
+            loader.BeginLoad();
+        }
+
+        private void HandleModsReloaded(IReadOnlyList<string> ids)
+        {
+            if (enableLogging && ids.Count > 0)
+                Debug.Log($"ModdingSystem: Loaded {ids.Count} mods in {loader.LastScanMs:F0}ms scan ({string.Join(", ", ids)})");
+        }
+
         #endregion
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.modding.apiCalls += UnityEngine.Random.Range(1, 5);
-            currentData.modding.activeMods = Mathf.Max(0, currentData.modding.activeMods + UnityEngine.Random.Range(-1, 2));
+            if (loader == null) return;
+
+            var info = currentData.modding;
+            int loaded = 0, active = 0, failed = 0;
+            var mods = loader.Mods;
+            for (int i = 0; i < mods.Count; i++)
+            {
+                var record = mods[i];
+                if (record.state != ModState.Loaded)
+                {
+                    failed++;
+                    continue;
+                }
+
+                loaded++;
+                if (record.api.HasTickHandlers) active++;
+            }
+
+            var slowest = loader.FindSlowest();
+            info.loadedMods = loaded;
+            info.activeMods = active;
+            info.failedMods = failed;
+            info.apiCalls = retiredApiCalls + loader.ApiCalls;
+            info.reloadCount = loader.Reloads;
+            info.slowestMod = slowest != null && slowest.stats.ticks > 0 ? slowest.Id : "";
+            info.slowestModMs = slowest != null ? slowest.stats.averageTickMs : 0f;
+            info.modsDirectory = modsDirectory;
+            info.hotReloadEnabled = hotReloadEnabled;
+            info.sandboxMode = sandboxMode;
+            info.systemHealth = failed > 0 ? "degraded" : "operational";
+            scannedMods = mods.Count;
+            lastScanMs = loader.LastScanMs;
         }
 
         private void ProcessUpdate()
@@ -121,6 +341,12 @@ namespace UnitySim.Modding
                 OnModdingChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -128,10 +354,67 @@ namespace UnitySim.Modding
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.modding;
+            var changed = publishFullDelta ? ModdingField.All : info.Diff(publishedInfo);
+            if (changed == ModdingField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnModdingDelta?.Invoke(new ModdingDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(ModdingSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("ModdingSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -142,7 +425,9 @@ namespace UnitySim.Modding
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -163,6 +448,29 @@ namespace UnitySim.Modding
             return currentData;
         }
 
+        // Value published by the latest mod in load order to set key, e.g. "units.tank.speed"
+        public bool GetModValue(string key, out float value)
+        {
+            value = 0f;
+            return loader != null && loader.Values.TryGet(key, out value);
+        }
+
+        public ModStats GetModStats(string modId)
+        {
+            return loader?.Find(modId)?.stats;
+        }
+
+        // Reloads one mod and every mod depending on it
+        public void ReloadMod(string modId)
+        {
+            loader?.Reload(modId);
+        }
+
+        public ModLoader GetLoader()
+        {
+            return loader;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -191,10 +499,18 @@ namespace UnitySim.Modding
             ResetData();
         }
 
+        [ContextMenu("Reload All Mods")]
+        public void ReloadAllMods()
+        {
+            if (loader == null) return;
+            var mods = loader.Mods;
+            for (int i = 0; i < mods.Count; i++) loader.Reload(mods[i].Id);
+        }
+
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -206,6 +522,14 @@ namespace UnitySim.Modding
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            scanParallelism = Mathf.Max(0, scanParallelism);
+            reloadDebounce = Mathf.Max(0f, reloadDebounce);
+            tickBudgetMs = Mathf.Max(0.01f, tickBudgetMs);
+            slowTickLimit = Mathf.Max(1, slowTickLimit);
+            maxFaults = Mathf.Max(1, maxFaults);
+            maxReadKilobytes = Mathf.Max(1, maxReadKilobytes);
+
+            loaderChanged = true;
         }
 
         #endregion
@@ -217,7 +541,16 @@ namespace UnitySim.Modding
             Debug.Log($"ModdingSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (currentData != null)
+            {
+                var info = currentData.modding;
+                Debug.Log($"- Mods: {info.loadedMods} loaded, {info.activeMods} ticking, {info.failedMods} failed, {info.reloadCount} reloads (sandbox {sandboxMode}, hot reload {hotReloadEnabled})");
+                Debug.Log($"- Cost: {info.apiCalls} API calls, slowest {(info.slowestMod.Length > 0 ? info.slowestMod : "none")} at {info.slowestModMs:F2}ms/{tickBudgetMs:F2}ms");
+            }
+            if (loader != null)
+                Debug.Log($"- Scan: {lastScanMs:F0}ms, {loader.Scanner.FilesHashed} files hashed, {loader.Scanner.FilesReused} reused, assets {loader.Assets.Compiled} compiled/{loader.Assets.DiskHits} from disk");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -0,0 +1,189 @@
+using System;
+
+namespace UnitySim.NetworkMultiplayer
+{
+    // Packs values into a byte buffer at bit granularity, least significant bit first. Bits
+    // are OR-ed into a buffer kept zeroed past the write position, so Rewind can drop a
+    // partly written entity when it would overrun a packet's budget.
+    public class BitWriter
+    {
+        private byte[] buffer;
+        private int bitPosition = 0;
+
+        public byte[] Buffer => buffer;
+        public int BitPosition => bitPosition;
+        public int ByteCount => (bitPosition + 7) >> 3;
+
+        public BitWriter(int capacity = 1500)
+        {
+            buffer = new byte[Math.Max(16, capacity)];
+        }
+
+        public void Reset()
+        {
+            Array.Clear(buffer, 0, ByteCount);
+            bitPosition = 0;
+        }
+
+        // Returns to a position from BitPosition, clearing everything written after it
+        public void Rewind(int position)
+        {
+            if (position < 0 || position > bitPosition) throw new ArgumentOutOfRangeException(nameof(position));
+
+            int end = ByteCount;
+            int first = position >> 3;
+            if (first < end)
+            {
+                buffer[first] &= (byte)((1 << (position & 7)) - 1);
+                Array.Clear(buffer, first + 1, end - first - 1);
+            }
+            bitPosition = position;
+        }
+
+        public void WriteBits(ulong value, int bits)
+        {
+            if (bits <= 0) return;
+            if (bits > 64) throw new ArgumentOutOfRangeException(nameof(bits));
+
+            int needed = (bitPosition + bits + 7) >> 3;
+            if (needed > buffer.Length) Array.Resize(ref buffer, Math.Max(needed, buffer.Length * 2));
+
+            if (bits < 64) value &= (1UL << bits) - 1;
+            while (bits > 0)
+            {
+                int offset = bitPosition & 7;
+                int take = Math.Min(8 - offset, bits);
+                buffer[bitPosition >> 3] |= (byte)((value & ((1UL << take) - 1)) << offset);
+                value >>= take;
+                bits -= take;
+                bitPosition += take;
+            }
+        }
+
+        public void WriteBool(bool value)
+        {
+            WriteBits(value ? 1UL : 0UL, 1);
+        }
+
+        // Two-bit width class then 4, 12, 28 or 64 bits, so small numbers stay small
+        public void WriteVarUInt(ulong value)
+        {
+            int width = BitPacking.WidthClass(value);
+            WriteBits((ulong)width, 2);
+            WriteBits(value, BitPacking.Widths[width]);
+        }
+
+        public void WriteVarInt(long value)
+        {
+            WriteVarUInt(BitPacking.ZigZag(value));
+        }
+    }
+
+    // Reads what BitWriter wrote. Packets come off the network, so reading past the end
+    // returns zeros and sets Overflowed instead of throwing.
+    public class BitReader
+    {
+        private byte[] buffer;
+        private int start;
+        private int bitLength;
+        private int bitPosition;
+
+        public bool Overflowed { get; private set; }
+        public int BitsRemaining => bitLength - bitPosition;
+
+        public void Reset(byte[] data, int offset, int length)
+        {
+            buffer = data;
+            start = offset;
+            bitLength = length * 8;
+            bitPosition = 0;
+            Overflowed = false;
+        }
+
+        public ulong ReadBits(int bits)
+        {
+            if (bits <= 0) return 0;
+            if (bits > 64) throw new ArgumentOutOfRangeException(nameof(bits));
+            if (bitPosition + bits > bitLength)
+            {
+                Overflowed = true;
+                bitPosition = bitLength;
+                return 0;
+            }
+
+            ulong value = 0;
+            int shift = 0;
+            while (bits > 0)
+            {
+                int offset = bitPosition & 7;
+                int take = Math.Min(8 - offset, bits);
+                ulong chunk = (ulong)(buffer[start + (bitPosition >> 3)] >> offset) & ((1UL << take) - 1);
+                value |= chunk << shift;
+                shift += take;
+                bits -= take;
+                bitPosition += take;
+            }
+            return value;
+        }
+
+        public bool ReadBool()
+        {
+            return ReadBits(1) != 0;
+        }
+
+        public ulong ReadVarUInt()
+        {
+            int width = (int)ReadBits(2);
+            return ReadBits(BitPacking.Widths[width]);
+        }
+
+        public long ReadVarInt()
+        {
+            return BitPacking.UnZigZag(ReadVarUInt());
+        }
+    }
+
+    public static class BitPacking
+    {
+        public static readonly int[] Widths = { 4, 12, 28, 64 };
+
+        public static int WidthClass(ulong value)
+        {
+            if (value < 1UL << 4) return 0;
+            if (value < 1UL << 12) return 1;
+            if (value < 1UL << 28) return 2;
+            return 3;
+        }
+
+        // Bits WriteVarUInt would use, for budgeting without writing
+        public static int VarUIntBits(ulong value)
+        {
+            return 2 + Widths[WidthClass(value)];
+        }
+
+        public static ulong ZigZag(long value)
+        {
+            return (ulong)((value << 1) ^ (value >> 63));
+        }
+
+        public static long UnZigZag(ulong value)
+        {
+            return (long)(value >> 1) ^ -(long)(value & 1);
+        }
+
+        // Fixed point at the given step, e.g. 0.01 keeps two decimals
+        public static long Quantize(float value, float precision)
+        {
+            if (float.IsNaN(value)) return 0;
+            double scaled = Math.Round(value / (double)precision);
+            if (scaled >= long.MaxValue / 2) return long.MaxValue / 2;
+            if (scaled <= long.MinValue / 2) return long.MinValue / 2;
+            return (long)scaled;
+        }
+
+        public static float Dequantize(long value, float precision)
+        {
+            return (float)(value * (double)precision);
+        }
+    }
+}
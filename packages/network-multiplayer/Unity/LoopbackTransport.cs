@@ -0,0 +1,125 @@
+using System;
+using System.Collections.Generic;
+
+namespace UnitySim.NetworkMultiplayer
+{
+    // Stands in for a socket layer: in-process ReplicationClients receive the server's
+    // packets after a simulated one-way latency with jitter and loss, and their acks come
+    // back the same way. Reordering falls out of the jitter.
+    public class LoopbackTransport : IReplicationTransport
+    {
+        private struct InFlight
+        {
+            public int connection;
+            public bool toServer;
+            public double deliverAt;
+            public byte[] data;
+            public int length;
+        }
+
+        public float latencyMs = 40f;
+        public float jitterMs = 10f;
+        public float packetLoss = 0.01f;
+
+        private readonly List<InFlight> inFlight = new List<InFlight>();
+        private readonly Stack<byte[]> pool = new Stack<byte[]>();
+        private readonly Dictionary<int, ReplicationClient> clients = new Dictionary<int, ReplicationClient>();
+        private readonly BitWriter ackWriter = new BitWriter(16);
+        private readonly Random random;
+        private double now = 0.0;
+
+        public int InFlightCount => inFlight.Count;
+        public long PacketsDropped { get; private set; }
+
+        public LoopbackTransport(int seed)
+        {
+            random = new Random(seed);
+        }
+
+        public ReplicationClient AddClient(int connection)
+        {
+            if (!clients.TryGetValue(connection, out var client))
+            {
+                client = new ReplicationClient();
+                clients[connection] = client;
+            }
+            return client;
+        }
+
+        public void RemoveClient(int connection)
+        {
+            clients.Remove(connection);
+        }
+
+        public ReplicationClient GetClient(int connection)
+        {
+            return clients.TryGetValue(connection, out var client) ? client : null;
+        }
+
+        public void Send(int connection, byte[] data, int length)
+        {
+            Enqueue(connection, false, data, length);
+        }
+
+        // Delivers everything due by now: packets to clients, which ack them, and acks to the server
+        public void Update(double now, ReplicationServer server)
+        {
+            this.now = now;
+
+            for (int i = 0; i < inFlight.Count; i++)
+            {
+                var packet = inFlight[i];
+                if (packet.deliverAt > now) continue;
+
+                inFlight[i] = inFlight[inFlight.Count - 1];
+                inFlight.RemoveAt(inFlight.Count - 1);
+                i--;
+
+                if (packet.toServer)
+                {
+                    server.ReceiveAck(packet.connection, packet.data, 0, packet.length, now);
+                }
+                else if (clients.TryGetValue(packet.connection, out var client))
+                {
+                    client.Receive(packet.data, 0, packet.length);
+                    if (client.HasReceived)
+                    {
+                        ackWriter.Reset();
+                        client.WriteAck(ackWriter);
+                        Enqueue(packet.connection, true, ackWriter.Buffer, ackWriter.ByteCount);
+                    }
+                }
+                pool.Push(packet.data);
+            }
+        }
+
+        public void Clear()
+        {
+            for (int i = 0; i < inFlight.Count; i++) pool.Push(inFlight[i].data);
+            inFlight.Clear();
+        }
+
+        private void Enqueue(int connection, bool toServer, byte[] data, int length)
+        {
+            if (random.NextDouble() < packetLoss)
+            {
+                PacketsDropped++;
+                return;
+            }
+
+            byte[] copy = pool.Count > 0 ? pool.Pop() : null;
+            if (copy == null || copy.Length < length) copy = new byte[Math.Max(length, 1500)];
+            Buffer.BlockCopy(data, 0, copy, 0, length);
+
+            double delay = (latencyMs + (random.NextDouble() * 2.0 - 1.0) * jitterMs) / 1000.0;
+            inFlight.Add(new InFlight
+            {
+                connection = connection,
+                toServer = toServer,
+                deliverAt = now + Math.Max(0.0, delay),
+                data = copy,
+                length = length
+            });
+        }
+    }
+}
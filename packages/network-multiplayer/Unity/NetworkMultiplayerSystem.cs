@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.NetworkMultiplayer
 {
@@ -13,32 +17,154 @@ namespace UnitySim.NetworkMultiplayer
 
         public NetworkMultiplayerData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             networkmultiplayer = new NetworkMultiplayerInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (networkmultiplayer != null)
+                networkmultiplayer.WriteState(writer, "networkmultiplayer");
+            else
+                writer.Write("networkmultiplayer", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
     public class NetworkMultiplayerInfo
     {
-                public int connectedPlayers = 0;
-        public int maxPlayers = 4;
+        public int connectedPlayers = 0;
+        public int maxPlayers = 128;
         public bool isHost = false;
         public string sessionId = "";
-        public float latency = 45f;
-        public int packetsPerSecond = 120;
+        public float latency = 0f;
+        public int packetsPerSecond = 0;
+        public float bandwidthKbps = 0f;
+        public int replicatedEntities = 0;
         public string systemHealth = "operational";
         public string framework = "unity-sim-network-multiplayer";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("connectedPlayers", connectedPlayers);
+            writer.Write("maxPlayers", maxPlayers);
+            writer.Write("isHost", isHost);
+            writer.Write("sessionId", sessionId);
+            writer.Write("latency", latency);
+            writer.Write("packetsPerSecond", packetsPerSecond);
+            writer.Write("bandwidthKbps", bandwidthKbps);
+            writer.Write("replicatedEntities", replicatedEntities);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public NetworkMultiplayerField Diff(NetworkMultiplayerInfo other)
+        {
+            var changed = NetworkMultiplayerField.None;
+            if (connectedPlayers != other.connectedPlayers) changed |= NetworkMultiplayerField.ConnectedPlayers;
+            if (maxPlayers != other.maxPlayers) changed |= NetworkMultiplayerField.MaxPlayers;
+            if (isHost != other.isHost) changed |= NetworkMultiplayerField.IsHost;
+            if (sessionId != other.sessionId) changed |= NetworkMultiplayerField.SessionId;
+            if (latency != other.latency) changed |= NetworkMultiplayerField.Latency;
+            if (packetsPerSecond != other.packetsPerSecond) changed |= NetworkMultiplayerField.PacketsPerSecond;
+            if (bandwidthKbps != other.bandwidthKbps) changed |= NetworkMultiplayerField.BandwidthKbps;
+            if (replicatedEntities != other.replicatedEntities) changed |= NetworkMultiplayerField.ReplicatedEntities;
+            if (systemHealth != other.systemHealth) changed |= NetworkMultiplayerField.SystemHealth;
+            if (framework != other.framework) changed |= NetworkMultiplayerField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(NetworkMultiplayerInfo target)
+        {
+            target.connectedPlayers = connectedPlayers;
+            target.maxPlayers = maxPlayers;
+            target.isHost = isHost;
+            target.sessionId = sessionId;
+            target.latency = latency;
+            target.packetsPerSecond = packetsPerSecond;
+            target.bandwidthKbps = bandwidthKbps;
+            target.replicatedEntities = replicatedEntities;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
     }
 
-    public class NetworkMultiplayerSystem : MonoBehaviour
+    [System.Flags]
+    public enum NetworkMultiplayerField
+    {
+        None = 0,
+        ConnectedPlayers = 1 << 0,
+        MaxPlayers = 1 << 1,
+        IsHost = 1 << 2,
+        SessionId = 1 << 3,
+        Latency = 1 << 4,
+        PacketsPerSecond = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        BandwidthKbps = 1 << 8,
+        ReplicatedEntities = 1 << 9,
+        All = (1 << 10) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct NetworkMultiplayerDelta
+    {
+        public readonly long timestamp;
+        public readonly NetworkMultiplayerField changed;
+        public readonly NetworkMultiplayerInfo values;
+
+        public NetworkMultiplayerDelta(long timestamp, NetworkMultiplayerField changed, NetworkMultiplayerInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(NetworkMultiplayerField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class NetworkMultiplayerSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("NetworkMultiplayer Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Replication")]
+        public bool enableReplication = true;
+        public float sendRate = 20f;
+        public int bytesPerClientPerSecond = 16 * 1024;
+        public int maxPacketBytes = 1200;
+        public float interestRadius = 600f;
+        public float positionPrecision = 0.1f;
+        public float valuePrecision = 0.01f;
+        public string[] replicatedSystems = { "EconomySystem", "WeatherSystem" };
+        public bool replicateEntities = true;
+
+        [Header("Simulated Clients")]
+        public int simulatedClients = 64;
+        public float simulatedLatencyMs = 40f;
+        public float simulatedJitterMs = 10f;
+        public float simulatedPacketLoss = 0.01f;
+        public float clientMoveSpeed = 15f;
+        public int randomSeed = 0;
+        [SerializeField] private float lastSnapshotMs = 0f;
+        [SerializeField] private float lastSendMs = 0f;
+        [SerializeField] private long skippedSends = 0;
+        [SerializeField] private int averagePacketBytes = 0;
+        [SerializeField] private float deltaFraction = 0f;
+        [SerializeField] private long packetsLost = 0;
+
         [Header("Current Data")]
         [SerializeField] private NetworkMultiplayerData currentData;
 
@@ -48,12 +174,36 @@ namespace UnitySim.NetworkMultiplayer
 
         // Events
         public System.Action<NetworkMultiplayerData> OnNetworkMultiplayerChanged;
+        public System.Action<NetworkMultiplayerDelta> OnNetworkMultiplayerDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.NetworkMultiplayerSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly NetworkMultiplayerInfo publishedInfo = new NetworkMultiplayerInfo();
+        private bool publishFullDelta = true;
+
+        // Replication
+        private ReplicationHost host;
+        private System.Random random;
+        private int lastEntityCount = 0;
+        private bool settingsChanged = false;
+        private float sendAccumulator = 0f;
+        private readonly List<Vector3> clientPositions = new List<Vector3>();
+        private readonly List<Vector3> clientHeadings = new List<Vector3>();
+        private bool clientsPlaced = false;
+
+        // Counters at the previous scheduled update, for per-second rates
+        private double lastMeasureTime = 0.0;
+        private long lastPackets = 0;
+        private long lastBytes = 0;
+        private long lastSentPackets = 0;
+        private long lastEntities = 0;
+        private long lastDeltas = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +212,52 @@ namespace UnitySim.NetworkMultiplayer
             InitializeNetworkMultiplayer();
         }
 
+        void OnEnable()
+        {
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
+
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
+
+        void OnDestroy()
+        {
+            host?.Dispose();
+            host = null;
+        }
+
+        // Replication runs at sendRate on real time; the scheduled update only publishes the rates
         void Update()
         {
-            if (!isInitialized) return;
+            if (host == null || !enableReplication) return;
+
+            sendAccumulator += UnityEngine.Time.unscaledDeltaTime;
+            float interval = 1f / sendRate;
+            if (sendAccumulator < interval) return;
 
-            UpdateSystem();
+            float elapsed = sendAccumulator;
+            sendAccumulator = Mathf.Min(sendAccumulator - interval, interval);
+            double now = UnityEngine.Time.realtimeSinceStartupAsDouble;
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
+            // The worker owns the snapshot until its send finishes; Submit records the skip
+            if (host.IsBusy)
             {
-                ProcessUpdate();
-                updateTimer = 0f;
+                host.Submit(now, elapsed, clientPositions);
+                return;
             }
+
+            if (settingsChanged) ApplySettings();
+
+            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+            BuildSnapshot();
+            MoveClients(elapsed);
+            lastSnapshotMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+
+            host.Submit(now, elapsed, clientPositions);
         }
 
         #endregion
@@ -83,33 +267,174 @@ namespace UnitySim.NetworkMultiplayer
         private void InitializeNetworkMultiplayer()
         {
             currentData = new NetworkMultiplayerData();
+
+            int seed = randomSeed != 0 ? randomSeed : UnityEngine.Random.Range(1, int.MaxValue);
+            random = new System.Random(seed);
+            host?.Dispose();
+            host = new ReplicationHost(seed);
+            ApplySettings();
+
+            clientPositions.Clear();
+            clientHeadings.Clear();
+            clientsPlaced = false;
+            int clients = Mathf.Min(simulatedClients, currentData.networkmultiplayer.maxPlayers);
+            for (int i = 0; i < clients; i++)
+            {
+                int connection = i + 1;
+                host.Server.AddClient(connection, Vector3.zero);
+                host.Loopback.AddClient(connection);
+                clientPositions.Add(Vector3.zero);
+                clientHeadings.Add(Vector3.forward);
+            }
+
+            var info = currentData.networkmultiplayer;
+            info.isHost = true;
+            info.sessionId = seed.ToString("x8");
+            info.connectedPlayers = host.Server.ClientCount;
+
+            lastEntityCount = 0;
+            lastMeasureTime = UnityEngine.Time.realtimeSinceStartupAsDouble;
+            lastPackets = 0;
+            lastBytes = 0;
+            lastSentPackets = 0;
+            lastEntities = 0;
+            lastDeltas = 0;
+            sendAccumulator = 0f;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
                 Debug.Log($"NetworkMultiplayerSystem initialized successfully");
         }
 
+        // Only while the worker is idle
+        private void ApplySettings()
+        {
+            settingsChanged = false;
+            if (host == null) return;
+
+            var server = host.Server;
+            server.maxPacketBytes = maxPacketBytes;
+            server.bytesPerClientPerSecond = bytesPerClientPerSecond;
+            server.interestRadius = interestRadius;
+
+            host.Snapshot.positionPrecision = positionPrecision;
+            host.Snapshot.valuePrecision = valuePrecision;
+
+            host.Loopback.latencyMs = simulatedLatencyMs;
+            host.Loopback.jitterMs = simulatedJitterMs;
+            host.Loopback.packetLoss = simulatedPacketLoss;
+        }
+
+        #endregion
+
+        #region Replication
+
+        // State sources by name plus every registered entity source
+        private void BuildSnapshot()
+        {
+            var snapshot = host.Snapshot;
+            snapshot.Clear();
+
+            for (int i = 0; i < replicatedSystems.Length; i++)
+            {
+                var source = SimulationRegistry.Get(replicatedSystems[i]);
+                if (source != null && (object)source != this) snapshot.AddState(source);
+            }
+
+            if (replicateEntities)
+            {
+                var systems = SimulationRegistry.Systems;
+                for (int i = 0; i < systems.Count; i++)
+                {
+                    if (systems[i] is IReplicatedEntitySource entities && systems[i].IsInitialized)
+                        snapshot.AddEntities(entities);
+                }
+            }
+
+            snapshot.BuildGrid(interestRadius);
+            lastEntityCount = snapshot.Count;
+        }
+
+        // Simulated players wander the entity bounds so their interest sets keep changing
+        private void MoveClients(float deltaTime)
+        {
+            if (clientPositions.Count == 0 || !host.Snapshot.TryGetBounds(out Vector3 min, out Vector3 max)) return;
+
+            for (int i = 0; i < clientPositions.Count; i++)
+            {
+                var position = clientPositions[i];
+                var heading = clientHeadings[i];
+
+                if (!clientsPlaced)
+                {
+                    position = new Vector3(Mathf.Lerp(min.x, max.x, (float)random.NextDouble()), 0f, Mathf.Lerp(min.z, max.z, (float)random.NextDouble()));
+                    float angle = (float)(random.NextDouble() * Math.PI * 2.0);
+                    heading = new Vector3(Mathf.Sin(angle), 0f, Mathf.Cos(angle));
+                }
+
+                position += heading * clientMoveSpeed * deltaTime;
+                if (position.x < min.x || position.x > max.x) heading.x = -heading.x;
+                if (position.z < min.z || position.z > max.z) heading.z = -heading.z;
+                position.x = Mathf.Clamp(position.x, min.x, max.x);
+                position.z = Mathf.Clamp(position.z, min.z, max.z);
+
+                clientPositions[i] = position;
+                clientHeadings[i] = heading;
+            }
+            clientsPlaced = true;
+        }
+
         #endregion
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.networkmultiplayer.latency += UnityEngine.Random.Range(-5f, 5f);
-            currentData.networkmultiplayer.packetsPerSecond += UnityEngine.Random.Range(-10, 20);
-            currentData.networkmultiplayer.connectedPlayers = UnityEngine.Random.Range(0, currentData.networkmultiplayer.maxPlayers + 1);
+            if (host == null) return;
+
+            var info = currentData.networkmultiplayer;
+            var stats = host.Stats;
+            double now = UnityEngine.Time.realtimeSinceStartupAsDouble;
+            double elapsed = now - lastMeasureTime;
+
+            info.connectedPlayers = stats.clients;
+            info.latency = stats.averageRoundTripMs;
+            info.replicatedEntities = lastEntityCount;
+            packetsLost = stats.packetsLost;
+            skippedSends = stats.skippedSends;
+            lastSendMs = stats.lastSendMs;
+            if (elapsed <= 0.0) return;
+
+            // Packets both ways, bytes the server sent
+            long packets = stats.packetsSent + stats.packetsReceived;
+            long bytes = stats.bytesSent;
+            info.packetsPerSecond = (int)Math.Round((packets - lastPackets) / elapsed);
+            info.bandwidthKbps = (float)((bytes - lastBytes) * 8.0 / 1000.0 / elapsed);
+
+            long sent = stats.packetsSent - lastSentPackets;
+            long entities = stats.entitiesSent - lastEntities;
+            averagePacketBytes = sent > 0 ? (int)((bytes - lastBytes) / sent) : 0;
+            deltaFraction = entities > 0 ? (float)(stats.deltasSent - lastDeltas) / entities : 0f;
+
+            lastMeasureTime = now;
+            lastPackets = packets;
+            lastBytes = bytes;
+            lastSentPackets = stats.packetsSent;
+            lastEntities = stats.entitiesSent;
+            lastDeltas = stats.deltasSent;
         }
 
         private void ProcessUpdate()
@@ -122,6 +447,12 @@ namespace UnitySim.NetworkMultiplayer
                 OnNetworkMultiplayerChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +460,67 @@ namespace UnitySim.NetworkMultiplayer
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.networkmultiplayer;
+            var changed = publishFullDelta ? NetworkMultiplayerField.All : info.Diff(publishedInfo);
+            if (changed == NetworkMultiplayerField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnNetworkMultiplayerDelta?.Invoke(new NetworkMultiplayerDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(NetworkMultiplayerSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("NetworkMultiplayerSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +531,9 @@ namespace UnitySim.NetworkMultiplayer
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +554,12 @@ namespace UnitySim.NetworkMultiplayer
             return currentData;
         }
 
+        // The server, loopback clients and snapshot; only touch them while IsBusy is false
+        public ReplicationHost GetReplicationHost()
+        {
+            return host;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +591,7 @@ namespace UnitySim.NetworkMultiplayer
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +603,20 @@ namespace UnitySim.NetworkMultiplayer
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            sendRate = Mathf.Clamp(sendRate, 1f, 120f);
+            bytesPerClientPerSecond = Mathf.Max(256, bytesPerClientPerSecond);
+            maxPacketBytes = Mathf.Clamp(maxPacketBytes, 64, 65000);
+            interestRadius = Mathf.Max(1f, interestRadius);
+            positionPrecision = Mathf.Max(1e-4f, positionPrecision);
+            valuePrecision = Mathf.Max(1e-4f, valuePrecision);
+            simulatedClients = Mathf.Max(0, simulatedClients);
+            simulatedLatencyMs = Mathf.Max(0f, simulatedLatencyMs);
+            simulatedJitterMs = Mathf.Clamp(simulatedJitterMs, 0f, simulatedLatencyMs);
+            simulatedPacketLoss = Mathf.Clamp01(simulatedPacketLoss);
+            clientMoveSpeed = Mathf.Max(0f, clientMoveSpeed);
+
+            // Picked up by the next send, when the worker is idle
+            settingsChanged = true;
         }
 
         #endregion
@@ -218,7 +628,11 @@ namespace UnitySim.NetworkMultiplayer
             Debug.Log($"NetworkMultiplayerSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Replication: {currentData?.networkmultiplayer.connectedPlayers ?? 0} clients, {lastEntityCount} entities at {sendRate}Hz");
+            Debug.Log($"- Send Cost: {lastSnapshotMs:F2}ms snapshot on the main thread, {lastSendMs:F2}ms on the worker, {skippedSends} skipped");
+            Debug.Log($"- Packets: {averagePacketBytes} bytes average, {deltaFraction:P0} of entity records as deltas, {packetsLost} lost");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -0,0 +1,273 @@
+using System;
+using System.Collections.Generic;
+
+namespace UnitySim.NetworkMultiplayer
+{
+    // Receiving end of ReplicationServer: rebuilds each entity's values from full records and
+    // deltas, and acknowledges packets. A packet is applied whole or not at all; one whose
+    // delta references a baseline this client no longer has is dropped unacknowledged, and
+    // the server falls back to a full record once that baseline ages out of its window.
+    public class ReplicationClient
+    {
+        private class EntityState
+        {
+            public uint id;
+            public int channel;
+            public int current = -1;
+            public int next = 0;
+            public readonly int[] sequences = new int[ReplicationServer.HistoryLength];
+            public readonly long[][] history = new long[ReplicationServer.HistoryLength][];
+            public readonly int[] counts = new int[ReplicationServer.HistoryLength];
+            public int currentSlot = -1;
+            public bool removed = false;
+
+            public EntityState()
+            {
+                for (int i = 0; i < sequences.Length; i++) sequences[i] = -1;
+            }
+
+            public int Find(int sequence)
+            {
+                for (int i = 0; i < sequences.Length; i++)
+                {
+                    if (sequences[i] == sequence) return i;
+                }
+                return -1;
+            }
+        }
+
+        private struct Update
+        {
+            public ulong key;
+            public int channel;
+            public uint id;
+            public int valueStart;
+            public int valueCount;
+        }
+
+        private readonly Dictionary<ulong, EntityState> entities = new Dictionary<ulong, EntityState>();
+        private readonly Dictionary<int, string> channelNames = new Dictionary<int, string>();
+        private readonly BitReader reader = new BitReader();
+        private readonly List<Update> updates = new List<Update>();
+        private readonly List<long> values = new List<long>();
+        private readonly List<ulong> removals = new List<ulong>();
+        private readonly List<KeyValuePair<int, string>> announcements = new List<KeyValuePair<int, string>>();
+        private readonly char[] nameBuffer = new char[256];
+        private int liveCount = 0;
+
+        private int latestSequence = -1;
+        private uint receivedMask = 0;
+
+        public int EntityCount => liveCount;
+        public long PacketsAccepted { get; private set; }
+        public long PacketsRejected { get; private set; }
+
+        // Returns false for packets that were malformed, duplicated or not decodable
+        public bool Receive(byte[] data, int offset, int length)
+        {
+            reader.Reset(data, offset, length);
+            updates.Clear();
+            values.Clear();
+            removals.Clear();
+            announcements.Clear();
+
+            int wire = (int)reader.ReadBits(16);
+            int sequence = latestSequence < 0 ? wire : latestSequence + (short)(wire - (latestSequence & 0xFFFF));
+            if (sequence < 0 || IsReceived(sequence) || !Read(sequence))
+            {
+                PacketsRejected++;
+                return false;
+            }
+
+            Apply(sequence);
+            MarkReceived(sequence);
+            PacketsAccepted++;
+            return true;
+        }
+
+        public void WriteAck(BitWriter writer)
+        {
+            writer.WriteBits((ulong)(Math.Max(0, latestSequence) & 0xFFFF), 16);
+            writer.WriteBits(receivedMask, 32);
+        }
+
+        public bool HasReceived => latestSequence >= 0;
+
+        // Latest values of an entity; state sources have id 0
+        public bool TryGetValues(string systemName, uint id, List<long> result)
+        {
+            result.Clear();
+            foreach (var pair in channelNames)
+            {
+                if (pair.Value != systemName) continue;
+
+                ulong key = ((ulong)(uint)pair.Key << 32) | id;
+                if (!entities.TryGetValue(key, out var entity) || entity.removed) return false;
+
+                var current = entity.history[entity.currentSlot];
+                for (int i = 0; i < entity.counts[entity.currentSlot]; i++) result.Add(current[i]);
+                return true;
+            }
+            return false;
+        }
+
+        public int CountEntities(string systemName)
+        {
+            int count = 0;
+            foreach (var entity in entities.Values)
+            {
+                if (!entity.removed && channelNames.TryGetValue(entity.channel, out string name) && name == systemName) count++;
+            }
+            return count;
+        }
+
+        #region Decoding
+
+        private bool Read(int sequence)
+        {
+            while (reader.ReadBool())
+            {
+                int channel = (int)reader.ReadVarUInt();
+                int length = (int)reader.ReadVarUInt();
+                if (reader.Overflowed || length > nameBuffer.Length) return false;
+
+                for (int k = 0; k < length; k++) nameBuffer[k] = (char)reader.ReadBits(16);
+                announcements.Add(new KeyValuePair<int, string>(channel, new string(nameBuffer, 0, length)));
+            }
+
+            while (reader.ReadBool())
+            {
+                ulong channel = reader.ReadVarUInt();
+                ulong id = reader.ReadBits(32);
+                removals.Add((channel << 32) | id);
+            }
+
+            while (reader.ReadBool())
+            {
+                var update = new Update
+                {
+                    channel = (int)reader.ReadVarUInt(),
+                    id = (uint)reader.ReadBits(32),
+                    valueStart = values.Count
+                };
+                update.key = ((ulong)(uint)update.channel << 32) | update.id;
+
+                if (reader.ReadBool())
+                {
+                    int baselineSequence = sequence - (int)reader.ReadVarUInt();
+                    if (!entities.TryGetValue(update.key, out var entity) || entity.removed) return false;
+
+                    int slot = entity.Find(baselineSequence);
+                    if (slot < 0) return false;
+
+                    var baseline = entity.history[slot];
+                    update.valueCount = entity.counts[slot];
+                    for (int v = 0; v < update.valueCount; v++)
+                    {
+                        long value = baseline[v];
+                        if (reader.ReadBool()) value += reader.ReadVarInt();
+                        values.Add(value);
+                    }
+                }
+                else
+                {
+                    update.valueCount = (int)reader.ReadVarUInt();
+                    if (update.valueCount > reader.BitsRemaining) return false;
+                    for (int v = 0; v < update.valueCount; v++) values.Add(reader.ReadVarInt());
+                }
+
+                if (reader.Overflowed) return false;
+                updates.Add(update);
+            }
+
+            return !reader.Overflowed;
+        }
+
+        private void Apply(int sequence)
+        {
+            for (int i = 0; i < announcements.Count; i++) channelNames[announcements[i].Key] = announcements[i].Value;
+
+            // A removal only applies to values older than it. Removed entities stay behind
+            // so late packets from before the removal can't bring them back.
+            for (int i = 0; i < removals.Count; i++)
+            {
+                if (entities.TryGetValue(removals[i], out var entity) && !entity.removed && entity.current < sequence)
+                {
+                    entity.removed = true;
+                    entity.current = sequence;
+                    entity.currentSlot = -1;
+                    liveCount--;
+                }
+            }
+
+            for (int i = 0; i < updates.Count; i++)
+            {
+                var update = updates[i];
+                if (!entities.TryGetValue(update.key, out var entity))
+                {
+                    entity = new EntityState { removed = true };
+                    entities[update.key] = entity;
+                }
+
+                // Late packets carry older values than the entity already has; the server
+                // never bases deltas on them once it has a newer ack
+                if (sequence < entity.current) continue;
+
+                if (entity.removed)
+                {
+                    entity.removed = false;
+                    liveCount++;
+                }
+
+                entity.id = update.id;
+                entity.channel = update.channel;
+
+                int slot = entity.next;
+                entity.next = (entity.next + 1) % entity.sequences.Length;
+                if (entity.history[slot] == null || entity.history[slot].Length < update.valueCount)
+                    entity.history[slot] = new long[Math.Max(4, update.valueCount)];
+
+                for (int v = 0; v < update.valueCount; v++) entity.history[slot][v] = values[update.valueStart + v];
+                entity.counts[slot] = update.valueCount;
+                entity.sequences[slot] = sequence;
+                entity.current = sequence;
+                entity.currentSlot = slot;
+            }
+        }
+
+        #endregion
+
+        #region Acks
+
+        private bool IsReceived(int sequence)
+        {
+            if (latestSequence < 0 || sequence > latestSequence) return false;
+            if (sequence == latestSequence) return true;
+
+            int distance = latestSequence - sequence;
+            return distance > 32 || (receivedMask & (1u << (distance - 1))) != 0;
+        }
+
+        private void MarkReceived(int sequence)
+        {
+            if (latestSequence < 0)
+            {
+                latestSequence = sequence;
+                return;
+            }
+
+            if (sequence > latestSequence)
+            {
+                int shift = sequence - latestSequence;
+                receivedMask = shift > 32 ? 0u : ((shift == 32 ? 0u : receivedMask << shift) | (1u << (shift - 1)));
+                latestSequence = sequence;
+            }
+            else
+            {
+                receivedMask |= 1u << (latestSequence - sequence - 1);
+            }
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,162 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using UnityEngine;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.NetworkMultiplayer
+{
+    public struct ReplicationStats
+    {
+        public int clients;
+        public long packetsSent;
+        public long packetsReceived;
+        public long packetsLost;
+        public long bytesSent;
+        public long entitiesSent;
+        public long deltasSent;
+        public long skippedSends;
+        public float averageRoundTripMs;
+        public float lastSendMs;
+    }
+
+    // Runs a ReplicationServer and its loopback clients on a worker thread. The main thread
+    // fills Snapshot while the worker is idle, then Submit hands it over; the worker polls
+    // acks, sends every client its packet and goes idle again. A send that comes due while
+    // the worker is still busy is skipped, and the next one carries the elapsed time so
+    // client budgets refill the same.
+    public class ReplicationHost : IDisposable
+    {
+        private readonly ReplicationServer server = new ReplicationServer();
+        private readonly LoopbackTransport loopback;
+        private readonly ReplicationSnapshot snapshot = new ReplicationSnapshot();
+        private readonly object gate = new object();
+        private readonly Thread worker;
+        private readonly List<Vector3> focus = new List<Vector3>();
+        private ReplicationStats stats;
+        private bool busy = false;
+        private bool disposing = false;
+        private double submittedAt;
+        private float submittedDelta;
+        private float skippedDelta = 0f;
+
+        // Only touch the server, clients or snapshot while IsBusy is false
+        public ReplicationServer Server => server;
+        public LoopbackTransport Loopback => loopback;
+        public ReplicationSnapshot Snapshot => snapshot;
+
+        public bool IsBusy
+        {
+            get { lock (gate) return busy; }
+        }
+
+        public ReplicationStats Stats
+        {
+            get { lock (gate) return stats; }
+        }
+
+        public ReplicationHost(int seed)
+        {
+            loopback = new LoopbackTransport(seed);
+            worker = new Thread(Run) { IsBackground = true, Name = "ReplicationHost" };
+            worker.Start();
+        }
+
+        // focus[i] is the interest centre of connection i + 1. Returns false, and counts a
+        // skipped send, when the previous one hasn't finished.
+        public bool Submit(double now, float deltaTime, IReadOnlyList<Vector3> clientFocus)
+        {
+            lock (gate)
+            {
+                if (disposing) throw new ObjectDisposedException(nameof(ReplicationHost));
+                if (busy)
+                {
+                    stats.skippedSends++;
+                    skippedDelta += deltaTime;
+                    return false;
+                }
+
+                focus.Clear();
+                for (int i = 0; i < clientFocus.Count; i++) focus.Add(clientFocus[i]);
+                submittedAt = now;
+                submittedDelta = deltaTime + skippedDelta;
+                skippedDelta = 0f;
+                busy = true;
+                Monitor.PulseAll(gate);
+            }
+            return true;
+        }
+
+        // Waits for the current send to finish, e.g. before resetting
+        public bool Wait(int timeoutMs = 1000)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            lock (gate)
+            {
+                while (busy)
+                {
+                    int remaining = timeoutMs - (int)stopwatch.ElapsedMilliseconds;
+                    if (remaining <= 0) return false;
+                    Monitor.Wait(gate, remaining);
+                }
+            }
+            return true;
+        }
+
+        public void Dispose()
+        {
+            lock (gate)
+            {
+                if (disposing) return;
+                disposing = true;
+                Monitor.PulseAll(gate);
+            }
+            worker.Join();
+        }
+
+        private void Run()
+        {
+            while (true)
+            {
+                double now;
+                float deltaTime;
+                lock (gate)
+                {
+                    while (!busy && !disposing) Monitor.Wait(gate);
+                    if (disposing) return;
+
+                    now = submittedAt;
+                    deltaTime = submittedDelta;
+                    for (int i = 0; i < focus.Count; i++) server.SetFocus(i + 1, focus[i]);
+                }
+
+                var stopwatch = Stopwatch.StartNew();
+                try
+                {
+                    loopback.Update(now, server);
+                    server.Send(now, deltaTime, snapshot, loopback);
+                }
+                catch (Exception e)
+                {
+                    Debug.LogError($"ReplicationHost: Send failed - {e.Message}");
+                }
+
+                lock (gate)
+                {
+                    stats.clients = server.ClientCount;
+                    stats.packetsSent = server.PacketsSent;
+                    stats.packetsReceived = server.PacketsReceived;
+                    stats.packetsLost = server.PacketsLost;
+                    stats.bytesSent = server.BytesSent;
+                    stats.entitiesSent = server.EntitiesSent;
+                    stats.deltasSent = server.DeltasSent;
+                    stats.averageRoundTripMs = server.AverageRoundTripMs;
+                    stats.lastSendMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+                    busy = false;
+                    Monitor.PulseAll(gate);
+                }
+            }
+        }
+    }
+}
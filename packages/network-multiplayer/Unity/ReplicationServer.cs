@@ -0,0 +1,535 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.NetworkMultiplayer
+{
+    // Whatever carries packets to clients; implementations copy data before returning
+    public interface IReplicationTransport
+    {
+        void Send(int connection, byte[] data, int length);
+    }
+
+    // Sends each client the part of a ReplicationSnapshot it is interested in: every global
+    // state source plus spatial entities within interestRadius of its focus. Entities go out
+    // as deltas against the last values that client acknowledged, so unchanged entities cost
+    // nothing and changed ones only their changed fields. Each entity accumulates priority
+    // while it differs from the client's baseline, faster when near; packets take the highest
+    // first until the client's byte budget for that send is spent.
+    //
+    // Packet: u16 sequence, channel announcements, removals, then entity records, each list
+    // a run of 1-bit-prefixed items closed by a 0 bit. Ack: u16 latest sequence received and
+    // a 32-bit mask of the ones before it.
+    public class ReplicationServer
+    {
+        // Deltas only reference baselines this many packets back, which bounds the history a
+        // client keeps per entity
+        public const int HistoryLength = 16;
+        public const int AckBytes = 6;
+        private const int SentRingSize = 64;
+        private const int SmallestRecordBits = 40;
+
+        public int maxPacketBytes = 1200;
+        public int bytesPerClientPerSecond = 16 * 1024;
+        public float interestRadius = 600f;
+        public float globalPriority = 4f;
+
+        private class SentPacket
+        {
+            public int sequence = -1;
+            public double sentAt;
+            public bool acked;
+            public readonly List<ulong> keys = new List<ulong>();
+            public readonly List<int> counts = new List<int>();
+            public readonly List<long> values = new List<long>();
+            public readonly List<ulong> removals = new List<ulong>();
+            public readonly List<int> announced = new List<int>();
+
+            public void Reset(int sequence, double now)
+            {
+                this.sequence = sequence;
+                sentAt = now;
+                acked = false;
+                keys.Clear();
+                counts.Clear();
+                values.Clear();
+                removals.Clear();
+                announced.Clear();
+            }
+        }
+
+        // What one client has of one entity: the last values it acknowledged, if any, and
+        // the priority built up since it was last sent. removed marks a removal sent from
+        // sequence on that isn't acknowledged yet.
+        private struct Tracked
+        {
+            public ulong key;
+            public bool hasBaseline;
+            public bool removed;
+            public int sequence;
+            public int count;
+            public int valueStart;      // into ClientView.baselineValues
+            public int valueCapacity;
+            public float priority;
+            public int seen;
+        }
+
+        // Per-client entity table in flat arrays; entities are looked up once per send
+        private class ClientView
+        {
+            public int connection;
+            public Vector3 focus;
+            public int nextSequence = 0;
+            public double budget;
+            public float rttMs = -1f;
+            public readonly Dictionary<ulong, int> slots = new Dictionary<ulong, int>();
+            public Tracked[] tracked = new Tracked[256];
+            public int trackedCount = 0;
+            public readonly Stack<int> freeSlots = new Stack<int>();
+            public long[] baselineValues = new long[1024];
+            public int baselineUsed = 0;
+            public readonly HashSet<ulong> pendingRemovals = new HashSet<ulong>();
+            public readonly HashSet<int> announced = new HashSet<int>();
+            public readonly SentPacket[] sent = new SentPacket[SentRingSize];
+
+            public int Acquire(ulong key, int tick)
+            {
+                int slot;
+                if (freeSlots.Count > 0)
+                {
+                    slot = freeSlots.Pop();
+                }
+                else
+                {
+                    if (trackedCount == tracked.Length) Array.Resize(ref tracked, tracked.Length * 2);
+                    slot = trackedCount++;
+                }
+
+                ref var entry = ref tracked[slot];
+                int start = entry.valueStart, capacity = entry.valueCapacity;
+                entry = new Tracked { key = key, seen = tick, valueStart = start, valueCapacity = capacity };
+                slots[key] = slot;
+                return slot;
+            }
+
+            // The slot keeps its value storage for the next entity that takes it
+            public void Release(int slot)
+            {
+                slots.Remove(tracked[slot].key);
+                tracked[slot].key = 0;
+                tracked[slot].hasBaseline = false;
+                tracked[slot].removed = true;
+                tracked[slot].seen = int.MaxValue;
+                freeSlots.Push(slot);
+            }
+
+            public void StoreBaseline(int slot, List<long> values, int offset, int count)
+            {
+                ref var entry = ref tracked[slot];
+                if (entry.valueCapacity < count)
+                {
+                    if (baselineUsed + count > baselineValues.Length)
+                        Array.Resize(ref baselineValues, Math.Max(baselineUsed + count, baselineValues.Length * 2));
+                    entry.valueStart = baselineUsed;
+                    entry.valueCapacity = count;
+                    baselineUsed += count;
+                }
+
+                for (int v = 0; v < count; v++) baselineValues[entry.valueStart + v] = values[offset + v];
+                entry.count = count;
+            }
+        }
+
+        private readonly List<ClientView> clients = new List<ClientView>();
+        private readonly Dictionary<int, ClientView> byConnection = new Dictionary<int, ClientView>();
+        private readonly BitWriter writer = new BitWriter(1500);
+        private readonly BitReader reader = new BitReader();
+        private readonly List<int> query = new List<int>(1024);
+        private readonly List<int> channels = new List<int>();
+        private int tick = 0;
+
+        // Candidates for the packet being written; the first candidateSorted are in
+        // descending priority, which is as many as could fit in one packet
+        private float[] candidateKeys = new float[1024];
+        private int[] candidateOrder = new int[1024];
+        private int[] candidateIndex = new int[1024];
+        private int[] candidateSlot = new int[1024];
+        private int candidateCount = 0;
+        private int candidateSorted = 0;
+
+        public int ClientCount => clients.Count;
+        public long PacketsSent { get; private set; }
+        public long PacketsReceived { get; private set; }
+        public long PacketsLost { get; private set; }
+        public long BytesSent { get; private set; }
+        public long BytesReceived { get; private set; }
+        public long EntitiesSent { get; private set; }
+        public long DeltasSent { get; private set; }
+
+        #region Clients
+
+        public void AddClient(int connection, Vector3 focus)
+        {
+            if (byConnection.ContainsKey(connection)) return;
+
+            var client = new ClientView { connection = connection, focus = focus, budget = maxPacketBytes };
+            for (int i = 0; i < SentRingSize; i++) client.sent[i] = new SentPacket();
+            clients.Add(client);
+            byConnection[connection] = client;
+        }
+
+        public void RemoveClient(int connection)
+        {
+            if (!byConnection.TryGetValue(connection, out var client)) return;
+
+            clients.Remove(client);
+            byConnection.Remove(connection);
+        }
+
+        public void SetFocus(int connection, Vector3 focus)
+        {
+            if (byConnection.TryGetValue(connection, out var client)) client.focus = focus;
+        }
+
+        // Smoothed round trip in milliseconds, or -1 before the first ack
+        public float GetRoundTripMs(int connection)
+        {
+            return byConnection.TryGetValue(connection, out var client) ? client.rttMs : -1f;
+        }
+
+        public float AverageRoundTripMs
+        {
+            get
+            {
+                float total = 0f;
+                int measured = 0;
+                for (int i = 0; i < clients.Count; i++)
+                {
+                    if (clients[i].rttMs < 0f) continue;
+                    total += clients[i].rttMs;
+                    measured++;
+                }
+                return measured > 0 ? total / measured : 0f;
+            }
+        }
+
+        #endregion
+
+        #region Sending
+
+        // One packet per client. deltaTime is the time since the previous send, which refills
+        // each client's byte budget.
+        public void Send(double now, float deltaTime, ReplicationSnapshot snapshot, IReplicationTransport transport)
+        {
+            tick++;
+            for (int i = 0; i < clients.Count; i++)
+            {
+                var client = clients[i];
+                client.budget = Math.Min(maxPacketBytes, client.budget + bytesPerClientPerSecond * (double)deltaTime);
+
+                int limit = (int)client.budget;
+                if (limit < 16) continue;
+
+                GatherInterest(client, snapshot, deltaTime);
+                int bytes = WritePacket(client, snapshot, now, limit);
+
+                transport.Send(client.connection, writer.Buffer, bytes);
+                client.budget -= bytes;
+                PacketsSent++;
+                BytesSent += bytes;
+            }
+        }
+
+        private void GatherInterest(ClientView client, ReplicationSnapshot snapshot, float deltaTime)
+        {
+            query.Clear();
+            channels.Clear();
+            candidateCount = 0;
+
+            for (int g = 0; g < snapshot.Globals.Count; g++) query.Add(snapshot.Globals[g]);
+            snapshot.Query(client.focus, interestRadius, query);
+
+            float step = Math.Max(deltaTime, 1e-3f);
+            float inverseRadiusSquared = 1f / Math.Max(1f, interestRadius * interestRadius);
+            int lastChannel = -1;
+
+            for (int q = 0; q < query.Count; q++)
+            {
+                int index = query[q];
+                ref readonly var entity = ref snapshot[index];
+
+                if (!client.slots.TryGetValue(entity.key, out int slot)) slot = client.Acquire(entity.key, tick);
+                ref var entry = ref client.tracked[slot];
+                entry.seen = tick;
+
+                if (entity.channel != lastChannel)
+                {
+                    lastChannel = entity.channel;
+                    if (!client.announced.Contains(lastChannel) && !channels.Contains(lastChannel)) channels.Add(lastChannel);
+                }
+
+                // Nothing to send while the client already has these values
+                if (entry.hasBaseline && !entry.removed &&
+                    snapshot.GetValues(entity).SequenceEqual(new ReadOnlySpan<long>(client.baselineValues, entry.valueStart, entry.count)))
+                {
+                    entry.priority = 0f;
+                    continue;
+                }
+
+                // Nearer entities gain priority up to three times as fast
+                float weight = globalPriority;
+                if (!entity.global)
+                {
+                    float dx = entity.position.x - client.focus.x;
+                    float dz = entity.position.z - client.focus.z;
+                    weight = 1f + 2f * Math.Max(0f, 1f - (dx * dx + dz * dz) * inverseRadiusSquared);
+                }
+                entry.priority += weight * step;
+                AddCandidate(index, slot, entry.priority);
+            }
+
+            // Entities the client has that left its interest, or the world
+            for (int slot = 0; slot < client.trackedCount; slot++)
+            {
+                ref var entry = ref client.tracked[slot];
+                if (entry.seen == tick || entry.removed) continue;
+
+                if (!entry.hasBaseline)
+                {
+                    // Never acknowledged, so there is nothing on the client to remove
+                    client.Release(slot);
+                    continue;
+                }
+
+                entry.removed = true;
+                entry.sequence = client.nextSequence;
+                entry.priority = 0f;
+                client.pendingRemovals.Add(entry.key);
+            }
+
+            // Only the entities one packet could hold need to be in order
+            candidateSorted = Math.Min(candidateCount, maxPacketBytes * 8 / SmallestRecordBits + 1);
+            for (int c = 0; c < candidateCount; c++) candidateOrder[c] = c;
+            if (candidateSorted < candidateCount) SelectSmallest(candidateSorted);
+            Array.Sort(candidateKeys, candidateOrder, 0, candidateSorted);
+        }
+
+        private void AddCandidate(int index, int slot, float priority)
+        {
+            if (candidateCount == candidateKeys.Length)
+            {
+                int size = candidateKeys.Length * 2;
+                Array.Resize(ref candidateKeys, size);
+                Array.Resize(ref candidateOrder, size);
+                Array.Resize(ref candidateIndex, size);
+                Array.Resize(ref candidateSlot, size);
+            }
+
+            // Negated so an ascending sort puts the highest priority first
+            candidateKeys[candidateCount] = -priority;
+            candidateIndex[candidateCount] = index;
+            candidateSlot[candidateCount] = slot;
+            candidateCount++;
+        }
+
+        // Quickselect: moves the count smallest keys, with their order entries, to the front
+        private void SelectSmallest(int count)
+        {
+            int left = 0, right = candidateCount - 1;
+            while (left < right)
+            {
+                float pivot = candidateKeys[(left + right) >> 1];
+                int i = left, j = right;
+                while (i <= j)
+                {
+                    while (candidateKeys[i] < pivot) i++;
+                    while (candidateKeys[j] > pivot) j--;
+                    if (i > j) break;
+
+                    (candidateKeys[i], candidateKeys[j]) = (candidateKeys[j], candidateKeys[i]);
+                    (candidateOrder[i], candidateOrder[j]) = (candidateOrder[j], candidateOrder[i]);
+                    i++;
+                    j--;
+                }
+
+                if (count - 1 <= j) right = j;
+                else if (count - 1 >= i) left = i;
+                else break;
+            }
+        }
+
+        private int WritePacket(ClientView client, ReplicationSnapshot snapshot, double now, int limit)
+        {
+            int sequence = client.nextSequence++;
+            var record = client.sent[sequence % SentRingSize];
+            if (record.sequence >= 0 && !record.acked) PacketsLost++;
+            record.Reset(sequence, now);
+
+            // One byte is kept back for the closing bits
+            limit = Math.Min(limit, maxPacketBytes) - 1;
+
+            writer.Reset();
+            writer.WriteBits((ulong)(sequence & 0xFFFF), 16);
+
+            for (int c = 0; c < channels.Count; c++)
+            {
+                string name = snapshot.GetChannelName(channels[c]);
+                int mark = writer.BitPosition;
+                writer.WriteBool(true);
+                writer.WriteVarUInt((ulong)channels[c]);
+                writer.WriteVarUInt((ulong)name.Length);
+                for (int k = 0; k < name.Length; k++) writer.WriteBits(name[k], 16);
+
+                if (writer.ByteCount > limit)
+                {
+                    writer.Rewind(mark);
+                    break;
+                }
+                record.announced.Add(channels[c]);
+            }
+            writer.WriteBool(false);
+
+            foreach (ulong key in client.pendingRemovals)
+            {
+                int mark = writer.BitPosition;
+                writer.WriteBool(true);
+                writer.WriteVarUInt(key >> 32);
+                writer.WriteBits(key & 0xFFFFFFFF, 32);
+
+                if (writer.ByteCount > limit)
+                {
+                    writer.Rewind(mark);
+                    break;
+                }
+                record.removals.Add(key);
+            }
+            writer.WriteBool(false);
+
+            for (int c = 0; c < candidateSorted; c++)
+            {
+                int candidate = candidateOrder[c];
+                ref var entry = ref client.tracked[candidateSlot[candidate]];
+                ref readonly var entity = ref snapshot[candidateIndex[candidate]];
+                var current = snapshot.GetValues(entity);
+                int mark = writer.BitPosition;
+
+                writer.WriteBool(true);
+                writer.WriteVarUInt((ulong)entity.channel);
+                writer.WriteBits(entity.id, 32);
+
+                // Deltas need a baseline of the same shape the client still has in its history
+                bool delta = entry.hasBaseline && !entry.removed && entry.count == current.Length &&
+                             sequence - entry.sequence < HistoryLength;
+                writer.WriteBool(delta);
+
+                if (delta)
+                {
+                    writer.WriteVarUInt((ulong)(sequence - entry.sequence));
+                    for (int v = 0; v < current.Length; v++)
+                    {
+                        long difference = current[v] - client.baselineValues[entry.valueStart + v];
+                        writer.WriteBool(difference != 0);
+                        if (difference != 0) writer.WriteVarInt(difference);
+                    }
+                }
+                else
+                {
+                    writer.WriteVarUInt((ulong)current.Length);
+                    for (int v = 0; v < current.Length; v++) writer.WriteVarInt(current[v]);
+                }
+
+                // Stop at the first entity that doesn't fit so priorities keep their order
+                if (writer.ByteCount > limit)
+                {
+                    writer.Rewind(mark);
+                    break;
+                }
+
+                record.keys.Add(entity.key);
+                record.counts.Add(current.Length);
+                for (int v = 0; v < current.Length; v++) record.values.Add(current[v]);
+                entry.priority = 0f;
+                if (entry.removed) client.pendingRemovals.Remove(entity.key);
+                EntitiesSent++;
+                if (delta) DeltasSent++;
+            }
+            writer.WriteBool(false);
+
+            return writer.ByteCount;
+        }
+
+        #endregion
+
+        #region Acks
+
+        public void ReceiveAck(int connection, byte[] data, int offset, int length, double now)
+        {
+            if (!byConnection.TryGetValue(connection, out var client)) return;
+
+            reader.Reset(data, offset, length);
+            int wire = (int)reader.ReadBits(16);
+            uint mask = (uint)reader.ReadBits(32);
+            if (reader.Overflowed) return;
+
+            PacketsReceived++;
+            BytesReceived += length;
+
+            // Nearest full sequence to the newest one sent with these low bits
+            int newest = client.nextSequence - 1;
+            int latest = newest + (short)(wire - (newest & 0xFFFF));
+            if (latest > newest) return;
+
+            Acknowledge(client, latest, now);
+            for (int bit = 0; bit < 32; bit++)
+            {
+                if ((mask & (1u << bit)) != 0) Acknowledge(client, latest - 1 - bit, now);
+            }
+        }
+
+        private void Acknowledge(ClientView client, int sequence, double now)
+        {
+            if (sequence < 0) return;
+
+            var record = client.sent[sequence % SentRingSize];
+            if (record.sequence != sequence || record.acked) return;
+            record.acked = true;
+
+            float sample = (float)((now - record.sentAt) * 1000.0);
+            client.rttMs = client.rttMs < 0f ? sample : Mathf.Lerp(client.rttMs, sample, 0.1f);
+
+            for (int i = 0; i < record.announced.Count; i++) client.announced.Add(record.announced[i]);
+
+            // Newer values win; a removal sent after this packet keeps its tombstone
+            int offset = 0;
+            for (int i = 0; i < record.keys.Count; i++)
+            {
+                int count = record.counts[i];
+                ulong key = record.keys[i];
+
+                if (!client.slots.TryGetValue(key, out int slot)) slot = client.Acquire(key, tick);
+
+                ref var entry = ref client.tracked[slot];
+                if (!entry.hasBaseline || sequence > entry.sequence)
+                {
+                    client.StoreBaseline(slot, record.values, offset, count);
+                    entry.sequence = sequence;
+                    entry.hasBaseline = true;
+                    entry.removed = false;
+                }
+                offset += count;
+            }
+
+            for (int i = 0; i < record.removals.Count; i++)
+            {
+                ulong key = record.removals[i];
+                if (client.slots.TryGetValue(key, out int slot) && client.tracked[slot].removed && client.tracked[slot].sequence <= sequence)
+                {
+                    client.Release(slot);
+                    client.pendingRemovals.Remove(key);
+                }
+            }
+        }
+
+        #endregion
+    }
+}
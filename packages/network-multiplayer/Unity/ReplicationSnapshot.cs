@@ -0,0 +1,320 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+using UnitySim.Core;
+
+namespace UnitySim.NetworkMultiplayer
+{
+    // The replicated world at one send tick. Each entity is a key, a position for interest
+    // management and a run of quantized values: a state source's numeric fields in its
+    // WriteState order, or an entity's position followed by its own values. Positions and
+    // floats are fixed point at positionPrecision/valuePrecision; strings are not replicated.
+    public class ReplicationSnapshot
+    {
+        public struct Entity
+        {
+            public ulong key;           // channel << 32 | id
+            public int channel;
+            public uint id;
+            public bool global;         // state sources are in every client's interest
+            public Vector3 position;
+            public int valueStart;
+            public int valueCount;
+        }
+
+        private const int MaxGridSide = 512;
+
+        private Entity[] entities = new Entity[256];
+        private int entityCount = 0;
+        private long[] values = new long[2048];
+        private int valueCount = 0;
+        private float[] entityValues = new float[8];
+        private readonly StateCollector collector;
+
+        // Channels are handed out per system name and never reused, so keys stay stable
+        private readonly Dictionary<string, int> channelIds = new Dictionary<string, int>();
+        private readonly List<string> channelNames = new List<string>();
+
+        // Uniform grid over the spatial entities, rebuilt by BuildGrid
+        private float originX, originZ, limitX, limitZ, cellSize, inverseCellSize;
+        private int gridWidth, gridHeight;
+        private int[] cellStart = new int[2];
+        private int[] entityCell = new int[256];
+        private int spatialStart = 0;
+        private Entity[] sortedEntities = new Entity[256];
+        private long[] sortedValues = new long[2048];
+        private readonly List<int> globals = new List<int>();
+
+        public float positionPrecision = 0.1f;
+        public float valuePrecision = 0.01f;
+
+        public int Count => entityCount;
+        public int ChannelCount => channelNames.Count;
+        public IReadOnlyList<int> Globals => globals;
+
+        public ReplicationSnapshot()
+        {
+            collector = new StateCollector(this);
+        }
+
+        public ref readonly Entity this[int index] => ref entities[index];
+
+        public ReadOnlySpan<long> GetValues(in Entity entity)
+        {
+            return new ReadOnlySpan<long>(values, entity.valueStart, entity.valueCount);
+        }
+
+        public string GetChannelName(int channel)
+        {
+            return channel >= 0 && channel < channelNames.Count ? channelNames[channel] : null;
+        }
+
+        public void Clear()
+        {
+            entityCount = 0;
+            valueCount = 0;
+            globals.Clear();
+            gridWidth = 0;
+            gridHeight = 0;
+        }
+
+        #region Building
+
+        // One global entity holding the source's numeric fields
+        public bool AddState(IStateSource source)
+        {
+            if (source == null) return false;
+
+            ref var entity = ref Append(Channel(source.SystemName), 0u, true, Vector3.zero);
+            collector.entityIndex = entityCount - 1;
+            if (!source.WriteState(collector))
+            {
+                entityCount--;
+                valueCount = entity.valueStart;
+                return false;
+            }
+
+            globals.Add(entityCount - 1);
+            return true;
+        }
+
+        public int AddEntities(IReplicatedEntitySource source)
+        {
+            if (source == null) return 0;
+
+            int channel = Channel(source.SystemName);
+            int extra = Math.Max(0, source.EntityValueCount);
+            if (entityValues.Length < extra) entityValues = new float[extra];
+            var buffer = new Span<float>(entityValues, 0, extra);
+
+            int count = source.EntityCount;
+            for (int i = 0; i < count; i++)
+            {
+                source.GetEntity(i, out uint id, out Vector3 position, buffer);
+
+                ref var entity = ref Append(channel, id, false, position);
+                AddValue(ref entity, BitPacking.Quantize(position.x, positionPrecision));
+                AddValue(ref entity, BitPacking.Quantize(position.y, positionPrecision));
+                AddValue(ref entity, BitPacking.Quantize(position.z, positionPrecision));
+                for (int v = 0; v < extra; v++)
+                {
+                    AddValue(ref entity, BitPacking.Quantize(buffer[v], valuePrecision));
+                }
+            }
+            return count;
+        }
+
+        private int Channel(string systemName)
+        {
+            if (!channelIds.TryGetValue(systemName, out int channel))
+            {
+                channel = channelNames.Count;
+                channelIds[systemName] = channel;
+                channelNames.Add(systemName);
+            }
+            return channel;
+        }
+
+        private ref Entity Append(int channel, uint id, bool global, Vector3 position)
+        {
+            if (entityCount == entities.Length) Array.Resize(ref entities, entities.Length * 2);
+
+            ref var entity = ref entities[entityCount++];
+            entity.key = ((ulong)(uint)channel << 32) | id;
+            entity.channel = channel;
+            entity.id = id;
+            entity.global = global;
+            entity.position = position;
+            entity.valueStart = valueCount;
+            entity.valueCount = 0;
+            return ref entity;
+        }
+
+        private void AddValue(ref Entity entity, long value)
+        {
+            if (valueCount == values.Length) Array.Resize(ref values, values.Length * 2);
+            values[valueCount++] = value;
+            entity.valueCount++;
+        }
+
+        #endregion
+
+        #region Interest
+
+        // Buckets spatial entities by ground position; cells are at least cellSize across.
+        // Entities are reordered, globals first and then cell by cell, so queries walk
+        // contiguous memory; call it after everything has been added.
+        public void BuildGrid(float cellSize)
+        {
+            float minX = float.MaxValue, minZ = float.MaxValue, maxX = float.MinValue, maxZ = float.MinValue;
+            int spatial = 0;
+            for (int i = 0; i < entityCount; i++)
+            {
+                if (entities[i].global) continue;
+                var p = entities[i].position;
+                minX = Math.Min(minX, p.x);
+                maxX = Math.Max(maxX, p.x);
+                minZ = Math.Min(minZ, p.z);
+                maxZ = Math.Max(maxZ, p.z);
+                spatial++;
+            }
+
+            if (spatial == 0)
+            {
+                gridWidth = 0;
+                gridHeight = 0;
+                return;
+            }
+
+            float extent = Math.Max(maxX - minX, maxZ - minZ);
+            this.cellSize = Math.Max(Math.Max(1f, cellSize), extent / MaxGridSide);
+            inverseCellSize = 1f / this.cellSize;
+            originX = minX;
+            originZ = minZ;
+            limitX = maxX;
+            limitZ = maxZ;
+            gridWidth = (int)((maxX - minX) / this.cellSize) + 1;
+            gridHeight = (int)((maxZ - minZ) / this.cellSize) + 1;
+
+            int cells = gridWidth * gridHeight;
+            if (cellStart.Length < cells + 1) cellStart = new int[cells + 1];
+            if (entityCell.Length < entityCount) entityCell = new int[Math.Max(entityCount, entityCell.Length * 2)];
+            Array.Clear(cellStart, 0, cells + 1);
+
+            // Counting sort by cell
+            for (int i = 0; i < entityCount; i++)
+            {
+                if (entities[i].global) continue;
+                int cell = CellX(entities[i].position.x) + CellZ(entities[i].position.z) * gridWidth;
+                entityCell[i] = cell;
+                cellStart[cell + 1]++;
+            }
+            for (int c = 0; c < cells; c++) cellStart[c + 1] += cellStart[c];
+
+            if (sortedEntities.Length < entities.Length) sortedEntities = new Entity[entities.Length];
+            if (sortedValues.Length < values.Length) sortedValues = new long[values.Length];
+
+            spatialStart = globals.Count;
+            for (int g = 0; g < globals.Count; g++)
+            {
+                sortedEntities[g] = entities[globals[g]];
+                globals[g] = g;
+            }
+            for (int i = 0; i < entityCount; i++)
+            {
+                if (entities[i].global) continue;
+                sortedEntities[spatialStart + cellStart[entityCell[i]]++] = entities[i];
+            }
+            for (int c = cells; c > 0; c--) cellStart[c] = cellStart[c - 1];
+            cellStart[0] = 0;
+
+            int next = 0;
+            for (int i = 0; i < entityCount; i++)
+            {
+                ref var entity = ref sortedEntities[i];
+                int from = entity.valueStart;
+                entity.valueStart = next;
+                for (int v = 0; v < entity.valueCount; v++) sortedValues[next++] = values[from + v];
+            }
+
+            (entities, sortedEntities) = (sortedEntities, entities);
+            (values, sortedValues) = (sortedValues, values);
+        }
+
+        // Spatial entities within radius of center on the ground plane
+        public void Query(Vector3 center, float radius, List<int> results)
+        {
+            if (gridWidth == 0) return;
+
+            int x0 = CellX(center.x - radius), x1 = CellX(center.x + radius);
+            int z0 = CellZ(center.z - radius), z1 = CellZ(center.z + radius);
+            float radiusSquared = radius * radius;
+
+            for (int z = z0; z <= z1; z++)
+            {
+                for (int x = x0; x <= x1; x++)
+                {
+                    int cell = x + z * gridWidth;
+                    int end = spatialStart + cellStart[cell + 1];
+                    for (int index = spatialStart + cellStart[cell]; index < end; index++)
+                    {
+                        float dx = entities[index].position.x - center.x;
+                        float dz = entities[index].position.z - center.z;
+                        if (dx * dx + dz * dz <= radiusSquared) results.Add(index);
+                    }
+                }
+            }
+        }
+
+        // Ground-plane extent of the spatial entities at the last BuildGrid
+        public bool TryGetBounds(out Vector3 min, out Vector3 max)
+        {
+            min = new Vector3(originX, 0f, originZ);
+            max = new Vector3(limitX, 0f, limitZ);
+            return gridWidth > 0;
+        }
+
+        private int CellX(float x)
+        {
+            return Math.Min(gridWidth - 1, Math.Max(0, (int)((x - originX) * inverseCellSize)));
+        }
+
+        private int CellZ(float z)
+        {
+            return Math.Min(gridHeight - 1, Math.Max(0, (int)((z - originZ) * inverseCellSize)));
+        }
+
+        #endregion
+
+        // Appends a state source's numeric fields to the entity being built
+        private class StateCollector : IStateWriter
+        {
+            private readonly ReplicationSnapshot snapshot;
+            public int entityIndex;
+
+            public StateCollector(ReplicationSnapshot snapshot)
+            {
+                this.snapshot = snapshot;
+            }
+
+            private void Add(long value)
+            {
+                snapshot.AddValue(ref snapshot.entities[entityIndex], value);
+            }
+
+            public void BeginObject(string name) { }
+            public void EndObject() { }
+            public void Write(string name, int value) => Add(value);
+            public void Write(string name, long value) => Add(value);
+            public void Write(string name, float value) => Add(BitPacking.Quantize(value, snapshot.valuePrecision));
+            public void Write(string name, bool value) => Add(value ? 1 : 0);
+            public void Write(string name, string value) { }
+
+            public void Write(string name, Vector2Int value)
+            {
+                Add(value.x);
+                Add(value.y);
+            }
+        }
+    }
+}
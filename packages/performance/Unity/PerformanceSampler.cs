@@ -0,0 +1,153 @@
+using System;
+using Unity.Profiling;
+using UnityEngine;
+using UnitySim.Core;
+
+namespace UnitySim.Performance
+{
+    // One rendered frame as the engine reported it. Times are milliseconds, memory is bytes;
+    // gpuMs is 0 where FrameTimingManager has no GPU timings.
+    public struct PerformanceFrame
+    {
+        public int frame;
+        public float frameMs;
+        public float cpuMs;
+        public float gpuMs;
+        public float simulationMs;
+        public long gcAllocBytes;
+        public int drawCalls;
+        public long usedMemoryBytes;
+    }
+
+    // Averages of the frames sampled since the last TakeSummary
+    public struct PerformanceSummary
+    {
+        public int frames;
+        public float frameMs;
+        public float cpuMs;
+        public float gpuMs;
+        public float simulationMs;
+        public float gcAllocBytes;
+        public float drawCalls;
+        public long usedMemoryBytes;
+        public float worstFrameMs;
+    }
+
+    // Reads the engine's own counters once per frame: the main thread time, GC allocation and
+    // draw calls through ProfilerRecorder, GPU time through FrameTimingManager, and keeps every
+    // frame in a lock-free history. Recorders that a player doesn't expose (draw calls outside
+    // development builds, for example) read 0 rather than failing.
+    public class PerformanceSampler : IDisposable
+    {
+        private ProfilerRecorder mainThread;
+        private ProfilerRecorder gcAlloc;
+        private ProfilerRecorder drawCalls;
+        private ProfilerRecorder totalUsedMemory;
+        private ProfilerRecorder systemUsedMemory;
+
+        private readonly FrameTiming[] timings = new FrameTiming[1];
+        private readonly SimulationRingBuffer<PerformanceFrame> history;
+        private PerformanceSummary sums;
+        private bool recording = false;
+
+        public bool captureGpu = true;
+
+        public SimulationRingBuffer<PerformanceFrame> History => history;
+        public bool IsRecording => recording;
+        public PerformanceFrame Last { get; private set; }
+
+        public PerformanceSampler(int historyFrames)
+        {
+            history = new SimulationRingBuffer<PerformanceFrame>(Math.Max(1, historyFrames));
+        }
+
+        public void Start()
+        {
+            if (recording) return;
+
+            mainThread = ProfilerRecorder.StartNew(ProfilerCategory.Internal, "Main Thread", 1);
+            gcAlloc = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "GC Allocated In Frame", 1);
+            drawCalls = ProfilerRecorder.StartNew(ProfilerCategory.Render, "Draw Calls Count", 1);
+            totalUsedMemory = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "Total Used Memory", 1);
+            systemUsedMemory = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "System Used Memory", 1);
+            recording = true;
+        }
+
+        public void Dispose()
+        {
+            if (!recording) return;
+
+            mainThread.Dispose();
+            gcAlloc.Dispose();
+            drawCalls.Dispose();
+            totalUsedMemory.Dispose();
+            systemUsedMemory.Dispose();
+            recording = false;
+        }
+
+        // Call once per frame. Recorders report the previous frame, so samples trail by one.
+        public void Sample(float frameMs, float simulationMs)
+        {
+            if (!recording) return;
+
+            var frame = new PerformanceFrame
+            {
+                frame = UnityEngine.Time.frameCount,
+                frameMs = frameMs,
+                simulationMs = simulationMs,
+                gcAllocBytes = Read(gcAlloc),
+                drawCalls = (int)Read(drawCalls),
+                usedMemoryBytes = totalUsedMemory.Valid ? Read(totalUsedMemory) : Read(systemUsedMemory)
+            };
+
+            // Main Thread is in nanoseconds; FrameTimingManager fills in when it isn't recorded
+            frame.cpuMs = mainThread.Valid ? Read(mainThread) * 1e-6f : 0f;
+
+            if (captureGpu || !mainThread.Valid)
+            {
+                FrameTimingManager.CaptureFrameTimings();
+                if (FrameTimingManager.GetLatestTimings(1, timings) > 0)
+                {
+                    if (captureGpu) frame.gpuMs = (float)timings[0].gpuFrameTime;
+                    if (!mainThread.Valid) frame.cpuMs = (float)timings[0].cpuFrameTime;
+                }
+            }
+
+            if (frame.usedMemoryBytes == 0) frame.usedMemoryBytes = GC.GetTotalMemory(false);
+
+            history.Add(frame);
+            Last = frame;
+
+            sums.frames++;
+            sums.frameMs += frame.frameMs;
+            sums.cpuMs += frame.cpuMs;
+            sums.gpuMs += frame.gpuMs;
+            sums.simulationMs += frame.simulationMs;
+            sums.gcAllocBytes += frame.gcAllocBytes;
+            sums.drawCalls += frame.drawCalls;
+            sums.usedMemoryBytes = frame.usedMemoryBytes;
+            sums.worstFrameMs = Math.Max(sums.worstFrameMs, frame.frameMs);
+        }
+
+        public PerformanceSummary TakeSummary()
+        {
+            var summary = sums;
+            sums = default;
+            if (summary.frames == 0) return summary;
+
+            float scale = 1f / summary.frames;
+            summary.frameMs *= scale;
+            summary.cpuMs *= scale;
+            summary.gpuMs *= scale;
+            summary.simulationMs *= scale;
+            summary.gcAllocBytes *= scale;
+            summary.drawCalls *= scale;
+            return summary;
+        }
+
+        private static long Read(ProfilerRecorder recorder)
+        {
+            return recorder.Valid ? recorder.LastValue : 0;
+        }
+    }
+}
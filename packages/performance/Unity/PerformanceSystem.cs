@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Performance
 {
@@ -13,32 +17,141 @@ namespace UnitySim.Performance
 
         public PerformanceData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             performance = new PerformanceInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (performance != null)
+                performance.WriteState(writer, "performance");
+            else
+                writer.Write("performance", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
     public class PerformanceInfo
     {
-                public float cpuUsage = 45f;
-        public float memoryUsage = 2.1f;
-        public float frameRate = 60f;
-        public int drawCalls = 150;
-        public float gpuUsage = 30f;
-        public float loadTime = 2.5f;
+        // Usage is the percentage of the target frame time spent on that processor, memory is GB
+        public float cpuUsage = 0f;
+        public float memoryUsage = 0f;
+        public float frameRate = 0f;
+        public int drawCalls = 0;
+        public float gpuUsage = 0f;
+        public float loadTime = 0f;
+        public float gcAllocPerFrame = 0f;
+        public float simulationTime = 0f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-performance";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("cpuUsage", cpuUsage);
+            writer.Write("memoryUsage", memoryUsage);
+            writer.Write("frameRate", frameRate);
+            writer.Write("drawCalls", drawCalls);
+            writer.Write("gpuUsage", gpuUsage);
+            writer.Write("loadTime", loadTime);
+            writer.Write("gcAllocPerFrame", gcAllocPerFrame);
+            writer.Write("simulationTime", simulationTime);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public PerformanceField Diff(PerformanceInfo other)
+        {
+            var changed = PerformanceField.None;
+            if (cpuUsage != other.cpuUsage) changed |= PerformanceField.CpuUsage;
+            if (memoryUsage != other.memoryUsage) changed |= PerformanceField.MemoryUsage;
+            if (frameRate != other.frameRate) changed |= PerformanceField.FrameRate;
+            if (drawCalls != other.drawCalls) changed |= PerformanceField.DrawCalls;
+            if (gpuUsage != other.gpuUsage) changed |= PerformanceField.GpuUsage;
+            if (loadTime != other.loadTime) changed |= PerformanceField.LoadTime;
+            if (gcAllocPerFrame != other.gcAllocPerFrame) changed |= PerformanceField.GcAllocPerFrame;
+            if (simulationTime != other.simulationTime) changed |= PerformanceField.SimulationTime;
+            if (systemHealth != other.systemHealth) changed |= PerformanceField.SystemHealth;
+            if (framework != other.framework) changed |= PerformanceField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(PerformanceInfo target)
+        {
+            target.cpuUsage = cpuUsage;
+            target.memoryUsage = memoryUsage;
+            target.frameRate = frameRate;
+            target.drawCalls = drawCalls;
+            target.gpuUsage = gpuUsage;
+            target.loadTime = loadTime;
+            target.gcAllocPerFrame = gcAllocPerFrame;
+            target.simulationTime = simulationTime;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum PerformanceField
+    {
+        None = 0,
+        CpuUsage = 1 << 0,
+        MemoryUsage = 1 << 1,
+        FrameRate = 1 << 2,
+        DrawCalls = 1 << 3,
+        GpuUsage = 1 << 4,
+        LoadTime = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        GcAllocPerFrame = 1 << 8,
+        SimulationTime = 1 << 9,
+        All = (1 << 10) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct PerformanceDelta
+    {
+        public readonly long timestamp;
+        public readonly PerformanceField changed;
+        public readonly PerformanceInfo values;
+
+        public PerformanceDelta(long timestamp, PerformanceField changed, PerformanceInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(PerformanceField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class PerformanceSystem : MonoBehaviour
+    public class PerformanceSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Performance Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Profiling")]
+        public float targetFrameRate = 60f;
+        public bool captureGpuTiming = true;
+        public int historyFrames = 600;
+        public int heaviestSystemsFrames = 60;
+        [SerializeField] private float lastCpuMs = 0f;
+        [SerializeField] private float lastGpuMs = 0f;
+        [SerializeField] private long lastGcAllocBytes = 0;
+        [SerializeField] private float worstFrameMs = 0f;
+        [SerializeField] private string heaviestSystem = "";
+
         [Header("Current Data")]
         [SerializeField] private PerformanceData currentData;
 
@@ -48,12 +161,20 @@ namespace UnitySim.Performance
 
         // Events
         public System.Action<PerformanceData> OnPerformanceChanged;
+        public System.Action<PerformanceDelta> OnPerformanceDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.PerformanceSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly PerformanceInfo publishedInfo = new PerformanceInfo();
+        private bool publishFullDelta = true;
+        private PerformanceSampler sampler;
+        private readonly List<SystemCost> heaviest = new List<SystemCost>();
 
         #region Unity Lifecycle
 
@@ -62,18 +183,35 @@ namespace UnitySim.Performance
             InitializePerformance();
         }
 
+        void OnEnable()
+        {
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+
+            if (sampler == null) sampler = new PerformanceSampler(historyFrames);
+            sampler.Start();
+        }
+
+        void OnDisable()
+        {
+            sampler?.Dispose();
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
+
         void Update()
         {
-            if (!isInitialized) return;
+            if (sampler == null) return;
 
-            UpdateSystem();
+            // Every rendered frame is sampled; the scheduled update publishes the averages
+            sampler.captureGpu = captureGpuTiming;
+            var scheduler = SimulationScheduler.Instance;
+            sampler.Sample(UnityEngine.Time.unscaledDeltaTime * 1000f, scheduler != null ? scheduler.LastFrameTimeMs : 0f);
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+            var last = sampler.Last;
+            lastCpuMs = last.cpuMs;
+            lastGpuMs = last.gpuMs;
+            lastGcAllocBytes = last.gcAllocBytes;
         }
 
         #endregion
@@ -83,6 +221,9 @@ namespace UnitySim.Performance
         private void InitializePerformance()
         {
             currentData = new PerformanceData();
+            currentData.performance.loadTime = UnityEngine.Time.realtimeSinceStartup;
+            sampler?.TakeSummary();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +234,41 @@ namespace UnitySim.Performance
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.performance.cpuUsage = Mathf.Clamp(currentData.performance.cpuUsage + UnityEngine.Random.Range(-5f, 5f), 0f, 100f);
-            currentData.performance.frameRate = Mathf.Max(30f, currentData.performance.frameRate + UnityEngine.Random.Range(-2f, 2f));
-            currentData.performance.memoryUsage += UnityEngine.Random.Range(-0.1f, 0.1f);
+            if (sampler == null) return;
+
+            var summary = sampler.TakeSummary();
+            if (summary.frames == 0) return;
+
+            var info = currentData.performance;
+            float targetMs = 1000f / Mathf.Max(1f, targetFrameRate);
+            info.frameRate = summary.frameMs > 0f ? 1000f / summary.frameMs : 0f;
+            info.cpuUsage = summary.cpuMs / targetMs * 100f;
+            info.gpuUsage = summary.gpuMs / targetMs * 100f;
+            info.memoryUsage = summary.usedMemoryBytes / (1024f * 1024f * 1024f);
+            info.drawCalls = Mathf.RoundToInt(summary.drawCalls);
+            info.gcAllocPerFrame = summary.gcAllocBytes / 1024f;
+            info.simulationTime = summary.simulationMs;
+            info.systemHealth = summary.cpuMs > targetMs || summary.gpuMs > targetMs ? "over-budget" : "operational";
+            worstFrameMs = summary.worstFrameMs;
+
+            var scheduler = SimulationScheduler.Instance;
+            if (scheduler == null) return;
+            scheduler.Profiler.GetHeaviest(heaviestSystemsFrames, heaviest);
+            heaviestSystem = heaviest.Count > 0 ? heaviest[0].name : "";
         }
 
         private void ProcessUpdate()
@@ -122,6 +281,12 @@ namespace UnitySim.Performance
                 OnPerformanceChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +294,67 @@ namespace UnitySim.Performance
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.performance;
+            var changed = publishFullDelta ? PerformanceField.All : info.Diff(publishedInfo);
+            if (changed == PerformanceField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnPerformanceDelta?.Invoke(new PerformanceDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(PerformanceSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("PerformanceSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +365,9 @@ namespace UnitySim.Performance
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +388,20 @@ namespace UnitySim.Performance
             return currentData;
         }
 
+        // Frames sampled so far, oldest first; safe to read from another thread
+        public SimulationRingBuffer<PerformanceFrame> GetFrameHistory()
+        {
+            return sampler?.History;
+        }
+
+        // Registered systems by tick cost over the last frames, heaviest first
+        public void GetHeaviestSystems(int frames, List<SystemCost> results)
+        {
+            results.Clear();
+            var scheduler = SimulationScheduler.Instance;
+            if (scheduler != null) scheduler.Profiler.GetHeaviest(frames, results);
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +433,7 @@ namespace UnitySim.Performance
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +445,9 @@ namespace UnitySim.Performance
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            targetFrameRate = Mathf.Max(1f, targetFrameRate);
+            historyFrames = Mathf.Max(1, historyFrames);
+            heaviestSystemsFrames = Mathf.Max(1, heaviestSystemsFrames);
         }
 
         #endregion
@@ -218,7 +459,16 @@ namespace UnitySim.Performance
             Debug.Log($"PerformanceSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Last Frame: CPU {lastCpuMs:F2}ms, GPU {lastGpuMs:F2}ms, GC {lastGcAllocBytes} bytes");
+
+            GetHeaviestSystems(heaviestSystemsFrames, heaviest);
+            for (int i = 0; i < heaviest.Count && i < 5; i++)
+            {
+                var cost = heaviest[i];
+                Debug.Log($"- {cost.name}: {cost.totalMs:F2}ms over {cost.frames} frames (max {cost.maxMs:F2}ms)");
+            }
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
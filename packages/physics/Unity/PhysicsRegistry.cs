@@ -0,0 +1,80 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.Physics
+{
+    // Incrementally maintained set of tracked rigidbodies, fed by TrackedRigidbody
+    // enable/disable and collision callbacks. All counters are O(1) to read.
+    public static class PhysicsRegistry
+    {
+        private static readonly List<TrackedRigidbody> bodies = new List<TrackedRigidbody>(1024);
+        private static int constraintCount = 0;
+        private static long collisionCount = 0;
+        private static int activeContacts = 0;
+
+        public static int RigidbodyCount => bodies.Count;
+        public static int ConstraintCount => constraintCount;
+        public static long CollisionCount => collisionCount;
+        public static int ActiveContacts => activeContacts;
+
+        public static TrackedRigidbody GetBody(int index)
+        {
+            return bodies[index];
+        }
+
+        internal static void Register(TrackedRigidbody body)
+        {
+            if (body.RegistryIndex >= 0) return;
+
+            body.RegistryIndex = bodies.Count;
+            bodies.Add(body);
+            constraintCount += body.JointCount;
+        }
+
+        internal static void Unregister(TrackedRigidbody body)
+        {
+            int index = body.RegistryIndex;
+            if (index < 0 || index >= bodies.Count || bodies[index] != body) return;
+
+            // Swap-remove keeps removal O(1) without shifting the list
+            int last = bodies.Count - 1;
+            if (index != last)
+            {
+                var moved = bodies[last];
+                bodies[index] = moved;
+                moved.RegistryIndex = index;
+            }
+            bodies.RemoveAt(last);
+            body.RegistryIndex = -1;
+
+            constraintCount -= body.JointCount;
+            activeContacts -= body.RecordedContacts;
+        }
+
+        internal static void AdjustConstraints(int delta)
+        {
+            constraintCount += delta;
+        }
+
+        internal static void RecordCollisionEnter()
+        {
+            collisionCount++;
+            activeContacts++;
+        }
+
+        internal static void RecordCollisionExit()
+        {
+            activeContacts--;
+        }
+
+        // Domain reload may be disabled in the editor, so statics are cleared explicitly
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+        private static void ResetStatics()
+        {
+            bodies.Clear();
+            constraintCount = 0;
+            collisionCount = 0;
+            activeContacts = 0;
+        }
+    }
+}
@@ -1,6 +1,9 @@
 using System;
+using System.Buffers;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Physics
 {
@@ -13,10 +16,22 @@ namespace UnitySim.Physics
 
         public PhysicsData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             physics = new PhysicsInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (physics != null)
+                physics.WriteState(writer, "physics");
+            else
+                writer.Write("physics", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,9 +45,84 @@ namespace UnitySim.Physics
         public int physicsIterations = 6;
         public string systemHealth = "operational";
         public string framework = "unity-sim-physics";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("gravity", gravity);
+            writer.Write("rigidBodies", rigidBodies);
+            writer.Write("constraints", constraints);
+            writer.Write("collisions", collisions);
+            writer.Write("timeStep", timeStep);
+            writer.Write("physicsIterations", physicsIterations);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public PhysicsField Diff(PhysicsInfo other)
+        {
+            var changed = PhysicsField.None;
+            if (gravity != other.gravity) changed |= PhysicsField.Gravity;
+            if (rigidBodies != other.rigidBodies) changed |= PhysicsField.RigidBodies;
+            if (constraints != other.constraints) changed |= PhysicsField.Constraints;
+            if (collisions != other.collisions) changed |= PhysicsField.Collisions;
+            if (timeStep != other.timeStep) changed |= PhysicsField.TimeStep;
+            if (physicsIterations != other.physicsIterations) changed |= PhysicsField.PhysicsIterations;
+            if (systemHealth != other.systemHealth) changed |= PhysicsField.SystemHealth;
+            if (framework != other.framework) changed |= PhysicsField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(PhysicsInfo target)
+        {
+            target.gravity = gravity;
+            target.rigidBodies = rigidBodies;
+            target.constraints = constraints;
+            target.collisions = collisions;
+            target.timeStep = timeStep;
+            target.physicsIterations = physicsIterations;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum PhysicsField
+    {
+        None = 0,
+        Gravity = 1 << 0,
+        RigidBodies = 1 << 1,
+        Constraints = 1 << 2,
+        Collisions = 1 << 3,
+        TimeStep = 1 << 4,
+        PhysicsIterations = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct PhysicsDelta
+    {
+        public readonly long timestamp;
+        public readonly PhysicsField changed;
+        public readonly PhysicsInfo values;
+
+        public PhysicsDelta(long timestamp, PhysicsField changed, PhysicsInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(PhysicsField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class PhysicsSystem : MonoBehaviour
+    public class PhysicsSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Physics Settings")]
         public float updateInterval = 1f;
@@ -46,14 +136,25 @@ namespace UnitySim.Physics
         public bool enableOptimization = true;
         public int maxUpdatesPerFrame = 1;
 
+        [Header("Rigidbody Tracking")]
+        public bool autoTrackSceneBodies = true;
+        public bool reuseCollisionCallbacks = true;
+
         // Events
         public System.Action<PhysicsData> OnPhysicsChanged;
+        public System.Action<PhysicsDelta> OnPhysicsDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.PhysicsSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly PhysicsInfo publishedInfo = new PhysicsInfo();
+        private bool publishFullDelta = true;
+        private long collisionBaseline = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +163,16 @@ namespace UnitySim.Physics
             InitializePhysics();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,33 +182,64 @@ namespace UnitySim.Physics
         private void InitializePhysics()
         {
             currentData = new PhysicsData();
+            publishFullDelta = true;
+            collisionBaseline = PhysicsRegistry.CollisionCount;
+
+            // Pooled Collision objects keep OnCollisionEnter allocation-free
+            if (reuseCollisionCallbacks)
+                UnityEngine.Physics.reuseCollisionCallbacks = true;
+
+            if (autoTrackSceneBodies)
+                TrackSceneBodies();
+
             isInitialized = true;
 
             if (enableLogging)
                 Debug.Log($"PhysicsSystem initialized successfully");
         }
 
+        // One-time scan so existing scenes work without adding TrackedRigidbody by hand
+        private void TrackSceneBodies()
+        {
+            int added = 0;
+            foreach (var body in FindObjectsOfType<Rigidbody>())
+            {
+                if (!body.TryGetComponent<TrackedRigidbody>(out _))
+                {
+                    body.gameObject.AddComponent<TrackedRigidbody>();
+                    added++;
+                }
+            }
+
+            if (enableLogging && added > 0)
+                Debug.Log($"PhysicsSystem: Tracking {added} scene rigidbodies");
+        }
+
         #endregion
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.physics.rigidBodies = FindObjectsOfType<Rigidbody>().Length;
-            currentData.physics.collisions += UnityEngine.Random.Range(0, 5);
-            currentData.physics.constraints = currentData.physics.rigidBodies * UnityEngine.Random.Range(0, 3);
+            // Counters are maintained incrementally by TrackedRigidbody callbacks
+            currentData.physics.rigidBodies = PhysicsRegistry.RigidbodyCount;
+            currentData.physics.constraints = PhysicsRegistry.ConstraintCount;
+            currentData.physics.collisions = (int)(PhysicsRegistry.CollisionCount - collisionBaseline);
+            currentData.physics.gravity = UnityEngine.Physics.gravity.y;
+            currentData.physics.timeStep = UnityEngine.Time.fixedDeltaTime;
+            currentData.physics.physicsIterations = UnityEngine.Physics.defaultSolverIterations;
         }
 
         private void ProcessUpdate()
@@ -122,6 +252,12 @@ namespace UnitySim.Physics
                 OnPhysicsChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +265,67 @@ namespace UnitySim.Physics
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.physics;
+            var changed = publishFullDelta ? PhysicsField.All : info.Diff(publishedInfo);
+            if (changed == PhysicsField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnPhysicsDelta?.Invoke(new PhysicsDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(PhysicsSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("PhysicsSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +336,9 @@ namespace UnitySim.Physics
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +390,7 @@ namespace UnitySim.Physics
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -218,7 +413,9 @@ namespace UnitySim.Physics
             Debug.Log($"PhysicsSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Tracked Bodies: {PhysicsRegistry.RigidbodyCount} ({PhysicsRegistry.ActiveContacts} active contacts)");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -0,0 +1,99 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.Physics
+{
+    // Registers its Rigidbody (and any joints on the same GameObject) with the
+    // PhysicsRegistry while enabled, and forwards collision callbacks to it.
+    [DisallowMultipleComponent]
+    [RequireComponent(typeof(Rigidbody))]
+    [AddComponentMenu("Unity Sim/Physics/Tracked Rigidbody")]
+    public class TrackedRigidbody : MonoBehaviour
+    {
+        private static readonly List<Joint> jointBuffer = new List<Joint>(4);
+
+        private Rigidbody body;
+
+        // Colliders whose contact with this body was counted by this body, so exits and
+        // unregistering undo exactly what was recorded even if registry indices change meanwhile
+        private readonly HashSet<Collider> recordedContacts = new HashSet<Collider>();
+
+        public Rigidbody Body => body;
+        public int JointCount { get; private set; }
+        public int ContactCount { get; private set; }
+        internal int RegistryIndex { get; set; } = -1;
+        internal int RecordedContacts => recordedContacts.Count;
+
+        void Awake()
+        {
+            body = GetComponent<Rigidbody>();
+        }
+
+        void OnEnable()
+        {
+            CountJoints();
+            PhysicsRegistry.Register(this);
+        }
+
+        void OnDisable()
+        {
+            PhysicsRegistry.Unregister(this);
+            recordedContacts.Clear();
+            ContactCount = 0;
+        }
+
+        void OnCollisionEnter(Collision collision)
+        {
+            ContactCount++;
+            if (RecordsPair(collision) && recordedContacts.Add(collision.collider))
+                PhysicsRegistry.RecordCollisionEnter();
+        }
+
+        void OnCollisionExit(Collision collision)
+        {
+            if (ContactCount <= 0) return;
+
+            ContactCount--;
+            if (recordedContacts.Remove(collision.collider))
+                PhysicsRegistry.RecordCollisionExit();
+        }
+
+        // Both bodies of a tracked pair get the callback; the one with the lower index counts it
+        private bool RecordsPair(Collision collision)
+        {
+            if (RegistryIndex < 0) return false;
+
+            var other = collision.rigidbody;
+            if (other == null || !other.TryGetComponent<TrackedRigidbody>(out var tracked) || tracked.RegistryIndex < 0)
+                return true;
+
+            return RegistryIndex < tracked.RegistryIndex;
+        }
+
+        void OnJointBreak(float breakForce)
+        {
+            if (JointCount <= 0) return;
+
+            JointCount--;
+            if (RegistryIndex >= 0)
+                PhysicsRegistry.AdjustConstraints(-1);
+        }
+
+        // Call after adding or removing joints at runtime
+        public void RefreshJoints()
+        {
+            int previous = JointCount;
+            CountJoints();
+
+            if (RegistryIndex >= 0)
+                PhysicsRegistry.AdjustConstraints(JointCount - previous);
+        }
+
+        private void CountJoints()
+        {
+            GetComponents(jointBuffer);
+            JointCount = jointBuffer.Count;
+            jointBuffer.Clear();
+        }
+    }
+}
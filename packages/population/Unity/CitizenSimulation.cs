@@ -0,0 +1,417 @@
+using System;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+
+namespace UnitySim.Population
+{
+    [Serializable]
+    public class CitizenSettings
+    {
+        // Gompertz mortality: hazard = mortalityBase * e^(mortalityGrowth * age) per year
+        public float mortalityBase = 0.000025f;
+        public float mortalityGrowth = 0.1f;
+
+        // Births per person-year between the fertile ages
+        public float fertilityRate = 0.032f;
+        public float fertileFrom = 18f;
+        public float fertileTo = 45f;
+
+        // Per person-year; immigration scales with the current population
+        public float emigrationRate = 0.008f;
+        public float immigrationRate = 0.009f;
+        public float relocationRate = 0.1f;
+
+        public float workingAge = 18f;
+        public float retirementAge = 67f;
+        public float hiringRate = 2f;
+        public float jobLossRate = 0.05f;
+
+        public int districts = 16;
+    }
+
+    // Steps a CitizenStore in three passes: a parallel Burst pass per chunk that ages
+    // everyone, updates employment and location and rolls births, deaths and emigration
+    // into per-chunk event lists; a commit that applies only those events; and O(MaxAge)
+    // bookkeeping that keeps the age histogram and life table current without a rescan.
+    public class CitizenSimulation : IDisposable
+    {
+        private const byte DeathEvent = 0;
+        private const byte EmigrationEvent = 1;
+        private const byte BirthEvent = 2;
+
+        public static readonly int[] AgeGroupStarts = { 0, 15, 25, 45, 65 };
+
+        private readonly CitizenStore store;
+        private readonly CitizenSettings settings;
+        private readonly uint seed;
+        private Unity.Mathematics.Random random;
+        private uint stepIndex = 0;
+        private int nextHousehold = 0;
+
+        // Per chunk: up to ChunkSize events, an event count, and whole-year crossings
+        private NativeArray<int> events;
+        private NativeArray<int> eventCount;
+        private NativeArray<int> crossings;
+        private int chunkCapacity = 0;
+
+        // Decayed exposure (person-years) and deaths per year of age for the period life table
+        private readonly double[] exposure = new double[CitizenStore.MaxAge + 1];
+        private readonly double[] deathsAtAge = new double[CitizenStore.MaxAge + 1];
+        private readonly int[] ageGroups = new int[AgeGroupStarts.Length];
+        private bool disposed = false;
+
+        public CitizenStore Store => store;
+        public CitizenSettings Settings => settings;
+        public double SimulatedYears { get; private set; }
+
+        // Years over which the life table forgets old deaths
+        public float LifeTableWindow { get; set; } = 5f;
+
+        // Counts for the last step
+        public int Births { get; private set; }
+        public int Deaths { get; private set; }
+        public int Emigrants { get; private set; }
+        public int Immigrants { get; private set; }
+
+        public CitizenSimulation(CitizenSettings settings, uint seed)
+        {
+            this.settings = settings ?? new CitizenSettings();
+            this.seed = seed == 0 ? 1u : seed;
+            random = new Unity.Mathematics.Random(this.seed);
+            store = new CitizenStore(CitizenStore.ChunkSize);
+        }
+
+        #region Population
+
+        // Fills the store with a roughly stationary population for the mortality settings,
+        // grouped into households of one to five
+        public void Populate(int citizens)
+        {
+            store.Reserve(store.Count + citizens);
+
+            int remainingInHousehold = 0;
+            int districtId = 0;
+            for (int i = 0; i < citizens; i++)
+            {
+                if (remainingInHousehold == 0)
+                {
+                    nextHousehold++;
+                    remainingInHousehold = random.NextInt(1, 6);
+                    districtId = random.NextInt(0, Math.Max(1, settings.districts));
+                }
+                remainingInHousehold--;
+
+                float years;
+                do
+                {
+                    years = random.NextFloat(0f, 100f);
+                }
+                while (random.NextFloat() > Survival(years));
+
+                store.Create(years, nextHousehold, StatusForAge(years), districtId);
+            }
+        }
+
+        private float Survival(float years)
+        {
+            float b = Math.Max(0.0001f, settings.mortalityGrowth);
+            return (float)Math.Exp(-settings.mortalityBase / b * (Math.Exp(b * years) - 1.0));
+        }
+
+        private EmploymentStatus StatusForAge(float years)
+        {
+            if (years < settings.workingAge) return EmploymentStatus.Inactive;
+            if (years >= settings.retirementAge) return EmploymentStatus.Retired;
+            return random.NextFloat() < 0.94f ? EmploymentStatus.Employed : EmploymentStatus.Unemployed;
+        }
+
+        #endregion
+
+        #region Step
+
+        public void Step(float years)
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(CitizenSimulation));
+            if (years <= 0f) return;
+
+            int chunks = store.ChunkCount;
+            EnsureChunkBuffers(chunks);
+
+            // Exposure is taken before ageing, over the ages lived during the step
+            AccumulateExposure(years);
+
+            new CitizenStepJob
+            {
+                years = years,
+                seed = seed,
+                step = stepIndex++,
+                settings = settings,
+                age = store.Age,
+                employment = store.Employment,
+                district = store.District,
+                alive = store.Alive,
+                chunkLive = store.ChunkLive,
+                events = events,
+                eventCount = eventCount,
+                crossings = crossings
+            }.Schedule(chunks, 1).Complete();
+
+            Commit(chunks, years);
+            UpdateAgeGroups();
+            SimulatedYears += years;
+        }
+
+        private void Commit(int chunks, float years)
+        {
+            Births = Deaths = Emigrants = Immigrants = 0;
+
+            // Age crossings first, so deaths are removed from the bin the citizen is now in
+            for (int chunk = 0; chunk < chunks; chunk++)
+            {
+                store.ApplyAgeing(crossings, chunk * CitizenStore.MaxAge);
+            }
+
+            for (int chunk = 0; chunk < chunks; chunk++)
+            {
+                int offset = chunk * CitizenStore.ChunkSize;
+                int count = eventCount[chunk];
+                for (int e = 0; e < count; e++)
+                {
+                    int packed = events[offset + e];
+                    int index = packed >> 2;
+                    int kind = packed & 3;
+
+                    if (kind == BirthEvent)
+                    {
+                        // Newborns may take slots freed earlier in this commit, never ones still to be read
+                        store.Create(0f, store.Household[index], EmploymentStatus.Inactive, store.District[index]);
+                        Births++;
+                    }
+                    else
+                    {
+                        if (kind == DeathEvent)
+                        {
+                            deathsAtAge[CitizenStore.AgeBin(store.Age[index])] += 1.0;
+                            Deaths++;
+                        }
+                        else
+                        {
+                            Emigrants++;
+                        }
+                        store.DestroyAt(index);
+                    }
+                }
+            }
+
+            // Immigrants arrive as new working-age households
+            float expected = settings.immigrationRate * store.Count * years;
+            int arrivals = (int)expected + (random.NextFloat() < expected - (int)expected ? 1 : 0);
+            int districtCount = Math.Max(1, settings.districts);
+            for (int i = 0; i < arrivals; i++)
+            {
+                float years0 = random.NextFloat(18f, 40f);
+                store.Create(years0, ++nextHousehold, EmploymentStatus.Unemployed, random.NextInt(0, districtCount));
+            }
+            Immigrants = arrivals;
+        }
+
+        private void EnsureChunkBuffers(int chunks)
+        {
+            if (chunks <= chunkCapacity) return;
+
+            int capacity = Math.Max(chunks, store.Capacity / CitizenStore.ChunkSize);
+            if (events.IsCreated)
+            {
+                events.Dispose();
+                eventCount.Dispose();
+                crossings.Dispose();
+            }
+            events = new NativeArray<int>(capacity * CitizenStore.ChunkSize, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+            eventCount = new NativeArray<int>(capacity, Allocator.Persistent);
+            crossings = new NativeArray<int>(capacity * CitizenStore.MaxAge, Allocator.Persistent);
+            chunkCapacity = capacity;
+        }
+
+        #endregion
+
+        #region Statistics
+
+        private void AccumulateExposure(float years)
+        {
+            double decay = Math.Exp(-years / Math.Max(0.01, LifeTableWindow));
+            int[] histogram = store.AgeHistogram;
+            for (int y = 0; y <= CitizenStore.MaxAge; y++)
+            {
+                exposure[y] = exposure[y] * decay + histogram[y] * (double)years;
+                deathsAtAge[y] *= decay;
+            }
+        }
+
+        private void UpdateAgeGroups()
+        {
+            int[] histogram = store.AgeHistogram;
+            Array.Clear(ageGroups, 0, ageGroups.Length);
+
+            int group = 0;
+            for (int y = 0; y <= CitizenStore.MaxAge; y++)
+            {
+                while (group + 1 < AgeGroupStarts.Length && y >= AgeGroupStarts[group + 1]) group++;
+                ageGroups[group] += histogram[y];
+            }
+        }
+
+        // Citizens per AgeGroupStarts bracket
+        public int[] AgeGroups => ageGroups;
+
+        // Period life expectancy at birth from the decayed age-specific death rates
+        public float LifeExpectancy()
+        {
+            double survivors = 1.0;
+            double expectancy = 0.0;
+            for (int y = 0; y <= CitizenStore.MaxAge; y++)
+            {
+                double rate = exposure[y] > 0.0 ? deathsAtAge[y] / exposure[y] : 0.0;
+                double dying = y == CitizenStore.MaxAge ? 1.0 : 1.0 - Math.Exp(-rate);
+                double next = survivors * (1.0 - dying);
+
+                // Those who die within the year live half of it on average
+                expectancy += y == CitizenStore.MaxAge && rate > 0.0 ? survivors / rate : (survivors + next) * 0.5;
+                survivors = next;
+            }
+            return (float)expectancy;
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            disposed = true;
+
+            store.Dispose();
+            if (events.IsCreated)
+            {
+                events.Dispose();
+                eventCount.Dispose();
+                crossings.Dispose();
+            }
+        }
+
+        #endregion
+
+        #region Jobs
+
+        [BurstCompile]
+        private struct CitizenStepJob : IJobParallelFor
+        {
+            public float years;
+            public uint seed;
+            public uint step;
+            public CitizenRates settings;
+
+            [NativeDisableParallelForRestriction] public NativeArray<float> age;
+            [NativeDisableParallelForRestriction] public NativeArray<byte> employment;
+            [NativeDisableParallelForRestriction] public NativeArray<ushort> district;
+            [ReadOnly] public NativeArray<byte> alive;
+            [ReadOnly] public NativeArray<int> chunkLive;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<int> events;
+            [WriteOnly] public NativeArray<int> eventCount;
+            [NativeDisableParallelForRestriction] public NativeArray<int> crossings;
+
+            public void Execute(int chunk)
+            {
+                int crossingOffset = chunk * CitizenStore.MaxAge;
+                for (int y = 0; y < CitizenStore.MaxAge; y++) crossings[crossingOffset + y] = 0;
+
+                int count = 0;
+                if (chunkLive[chunk] == 0)
+                {
+                    eventCount[chunk] = 0;
+                    return;
+                }
+
+                // One stream per chunk and step, so results do not depend on thread timing
+                var rng = new Unity.Mathematics.Random(math.hash(new uint3(seed, step, (uint)chunk)) | 1u);
+
+                float hire = 1f - math.exp(-settings.hiringRate * years);
+                float fire = 1f - math.exp(-settings.jobLossRate * years);
+                float leave = 1f - math.exp(-settings.emigrationRate * years);
+                float relocate = 1f - math.exp(-settings.relocationRate * years);
+                float birth = 1f - math.exp(-settings.fertilityRate * years);
+
+                int start = chunk * CitizenStore.ChunkSize;
+                int end = math.min(start + CitizenStore.ChunkSize, age.Length);
+                for (int i = start; i < end; i++)
+                {
+                    if (alive[i] == 0) continue;
+
+                    float a0 = age[i];
+                    float a1 = a0 + years;
+                    age[i] = a1;
+
+                    int from = math.min((int)a0, CitizenStore.MaxAge);
+                    int to = math.min((int)a1, CitizenStore.MaxAge);
+                    for (int y = from; y < to; y++) crossings[crossingOffset + y]++;
+
+                    byte status = employment[i];
+                    if (a1 >= settings.retirementAge) status = (byte)EmploymentStatus.Retired;
+                    else if (status == (byte)EmploymentStatus.Inactive && a1 >= settings.workingAge) status = (byte)EmploymentStatus.Unemployed;
+                    else if (status == (byte)EmploymentStatus.Unemployed && rng.NextFloat() < hire) status = (byte)EmploymentStatus.Employed;
+                    else if (status == (byte)EmploymentStatus.Employed && rng.NextFloat() < fire) status = (byte)EmploymentStatus.Unemployed;
+                    employment[i] = status;
+
+                    if (settings.districts > 1 && rng.NextFloat() < relocate)
+                        district[i] = (ushort)rng.NextInt(0, settings.districts);
+
+                    float hazard = settings.mortalityBase * math.exp(settings.mortalityGrowth * a1);
+                    if (rng.NextFloat() < 1f - math.exp(-hazard * years))
+                        events[start + count++] = (i << 2) | DeathEvent;
+                    else if (rng.NextFloat() < leave)
+                        events[start + count++] = (i << 2) | EmigrationEvent;
+                    else if (a1 >= settings.fertileFrom && a1 < settings.fertileTo && rng.NextFloat() < birth)
+                        events[start + count++] = (i << 2) | BirthEvent;
+                }
+
+                eventCount[chunk] = count;
+            }
+        }
+
+        // Blittable copy of CitizenSettings for the job
+        private struct CitizenRates
+        {
+            public float mortalityBase;
+            public float mortalityGrowth;
+            public float fertilityRate;
+            public float fertileFrom;
+            public float fertileTo;
+            public float emigrationRate;
+            public float relocationRate;
+            public float workingAge;
+            public float retirementAge;
+            public float hiringRate;
+            public float jobLossRate;
+            public int districts;
+
+            public static implicit operator CitizenRates(CitizenSettings s)
+            {
+                return new CitizenRates
+                {
+                    mortalityBase = s.mortalityBase,
+                    mortalityGrowth = s.mortalityGrowth,
+                    fertilityRate = s.fertilityRate,
+                    fertileFrom = s.fertileFrom,
+                    fertileTo = s.fertileTo,
+                    emigrationRate = s.emigrationRate,
+                    relocationRate = s.relocationRate,
+                    workingAge = s.workingAge,
+                    retirementAge = s.retirementAge,
+                    hiringRate = s.hiringRate,
+                    jobLossRate = s.jobLossRate,
+                    districts = Math.Max(1, s.districts)
+                };
+            }
+        }
+
+        #endregion
+    }
+}
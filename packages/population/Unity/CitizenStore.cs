@@ -0,0 +1,227 @@
+using System;
+using Unity.Collections;
+
+namespace UnitySim.Population
+{
+    public enum EmploymentStatus : byte
+    {
+        Inactive,
+        Employed,
+        Unemployed,
+        Retired
+    }
+
+    // Refers to one citizen for as long as they live; a reused slot gets a new version
+    public readonly struct CitizenHandle : IEquatable<CitizenHandle>
+    {
+        public readonly int index;
+        public readonly int version;
+
+        public CitizenHandle(int index, int version)
+        {
+            this.index = index;
+            this.version = version;
+        }
+
+        public bool IsValid => version != 0;
+
+        public bool Equals(CitizenHandle other) => index == other.index && version == other.version;
+        public override bool Equals(object obj) => obj is CitizenHandle other && Equals(other);
+        public override int GetHashCode() => index * 397 ^ version;
+    }
+
+    // Citizens in fixed-size chunks of structure-of-arrays storage. A citizen keeps its slot
+    // for life, freed slots are reused from a free list, and jobs walk whole chunks, skipping
+    // empty ones. Alongside the fields it keeps a single-year age histogram, updated on
+    // every create and destroy so no pass has to rescan the population.
+    public class CitizenStore : IDisposable
+    {
+        public const int ChunkSize = 16384;
+        public const int MaxAge = 110;
+
+        private NativeArray<float> age;
+        private NativeArray<int> household;
+        private NativeArray<byte> employment;
+        private NativeArray<ushort> district;
+        private NativeArray<byte> alive;
+        private NativeArray<int> version;
+        private NativeArray<int> chunkLive;
+
+        private int[] freeList;
+        private int freeCount = 0;
+        private int highWater = 0;
+        private int count = 0;
+        private int capacity = 0;
+        private bool disposed = false;
+
+        // Citizens per whole year of age, the last bin holding MaxAge and over
+        private readonly int[] ageHistogram = new int[MaxAge + 1];
+
+        public int Count => count;
+        public int Capacity => capacity;
+        public int ChunkCount => (highWater + ChunkSize - 1) / ChunkSize;
+        public int[] AgeHistogram => ageHistogram;
+
+        // Raw fields for jobs, valid up to ChunkCount * ChunkSize; reallocated when the store grows
+        public NativeArray<float> Age => age;
+        public NativeArray<int> Household => household;
+        public NativeArray<byte> Employment => employment;
+        public NativeArray<ushort> District => district;
+        public NativeArray<byte> Alive => alive;
+        public NativeArray<int> ChunkLive => chunkLive;
+
+        public CitizenStore(int initialCapacity)
+        {
+            Reserve(Math.Max(1, initialCapacity));
+        }
+
+        public static int AgeBin(float years)
+        {
+            return Math.Min(MaxAge, Math.Max(0, (int)years));
+        }
+
+        #region Lifetime
+
+        public CitizenHandle Create(float years, int householdId, EmploymentStatus status, int districtId)
+        {
+            int index;
+            if (freeCount > 0)
+            {
+                index = freeList[--freeCount];
+            }
+            else
+            {
+                if (highWater == capacity) Reserve(capacity * 2);
+                index = highWater++;
+            }
+
+            age[index] = years;
+            household[index] = householdId;
+            employment[index] = (byte)status;
+            district[index] = (ushort)districtId;
+            alive[index] = 1;
+
+            int chunk = index / ChunkSize;
+            chunkLive[chunk] = chunkLive[chunk] + 1;
+            ageHistogram[AgeBin(years)]++;
+            count++;
+
+            return new CitizenHandle(index, version[index]);
+        }
+
+        public bool Destroy(CitizenHandle handle)
+        {
+            if (!IsAlive(handle)) return false;
+
+            DestroyAt(handle.index);
+            return true;
+        }
+
+        // For passes that work on slot indices; the slot must be alive
+        public void DestroyAt(int index)
+        {
+            alive[index] = 0;
+            version[index] = version[index] + 1;
+
+            int chunk = index / ChunkSize;
+            chunkLive[chunk] = chunkLive[chunk] - 1;
+            ageHistogram[AgeBin(age[index])]--;
+            count--;
+
+            freeList[freeCount++] = index;
+        }
+
+        public bool IsAlive(CitizenHandle handle)
+        {
+            return handle.index >= 0 && handle.index < highWater
+                && alive[handle.index] != 0 && version[handle.index] == handle.version;
+        }
+
+        public bool IsAliveAt(int index)
+        {
+            return index >= 0 && index < highWater && alive[index] != 0;
+        }
+
+        public CitizenHandle HandleAt(int index)
+        {
+            return IsAliveAt(index) ? new CitizenHandle(index, version[index]) : default;
+        }
+
+        #endregion
+
+        #region Fields
+
+        public float GetAge(CitizenHandle handle) => IsAlive(handle) ? age[handle.index] : 0f;
+        public int GetHousehold(CitizenHandle handle) => IsAlive(handle) ? household[handle.index] : -1;
+        public EmploymentStatus GetEmployment(CitizenHandle handle) => IsAlive(handle) ? (EmploymentStatus)employment[handle.index] : EmploymentStatus.Inactive;
+        public int GetDistrict(CitizenHandle handle) => IsAlive(handle) ? district[handle.index] : -1;
+
+        // Applies whole-year crossings counted by an ageing pass: crossings[y] moved from y to y + 1
+        public void ApplyAgeing(NativeArray<int> crossings, int offset)
+        {
+            for (int y = MaxAge - 1; y >= 0; y--)
+            {
+                int moved = crossings[offset + y];
+                if (moved == 0) continue;
+
+                ageHistogram[y] -= moved;
+                ageHistogram[y + 1] += moved;
+            }
+        }
+
+        #endregion
+
+        #region Storage
+
+        // Grows to whole chunks; existing slots keep their indices
+        public void Reserve(int minimumCapacity)
+        {
+            int chunks = (minimumCapacity + ChunkSize - 1) / ChunkSize;
+            int newCapacity = chunks * ChunkSize;
+            if (newCapacity <= capacity) return;
+
+            Grow(ref age, newCapacity);
+            Grow(ref household, newCapacity);
+            Grow(ref employment, newCapacity);
+            Grow(ref district, newCapacity);
+            Grow(ref alive, newCapacity);
+            Grow(ref version, newCapacity);
+            Grow(ref chunkLive, chunks);
+
+            // Versions start at 1 so a default handle never matches a slot
+            for (int i = capacity; i < newCapacity; i++) version[i] = 1;
+
+            var newFree = new int[newCapacity];
+            if (freeList != null) Array.Copy(freeList, newFree, freeCount);
+            freeList = newFree;
+            capacity = newCapacity;
+        }
+
+        private void Grow<T>(ref NativeArray<T> array, int length) where T : struct
+        {
+            var grown = new NativeArray<T>(length, Allocator.Persistent);
+            if (array.IsCreated)
+            {
+                NativeArray<T>.Copy(array, 0, grown, 0, array.Length);
+                array.Dispose();
+            }
+            array = grown;
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            disposed = true;
+
+            age.Dispose();
+            household.Dispose();
+            employment.Dispose();
+            district.Dispose();
+            alive.Dispose();
+            version.Dispose();
+            chunkLive.Dispose();
+        }
+
+        #endregion
+    }
+}
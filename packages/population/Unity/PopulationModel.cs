@@ -0,0 +1,53 @@
+using System.Collections.Generic;
+using UnitySim.Core;
+
+namespace UnitySim.Population
+{
+    // Aggregate population state and step logic with no MonoBehaviour, so it can run off the
+    // main thread. Used by batch sweeps and by PopulationSystem when citizens are not simulated.
+    public class PopulationModel : ISimulationModel
+    {
+        private static readonly SimulationChannel[] Channels = CreateChannels();
+
+        private readonly PopulationInfo state;
+        private Unity.Mathematics.Random random;
+
+        public PopulationInfo State => state;
+
+        public PopulationModel(uint seed) : this(new PopulationInfo(), seed)
+        {
+        }
+
+        public PopulationModel(PopulationInfo state, uint seed)
+        {
+            this.state = state ?? new PopulationInfo();
+            random = new Unity.Mathematics.Random(seed == 0 ? 1u : seed);
+        }
+
+        public static void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.AddInt(-10, 25));
+            channels.Add(SimulationChannel.Add(-0.2f, 0.2f));
+            channels.Add(SimulationChannel.Add(-0.1f, 0.1f));
+        }
+
+        public void Step(float deltaTime)
+        {
+            state.totalPopulation = (int)Channels[0].Step(state.totalPopulation, ref random);
+            state.birthRate = (float)Channels[1].Step(state.birthRate, ref random);
+            state.deathRate = (float)Channels[2].Step(state.deathRate, ref random);
+        }
+
+        public void WriteState(IStateWriter writer)
+        {
+            state.WriteState(writer, "population");
+        }
+
+        private static SimulationChannel[] CreateChannels()
+        {
+            var channels = new List<SimulationChannel>();
+            DescribeChannels(channels);
+            return channels.ToArray();
+        }
+    }
+}
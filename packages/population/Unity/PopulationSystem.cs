@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Population
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Population
 
         public PopulationData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             population = new PopulationInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (population != null)
+                population.WriteState(writer, "population");
+            else
+                writer.Write("population", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,99 @@ namespace UnitySim.Population
         public float lifeExpectancy = 78.5f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-population";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("totalPopulation", totalPopulation);
+            writer.Write("birthRate", birthRate);
+            writer.Write("deathRate", deathRate);
+            writer.Write("migrationRate", migrationRate);
+            writer.Write("ageGroups", ageGroups);
+            writer.Write("lifeExpectancy", lifeExpectancy);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public PopulationField Diff(PopulationInfo other)
+        {
+            var changed = PopulationField.None;
+            if (totalPopulation != other.totalPopulation) changed |= PopulationField.TotalPopulation;
+            if (birthRate != other.birthRate) changed |= PopulationField.BirthRate;
+            if (deathRate != other.deathRate) changed |= PopulationField.DeathRate;
+            if (migrationRate != other.migrationRate) changed |= PopulationField.MigrationRate;
+            if (ageGroups != other.ageGroups) changed |= PopulationField.AgeGroups;
+            if (lifeExpectancy != other.lifeExpectancy) changed |= PopulationField.LifeExpectancy;
+            if (systemHealth != other.systemHealth) changed |= PopulationField.SystemHealth;
+            if (framework != other.framework) changed |= PopulationField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(PopulationInfo target)
+        {
+            target.totalPopulation = totalPopulation;
+            target.birthRate = birthRate;
+            target.deathRate = deathRate;
+            target.migrationRate = migrationRate;
+            target.ageGroups = ageGroups;
+            target.lifeExpectancy = lifeExpectancy;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum PopulationField
+    {
+        None = 0,
+        TotalPopulation = 1 << 0,
+        BirthRate = 1 << 1,
+        DeathRate = 1 << 2,
+        MigrationRate = 1 << 3,
+        AgeGroups = 1 << 4,
+        LifeExpectancy = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct PopulationDelta
+    {
+        public readonly long timestamp;
+        public readonly PopulationField changed;
+        public readonly PopulationInfo values;
+
+        public PopulationDelta(long timestamp, PopulationField changed, PopulationInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(PopulationField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class PopulationSystem : MonoBehaviour
+    public class PopulationSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Population Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Citizens")]
+        public bool simulateCitizens = true;
+        public int initialCitizens = 1000000;
+        public float simulatedDaysPerSecond = 30f;
+        public float rateWindowYears = 1f;
+        public int randomSeed = 0;
+        public CitizenSettings citizenSettings = new CitizenSettings();
+        [SerializeField] private float lastStepMs = 0f;
+
         [Header("Current Data")]
         [SerializeField] private PopulationData currentData;
 
@@ -48,12 +148,20 @@ namespace UnitySim.Population
 
         // Events
         public System.Action<PopulationData> OnPopulationChanged;
+        public System.Action<PopulationDelta> OnPopulationDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.PopulationSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly PopulationInfo publishedInfo = new PopulationInfo();
+        private bool publishFullDelta = true;
+        private PopulationModel model;
+        private CitizenSimulation citizens;
 
         #region Unity Lifecycle
 
@@ -62,18 +170,22 @@ namespace UnitySim.Population
             InitializePopulation();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            citizens?.Dispose();
+            citizens = null;
         }
 
         #endregion
@@ -83,6 +195,19 @@ namespace UnitySim.Population
         private void InitializePopulation()
         {
             currentData = new PopulationData();
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            model = new PopulationModel(currentData.population, seed);
+
+            citizens?.Dispose();
+            citizens = null;
+            if (simulateCitizens)
+            {
+                citizens = new CitizenSimulation(citizenSettings, seed);
+                citizens.Populate(initialCitizens);
+                currentData.population.totalPopulation = citizens.Store.Count;
+                currentData.population.ageGroups = CitizenSimulation.AgeGroupStarts.Length;
+            }
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +218,46 @@ namespace UnitySim.Population
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.population.totalPopulation += UnityEngine.Random.Range(-10, 25);
-            currentData.population.birthRate += UnityEngine.Random.Range(-0.2f, 0.2f);
-            currentData.population.deathRate += UnityEngine.Random.Range(-0.1f, 0.1f);
+            if (citizens == null)
+            {
+                model.Step(deltaTime);
+                return;
+            }
+
+            float years = deltaTime * simulatedDaysPerSecond / 365.25f;
+            if (years <= 0f) return;
+
+            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+            citizens.Step(years);
+            lastStepMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+
+            // Rates are per 1000 people per year, smoothed because a single step sees few events
+            var info = currentData.population;
+            float perThousand = 1000f / Mathf.Max(1, citizens.Store.Count) / years;
+            float blend = 1f - Mathf.Exp(-years / Mathf.Max(0.01f, rateWindowYears));
+            info.totalPopulation = citizens.Store.Count;
+            info.birthRate = Mathf.Lerp(info.birthRate, citizens.Births * perThousand, blend);
+            info.deathRate = Mathf.Lerp(info.deathRate, citizens.Deaths * perThousand, blend);
+            info.migrationRate = Mathf.Lerp(info.migrationRate, (citizens.Immigrants - citizens.Emigrants) * perThousand, blend);
+            info.ageGroups = CitizenSimulation.AgeGroupStarts.Length;
+
+            // The life table needs some deaths at most ages before it means anything
+            if (citizens.SimulatedYears >= rateWindowYears)
+                info.lifeExpectancy = citizens.LifeExpectancy();
         }
 
         private void ProcessUpdate()
@@ -122,6 +270,12 @@ namespace UnitySim.Population
                 OnPopulationChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +283,67 @@ namespace UnitySim.Population
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.population;
+            var changed = publishFullDelta ? PopulationField.All : info.Diff(publishedInfo);
+            if (changed == PopulationField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnPopulationDelta?.Invoke(new PopulationDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(PopulationSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("PopulationSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +354,9 @@ namespace UnitySim.Population
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +377,17 @@ namespace UnitySim.Population
             return currentData;
         }
 
+        public CitizenSimulation GetCitizens()
+        {
+            return citizens;
+        }
+
+        // Citizens per CitizenSimulation.AgeGroupStarts bracket; empty without citizen simulation
+        public int[] GetAgeGroups()
+        {
+            return citizens != null ? citizens.AgeGroups : System.Array.Empty<int>();
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +419,7 @@ namespace UnitySim.Population
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +431,10 @@ namespace UnitySim.Population
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            initialCitizens = Mathf.Max(0, initialCitizens);
+            simulatedDaysPerSecond = Mathf.Max(0f, simulatedDaysPerSecond);
+            rateWindowYears = Mathf.Max(0.01f, rateWindowYears);
+            citizenSettings.districts = Mathf.Clamp(citizenSettings.districts, 1, ushort.MaxValue);
         }
 
         #endregion
@@ -218,7 +446,10 @@ namespace UnitySim.Population
             Debug.Log($"PopulationSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (citizens != null)
+                Debug.Log($"- Citizens: {citizens.Store.Count} in {citizens.Store.ChunkCount} chunks, last step {lastStepMs:F2}ms");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.ProceduralGeneration
 {
@@ -13,10 +17,22 @@ namespace UnitySim.ProceduralGeneration
 
         public ProceduralGenerationData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             proceduralgeneration = new ProceduralGenerationInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (proceduralgeneration != null)
+                proceduralgeneration.WriteState(writer, "proceduralgeneration");
+            else
+                writer.Write("proceduralgeneration", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,98 @@ namespace UnitySim.ProceduralGeneration
         public int landmarks = 8;
         public string systemHealth = "operational";
         public string framework = "unity-sim-procedural-generation";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("worldSize", worldSize);
+            writer.Write("biomes", biomes);
+            writer.Write("cities", cities);
+            writer.Write("roads", roads);
+            writer.Write("terrainHeight", terrainHeight);
+            writer.Write("landmarks", landmarks);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public ProceduralGenerationField Diff(ProceduralGenerationInfo other)
+        {
+            var changed = ProceduralGenerationField.None;
+            if (worldSize != other.worldSize) changed |= ProceduralGenerationField.WorldSize;
+            if (biomes != other.biomes) changed |= ProceduralGenerationField.Biomes;
+            if (cities != other.cities) changed |= ProceduralGenerationField.Cities;
+            if (roads != other.roads) changed |= ProceduralGenerationField.Roads;
+            if (terrainHeight != other.terrainHeight) changed |= ProceduralGenerationField.TerrainHeight;
+            if (landmarks != other.landmarks) changed |= ProceduralGenerationField.Landmarks;
+            if (systemHealth != other.systemHealth) changed |= ProceduralGenerationField.SystemHealth;
+            if (framework != other.framework) changed |= ProceduralGenerationField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(ProceduralGenerationInfo target)
+        {
+            target.worldSize = worldSize;
+            target.biomes = biomes;
+            target.cities = cities;
+            target.roads = roads;
+            target.terrainHeight = terrainHeight;
+            target.landmarks = landmarks;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
     }
 
-    public class ProceduralGenerationSystem : MonoBehaviour
+    [System.Flags]
+    public enum ProceduralGenerationField
+    {
+        None = 0,
+        WorldSize = 1 << 0,
+        Biomes = 1 << 1,
+        Cities = 1 << 2,
+        Roads = 1 << 3,
+        TerrainHeight = 1 << 4,
+        Landmarks = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct ProceduralGenerationDelta
+    {
+        public readonly long timestamp;
+        public readonly ProceduralGenerationField changed;
+        public readonly ProceduralGenerationInfo values;
+
+        public ProceduralGenerationDelta(long timestamp, ProceduralGenerationField changed, ProceduralGenerationInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(ProceduralGenerationField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class ProceduralGenerationSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("ProceduralGeneration Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("World")]
+        public WorldGenerationSettings world = new WorldGenerationSettings();
+        public float terrainHeight = 50f;
+        public bool useDiskCache = true;
+        public bool regenerateOnChange = true;
+        [SerializeField] private float lastGenerateMs = 0f;
+        [SerializeField] private int stagesRebuilt = 0;
+
         [Header("Current Data")]
         [SerializeField] private ProceduralGenerationData currentData;
 
@@ -48,12 +147,20 @@ namespace UnitySim.ProceduralGeneration
 
         // Events
         public System.Action<ProceduralGenerationData> OnProceduralGenerationChanged;
+        public System.Action<ProceduralGenerationDelta> OnProceduralGenerationDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.ProceduralGenerationSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly ProceduralGenerationInfo publishedInfo = new ProceduralGenerationInfo();
+        private bool publishFullDelta = true;
+        private WorldGenerationPipeline pipeline;
+        private bool worldDirty = false;
 
         #region Unity Lifecycle
 
@@ -62,18 +169,29 @@ namespace UnitySim.ProceduralGeneration
             InitializeProceduralGeneration();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void Update()
+        {
+            // Inspector edits regenerate from the first stage whose parameters changed
+            if (worldDirty && regenerateOnChange && pipeline != null)
+                GenerateWorld();
+        }
+
+        void OnDestroy()
+        {
+            pipeline?.Dispose();
+            pipeline = null;
         }
 
         #endregion
@@ -83,6 +201,11 @@ namespace UnitySim.ProceduralGeneration
         private void InitializeProceduralGeneration()
         {
             currentData = new ProceduralGenerationData();
+
+            pipeline?.Dispose();
+            pipeline = new WorldGenerationPipeline(useDiskCache ? System.IO.Path.Combine(Application.persistentDataPath, "WorldCache") : null);
+            GenerateWorld();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +216,52 @@ namespace UnitySim.ProceduralGeneration
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.proceduralgeneration.cities += UnityEngine.Random.Range(0, 1);
-            currentData.proceduralgeneration.roads += UnityEngine.Random.Range(1, 3);
-            currentData.proceduralgeneration.landmarks += UnityEngine.Random.Range(0, 2);
+            if (pipeline == null) return;
+
+            var info = currentData.proceduralgeneration;
+            info.worldSize = new Vector2Int(pipeline.Width, pipeline.Height);
+            info.biomes = pipeline.BiomeCount;
+            info.cities = pipeline.Settlements.Count;
+            info.roads = pipeline.Roads.Count;
+            info.terrainHeight = terrainHeight;
+            info.landmarks = pipeline.Landmarks.Count;
+        }
+
+        private WorldGenerationReport GenerateWorld()
+        {
+            worldDirty = false;
+            if (pipeline == null) return default;
+
+            try
+            {
+                var report = pipeline.Generate(world);
+                lastGenerateMs = report.totalMs;
+                stagesRebuilt = WorldGenerationPipeline.StageCount - report.Count(WorldStageSource.Memory);
+
+                if (enableLogging)
+                    Debug.Log($"ProceduralGenerationSystem: World {pipeline.Width}x{pipeline.Height} ready in {report.totalMs:F0}ms ({report.Count(WorldStageSource.Generated)} generated, {report.Count(WorldStageSource.Disk)} from cache)");
+
+                return report;
+            }
+            catch (System.Exception e)
+            {
+                Debug.LogError($"ProceduralGenerationSystem: World generation failed - {e.Message}");
+                return default;
+            }
         }
 
         private void ProcessUpdate()
@@ -122,6 +274,12 @@ namespace UnitySim.ProceduralGeneration
                 OnProceduralGenerationChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +287,67 @@ namespace UnitySim.ProceduralGeneration
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.proceduralgeneration;
+            var changed = publishFullDelta ? ProceduralGenerationField.All : info.Diff(publishedInfo);
+            if (changed == ProceduralGenerationField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnProceduralGenerationDelta?.Invoke(new ProceduralGenerationDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(ProceduralGenerationSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("ProceduralGenerationSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +358,9 @@ namespace UnitySim.ProceduralGeneration
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +381,22 @@ namespace UnitySim.ProceduralGeneration
             return currentData;
         }
 
+        public WorldGenerationPipeline GetWorld()
+        {
+            return pipeline;
+        }
+
+        // Reruns the pipeline now; unchanged stages are reused, so this is cheap after small edits
+        public WorldGenerationReport Regenerate()
+        {
+            return GenerateWorld();
+        }
+
+        public float GetTerrainHeight(Vector2Int cell)
+        {
+            return pipeline != null ? pipeline.GetHeight(cell) * terrainHeight : 0f;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +428,7 @@ namespace UnitySim.ProceduralGeneration
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +440,14 @@ namespace UnitySim.ProceduralGeneration
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            world.size = Vector2Int.Max(new Vector2Int(16, 16), world.size);
+            world.octaves = Mathf.Clamp(world.octaves, 1, 12);
+            world.featureSize = Mathf.Max(1f, world.featureSize);
+            world.moistureFeatureSize = Mathf.Max(1f, world.moistureFeatureSize);
+            world.settlementCount = Mathf.Max(0, world.settlementCount);
+            world.landmarkCount = Mathf.Max(0, world.landmarkCount);
+            world.roadCellSize = Mathf.Max(1, world.roadCellSize);
+            worldDirty = true;
         }
 
         #endregion
@@ -218,7 +459,10 @@ namespace UnitySim.ProceduralGeneration
             Debug.Log($"ProceduralGenerationSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (pipeline != null)
+                Debug.Log($"- World: {pipeline.Width}x{pipeline.Height}, {pipeline.BiomeCount} biomes, {pipeline.Settlements.Count} settlements, {pipeline.Roads.Count} roads, {pipeline.Landmarks.Count} landmarks, last build {lastGenerateMs:F0}ms ({stagesRebuilt} stages rebuilt)");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -0,0 +1,1192 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+using UnityEngine;
+
+namespace UnitySim.ProceduralGeneration
+{
+    public enum WorldStage
+    {
+        Heightmap,
+        Biomes,
+        Settlements,
+        Roads,
+        Landmarks
+    }
+
+    public enum WorldStageSource
+    {
+        Memory,
+        Disk,
+        Generated
+    }
+
+    public enum Biome : byte
+    {
+        Ocean,
+        Beach,
+        Desert,
+        Grassland,
+        Forest,
+        Rainforest,
+        Tundra,
+        Mountain,
+        Snow
+    }
+
+    public enum LandmarkKind : byte
+    {
+        Peak,
+        Oasis,
+        Ruins,
+        Lighthouse,
+        Monument
+    }
+
+    [System.Serializable]
+    public class WorldGenerationSettings
+    {
+        public int seed = 12345;
+        public Vector2Int size = new Vector2Int(1024, 1024);
+
+        [Header("Heightmap")]
+        public float featureSize = 512f;
+        public int octaves = 6;
+        public float persistence = 0.5f;
+        public float lacunarity = 2f;
+        public float edgeFalloff = 0.6f;
+
+        [Header("Biomes")]
+        public float seaLevel = 0.45f;
+        public float mountainLevel = 0.72f;
+        public float snowLevel = 0.86f;
+        public float moistureFeatureSize = 384f;
+
+        [Header("Settlements")]
+        public int settlementCount = 24;
+        public float settlementSpacing = 160f;
+
+        [Header("Roads")]
+        public int roadCellSize = 8;
+        public float slopeCost = 60f;
+        public float waterCost = 40f;
+
+        [Header("Landmarks")]
+        public int landmarkCount = 16;
+        public float landmarkSpacing = 128f;
+    }
+
+    public struct WorldSettlement
+    {
+        public Vector2Int cell;
+        public int population;
+        public float suitability;
+    }
+
+    public struct WorldLandmark
+    {
+        public Vector2Int cell;
+        public LandmarkKind kind;
+        public float score;
+    }
+
+    public class WorldRoad
+    {
+        public int from;
+        public int to;
+
+        // World cells along the route, one per road-grid cell
+        public readonly List<Vector2Int> points = new List<Vector2Int>();
+    }
+
+    public struct WorldGenerationReport
+    {
+        public WorldStageSource[] sources;
+        public float[] stageMs;
+        public float totalMs;
+
+        public int Count(WorldStageSource source)
+        {
+            if (sources == null) return 0;
+
+            int count = 0;
+            for (int i = 0; i < sources.Length; i++) if (sources[i] == source) count++;
+            return count;
+        }
+    }
+
+    // Builds a world in five stages: heightmap, biomes, settlements, road network, landmarks.
+    // Each stage's key hashes its own parameters with the previous stage's key, so a change
+    // invalidates only that stage and the ones after it. Stages whose key is unchanged keep
+    // their output in memory; others are loaded from the disk cache when present and
+    // regenerated otherwise. Per-cell and per-block work runs as parallel Burst jobs, and the
+    // small selection passes that must be ordered run on the main thread.
+    public class WorldGenerationPipeline : IDisposable
+    {
+        public const int StageCount = 5;
+
+        // Bump when a stage's algorithm changes so old cache entries stop matching
+        private const int AlgorithmVersion = 1;
+        private const int SiteBlock = 64;
+        private const int SiteStride = 4;
+
+        private readonly WorldStageCache cache;
+        private readonly ulong[] stageKeys = new ulong[StageCount];
+
+        private int width;
+        private int height;
+        private NativeArray<float> heights;
+        private NativeArray<byte> biomes;
+        private int biomeMask;
+        private readonly List<WorldSettlement> settlements = new List<WorldSettlement>();
+        private readonly List<WorldRoad> roads = new List<WorldRoad>();
+        private readonly List<WorldLandmark> landmarks = new List<WorldLandmark>();
+        private bool disposed = false;
+
+        public int Width => width;
+        public int Height => height;
+        public NativeArray<float> Heights => heights;
+        public NativeArray<byte> Biomes => biomes;
+        public IReadOnlyList<WorldSettlement> Settlements => settlements;
+        public IReadOnlyList<WorldRoad> Roads => roads;
+        public IReadOnlyList<WorldLandmark> Landmarks => landmarks;
+        public WorldStageCache Cache => cache;
+
+        // Number of distinct biomes present in the current world
+        public int BiomeCount
+        {
+            get
+            {
+                int count = 0;
+                for (int mask = biomeMask; mask != 0; mask &= mask - 1) count++;
+                return count;
+            }
+        }
+
+        // Pass null to keep stage outputs in memory only
+        public WorldGenerationPipeline(string cacheDirectory)
+        {
+            cache = string.IsNullOrEmpty(cacheDirectory) ? null : new WorldStageCache(cacheDirectory);
+        }
+
+        public ulong StageKey(WorldStage stage) => stageKeys[(int)stage];
+
+        #region Generation
+
+        public WorldGenerationReport Generate(WorldGenerationSettings settings)
+        {
+            ThrowIfDisposed();
+            if (settings == null) throw new ArgumentNullException(nameof(settings));
+
+            var report = new WorldGenerationReport
+            {
+                sources = new WorldStageSource[StageCount],
+                stageMs = new float[StageCount]
+            };
+            var total = Stopwatch.StartNew();
+
+            ulong key = 0;
+            for (int i = 0; i < StageCount; i++)
+            {
+                var stage = (WorldStage)i;
+                key = ComputeKey(stage, settings, key);
+
+                var stopwatch = Stopwatch.StartNew();
+                report.sources[i] = RunStage(stage, settings, key);
+                report.stageMs[i] = (float)stopwatch.Elapsed.TotalMilliseconds;
+            }
+
+            report.totalMs = (float)total.Elapsed.TotalMilliseconds;
+            return report;
+        }
+
+        private WorldStageSource RunStage(WorldStage stage, WorldGenerationSettings settings, ulong key)
+        {
+            if (stageKeys[(int)stage] == key) return WorldStageSource.Memory;
+
+            // Anything downstream was built on the old output and must not be reused
+            for (int i = (int)stage; i < StageCount; i++) stageKeys[i] = 0;
+
+            if (stage == WorldStage.Heightmap) Allocate(Math.Max(16, settings.size.x), Math.Max(16, settings.size.y));
+
+            var source = WorldStageSource.Disk;
+            if (cache == null || !cache.TryLoad(stage, key, reader => Read(stage, reader)))
+            {
+                Build(stage, settings);
+                cache?.Save(stage, key, writer => Write(stage, writer));
+                source = WorldStageSource.Generated;
+            }
+
+            stageKeys[(int)stage] = key;
+            return source;
+        }
+
+        private void Build(WorldStage stage, WorldGenerationSettings settings)
+        {
+            switch (stage)
+            {
+                case WorldStage.Heightmap: BuildHeightmap(settings); break;
+                case WorldStage.Biomes: BuildBiomes(settings); break;
+                case WorldStage.Settlements: BuildSettlements(settings); break;
+                case WorldStage.Roads: BuildRoads(settings); break;
+                case WorldStage.Landmarks: BuildLandmarks(settings); break;
+            }
+        }
+
+        private void Allocate(int newWidth, int newHeight)
+        {
+            if (heights.IsCreated && newWidth == width && newHeight == height) return;
+
+            if (heights.IsCreated) heights.Dispose();
+            if (biomes.IsCreated) biomes.Dispose();
+
+            width = newWidth;
+            height = newHeight;
+            heights = new NativeArray<float>(width * height, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+            biomes = new NativeArray<byte>(width * height, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+        }
+
+        #endregion
+
+        #region Stage Keys
+
+        private static ulong ComputeKey(WorldStage stage, WorldGenerationSettings s, ulong upstream)
+        {
+            var hash = new StageHash(upstream);
+            hash.Add((int)stage);
+            hash.Add(AlgorithmVersion);
+
+            switch (stage)
+            {
+                case WorldStage.Heightmap:
+                    hash.Add(s.seed);
+                    hash.Add(s.size.x);
+                    hash.Add(s.size.y);
+                    hash.Add(s.featureSize);
+                    hash.Add(s.octaves);
+                    hash.Add(s.persistence);
+                    hash.Add(s.lacunarity);
+                    hash.Add(s.edgeFalloff);
+                    break;
+                case WorldStage.Biomes:
+                    hash.Add(s.seaLevel);
+                    hash.Add(s.mountainLevel);
+                    hash.Add(s.snowLevel);
+                    hash.Add(s.moistureFeatureSize);
+                    break;
+                case WorldStage.Settlements:
+                    hash.Add(s.settlementCount);
+                    hash.Add(s.settlementSpacing);
+                    break;
+                case WorldStage.Roads:
+                    hash.Add(s.roadCellSize);
+                    hash.Add(s.slopeCost);
+                    hash.Add(s.waterCost);
+                    break;
+                case WorldStage.Landmarks:
+                    hash.Add(s.landmarkCount);
+                    hash.Add(s.landmarkSpacing);
+                    break;
+            }
+
+            // Zero means "nothing cached" in stageKeys
+            return hash.Value != 0 ? hash.Value : 1;
+        }
+
+        // FNV-1a over the raw bits of each value
+        private struct StageHash
+        {
+            public ulong Value;
+
+            public StageHash(ulong seed)
+            {
+                Value = 14695981039346656037UL ^ seed;
+            }
+
+            public void Add(int value)
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    Value ^= (byte)(value >> (i * 8));
+                    Value *= 1099511628211UL;
+                }
+            }
+
+            public void Add(float value)
+            {
+                Add(BitConverter.SingleToInt32Bits(value));
+            }
+        }
+
+        #endregion
+
+        #region Heightmap and Biomes
+
+        private void BuildHeightmap(WorldGenerationSettings s)
+        {
+            new HeightmapJob
+            {
+                width = width,
+                height = height,
+                frequency = 1f / Math.Max(1f, s.featureSize),
+                octaves = Math.Max(1, Math.Min(12, s.octaves)),
+                persistence = s.persistence,
+                lacunarity = Math.Max(1f, s.lacunarity),
+                edgeFalloff = Mathf.Clamp01(s.edgeFalloff),
+                offset = SeedOffset(s.seed, 0),
+                heights = heights
+            }.Schedule(height, 8).Complete();
+        }
+
+        private void BuildBiomes(WorldGenerationSettings s)
+        {
+            var rowMasks = new NativeArray<int>(height, Allocator.TempJob);
+
+            new BiomeJob
+            {
+                width = width,
+                height = height,
+                seaLevel = s.seaLevel,
+                mountainLevel = s.mountainLevel,
+                snowLevel = s.snowLevel,
+                moistureFrequency = 1f / Math.Max(1f, s.moistureFeatureSize),
+                offset = SeedOffset(s.seed, 1),
+                heights = heights,
+                biomes = biomes,
+                rowMasks = rowMasks
+            }.Schedule(height, 8).Complete();
+
+            biomeMask = 0;
+            for (int y = 0; y < height; y++) biomeMask |= rowMasks[y];
+            rowMasks.Dispose();
+        }
+
+        #endregion
+
+        #region Settlements
+
+        private struct SiteCandidate
+        {
+            public int cell;
+            public float score;
+            public byte kind;
+        }
+
+        private void BuildSettlements(WorldGenerationSettings s)
+        {
+            var candidates = ScoreBlocks(s, false);
+            settlements.Clear();
+
+            float spacing = Math.Max(1f, s.settlementSpacing);
+            for (int i = 0; i < candidates.Count && settlements.Count < s.settlementCount; i++)
+            {
+                var cell = CellOf(candidates[i].cell);
+                if (!FarFromAll(cell, spacing, settlements)) continue;
+
+                // The first pick is the capital; size falls off with rank and with site quality
+                int rank = settlements.Count;
+                int population = (int)(2000 + 250000 * candidates[i].score / (1 + rank * 0.5f));
+                settlements.Add(new WorldSettlement { cell = cell, population = population, suitability = candidates[i].score });
+            }
+        }
+
+        private List<SiteCandidate> ScoreBlocks(WorldGenerationSettings s, bool landmarkSites)
+        {
+            int blocksX = (width + SiteBlock - 1) / SiteBlock;
+            int blocksY = (height + SiteBlock - 1) / SiteBlock;
+            var best = new NativeArray<SiteCandidate>(blocksX * blocksY, Allocator.TempJob);
+
+            new SiteJob
+            {
+                width = width,
+                height = height,
+                blocksX = blocksX,
+                seed = (uint)s.seed,
+                seaLevel = s.seaLevel,
+                landmarks = landmarkSites,
+                heights = heights,
+                biomes = biomes,
+                best = best
+            }.Schedule(best.Length, 4).Complete();
+
+            var candidates = new List<SiteCandidate>(best.Length);
+            for (int i = 0; i < best.Length; i++)
+            {
+                if (best[i].score > 0f) candidates.Add(best[i]);
+            }
+            best.Dispose();
+
+            // Cell index breaks ties so the order never depends on the job schedule
+            candidates.Sort((a, b) => a.score != b.score ? b.score.CompareTo(a.score) : a.cell.CompareTo(b.cell));
+            return candidates;
+        }
+
+        #endregion
+
+        #region Roads
+
+        private void BuildRoads(WorldGenerationSettings s)
+        {
+            roads.Clear();
+            if (settlements.Count < 2) return;
+
+            int cellSize = Math.Max(1, s.roadCellSize);
+            int gridWidth = (width + cellSize - 1) / cellSize;
+            int gridHeight = (height + cellSize - 1) / cellSize;
+            int gridCells = gridWidth * gridHeight;
+
+            var edges = SpanningTree();
+            int workers = Math.Max(1, Math.Min(edges.Count, Environment.ProcessorCount));
+            int maxPathLength = 4 * (gridWidth + gridHeight);
+
+            var costs = new NativeArray<float>(gridCells, Allocator.TempJob, NativeArrayOptions.UninitializedMemory);
+            var routes = new NativeArray<int2>(edges.Count, Allocator.TempJob);
+            var lengths = new NativeArray<int>(edges.Count, Allocator.TempJob);
+            var paths = new NativeArray<int>(edges.Count * maxPathLength, Allocator.TempJob, NativeArrayOptions.UninitializedMemory);
+            var gScore = new NativeArray<float>(workers * gridCells, Allocator.TempJob, NativeArrayOptions.UninitializedMemory);
+            var parent = new NativeArray<int>(workers * gridCells, Allocator.TempJob, NativeArrayOptions.UninitializedMemory);
+            var stamp = new NativeArray<int>(workers * gridCells, Allocator.TempJob);
+            var heapPosition = new NativeArray<int>(workers * gridCells, Allocator.TempJob, NativeArrayOptions.UninitializedMemory);
+            var heap = new NativeArray<int>(workers * gridCells, Allocator.TempJob, NativeArrayOptions.UninitializedMemory);
+
+            for (int i = 0; i < edges.Count; i++)
+            {
+                var a = settlements[edges[i].x].cell;
+                var b = settlements[edges[i].y].cell;
+                routes[i] = new int2(a.x / cellSize + a.y / cellSize * gridWidth, b.x / cellSize + b.y / cellSize * gridWidth);
+            }
+
+            var costHandle = new RoadCostJob
+            {
+                width = width,
+                height = height,
+                cellSize = cellSize,
+                gridWidth = gridWidth,
+                slopeCost = s.slopeCost,
+                waterCost = s.waterCost,
+                heights = heights,
+                biomes = biomes,
+                costs = costs
+            }.Schedule(gridHeight, 8);
+
+            var routeJob = new RouteJob
+            {
+                gridWidth = gridWidth,
+                gridHeight = gridHeight,
+                workers = workers,
+                maxPathLength = maxPathLength,
+                costs = costs,
+                routes = routes,
+                lengths = lengths,
+                paths = paths,
+                gScore = gScore,
+                parent = parent,
+                stamp = stamp,
+                heapPosition = heapPosition,
+                heap = heap
+            };
+            routeJob.Schedule(workers, 1, costHandle).Complete();
+
+            // Winding routes can outgrow the buffer; lengths then hold the full path length, so
+            // rerun once with room for the longest instead of keeping a route cut off at its start
+            int longest = 0;
+            for (int i = 0; i < edges.Count; i++) longest = Math.Max(longest, lengths[i]);
+            if (longest > maxPathLength)
+            {
+                maxPathLength = longest;
+                paths.Dispose();
+                paths = new NativeArray<int>(edges.Count * maxPathLength, Allocator.TempJob, NativeArrayOptions.UninitializedMemory);
+
+                routeJob.maxPathLength = maxPathLength;
+                routeJob.paths = paths;
+                routeJob.firstGeneration = edges.Count;
+                routeJob.Schedule(workers, 1).Complete();
+            }
+
+            for (int i = 0; i < edges.Count; i++)
+            {
+                var road = new WorldRoad { from = edges[i].x, to = edges[i].y };
+                int offset = i * maxPathLength;
+                for (int p = 0; p < lengths[i]; p++)
+                {
+                    int cell = paths[offset + p];
+                    road.points.Add(new Vector2Int(
+                        Math.Min(width - 1, cell % gridWidth * cellSize + cellSize / 2),
+                        Math.Min(height - 1, cell / gridWidth * cellSize + cellSize / 2)));
+                }
+                roads.Add(road);
+            }
+
+            costs.Dispose();
+            routes.Dispose();
+            lengths.Dispose();
+            paths.Dispose();
+            gScore.Dispose();
+            parent.Dispose();
+            stamp.Dispose();
+            heapPosition.Dispose();
+            heap.Dispose();
+        }
+
+        // Prim's minimum spanning tree over straight-line distance; settlements are few
+        private List<int2> SpanningTree()
+        {
+            int count = settlements.Count;
+            var edges = new List<int2>(count - 1);
+            var inTree = new bool[count];
+            var bestDistance = new float[count];
+            var bestFrom = new int[count];
+
+            for (int i = 0; i < count; i++) bestDistance[i] = float.MaxValue;
+            bestDistance[0] = 0f;
+
+            for (int added = 0; added < count; added++)
+            {
+                int next = -1;
+                for (int i = 0; i < count; i++)
+                {
+                    if (!inTree[i] && (next < 0 || bestDistance[i] < bestDistance[next])) next = i;
+                }
+
+                inTree[next] = true;
+                if (added > 0) edges.Add(new int2(bestFrom[next], next));
+
+                for (int i = 0; i < count; i++)
+                {
+                    if (inTree[i]) continue;
+                    float distance = Vector2Int.Distance(settlements[next].cell, settlements[i].cell);
+                    if (distance < bestDistance[i])
+                    {
+                        bestDistance[i] = distance;
+                        bestFrom[i] = next;
+                    }
+                }
+            }
+            return edges;
+        }
+
+        #endregion
+
+        #region Landmarks
+
+        private void BuildLandmarks(WorldGenerationSettings s)
+        {
+            var candidates = ScoreBlocks(s, true);
+            landmarks.Clear();
+
+            float spacing = Math.Max(1f, s.landmarkSpacing);
+            for (int i = 0; i < candidates.Count && landmarks.Count < s.landmarkCount; i++)
+            {
+                var cell = CellOf(candidates[i].cell);
+                if (!FarFromAll(cell, spacing, landmarks)) continue;
+
+                // Landmarks sit out in the wilds rather than inside towns
+                if (!FarFromAll(cell, spacing * 0.5f, settlements)) continue;
+
+                landmarks.Add(new WorldLandmark { cell = cell, kind = (LandmarkKind)candidates[i].kind, score = candidates[i].score });
+            }
+        }
+
+        #endregion
+
+        #region Serialization
+
+        private void Write(WorldStage stage, BinaryWriter writer)
+        {
+            switch (stage)
+            {
+                case WorldStage.Heightmap:
+                    cache.WriteArray(writer, heights, sizeof(float));
+                    break;
+                case WorldStage.Biomes:
+                    writer.Write(biomeMask);
+                    cache.WriteArray(writer, biomes, sizeof(byte));
+                    break;
+                case WorldStage.Settlements:
+                    writer.Write(settlements.Count);
+                    foreach (var settlement in settlements)
+                    {
+                        writer.Write(settlement.cell.x);
+                        writer.Write(settlement.cell.y);
+                        writer.Write(settlement.population);
+                        writer.Write(settlement.suitability);
+                    }
+                    break;
+                case WorldStage.Roads:
+                    writer.Write(roads.Count);
+                    foreach (var road in roads)
+                    {
+                        writer.Write(road.from);
+                        writer.Write(road.to);
+                        writer.Write(road.points.Count);
+                        foreach (var point in road.points)
+                        {
+                            writer.Write(point.x);
+                            writer.Write(point.y);
+                        }
+                    }
+                    break;
+                case WorldStage.Landmarks:
+                    writer.Write(landmarks.Count);
+                    foreach (var landmark in landmarks)
+                    {
+                        writer.Write(landmark.cell.x);
+                        writer.Write(landmark.cell.y);
+                        writer.Write((byte)landmark.kind);
+                        writer.Write(landmark.score);
+                    }
+                    break;
+            }
+        }
+
+        private void Read(WorldStage stage, BinaryReader reader)
+        {
+            switch (stage)
+            {
+                case WorldStage.Heightmap:
+                    cache.ReadArray(reader, heights, sizeof(float));
+                    break;
+                case WorldStage.Biomes:
+                    biomeMask = reader.ReadInt32();
+                    cache.ReadArray(reader, biomes, sizeof(byte));
+                    break;
+                case WorldStage.Settlements:
+                    settlements.Clear();
+                    for (int i = reader.ReadInt32(); i > 0; i--)
+                    {
+                        settlements.Add(new WorldSettlement
+                        {
+                            cell = new Vector2Int(reader.ReadInt32(), reader.ReadInt32()),
+                            population = reader.ReadInt32(),
+                            suitability = reader.ReadSingle()
+                        });
+                    }
+                    break;
+                case WorldStage.Roads:
+                    roads.Clear();
+                    for (int i = reader.ReadInt32(); i > 0; i--)
+                    {
+                        var road = new WorldRoad { from = reader.ReadInt32(), to = reader.ReadInt32() };
+                        for (int p = reader.ReadInt32(); p > 0; p--)
+                        {
+                            road.points.Add(new Vector2Int(reader.ReadInt32(), reader.ReadInt32()));
+                        }
+                        roads.Add(road);
+                    }
+                    break;
+                case WorldStage.Landmarks:
+                    landmarks.Clear();
+                    for (int i = reader.ReadInt32(); i > 0; i--)
+                    {
+                        landmarks.Add(new WorldLandmark
+                        {
+                            cell = new Vector2Int(reader.ReadInt32(), reader.ReadInt32()),
+                            kind = (LandmarkKind)reader.ReadByte(),
+                            score = reader.ReadSingle()
+                        });
+                    }
+                    break;
+            }
+        }
+
+        #endregion
+
+        #region Helpers
+
+        public float GetHeight(Vector2Int cell)
+        {
+            if (!heights.IsCreated || cell.x < 0 || cell.y < 0 || cell.x >= width || cell.y >= height) return 0f;
+            return heights[cell.x + cell.y * width];
+        }
+
+        public Biome GetBiome(Vector2Int cell)
+        {
+            if (!biomes.IsCreated || cell.x < 0 || cell.y < 0 || cell.x >= width || cell.y >= height) return Biome.Ocean;
+            return (Biome)biomes[cell.x + cell.y * width];
+        }
+
+        private Vector2Int CellOf(int index)
+        {
+            return new Vector2Int(index % width, index / width);
+        }
+
+        private static bool FarFromAll(Vector2Int cell, float spacing, List<WorldSettlement> placed)
+        {
+            for (int i = 0; i < placed.Count; i++)
+            {
+                if (Vector2Int.Distance(cell, placed[i].cell) < spacing) return false;
+            }
+            return true;
+        }
+
+        private static bool FarFromAll(Vector2Int cell, float spacing, List<WorldLandmark> placed)
+        {
+            for (int i = 0; i < placed.Count; i++)
+            {
+                if (Vector2Int.Distance(cell, placed[i].cell) < spacing) return false;
+            }
+            return true;
+        }
+
+        private static float2 SeedOffset(int seed, uint stream)
+        {
+            var random = new Unity.Mathematics.Random(math.hash(new uint3((uint)seed, stream, 0x9E3779B9u)) | 1u);
+            return random.NextFloat2(new float2(-10000f, -10000f), new float2(10000f, 10000f));
+        }
+
+        private void ThrowIfDisposed()
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(WorldGenerationPipeline));
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            disposed = true;
+
+            if (heights.IsCreated) heights.Dispose();
+            if (biomes.IsCreated) biomes.Dispose();
+        }
+
+        #endregion
+
+        #region Jobs
+
+        // One row per index; fBm of simplex noise, pulled down toward the map edge
+        [BurstCompile(FloatMode = FloatMode.Fast)]
+        private struct HeightmapJob : IJobParallelFor
+        {
+            public int width;
+            public int height;
+            public float frequency;
+            public int octaves;
+            public float persistence;
+            public float lacunarity;
+            public float edgeFalloff;
+            public float2 offset;
+
+            [NativeDisableParallelForRestriction]
+            [WriteOnly] public NativeArray<float> heights;
+
+            public void Execute(int y)
+            {
+                float amplitudeSum = 0f;
+                float amplitude = 1f;
+                for (int o = 0; o < octaves; o++)
+                {
+                    amplitudeSum += amplitude;
+                    amplitude *= persistence;
+                }
+
+                float ny = 2f * y / math.max(1, height - 1) - 1f;
+                int row = y * width;
+                for (int x = 0; x < width; x++)
+                {
+                    float n = Fbm(new float2(x, y) * frequency + offset, octaves, persistence, lacunarity) / amplitudeSum;
+                    float h = 0.5f + 0.5f * n;
+
+                    float nx = 2f * x / math.max(1, width - 1) - 1f;
+                    float edge = math.max(math.abs(nx), math.abs(ny));
+                    h = math.lerp(h, h * (1f - edge * edge * edge), edgeFalloff);
+
+                    heights[row + x] = math.saturate(h);
+                }
+            }
+        }
+
+        // One row per index; temperature from latitude and altitude, moisture from a second noise field
+        [BurstCompile(FloatMode = FloatMode.Fast)]
+        private struct BiomeJob : IJobParallelFor
+        {
+            public int width;
+            public int height;
+            public float seaLevel;
+            public float mountainLevel;
+            public float snowLevel;
+            public float moistureFrequency;
+            public float2 offset;
+
+            [ReadOnly] public NativeArray<float> heights;
+
+            [NativeDisableParallelForRestriction]
+            [WriteOnly] public NativeArray<byte> biomes;
+
+            [WriteOnly] public NativeArray<int> rowMasks;
+
+            public void Execute(int y)
+            {
+                float latitude = 1f - math.abs(2f * y / math.max(1, height - 1) - 1f);
+                int row = y * width;
+                int mask = 0;
+
+                for (int x = 0; x < width; x++)
+                {
+                    float h = heights[row + x];
+                    Biome biome;
+
+                    if (h < seaLevel) biome = Biome.Ocean;
+                    else if (h < seaLevel + 0.015f) biome = Biome.Beach;
+                    else if (h >= snowLevel) biome = Biome.Snow;
+                    else if (h >= mountainLevel) biome = Biome.Mountain;
+                    else
+                    {
+                        float temperature = latitude - (h - seaLevel) * 1.2f;
+                        float moisture = 0.5f + 0.5f * Fbm(new float2(x, y) * moistureFrequency + offset, 3, 0.5f, 2f) / 1.75f;
+
+                        if (temperature < 0.2f) biome = Biome.Tundra;
+                        else if (moisture < 0.35f) biome = temperature > 0.55f ? Biome.Desert : Biome.Grassland;
+                        else if (moisture < 0.6f) biome = Biome.Grassland;
+                        else biome = temperature > 0.65f ? Biome.Rainforest : Biome.Forest;
+                    }
+
+                    biomes[row + x] = (byte)biome;
+                    mask |= 1 << (int)biome;
+                }
+
+                rowMasks[y] = mask;
+            }
+        }
+
+        // Best site per 64x64 block, sampled every few cells. Settlements want flat, temperate
+        // land near the coast; landmarks want peaks and the odd spot in each biome.
+        [BurstCompile(FloatMode = FloatMode.Fast)]
+        private struct SiteJob : IJobParallelFor
+        {
+            public int width;
+            public int height;
+            public int blocksX;
+            public uint seed;
+            public float seaLevel;
+            public bool landmarks;
+
+            [ReadOnly] public NativeArray<float> heights;
+            [ReadOnly] public NativeArray<byte> biomes;
+
+            [WriteOnly] public NativeArray<SiteCandidate> best;
+
+            public void Execute(int block)
+            {
+                int x0 = block % blocksX * SiteBlock;
+                int y0 = block / blocksX * SiteBlock;
+                int x1 = math.min(width - 8, x0 + SiteBlock);
+                int y1 = math.min(height - 8, y0 + SiteBlock);
+
+                var result = new SiteCandidate { cell = -1, score = 0f };
+                for (int y = math.max(8, y0); y < y1; y += SiteStride)
+                {
+                    for (int x = math.max(8, x0); x < x1; x += SiteStride)
+                    {
+                        int cell = x + y * width;
+                        float jitter = math.hash(new uint3((uint)cell, seed, landmarks ? 2u : 1u)) / (float)uint.MaxValue;
+                        byte kind = 0;
+                        float score = landmarks ? LandmarkScore(cell, jitter, out kind) : SettlementScore(x, y, cell, jitter);
+
+                        if (score > result.score)
+                        {
+                            result.cell = cell;
+                            result.score = score;
+                            result.kind = kind;
+                        }
+                    }
+                }
+
+                best[block] = result;
+            }
+
+            private float SettlementScore(int x, int y, int cell, float jitter)
+            {
+                float weight;
+                switch ((Biome)biomes[cell])
+                {
+                    case Biome.Grassland: weight = 1f; break;
+                    case Biome.Forest: weight = 0.7f; break;
+                    case Biome.Beach: weight = 0.6f; break;
+                    case Biome.Rainforest: weight = 0.45f; break;
+                    case Biome.Desert: weight = 0.3f; break;
+                    case Biome.Tundra: weight = 0.25f; break;
+                    default: return 0f;
+                }
+
+                float slope = math.abs(heights[cell + 2] - heights[cell - 2]) + math.abs(heights[cell + 2 * width] - heights[cell - 2 * width]);
+                float flatness = math.saturate(1f - slope * 40f);
+
+                // Harbours: any sea within eight cells
+                bool coastal = heights[cell + 8] < seaLevel || heights[cell - 8] < seaLevel
+                    || heights[cell + 8 * width] < seaLevel || heights[cell - 8 * width] < seaLevel;
+
+                return weight * flatness * (coastal ? 1.35f : 1f) + jitter * 0.01f;
+            }
+
+            private float LandmarkScore(int cell, float jitter, out byte kind)
+            {
+                switch ((Biome)biomes[cell])
+                {
+                    case Biome.Snow:
+                    case Biome.Mountain:
+                        kind = (byte)LandmarkKind.Peak;
+                        return 0.5f + heights[cell] - seaLevel;
+                    case Biome.Desert:
+                        kind = (byte)LandmarkKind.Oasis;
+                        return 0.4f + jitter * 0.3f;
+                    case Biome.Forest:
+                    case Biome.Rainforest:
+                        kind = (byte)LandmarkKind.Ruins;
+                        return 0.3f + jitter * 0.3f;
+                    case Biome.Beach:
+                        kind = (byte)LandmarkKind.Lighthouse;
+                        return 0.35f + jitter * 0.3f;
+                    case Biome.Grassland:
+                    case Biome.Tundra:
+                        kind = (byte)LandmarkKind.Monument;
+                        return 0.2f + jitter * 0.3f;
+                    default:
+                        kind = 0;
+                        return 0f;
+                }
+            }
+        }
+
+        // Travel cost per road-grid cell: slope makes roads wind, water needs bridges
+        [BurstCompile(FloatMode = FloatMode.Fast)]
+        private struct RoadCostJob : IJobParallelFor
+        {
+            public int width;
+            public int height;
+            public int cellSize;
+            public int gridWidth;
+            public float slopeCost;
+            public float waterCost;
+
+            [ReadOnly] public NativeArray<float> heights;
+            [ReadOnly] public NativeArray<byte> biomes;
+
+            [NativeDisableParallelForRestriction]
+            [WriteOnly] public NativeArray<float> costs;
+
+            public void Execute(int gy)
+            {
+                int y = math.min(height - 1, gy * cellSize + cellSize / 2);
+                int y0 = math.max(0, y - cellSize);
+                int y1 = math.min(height - 1, y + cellSize);
+
+                for (int gx = 0; gx < gridWidth; gx++)
+                {
+                    int x = math.min(width - 1, gx * cellSize + cellSize / 2);
+                    int x0 = math.max(0, x - cellSize);
+                    int x1 = math.min(width - 1, x + cellSize);
+
+                    var biome = (Biome)biomes[x + y * width];
+                    float slope = math.abs(heights[x1 + y * width] - heights[x0 + y * width])
+                        + math.abs(heights[x + y1 * width] - heights[x + y0 * width]);
+
+                    float cost = 1f + slopeCost * slope;
+                    if (biome == Biome.Ocean) cost += waterCost;
+                    else if (biome == Biome.Snow) cost *= 2f;
+
+                    costs[gx + gy * gridWidth] = cost;
+                }
+            }
+        }
+
+        // One index per worker; worker w routes edges w, w + workers, ... with its own slice of
+        // search state, so the routes run in parallel without sharing anything writable
+        [BurstCompile]
+        private struct RouteJob : IJobParallelFor
+        {
+            public int gridWidth;
+            public int gridHeight;
+            public int workers;
+            public int maxPathLength;
+            public int firstGeneration;
+
+            [ReadOnly] public NativeArray<float> costs;
+            [ReadOnly] public NativeArray<int2> routes;
+
+            [NativeDisableParallelForRestriction] public NativeArray<int> lengths;
+            [NativeDisableParallelForRestriction] public NativeArray<int> paths;
+            [NativeDisableParallelForRestriction] public NativeArray<float> gScore;
+            [NativeDisableParallelForRestriction] public NativeArray<int> parent;
+            [NativeDisableParallelForRestriction] public NativeArray<int> stamp;
+            [NativeDisableParallelForRestriction] public NativeArray<int> heapPosition;
+            [NativeDisableParallelForRestriction] public NativeArray<int> heap;
+
+            public void Execute(int worker)
+            {
+                int generation = firstGeneration;
+                for (int r = worker; r < routes.Length; r += workers)
+                {
+                    generation++;
+                    lengths[r] = Route(worker * gridWidth * gridHeight, generation, routes[r].x, routes[r].y, r * maxPathLength);
+                }
+            }
+
+            private int Route(int baseIndex, int generation, int start, int goal, int pathOffset)
+            {
+                int heapCount = 0;
+                gScore[baseIndex + start] = 0f;
+                parent[baseIndex + start] = -1;
+                stamp[baseIndex + start] = generation;
+                Push(baseIndex, ref heapCount, start, goal);
+
+                while (heapCount > 0)
+                {
+                    int current = Pop(baseIndex, ref heapCount, goal);
+                    if (current == goal) return Reconstruct(baseIndex, goal, pathOffset);
+
+                    int cx = current % gridWidth;
+                    int cy = current / gridWidth;
+                    float currentCost = costs[current];
+
+                    for (int dy = -1; dy <= 1; dy++)
+                    {
+                        for (int dx = -1; dx <= 1; dx++)
+                        {
+                            if (dx == 0 && dy == 0) continue;
+
+                            int nx = cx + dx;
+                            int ny = cy + dy;
+                            if (nx < 0 || ny < 0 || nx >= gridWidth || ny >= gridHeight) continue;
+
+                            int next = nx + ny * gridWidth;
+                            float step = 0.5f * (currentCost + costs[next]) * (dx != 0 && dy != 0 ? 1.41421356f : 1f);
+                            float g = gScore[baseIndex + current] + step;
+
+                            int slot = baseIndex + next;
+                            if (stamp[slot] == generation && g >= gScore[slot]) continue;
+
+                            bool queued = stamp[slot] == generation && heapPosition[slot] >= 0;
+                            stamp[slot] = generation;
+                            gScore[slot] = g;
+                            parent[slot] = current;
+
+                            if (queued)
+                                SiftUp(baseIndex, heapPosition[slot], goal);
+                            else
+                                Push(baseIndex, ref heapCount, next, goal);
+                        }
+                    }
+                }
+
+                return 0;
+            }
+
+            // Returns the full length even when it doesn't fit; nothing is written then
+            private int Reconstruct(int baseIndex, int goal, int pathOffset)
+            {
+                int length = 0;
+                for (int cell = goal; cell >= 0; cell = parent[baseIndex + cell]) length++;
+                if (length > maxPathLength) return length;
+
+                int write = length;
+                for (int cell = goal; cell >= 0; cell = parent[baseIndex + cell])
+                {
+                    paths[pathOffset + --write] = cell;
+                }
+                return length;
+            }
+
+            private float Heuristic(int cell, int goal)
+            {
+                // Octile distance at the minimum cost of 1 per cell keeps A* admissible
+                float dx = math.abs(cell % gridWidth - goal % gridWidth);
+                float dy = math.abs(cell / gridWidth - goal / gridWidth);
+                return math.max(dx, dy) + 0.41421356f * math.min(dx, dy);
+            }
+
+            private float Key(int baseIndex, int cell, int goal)
+            {
+                return gScore[baseIndex + cell] + Heuristic(cell, goal);
+            }
+
+            #region Indexed Heap
+
+            private void Push(int baseIndex, ref int heapCount, int cell, int goal)
+            {
+                heap[baseIndex + heapCount] = cell;
+                heapPosition[baseIndex + cell] = heapCount;
+                heapCount++;
+                SiftUp(baseIndex, heapCount - 1, goal);
+            }
+
+            private int Pop(int baseIndex, ref int heapCount, int goal)
+            {
+                int top = heap[baseIndex];
+                heapPosition[baseIndex + top] = -1;
+                heapCount--;
+
+                if (heapCount > 0)
+                {
+                    int last = heap[baseIndex + heapCount];
+                    heap[baseIndex] = last;
+                    heapPosition[baseIndex + last] = 0;
+                    SiftDown(baseIndex, heapCount, goal);
+                }
+                return top;
+            }
+
+            private void SiftUp(int baseIndex, int index, int goal)
+            {
+                int cell = heap[baseIndex + index];
+                float key = Key(baseIndex, cell, goal);
+                while (index > 0)
+                {
+                    int parentIndex = (index - 1) >> 1;
+                    int parentCell = heap[baseIndex + parentIndex];
+                    if (Key(baseIndex, parentCell, goal) <= key) break;
+
+                    heap[baseIndex + index] = parentCell;
+                    heapPosition[baseIndex + parentCell] = index;
+                    index = parentIndex;
+                }
+                heap[baseIndex + index] = cell;
+                heapPosition[baseIndex + cell] = index;
+            }
+
+            private void SiftDown(int baseIndex, int heapCount, int goal)
+            {
+                int index = 0;
+                int cell = heap[baseIndex];
+                float key = Key(baseIndex, cell, goal);
+                while (true)
+                {
+                    int child = index * 2 + 1;
+                    if (child >= heapCount) break;
+                    if (child + 1 < heapCount && Key(baseIndex, heap[baseIndex + child + 1], goal) < Key(baseIndex, heap[baseIndex + child], goal)) child++;
+
+                    int childCell = heap[baseIndex + child];
+                    if (Key(baseIndex, childCell, goal) >= key) break;
+
+                    heap[baseIndex + index] = childCell;
+                    heapPosition[baseIndex + childCell] = index;
+                    index = child;
+                }
+                heap[baseIndex + index] = cell;
+                heapPosition[baseIndex + cell] = index;
+            }
+
+            #endregion
+        }
+
+        private static float Fbm(float2 p, int octaves, float persistence, float lacunarity)
+        {
+            float sum = 0f;
+            float amplitude = 1f;
+            for (int o = 0; o < octaves; o++)
+            {
+                sum += Unity.Mathematics.noise.snoise(p) * amplitude;
+                amplitude *= persistence;
+
+                // Rotating each octave breaks up the axis-aligned lattice artefacts
+                p = new float2(p.x * 0.8f - p.y * 0.6f, p.x * 0.6f + p.y * 0.8f) * lacunarity + new float2(19.1f, 47.7f);
+            }
+            return sum;
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,160 @@
+using System;
+using System.IO;
+using Unity.Collections;
+using UnityEngine;
+
+namespace UnitySim.ProceduralGeneration
+{
+    // Stage outputs on disk, one file per (stage, key). The key already folds in the seed,
+    // the stage's own parameters and every upstream key, so a file is either exactly right
+    // or simply not found. Files are written beside their final name and moved into place,
+    // so an interrupted run never leaves a half-written entry behind.
+    public class WorldStageCache
+    {
+        private const uint Magic = 0x43475755; // "UWGC"
+        private const int FormatVersion = 1;
+        private const int CopyChunkBytes = 1 << 20;
+
+        private readonly string directory;
+        private readonly int keepPerStage;
+        private byte[] copyBuffer;
+
+        public string Directory => directory;
+        public long BytesRead { get; private set; }
+        public long BytesWritten { get; private set; }
+
+        public WorldStageCache(string directory, int keepPerStage = 4)
+        {
+            this.directory = directory;
+            this.keepPerStage = Math.Max(1, keepPerStage);
+        }
+
+        public bool TryLoad(WorldStage stage, ulong key, Action<BinaryReader> read)
+        {
+            string path = PathFor(stage, key);
+            if (!File.Exists(path)) return false;
+
+            try
+            {
+                using (var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, 1 << 16))
+                using (var reader = new BinaryReader(stream))
+                {
+                    if (reader.ReadUInt32() != Magic || reader.ReadInt32() != FormatVersion || reader.ReadUInt64() != key)
+                        return false;
+
+                    read(reader);
+                    BytesRead += stream.Length;
+                }
+                return true;
+            }
+            catch (Exception e)
+            {
+                // A corrupt or truncated entry is just a miss; the stage is regenerated and rewritten
+                Debug.LogWarning($"WorldStageCache: Ignoring unreadable {Path.GetFileName(path)} - {e.Message}");
+                return false;
+            }
+        }
+
+        public void Save(WorldStage stage, ulong key, Action<BinaryWriter> write)
+        {
+            try
+            {
+                System.IO.Directory.CreateDirectory(directory);
+                string path = PathFor(stage, key);
+                string temporary = path + ".tmp";
+
+                using (var stream = new FileStream(temporary, FileMode.Create, FileAccess.Write, FileShare.None, 1 << 16))
+                using (var writer = new BinaryWriter(stream))
+                {
+                    writer.Write(Magic);
+                    writer.Write(FormatVersion);
+                    writer.Write(key);
+                    write(writer);
+                    writer.Flush();
+                    BytesWritten += stream.Length;
+                }
+
+                if (File.Exists(path)) File.Delete(path);
+                File.Move(temporary, path);
+                Prune(stage);
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarning($"WorldStageCache: Could not save {stage} - {e.Message}");
+            }
+        }
+
+        public void Clear()
+        {
+            if (!System.IO.Directory.Exists(directory)) return;
+
+            foreach (var file in System.IO.Directory.GetFiles(directory, "*.bin"))
+            {
+                File.Delete(file);
+            }
+        }
+
+        #region Arrays
+
+        public void WriteArray<T>(BinaryWriter writer, NativeArray<T> array, int elementSize) where T : struct
+        {
+            var bytes = array.Reinterpret<byte>(elementSize);
+            var buffer = CopyBuffer();
+
+            writer.Write(bytes.Length);
+            for (int offset = 0; offset < bytes.Length; offset += buffer.Length)
+            {
+                int count = Math.Min(buffer.Length, bytes.Length - offset);
+                NativeArray<byte>.Copy(bytes, offset, buffer, 0, count);
+                writer.Write(buffer, 0, count);
+            }
+        }
+
+        // The array must already have the stored length
+        public void ReadArray<T>(BinaryReader reader, NativeArray<T> array, int elementSize) where T : struct
+        {
+            var bytes = array.Reinterpret<byte>(elementSize);
+            if (reader.ReadInt32() != bytes.Length)
+                throw new InvalidDataException("Stored array length does not match");
+
+            var buffer = CopyBuffer();
+            for (int offset = 0; offset < bytes.Length; offset += buffer.Length)
+            {
+                int count = Math.Min(buffer.Length, bytes.Length - offset);
+                if (reader.Read(buffer, 0, count) != count)
+                    throw new EndOfStreamException();
+
+                NativeArray<byte>.Copy(buffer, 0, bytes, offset, count);
+            }
+        }
+
+        #endregion
+
+        #region Helpers
+
+        private string PathFor(WorldStage stage, ulong key)
+        {
+            return Path.Combine(directory, $"{stage.ToString().ToLowerInvariant()}-{key:x16}.bin");
+        }
+
+        // Keeps the most recent entries per stage so parameter sweeps don't fill the disk
+        private void Prune(WorldStage stage)
+        {
+            var files = new DirectoryInfo(directory).GetFiles($"{stage.ToString().ToLowerInvariant()}-*.bin");
+            if (files.Length <= keepPerStage) return;
+
+            Array.Sort(files, (a, b) => b.LastWriteTimeUtc.CompareTo(a.LastWriteTimeUtc));
+            for (int i = keepPerStage; i < files.Length; i++)
+            {
+                files[i].Delete();
+            }
+        }
+
+        private byte[] CopyBuffer()
+        {
+            return copyBuffer ?? (copyBuffer = new byte[CopyChunkBytes]);
+        }
+
+        #endregion
+    }
+}
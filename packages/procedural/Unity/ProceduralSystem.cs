@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Procedural
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Procedural
 
         public ProceduralData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             procedural = new ProceduralInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (procedural != null)
+                procedural.WriteState(writer, "procedural");
+            else
+                writer.Write("procedural", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,109 @@ namespace UnitySim.Procedural
         public float persistence = 0.5f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-procedural";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("seed", seed);
+            writer.Write("chunksGenerated", chunksGenerated);
+            writer.Write("algorithm", algorithm);
+            writer.Write("noiseScale", noiseScale);
+            writer.Write("octaves", octaves);
+            writer.Write("persistence", persistence);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public ProceduralField Diff(ProceduralInfo other)
+        {
+            var changed = ProceduralField.None;
+            if (seed != other.seed) changed |= ProceduralField.Seed;
+            if (chunksGenerated != other.chunksGenerated) changed |= ProceduralField.ChunksGenerated;
+            if (algorithm != other.algorithm) changed |= ProceduralField.Algorithm;
+            if (noiseScale != other.noiseScale) changed |= ProceduralField.NoiseScale;
+            if (octaves != other.octaves) changed |= ProceduralField.Octaves;
+            if (persistence != other.persistence) changed |= ProceduralField.Persistence;
+            if (systemHealth != other.systemHealth) changed |= ProceduralField.SystemHealth;
+            if (framework != other.framework) changed |= ProceduralField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(ProceduralInfo target)
+        {
+            target.seed = seed;
+            target.chunksGenerated = chunksGenerated;
+            target.algorithm = algorithm;
+            target.noiseScale = noiseScale;
+            target.octaves = octaves;
+            target.persistence = persistence;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum ProceduralField
+    {
+        None = 0,
+        Seed = 1 << 0,
+        ChunksGenerated = 1 << 1,
+        Algorithm = 1 << 2,
+        NoiseScale = 1 << 3,
+        Octaves = 1 << 4,
+        Persistence = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct ProceduralDelta
+    {
+        public readonly long timestamp;
+        public readonly ProceduralField changed;
+        public readonly ProceduralInfo values;
+
+        public ProceduralDelta(long timestamp, ProceduralField changed, ProceduralInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(ProceduralField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class ProceduralSystem : MonoBehaviour
+    public class ProceduralSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Procedural Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Terrain")]
+        public int seed = 12345;
+        public TerrainNoise algorithm = TerrainNoise.Perlin;
+        public float noiseScale = 0.01f;
+        public int octaves = 4;
+        public float persistence = 0.5f;
+        public float lacunarity = 2f;
+        public float heightScale = 40f;
+
+        [Header("Streaming")]
+        public Transform focus;
+        public int chunkResolution = 65;
+        public float chunkSize = 64f;
+        public int viewRadius = 4;
+        public int cacheCapacity = 256;
+        public int maxJobsInFlight = 8;
+        public int maxPublishesPerFrame = 4;
+        [SerializeField] private float lastStreamMs = 0f;
+
         [Header("Current Data")]
         [SerializeField] private ProceduralData currentData;
 
@@ -48,12 +158,19 @@ namespace UnitySim.Procedural
 
         // Events
         public System.Action<ProceduralData> OnProceduralChanged;
+        public System.Action<ProceduralDelta> OnProceduralDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.ProceduralSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly ProceduralInfo publishedInfo = new ProceduralInfo();
+        private bool publishFullDelta = true;
+        private TerrainChunkStreamer streamer;
 
         #region Unity Lifecycle
 
@@ -62,18 +179,32 @@ namespace UnitySim.Procedural
             InitializeProcedural();
         }
 
+        void OnEnable()
+        {
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
+
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
+
         void Update()
         {
-            if (!isInitialized) return;
+            if (streamer == null) return;
 
-            UpdateSystem();
+            // Streaming follows the camera every frame, independent of the publish interval
+            streamer.Configure(seed, CurrentNoiseSettings());
+            streamer.Update(FocusPosition(), viewRadius, maxPublishesPerFrame);
+            lastStreamMs = streamer.LastUpdateMs;
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            streamer?.Dispose();
+            streamer = null;
         }
 
         #endregion
@@ -83,6 +214,11 @@ namespace UnitySim.Procedural
         private void InitializeProcedural()
         {
             currentData = new ProceduralData();
+
+            streamer?.Dispose();
+            streamer = new TerrainChunkStreamer(chunkResolution, chunkSize, cacheCapacity, maxJobsInFlight);
+            streamer.Configure(seed, CurrentNoiseSettings());
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,22 +229,49 @@ namespace UnitySim.Procedural
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
+        }
+
+        private void UpdateSpecificData(float deltaTime)
+        {
+            if (streamer == null) return;
+
+            var info = currentData.procedural;
+            info.seed = seed;
+            info.chunksGenerated = (int)Math.Min(int.MaxValue, streamer.ChunksGenerated);
+            info.algorithm = algorithm.ToString();
+            info.noiseScale = noiseScale;
+            info.octaves = octaves;
+            info.persistence = persistence;
+        }
+
+        private TerrainNoiseSettings CurrentNoiseSettings()
+        {
+            return new TerrainNoiseSettings
+            {
+                noise = algorithm,
+                frequency = noiseScale,
+                octaves = octaves,
+                persistence = persistence,
+                lacunarity = lacunarity,
+                heightScale = heightScale
+            };
         }
 
-        private void UpdateSpecificData()
+        private Vector3 FocusPosition()
         {
-                        currentData.procedural.chunksGenerated += UnityEngine.Random.Range(1, 3);
-            currentData.procedural.noiseScale += UnityEngine.Random.Range(-0.01f, 0.01f);
+            if (focus != null) return focus.position;
+            var camera = Camera.main;
+            return camera != null ? camera.transform.position : transform.position;
         }
 
         private void ProcessUpdate()
@@ -121,6 +284,12 @@ namespace UnitySim.Procedural
                 OnProceduralChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -128,10 +297,67 @@ namespace UnitySim.Procedural
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.procedural;
+            var changed = publishFullDelta ? ProceduralField.All : info.Diff(publishedInfo);
+            if (changed == ProceduralField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnProceduralDelta?.Invoke(new ProceduralDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(ProceduralSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("ProceduralSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -142,7 +368,9 @@ namespace UnitySim.Procedural
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -163,6 +391,17 @@ namespace UnitySim.Procedural
             return currentData;
         }
 
+        public TerrainChunkStreamer GetStreamer()
+        {
+            return streamer;
+        }
+
+        // Terrain height under a world position, or NaN while that chunk is still generating
+        public float SampleHeight(Vector3 position)
+        {
+            return streamer != null ? streamer.SampleHeight(position) : float.NaN;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -194,7 +433,7 @@ namespace UnitySim.Procedural
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -206,6 +445,15 @@ namespace UnitySim.Procedural
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            noiseScale = Mathf.Max(1e-6f, noiseScale);
+            octaves = Mathf.Clamp(octaves, 1, 16);
+            lacunarity = Mathf.Max(1f, lacunarity);
+            chunkResolution = Mathf.Max(2, chunkResolution);
+            chunkSize = Mathf.Max(0.01f, chunkSize);
+            viewRadius = Mathf.Max(0, viewRadius);
+            cacheCapacity = Mathf.Max(1, cacheCapacity);
+            maxJobsInFlight = Mathf.Max(1, maxJobsInFlight);
+            maxPublishesPerFrame = Mathf.Max(1, maxPublishesPerFrame);
         }
 
         #endregion
@@ -217,7 +465,10 @@ namespace UnitySim.Procedural
             Debug.Log($"ProceduralSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (streamer != null)
+                Debug.Log($"- Terrain: {streamer.CachedChunks}/{streamer.CacheCapacity} chunks cached, {streamer.InFlight} generating, {streamer.ChunksGenerated} generated, {streamer.Evictions} evicted, {streamer.PooledBuffers} pooled buffers");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
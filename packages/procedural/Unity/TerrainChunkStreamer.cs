@@ -0,0 +1,486 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+using UnityEngine;
+
+namespace UnitySim.Procedural
+{
+    public enum TerrainNoise
+    {
+        Perlin,
+        Simplex,
+        Ridged
+    }
+
+    [System.Serializable]
+    public struct TerrainNoiseSettings
+    {
+        public TerrainNoise noise;
+        public float frequency;
+        public int octaves;
+        public float persistence;
+        public float lacunarity;
+        public float heightScale;
+
+        public bool Equals(TerrainNoiseSettings other)
+        {
+            return noise == other.noise && frequency == other.frequency && octaves == other.octaves
+                && persistence == other.persistence && lacunarity == other.lacunarity && heightScale == other.heightScale;
+        }
+    }
+
+    public readonly struct TerrainChunkKey : IEquatable<TerrainChunkKey>
+    {
+        public readonly int seed;
+        public readonly Vector2Int coord;
+
+        public TerrainChunkKey(int seed, Vector2Int coord)
+        {
+            this.seed = seed;
+            this.coord = coord;
+        }
+
+        public bool Equals(TerrainChunkKey other) => seed == other.seed && coord == other.coord;
+        public override bool Equals(object obj) => obj is TerrainChunkKey other && Equals(other);
+        public override int GetHashCode() => (seed * 397 ^ coord.x) * 397 ^ coord.y;
+    }
+
+    // A generated heightfield. Heights are Resolution² row-major samples; edge samples are
+    // shared with the neighbouring chunk, so adjacent chunks meet without seams. The buffer
+    // returns to the pool on eviction, so drop references when ChunkEvicted fires.
+    public sealed class TerrainChunk
+    {
+        public TerrainChunkKey Key { get; internal set; }
+        public NativeArray<float> Heights { get; internal set; }
+        public int Resolution { get; internal set; }
+        public float Size { get; internal set; }
+        public float MinHeight { get; internal set; }
+        public float MaxHeight { get; internal set; }
+
+        internal LinkedListNode<TerrainChunk> lruNode;
+
+        public Vector2Int Coord => Key.coord;
+    }
+
+    // Streams fBm terrain chunks around a focus point. Missing chunks are generated by Burst
+    // jobs on worker threads, nearest first, with at most MaxJobsInFlight running. Finished
+    // jobs are only collected once IsCompleted reports true, and at most maxPublishes per
+    // frame, so the main thread never waits on a worker. Generated chunks stay in an LRU
+    // cache keyed by (seed, coord); evicted buffers go back to a pool for the next job.
+    public class TerrainChunkStreamer : IDisposable
+    {
+        private struct PendingChunk
+        {
+            public TerrainChunkKey key;
+            public NativeArray<float> heights;
+            public JobHandle handle;
+            public int generation;
+        }
+
+        private const float MaxSeedOffset = 10000f;
+
+        private readonly int resolution;
+        private readonly float chunkSize;
+        private readonly int maxJobsInFlight;
+        private int cacheCapacity;
+
+        private readonly Dictionary<TerrainChunkKey, TerrainChunk> cache = new Dictionary<TerrainChunkKey, TerrainChunk>();
+        private readonly LinkedList<TerrainChunk> lru = new LinkedList<TerrainChunk>();
+        private readonly Stack<NativeArray<float>> bufferPool = new Stack<NativeArray<float>>();
+        private readonly Stack<TerrainChunk> chunkPool = new Stack<TerrainChunk>();
+        private readonly List<PendingChunk> inFlight = new List<PendingChunk>();
+        private readonly HashSet<TerrainChunkKey> requested = new HashSet<TerrainChunkKey>();
+        private readonly List<Vector2Int> ringOffsets = new List<Vector2Int>();
+
+        private TerrainNoiseSettings settings;
+        private int seed;
+        private int generation = 0;
+        private int viewRadius = -1;
+        private bool disposed = false;
+
+        public event Action<TerrainChunk> ChunkReady;
+        public event Action<TerrainChunk> ChunkEvicted;
+
+        public int Resolution => resolution;
+        public float ChunkSize => chunkSize;
+        public int MaxJobsInFlight => maxJobsInFlight;
+        public int CachedChunks => cache.Count;
+        public int InFlight => inFlight.Count;
+        public int PooledBuffers => bufferPool.Count;
+        public int Seed => seed;
+        public TerrainNoiseSettings Settings => settings;
+
+        // Running totals for reporting
+        public long ChunksGenerated { get; private set; }
+        public long CacheHits { get; private set; }
+        public long CacheMisses { get; private set; }
+        public long Evictions { get; private set; }
+        public float LastUpdateMs { get; private set; }
+
+        public int CacheCapacity
+        {
+            get => cacheCapacity;
+            set
+            {
+                cacheCapacity = Math.Max(1, value);
+                TrimCache(null);
+            }
+        }
+
+        public TerrainChunkStreamer(int resolution, float chunkSize, int cacheCapacity, int maxJobsInFlight)
+        {
+            this.resolution = Math.Max(2, resolution);
+            this.chunkSize = Math.Max(0.01f, chunkSize);
+            this.cacheCapacity = Math.Max(1, cacheCapacity);
+            this.maxJobsInFlight = Math.Max(1, maxJobsInFlight);
+        }
+
+        #region Settings
+
+        // A new seed keeps the cache, since chunks are keyed by seed; other changes reshape
+        // every chunk and clear it
+        public void Configure(int newSeed, TerrainNoiseSettings newSettings)
+        {
+            newSettings.octaves = Math.Max(1, Math.Min(16, newSettings.octaves));
+            newSettings.frequency = Math.Max(1e-6f, newSettings.frequency);
+            newSettings.lacunarity = Math.Max(1f, newSettings.lacunarity);
+
+            if (!newSettings.Equals(settings)) ClearCache();
+            settings = newSettings;
+            seed = newSeed;
+        }
+
+        public void ClearCache()
+        {
+            foreach (var chunk in lru)
+            {
+                ChunkEvicted?.Invoke(chunk);
+                Release(chunk);
+            }
+            lru.Clear();
+            cache.Clear();
+
+            // Jobs already running finish into the pool instead of the cache
+            generation++;
+        }
+
+        #endregion
+
+        #region Streaming
+
+        // Publishes finished chunks, then queues missing chunks within radius of the focus,
+        // nearest first; call once per frame
+        public int Update(Vector3 focus, int radius, int maxPublishes)
+        {
+            ThrowIfDisposed();
+            var stopwatch = Stopwatch.StartNew();
+
+            int published = CollectCompleted(Math.Max(1, maxPublishes));
+
+            if (radius != viewRadius) BuildRing(Math.Max(0, radius));
+            var center = WorldToChunk(focus);
+            bool scheduled = false;
+
+            for (int i = 0; i < ringOffsets.Count; i++)
+            {
+                var key = new TerrainChunkKey(seed, center + ringOffsets[i]);
+                if (cache.TryGetValue(key, out var chunk))
+                {
+                    Touch(chunk);
+                    continue;
+                }
+
+                if (requested.Contains(key) || inFlight.Count >= maxJobsInFlight) continue;
+
+                CacheMisses++;
+                ScheduleChunk(key);
+                scheduled = true;
+            }
+
+            if (scheduled) JobHandle.ScheduleBatchedJobs();
+
+            stopwatch.Stop();
+            LastUpdateMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+            return published;
+        }
+
+        public Vector2Int WorldToChunk(Vector3 world)
+        {
+            return new Vector2Int(Mathf.FloorToInt(world.x / chunkSize), Mathf.FloorToInt(world.z / chunkSize));
+        }
+
+        public bool TryGetChunk(Vector2Int coord, out TerrainChunk chunk)
+        {
+            if (cache.TryGetValue(new TerrainChunkKey(seed, coord), out chunk))
+            {
+                CacheHits++;
+                Touch(chunk);
+                return true;
+            }
+            return false;
+        }
+
+        // Bilinear height at a world XZ position; NaN until the chunk under it is generated
+        public float SampleHeight(Vector3 world)
+        {
+            var coord = WorldToChunk(world);
+            if (!cache.TryGetValue(new TerrainChunkKey(seed, coord), out var chunk)) return float.NaN;
+
+            float spacing = chunkSize / (resolution - 1);
+            float fx = Mathf.Clamp((world.x - coord.x * chunkSize) / spacing, 0f, resolution - 1);
+            float fz = Mathf.Clamp((world.z - coord.y * chunkSize) / spacing, 0f, resolution - 1);
+            int x0 = Math.Min((int)fx, resolution - 2);
+            int z0 = Math.Min((int)fz, resolution - 2);
+            float tx = fx - x0;
+            float tz = fz - z0;
+
+            var heights = chunk.Heights;
+            int row = z0 * resolution + x0;
+            float bottom = Mathf.Lerp(heights[row], heights[row + 1], tx);
+            float top = Mathf.Lerp(heights[row + resolution], heights[row + resolution + 1], tx);
+            return Mathf.Lerp(bottom, top, tz);
+        }
+
+        private void ScheduleChunk(TerrainChunkKey key)
+        {
+            var heights = bufferPool.Count > 0
+                ? bufferPool.Pop()
+                : new NativeArray<float>(resolution * resolution, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+
+            var handle = new HeightfieldJob
+            {
+                resolution = resolution,
+                origin = new float2(key.coord.x * chunkSize, key.coord.y * chunkSize),
+                spacing = chunkSize / (resolution - 1),
+                offset = SeedOffset(key.seed),
+                noise = (int)settings.noise,
+                frequency = settings.frequency,
+                octaves = settings.octaves,
+                persistence = settings.persistence,
+                lacunarity = settings.lacunarity,
+                heightScale = settings.heightScale,
+                heights = heights
+            }.Schedule(resolution, 4);
+
+            inFlight.Add(new PendingChunk { key = key, heights = heights, handle = handle, generation = generation });
+            requested.Add(key);
+        }
+
+        private int CollectCompleted(int maxPublishes)
+        {
+            int published = 0;
+            for (int i = 0; i < inFlight.Count && published < maxPublishes; )
+            {
+                var pending = inFlight[i];
+                if (!pending.handle.IsCompleted)
+                {
+                    i++;
+                    continue;
+                }
+
+                // Already finished on the worker, so this does not block
+                pending.handle.Complete();
+                inFlight.RemoveAt(i);
+                requested.Remove(pending.key);
+
+                if (pending.generation != generation || cache.ContainsKey(pending.key))
+                {
+                    bufferPool.Push(pending.heights);
+                    continue;
+                }
+
+                var chunk = chunkPool.Count > 0 ? chunkPool.Pop() : new TerrainChunk();
+                chunk.Key = pending.key;
+                chunk.Heights = pending.heights;
+                chunk.Resolution = resolution;
+                chunk.Size = chunkSize;
+                MeasureRange(chunk);
+
+                chunk.lruNode = lru.AddFirst(chunk);
+                cache[pending.key] = chunk;
+                ChunksGenerated++;
+                published++;
+
+                TrimCache(chunk);
+                ChunkReady?.Invoke(chunk);
+            }
+            return published;
+        }
+
+        #endregion
+
+        #region Cache
+
+        private void Touch(TerrainChunk chunk)
+        {
+            if (chunk.lruNode == lru.First) return;
+
+            lru.Remove(chunk.lruNode);
+            lru.AddFirst(chunk.lruNode);
+        }
+
+        private void TrimCache(TerrainChunk keep)
+        {
+            while (cache.Count > cacheCapacity && lru.Last != null && lru.Last.Value != keep)
+            {
+                var chunk = lru.Last.Value;
+                lru.RemoveLast();
+                cache.Remove(chunk.Key);
+                Evictions++;
+
+                ChunkEvicted?.Invoke(chunk);
+                Release(chunk);
+            }
+        }
+
+        private void Release(TerrainChunk chunk)
+        {
+            bufferPool.Push(chunk.Heights);
+            chunk.Heights = default;
+            chunk.lruNode = null;
+            chunkPool.Push(chunk);
+        }
+
+        private void MeasureRange(TerrainChunk chunk)
+        {
+            var heights = chunk.Heights;
+            float min = float.MaxValue;
+            float max = float.MinValue;
+            for (int i = 0; i < heights.Length; i++)
+            {
+                float h = heights[i];
+                if (h < min) min = h;
+                if (h > max) max = h;
+            }
+            chunk.MinHeight = min;
+            chunk.MaxHeight = max;
+        }
+
+        #endregion
+
+        #region Helpers
+
+        private void BuildRing(int radius)
+        {
+            viewRadius = radius;
+            ringOffsets.Clear();
+            for (int y = -radius; y <= radius; y++)
+            {
+                for (int x = -radius; x <= radius; x++)
+                {
+                    if (x * x + y * y <= radius * radius) ringOffsets.Add(new Vector2Int(x, y));
+                }
+            }
+            ringOffsets.Sort((a, b) => (a.x * a.x + a.y * a.y).CompareTo(b.x * b.x + b.y * b.y));
+
+            // The whole view must fit, or chunks in view would evict each other every frame
+            cacheCapacity = Math.Max(cacheCapacity, ringOffsets.Count);
+        }
+
+        private static float2 SeedOffset(int seed)
+        {
+            var random = new Unity.Mathematics.Random((uint)seed * 747796405u + 2891336453u);
+            return random.NextFloat2(new float2(-MaxSeedOffset, -MaxSeedOffset), new float2(MaxSeedOffset, MaxSeedOffset));
+        }
+
+        private void ThrowIfDisposed()
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(TerrainChunkStreamer));
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            disposed = true;
+
+            for (int i = 0; i < inFlight.Count; i++)
+            {
+                inFlight[i].handle.Complete();
+                inFlight[i].heights.Dispose();
+            }
+            inFlight.Clear();
+            requested.Clear();
+
+            foreach (var chunk in lru)
+            {
+                chunk.Heights.Dispose();
+            }
+            lru.Clear();
+            cache.Clear();
+
+            while (bufferPool.Count > 0) bufferPool.Pop().Dispose();
+        }
+
+        #endregion
+
+        #region Jobs
+
+        // One row of samples per index; octaves are normalised so heights stay within ±heightScale
+        [BurstCompile(FloatMode = FloatMode.Fast)]
+        private struct HeightfieldJob : IJobParallelFor
+        {
+            public int resolution;
+            public float2 origin;
+            public float spacing;
+            public float2 offset;
+            public int noise;
+            public float frequency;
+            public int octaves;
+            public float persistence;
+            public float lacunarity;
+            public float heightScale;
+
+            [NativeDisableParallelForRestriction]
+            [WriteOnly] public NativeArray<float> heights;
+
+            public void Execute(int row)
+            {
+                float amplitudeSum = 0f;
+                float amplitude = 1f;
+                for (int o = 0; o < octaves; o++)
+                {
+                    amplitudeSum += amplitude;
+                    amplitude *= persistence;
+                }
+                float normalise = heightScale / math.max(1e-6f, amplitudeSum);
+
+                int start = row * resolution;
+                float z = origin.y + row * spacing;
+                for (int x = 0; x < resolution; x++)
+                {
+                    var p = new float2(origin.x + x * spacing, z) * frequency + offset;
+                    heights[start + x] = Fbm(p) * normalise;
+                }
+            }
+
+            private float Fbm(float2 p)
+            {
+                float sum = 0f;
+                float amplitude = 1f;
+                for (int o = 0; o < octaves; o++)
+                {
+                    float n;
+                    if (noise == (int)TerrainNoise.Perlin)
+                        n = Unity.Mathematics.noise.cnoise(p);
+                    else if (noise == (int)TerrainNoise.Simplex)
+                        n = Unity.Mathematics.noise.snoise(p);
+                    else
+                        n = 1f - 2f * math.abs(Unity.Mathematics.noise.snoise(p));
+
+                    sum += n * amplitude;
+                    amplitude *= persistence;
+
+                    // Rotating each octave breaks up the axis-aligned lattice artefacts
+                    p = new float2(p.x * 0.8f - p.y * 0.6f, p.x * 0.6f + p.y * 0.8f) * lacunarity + new float2(19.1f, 47.7f);
+                }
+                return sum;
+            }
+        }
+
+        #endregion
+    }
+}
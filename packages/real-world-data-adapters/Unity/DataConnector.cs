@@ -0,0 +1,491 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Net;
+using System.Net.Http;
+using System.Threading;
+using System.Threading.Tasks;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.RealWorldDataAdapters
+{
+    public class DataConnectorSettings
+    {
+        public string cacheDirectory;
+        public int maxConcurrentRequests = 4;
+        public int maxConnectionsPerServer = 4;
+        public float requestTimeout = 30f;
+        public float retryDelay = 5f;            // first retry after a failure; doubles up to refreshInterval
+    }
+
+    public class DataSourceStatus
+    {
+        public string name;
+        public bool enabled;
+        public bool loading;
+        public int records;
+        public long requests;
+        public long cacheHits;          // served from disk without asking the server
+        public long notModified;        // 304s
+        public long failures;
+        public long bytesDownloaded;
+        public float latencyMs;         // time to response headers, smoothed
+        public float durationMs;        // whole last refresh, download and parse
+        public long confirmedUnixMs;    // when the server last vouched for the data; 0 before any
+        public string lastError;
+
+        public void CopyTo(DataSourceStatus target)
+        {
+            target.name = name;
+            target.enabled = enabled;
+            target.loading = loading;
+            target.records = records;
+            target.requests = requests;
+            target.cacheHits = cacheHits;
+            target.notModified = notModified;
+            target.failures = failures;
+            target.bytesDownloaded = bytesDownloaded;
+            target.latencyMs = latencyMs;
+            target.durationMs = durationMs;
+            target.confirmedUnixMs = confirmedUnixMs;
+            target.lastError = lastError;
+        }
+    }
+
+    public class DataConnectorSummary
+    {
+        public int enabledSources;
+        public int loadingSources;
+        public int failingSources;      // last refresh failed
+        public int requestsInFlight;
+        public long records;
+        public long recordsParsed;
+        public long requests;
+        public long cacheHits;
+        public long notModified;
+        public long failures;
+        public long bytesDownloaded;
+        public float latencyMs;
+        public float freshness;         // 0-100, see DataConnector.GetSummary
+    }
+
+    // Fetches DataSourceDefinitions over one shared HttpClient, so connections stay pooled
+    // and kept alive across refreshes. Each refresh is an async task: pages wait for their
+    // source's rate limiter and a global request slot, stream to the on-disk cache, and are
+    // then parsed from disk into a pooled DataRecordBuffer. A cached page younger than
+    // cacheTtl is not requested at all, and an older one is revalidated with its ETag or
+    // Last-Modified, so warm starts and unchanged data cost no download. Update, on the main
+    // thread, starts due refreshes and swaps finished buffers in.
+    public class DataConnector : IDisposable
+    {
+        private const int CopyBufferSize = 64 * 1024;
+        private const float LatencySmoothing = 0.2f;
+
+        private class Source
+        {
+            public DataSourceDefinition definition;
+            public TokenBucketRateLimiter limiter;
+            public readonly DataRecordParser parser = new DataRecordParser();
+            public readonly DataSourceStatus status = new DataSourceStatus();
+            public DataRecordBuffer current;    // main thread
+            public DataRecordBuffer pending;    // finished, not yet swapped in
+            public bool loaded;                 // a buffer has been parsed since AddSource
+            public long nextRefreshUnixMs;
+            public int consecutiveFailures;
+        }
+
+        private readonly DataConnectorSettings settings;
+        private readonly HttpClient client;
+        private readonly SemaphoreSlim requestSlots;
+        private readonly DataSourceCache cache;
+        private readonly DataRecordBufferPool pool = new DataRecordBufferPool();
+        private readonly CancellationTokenSource cancellation = new CancellationTokenSource();
+        private readonly List<Source> sources = new List<Source>();
+
+        // Guards every Source field except current, and the totals below
+        private readonly object gate = new object();
+        private int requestsInFlight = 0;
+        private long recordsParsed = 0;
+        private float latencyMs = 0f;
+        private bool disposed = false;
+
+        public int SourceCount => sources.Count;
+        public DataSourceCache Cache => cache;
+
+        // Raised on the main thread by Update when a source has new records
+        public event Action<int, DataRecordBuffer> SourceUpdated;
+
+        public DataConnector(DataConnectorSettings settings)
+        {
+            this.settings = settings ?? new DataConnectorSettings();
+
+            var handler = new HttpClientHandler
+            {
+                MaxConnectionsPerServer = Math.Max(1, this.settings.maxConnectionsPerServer),
+                AutomaticDecompression = DecompressionMethods.GZip | DecompressionMethods.Deflate
+            };
+            client = new HttpClient(handler) { Timeout = TimeSpan.FromSeconds(Math.Max(1f, this.settings.requestTimeout)) };
+            requestSlots = new SemaphoreSlim(Math.Max(1, this.settings.maxConcurrentRequests));
+            cache = new DataSourceCache(this.settings.cacheDirectory ?? Path.Combine(Path.GetTempPath(), "unity-sim-data-cache"));
+        }
+
+        public int AddSource(DataSourceDefinition definition)
+        {
+            if (definition == null) throw new ArgumentNullException(nameof(definition));
+            definition.Validate();
+
+            var source = new Source
+            {
+                definition = definition,
+                limiter = new TokenBucketRateLimiter(definition.requestsPerSecond, definition.burst)
+            };
+            source.status.name = definition.name;
+            source.status.enabled = definition.enabled;
+            sources.Add(source);
+            return sources.Count - 1;
+        }
+
+        #region Main Thread
+
+        // Swaps in finished refreshes and starts the ones that are due; returns how many sources updated
+        public int Update(long nowUnixMs)
+        {
+            int updated = 0;
+            for (int i = 0; i < sources.Count; i++)
+            {
+                var source = sources[i];
+                DataRecordBuffer finished = null;
+                bool start = false;
+
+                lock (gate)
+                {
+                    if (disposed) return updated;
+
+                    if (source.pending != null)
+                    {
+                        finished = source.pending;
+                        source.pending = null;
+                    }
+
+                    source.status.enabled = source.definition.enabled;
+                    if (source.definition.enabled && !source.status.loading && nowUnixMs >= source.nextRefreshUnixMs
+                        && !string.IsNullOrEmpty(source.definition.url))
+                    {
+                        source.status.loading = true;
+                        start = true;
+                    }
+                }
+
+                if (finished != null)
+                {
+                    pool.Return(source.current);
+                    source.current = finished;
+                    updated++;
+                    SourceUpdated?.Invoke(i, finished);
+                }
+
+                if (start) Task.Run(() => RefreshAsync(source));
+            }
+            return updated;
+        }
+
+        // The latest records; valid until the Update that replaces them
+        public DataRecordBuffer GetRecords(int index)
+        {
+            return (uint)index < (uint)sources.Count ? sources[index].current : null;
+        }
+
+        public int FindSource(string name)
+        {
+            for (int i = 0; i < sources.Count; i++)
+            {
+                if (sources[i].definition.name == name) return i;
+            }
+            return -1;
+        }
+
+        // Refreshes on the next Update regardless of refreshInterval; the cache still applies
+        public void RequestRefresh(int index)
+        {
+            if ((uint)index >= (uint)sources.Count) return;
+            lock (gate) sources[index].nextRefreshUnixMs = 0;
+        }
+
+        public void GetStatus(int index, DataSourceStatus target)
+        {
+            if ((uint)index >= (uint)sources.Count) return;
+            lock (gate) sources[index].status.CopyTo(target);
+        }
+
+        // freshness averages, over enabled sources, min(1, allowed age / data age) where the
+        // allowed age is the larger of refreshInterval and cacheTtl; sources without data count 0
+        public void GetSummary(long nowUnixMs, DataConnectorSummary target)
+        {
+            lock (gate)
+            {
+                target.enabledSources = 0;
+                target.loadingSources = 0;
+                target.failingSources = 0;
+                target.records = 0;
+                target.requests = 0;
+                target.cacheHits = 0;
+                target.notModified = 0;
+                target.failures = 0;
+                target.bytesDownloaded = 0;
+                target.requestsInFlight = requestsInFlight;
+                target.recordsParsed = recordsParsed;
+                target.latencyMs = latencyMs;
+
+                double freshness = 0.0;
+                for (int i = 0; i < sources.Count; i++)
+                {
+                    var source = sources[i];
+                    var status = source.status;
+                    target.requests += status.requests;
+                    target.cacheHits += status.cacheHits;
+                    target.notModified += status.notModified;
+                    target.failures += status.failures;
+                    target.bytesDownloaded += status.bytesDownloaded;
+                    if (!source.definition.enabled) continue;
+
+                    target.enabledSources++;
+                    target.records += status.records;
+                    if (status.loading) target.loadingSources++;
+                    if (source.consecutiveFailures > 0) target.failingSources++;
+                    if (status.confirmedUnixMs <= 0) continue;
+
+                    double allowed = Math.Max(source.definition.refreshInterval, source.definition.cacheTtl) * 1000.0;
+                    double age = Math.Max(1.0, nowUnixMs - status.confirmedUnixMs);
+                    freshness += Math.Min(1.0, allowed / age);
+                }
+                target.freshness = target.enabledSources > 0 ? (float)(freshness * 100.0 / target.enabledSources) : 0f;
+            }
+        }
+
+        #endregion
+
+        #region Refresh Tasks
+
+        private async Task RefreshAsync(Source source)
+        {
+            var definition = source.definition;
+            var token = cancellation.Token;
+            long started = Stopwatch.GetTimestamp();
+            DataRecordBuffer buffer = null;
+            bool succeeded = false;
+
+            try
+            {
+                // Pages download concurrently, within the rate limit and request slots
+                var pages = new Task<(DataCacheEntry entry, bool downloaded)>[definition.pages];
+                for (int page = 0; page < pages.Length; page++) pages[page] = FetchPageAsync(source, definition.GetPageUrl(page + 1), token);
+                await Task.WhenAll(pages).ConfigureAwait(false);
+
+                bool changed;
+                lock (gate) changed = !source.loaded;
+                long confirmed = long.MaxValue;
+                for (int page = 0; page < pages.Length; page++)
+                {
+                    changed |= pages[page].Result.downloaded;
+                    confirmed = Math.Min(confirmed, pages[page].Result.entry.fetchedUnixMs);
+                }
+
+                // Unchanged bodies are not parsed again; the server's confirmation still refreshes the data
+                if (changed)
+                {
+                    buffer = pool.Rent();
+                    for (int page = 0; page < pages.Length && buffer.Count < definition.maxRecords; page++)
+                    {
+                        token.ThrowIfCancellationRequested();
+                        using (var file = new FileStream(pages[page].Result.entry.bodyPath, FileMode.Open, FileAccess.Read, FileShare.Read, CopyBufferSize, FileOptions.SequentialScan))
+                        {
+                            source.parser.Parse(file, definition.format, definition.recordsField, buffer, definition.maxRecords - buffer.Count);
+                        }
+                    }
+                    buffer.FetchedUnixMs = confirmed;
+                }
+
+                lock (gate)
+                {
+                    if (buffer != null)
+                    {
+                        pool.Return(source.pending);
+                        source.pending = buffer;
+                        source.loaded = true;
+                        source.status.records = buffer.Count;
+                        recordsParsed += buffer.Count;
+                        buffer = null;
+                    }
+                    source.status.confirmedUnixMs = confirmed;
+                    source.status.lastError = null;
+                    source.consecutiveFailures = 0;
+                }
+                succeeded = true;
+            }
+            catch (Exception) when (token.IsCancellationRequested)
+            {
+                // Disposed mid-refresh
+            }
+            catch (Exception e)
+            {
+                var error = e is AggregateException aggregate ? aggregate.InnerException ?? e : e;
+                bool firstFailure;
+                lock (gate)
+                {
+                    firstFailure = source.consecutiveFailures == 0;
+                    source.consecutiveFailures++;
+                    source.status.lastError = error.Message;
+                }
+
+                // Logged once per failing streak, not per retry
+                if (firstFailure) Debug.LogWarning($"DataConnector: Refresh of {definition.name} failed - {error.Message}");
+            }
+            finally
+            {
+                pool.Return(buffer);
+
+                lock (gate)
+                {
+                    float interval = definition.refreshInterval;
+                    if (!succeeded && source.consecutiveFailures > 0)
+                        interval = Math.Min(interval, settings.retryDelay * (1 << Math.Min(10, source.consecutiveFailures - 1)));
+
+                    source.status.loading = false;
+                    source.status.durationMs = (float)((Stopwatch.GetTimestamp() - started) * 1000.0 / Stopwatch.Frequency);
+                    source.nextRefreshUnixMs = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds() + (long)(interval * 1000f);
+                }
+            }
+        }
+
+        // Returns the cache entry holding the page and whether a new body was downloaded
+        private async Task<(DataCacheEntry entry, bool downloaded)> FetchPageAsync(Source source, string url, CancellationToken token)
+        {
+            bool cached = cache.TryGetEntry(url, out var entry);
+            if (cached && entry.AgeSeconds(DateTimeOffset.UtcNow.ToUnixTimeMilliseconds()) < source.definition.cacheTtl)
+            {
+                lock (gate) source.status.cacheHits++;
+                return (entry, false);
+            }
+
+            await source.limiter.WaitAsync(token).ConfigureAwait(false);
+            await requestSlots.WaitAsync(token).ConfigureAwait(false);
+            lock (gate)
+            {
+                requestsInFlight++;
+                source.status.requests++;
+            }
+
+            try
+            {
+                using (var request = new HttpRequestMessage(HttpMethod.Get, url))
+                {
+                    if (cached && entry.etag != null) request.Headers.TryAddWithoutValidation("If-None-Match", entry.etag);
+                    if (cached && entry.lastModified != null) request.Headers.TryAddWithoutValidation("If-Modified-Since", entry.lastModified);
+
+                    long sent = Stopwatch.GetTimestamp();
+                    using (var response = await client.SendAsync(request, HttpCompletionOption.ResponseHeadersRead, token).ConfigureAwait(false))
+                    {
+                        RecordLatency(source, (float)((Stopwatch.GetTimestamp() - sent) * 1000.0 / Stopwatch.Frequency));
+
+                        if (cached && response.StatusCode == HttpStatusCode.NotModified)
+                        {
+                            cache.Touch(url, ref entry, DateTimeOffset.UtcNow.ToUnixTimeMilliseconds());
+                            lock (gate) source.status.notModified++;
+                            return (entry, false);
+                        }
+
+                        response.EnsureSuccessStatusCode();
+                        string temporary = cache.CreateTemporaryPath(url);
+                        try
+                        {
+                            await DownloadAsync(source, response, temporary, token).ConfigureAwait(false);
+                            string etag = response.Headers.ETag?.ToString();
+                            string lastModified = response.Content.Headers.LastModified?.ToString("R");
+                            return (cache.Commit(url, temporary, etag, lastModified, DateTimeOffset.UtcNow.ToUnixTimeMilliseconds()), true);
+                        }
+                        catch
+                        {
+                            cache.Discard(temporary);
+                            throw;
+                        }
+                    }
+                }
+            }
+            catch (Exception e) when (cached && !token.IsCancellationRequested)
+            {
+                // Unreachable or failing server: keep serving the stale copy, but count the failure
+                lock (gate)
+                {
+                    source.status.failures++;
+                    source.status.lastError = e.Message;
+                }
+                return (entry, false);
+            }
+            catch (Exception) when (!token.IsCancellationRequested)
+            {
+                lock (gate) source.status.failures++;
+                throw;
+            }
+            finally
+            {
+                lock (gate) requestsInFlight--;
+                requestSlots.Release();
+            }
+        }
+
+        // Straight to disk through one pooled buffer, whatever the body size
+        private async Task DownloadAsync(Source source, HttpResponseMessage response, string path, CancellationToken token)
+        {
+            var buffer = ArrayPool<byte>.Shared.Rent(CopyBufferSize);
+            try
+            {
+                using (var body = await response.Content.ReadAsStreamAsync().ConfigureAwait(false))
+                using (var file = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.None, CopyBufferSize, true))
+                {
+                    int read;
+                    while ((read = await body.ReadAsync(buffer, 0, buffer.Length, token).ConfigureAwait(false)) > 0)
+                    {
+                        await file.WriteAsync(buffer, 0, read, token).ConfigureAwait(false);
+                        lock (gate) source.status.bytesDownloaded += read;
+                    }
+                }
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        private void RecordLatency(Source source, float milliseconds)
+        {
+            lock (gate)
+            {
+                var status = source.status;
+                status.latencyMs = status.requests <= 1 ? milliseconds : status.latencyMs + (milliseconds - status.latencyMs) * LatencySmoothing;
+                latencyMs = latencyMs <= 0f ? milliseconds : latencyMs + (milliseconds - latencyMs) * LatencySmoothing;
+            }
+        }
+
+        #endregion
+
+        // Cancels refreshes in flight and closes the pooled connections
+        public void Dispose()
+        {
+            lock (gate)
+            {
+                if (disposed) return;
+                disposed = true;
+            }
+
+            cancellation.Cancel();
+            client.Dispose();
+            for (int i = 0; i < sources.Count; i++)
+            {
+                pool.Return(sources[i].current);
+                sources[i].current = null;
+            }
+        }
+    }
+}
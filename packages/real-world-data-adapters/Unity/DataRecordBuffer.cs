@@ -0,0 +1,135 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+
+namespace UnitySim.RealWorldDataAdapters
+{
+    // Parsed records of one source as a row-major float table. Values come from
+    // ArrayPool<float>.Shared and buffers themselves are recycled by DataRecordBufferPool,
+    // so refreshing a source reuses the memory of the data it replaces. Missing or
+    // non-numeric values are NaN.
+    public class DataRecordBuffer
+    {
+        private readonly List<string> fields = new List<string>();
+        private readonly Dictionary<string, int> fieldIndex = new Dictionary<string, int>();
+        private float[] values = Array.Empty<float>();
+        private int count = 0;
+        private int row = -1;
+
+        public int FieldCount => fields.Count;
+        public int Count => count;
+        public long FetchedUnixMs { get; internal set; }
+
+        public string GetFieldName(int field) => fields[field];
+
+        // -1 when the source has no such field
+        public int GetFieldIndex(string name)
+        {
+            return name != null && fieldIndex.TryGetValue(name, out int index) ? index : -1;
+        }
+
+        public float Get(int record, int field)
+        {
+            if ((uint)record >= (uint)count) throw new ArgumentOutOfRangeException(nameof(record));
+            if ((uint)field >= (uint)fields.Count) throw new ArgumentOutOfRangeException(nameof(field));
+            return values[record * fields.Count + field];
+        }
+
+        public ReadOnlySpan<float> GetRecord(int record)
+        {
+            if ((uint)record >= (uint)count) throw new ArgumentOutOfRangeException(nameof(record));
+            return new ReadOnlySpan<float>(values, record * fields.Count, fields.Count);
+        }
+
+        public void Clear()
+        {
+            if (values.Length > 0) ArrayPool<float>.Shared.Return(values);
+            values = Array.Empty<float>();
+            fields.Clear();
+            fieldIndex.Clear();
+            count = 0;
+            row = -1;
+            FetchedUnixMs = 0;
+        }
+
+        #region Parser Interface
+
+        // Fields can only be added before the first record
+        internal int AddField(string name)
+        {
+            if (fieldIndex.TryGetValue(name, out int existing)) return existing;
+            if (count > 0 || row >= 0) return -1;
+
+            fieldIndex[name] = fields.Count;
+            fields.Add(name);
+            return fields.Count - 1;
+        }
+
+        internal void BeginRecord()
+        {
+            int stride = Math.Max(1, fields.Count);
+            int needed = (count + 1) * stride;
+            if (needed > values.Length)
+            {
+                var grown = ArrayPool<float>.Shared.Rent(Math.Max(needed, values.Length * 2));
+                Array.Copy(values, grown, count * stride);
+                if (values.Length > 0) ArrayPool<float>.Shared.Return(values);
+                values = grown;
+            }
+
+            row = count;
+            values.AsSpan(row * stride, stride).Fill(float.NaN);
+        }
+
+        internal void Set(int field, float value)
+        {
+            if (row >= 0 && (uint)field < (uint)fields.Count) values[row * fields.Count + field] = value;
+        }
+
+        internal void EndRecord()
+        {
+            if (row < 0) return;
+            count = row + 1;
+            row = -1;
+        }
+
+        // Drops a record begun but not ended
+        internal void CancelRecord()
+        {
+            row = -1;
+        }
+
+        #endregion
+    }
+
+    public class DataRecordBufferPool
+    {
+        private readonly Stack<DataRecordBuffer> free = new Stack<DataRecordBuffer>();
+        private readonly int maxPooled;
+
+        public DataRecordBufferPool(int maxPooled = 8)
+        {
+            this.maxPooled = Math.Max(1, maxPooled);
+        }
+
+        public DataRecordBuffer Rent()
+        {
+            lock (free)
+            {
+                if (free.Count > 0) return free.Pop();
+            }
+            return new DataRecordBuffer();
+        }
+
+        public void Return(DataRecordBuffer buffer)
+        {
+            if (buffer == null) return;
+
+            buffer.Clear();
+            lock (free)
+            {
+                if (free.Count < maxPooled) free.Push(buffer);
+            }
+        }
+    }
+}
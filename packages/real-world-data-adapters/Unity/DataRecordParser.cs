@@ -0,0 +1,308 @@
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Text;
+using Newtonsoft.Json;
+
+namespace UnitySim.RealWorldDataAdapters
+{
+    // Streams CSV or JSON straight into a DataRecordBuffer without loading the document, so the
+    // memory used is the parsed table plus a few fixed buffers however large the body is.
+    // Keeps its scratch between calls; one instance per thread.
+    public class DataRecordParser
+    {
+        private const int ReadBufferSize = 16 * 1024;
+        private const int MaxCellLength = 1 << 20;
+
+        // Newtonsoft's char buffers, served from the shared pool
+        private class CharPool : IArrayPool<char>
+        {
+            public static readonly CharPool Instance = new CharPool();
+            public char[] Rent(int minimumLength) => ArrayPool<char>.Shared.Rent(minimumLength);
+            public void Return(char[] array) => ArrayPool<char>.Shared.Return(array);
+        }
+
+        private readonly DefaultJsonNameTable nameTable = new DefaultJsonNameTable();
+        private readonly List<string> firstNames = new List<string>();
+        private readonly List<float> firstValues = new List<float>();
+        private readonly List<int> columns = new List<int>();
+        private char[] cell = new char[256];
+
+        public bool Truncated { get; private set; }     // stopped at maxRecords
+
+        // Appends up to maxRecords records; returns how many were added
+        public int Parse(Stream stream, DataSourceFormat format, string recordsField, DataRecordBuffer target, int maxRecords)
+        {
+            Truncated = false;
+            return format == DataSourceFormat.Csv
+                ? ParseCsv(stream, target, maxRecords)
+                : ParseJson(stream, recordsField, target, maxRecords);
+        }
+
+        #region CSV
+
+        private int ParseCsv(Stream stream, DataRecordBuffer target, int maxRecords)
+        {
+            var chunk = ArrayPool<char>.Shared.Rent(ReadBufferSize);
+            columns.Clear();
+
+            int records = 0, column = 0, length = 0;
+            bool header = true, quoted = false, inQuotes = false, quotePending = false, afterReturn = false;
+
+            try
+            {
+                using (var reader = new StreamReader(stream, Encoding.UTF8, true, ReadBufferSize))
+                {
+                    int read;
+                    while ((read = reader.Read(chunk, 0, chunk.Length)) > 0)
+                    {
+                        for (int i = 0; i < read; i++)
+                        {
+                            char ch = chunk[i];
+                            bool wasReturn = afterReturn;
+                            afterReturn = false;
+
+                            if (inQuotes)
+                            {
+                                if (quotePending)
+                                {
+                                    // "" inside quotes is a literal quote; anything else closed them
+                                    quotePending = false;
+                                    if (ch == '"')
+                                    {
+                                        Append(ch, ref length);
+                                        continue;
+                                    }
+                                    inQuotes = false;
+                                }
+                                else
+                                {
+                                    if (ch == '"') quotePending = true;
+                                    else Append(ch, ref length);
+                                    continue;
+                                }
+                            }
+
+                            if (ch == ',')
+                            {
+                                EndCell(target, false, ref column, ref length, ref quoted, ref header, ref records);
+                            }
+                            else if (ch == '\r' || (ch == '\n' && !wasReturn))
+                            {
+                                afterReturn = ch == '\r';
+                                EndCell(target, true, ref column, ref length, ref quoted, ref header, ref records);
+                                if (records >= maxRecords)
+                                {
+                                    Truncated = true;
+                                    return records;
+                                }
+                            }
+                            else if (ch == '\n')
+                            {
+                                // Second half of \r\n
+                            }
+                            else if (ch == '"' && length == 0 && !quoted)
+                            {
+                                inQuotes = true;
+                                quoted = true;
+                            }
+                            else
+                            {
+                                Append(ch, ref length);
+                            }
+                        }
+                    }
+                }
+
+                // Last line without a newline
+                if (column > 0 || length > 0 || quoted) EndCell(target, true, ref column, ref length, ref quoted, ref header, ref records);
+                return records;
+            }
+            finally
+            {
+                // A record cut short by an exception is dropped, not kept half-filled
+                target.CancelRecord();
+                ArrayPool<char>.Shared.Return(chunk);
+            }
+        }
+
+        private void EndCell(DataRecordBuffer target, bool endOfRow, ref int column, ref int length, ref bool quoted, ref bool header, ref int records)
+        {
+            // Blank line
+            if (endOfRow && column == 0 && length == 0 && !quoted) return;
+
+            if (header)
+            {
+                string name = length > 0 ? new string(cell, 0, length).Trim() : $"column{column}";
+                columns.Add(target.AddField(name));
+            }
+            else
+            {
+                if (column == 0) target.BeginRecord();
+                if (column < columns.Count && columns[column] >= 0) target.Set(columns[column], ParseNumber(length));
+            }
+
+            column++;
+            length = 0;
+            quoted = false;
+            if (!endOfRow) return;
+
+            if (header) header = false;
+            else
+            {
+                target.EndRecord();
+                records++;
+            }
+            column = 0;
+        }
+
+        private void Append(char ch, ref int length)
+        {
+            if (length == cell.Length)
+            {
+                // Oversized cells are cut, which only ever turns them into NaN
+                if (length >= MaxCellLength) return;
+                Array.Resize(ref cell, Math.Min(MaxCellLength, cell.Length * 2));
+            }
+            cell[length++] = ch;
+        }
+
+        private float ParseNumber(int length)
+        {
+            var text = new ReadOnlySpan<char>(cell, 0, length);
+            return float.TryParse(text, NumberStyles.Float, CultureInfo.InvariantCulture, out float value) ? value : float.NaN;
+        }
+
+        #endregion
+
+        #region JSON
+
+        private int ParseJson(Stream stream, string recordsField, DataRecordBuffer target, int maxRecords)
+        {
+            using (var reader = new JsonTextReader(new StreamReader(stream, Encoding.UTF8, true, ReadBufferSize)))
+            {
+                reader.ArrayPool = CharPool.Instance;
+                reader.PropertyNameTable = nameTable;
+                reader.DateParseHandling = DateParseHandling.None;
+
+                if (!SeekRecords(reader, recordsField)) return 0;
+
+                int records = 0;
+                try
+                {
+                    while (reader.Read() && reader.TokenType != JsonToken.EndArray)
+                    {
+                        if (reader.TokenType != JsonToken.StartObject)
+                        {
+                            reader.Skip();
+                            continue;
+                        }
+                        if (records >= maxRecords)
+                        {
+                            Truncated = true;
+                            break;
+                        }
+
+                        if (target.Count == 0) ReadFirstRecord(reader, target);
+                        else ReadRecord(reader, target);
+                        records++;
+                    }
+                    return records;
+                }
+                finally
+                {
+                    target.CancelRecord();
+                }
+            }
+        }
+
+        // Leaves the reader on the StartArray holding the records
+        private static bool SeekRecords(JsonTextReader reader, string recordsField)
+        {
+            if (string.IsNullOrEmpty(recordsField))
+                return reader.Read() && reader.TokenType == JsonToken.StartArray;
+
+            while (reader.Read())
+            {
+                if (reader.TokenType != JsonToken.PropertyName || (string)reader.Value != recordsField) continue;
+                if (!reader.Read()) return false;
+                if (reader.TokenType == JsonToken.StartArray) return true;
+                reader.Skip();
+            }
+            return false;
+        }
+
+        // The first record defines the fields: its numeric properties, in order
+        private void ReadFirstRecord(JsonTextReader reader, DataRecordBuffer target)
+        {
+            firstNames.Clear();
+            firstValues.Clear();
+            while (ReadProperty(reader, out string name, out float value))
+            {
+                if (name == null) continue;
+                firstNames.Add(name);
+                firstValues.Add(value);
+            }
+
+            for (int i = 0; i < firstNames.Count; i++) target.AddField(firstNames[i]);
+            target.BeginRecord();
+            for (int i = 0; i < firstNames.Count; i++) target.Set(target.GetFieldIndex(firstNames[i]), firstValues[i]);
+            target.EndRecord();
+        }
+
+        private static void ReadRecord(JsonTextReader reader, DataRecordBuffer target)
+        {
+            target.BeginRecord();
+            while (ReadProperty(reader, out string name, out float value))
+            {
+                if (name != null) target.Set(target.GetFieldIndex(name), value);
+            }
+            target.EndRecord();
+        }
+
+        // False at the record's EndObject; name is null for values that are not numbers
+        private static bool ReadProperty(JsonTextReader reader, out string name, out float value)
+        {
+            name = null;
+            value = float.NaN;
+            if (!reader.Read() || reader.TokenType == JsonToken.EndObject) return false;
+
+            string property = (string)reader.Value;
+            if (!reader.Read()) return false;
+
+            switch (reader.TokenType)
+            {
+                case JsonToken.Integer:
+                case JsonToken.Float:
+                    value = ToSingle(reader.Value);
+                    name = property;
+                    break;
+                case JsonToken.Boolean:
+                    value = (bool)reader.Value ? 1f : 0f;
+                    name = property;
+                    break;
+                case JsonToken.StartObject:
+                case JsonToken.StartArray:
+                    reader.Skip();
+                    break;
+            }
+            return true;
+        }
+
+        // Integers beyond long come back as BigInteger and are left as NaN
+        private static float ToSingle(object number)
+        {
+            switch (number)
+            {
+                case long integer: return integer;
+                case double real: return (float)real;
+                case decimal exact: return (float)exact;
+                default: return float.NaN;
+            }
+        }
+
+        #endregion
+    }
+}
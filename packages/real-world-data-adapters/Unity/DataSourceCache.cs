@@ -0,0 +1,127 @@
+using System;
+using System.IO;
+using System.Text;
+using System.Threading;
+
+namespace UnitySim.RealWorldDataAdapters
+{
+    public struct DataCacheEntry
+    {
+        public string bodyPath;
+        public string etag;
+        public string lastModified;
+        public long fetchedUnixMs;      // when the server last confirmed this body
+        public long bytes;
+
+        public double AgeSeconds(long nowUnixMs) => Math.Max(0, nowUnixMs - fetchedUnixMs) / 1000.0;
+    }
+
+    // Response bodies on disk, one file per URL plus a small metadata file with the validators
+    // (ETag, Last-Modified) and the time the server last confirmed the body. Bodies are
+    // downloaded to a temporary file and moved into place, so a crash mid-download never
+    // leaves a truncated entry. Safe for concurrent use as long as each URL has one writer.
+    public class DataSourceCache
+    {
+        private readonly string directory;
+        private int temporaryCounter = 0;
+
+        public string Directory => directory;
+
+        public DataSourceCache(string directory)
+        {
+            this.directory = directory;
+            System.IO.Directory.CreateDirectory(directory);
+        }
+
+        public bool TryGetEntry(string url, out DataCacheEntry entry)
+        {
+            entry = default;
+            string key = GetKey(url);
+            string bodyPath = Path.Combine(directory, key + ".body");
+            string metaPath = Path.Combine(directory, key + ".meta");
+
+            try
+            {
+                if (!File.Exists(bodyPath) || !File.Exists(metaPath)) return false;
+
+                var lines = File.ReadAllLines(metaPath, Encoding.UTF8);
+                if (lines.Length < 4 || lines[0] != url || !long.TryParse(lines[3], out long fetched)) return false;
+
+                entry.bodyPath = bodyPath;
+                entry.etag = lines[1].Length > 0 ? lines[1] : null;
+                entry.lastModified = lines[2].Length > 0 ? lines[2] : null;
+                entry.fetchedUnixMs = fetched;
+                entry.bytes = new FileInfo(bodyPath).Length;
+                return true;
+            }
+            catch (IOException)
+            {
+                return false;
+            }
+        }
+
+        // A fresh path to download into before Commit
+        public string CreateTemporaryPath(string url)
+        {
+            return Path.Combine(directory, $"{GetKey(url)}.{Interlocked.Increment(ref temporaryCounter)}.tmp");
+        }
+
+        public DataCacheEntry Commit(string url, string temporaryPath, string etag, string lastModified, long fetchedUnixMs)
+        {
+            string key = GetKey(url);
+            string bodyPath = Path.Combine(directory, key + ".body");
+
+            if (File.Exists(bodyPath)) File.Delete(bodyPath);
+            File.Move(temporaryPath, bodyPath);
+            WriteMeta(key, url, etag, lastModified, fetchedUnixMs);
+
+            return new DataCacheEntry
+            {
+                bodyPath = bodyPath,
+                etag = etag,
+                lastModified = lastModified,
+                fetchedUnixMs = fetchedUnixMs,
+                bytes = new FileInfo(bodyPath).Length
+            };
+        }
+
+        // After a 304: the body is unchanged and confirmed as of fetchedUnixMs
+        public void Touch(string url, ref DataCacheEntry entry, long fetchedUnixMs)
+        {
+            entry.fetchedUnixMs = fetchedUnixMs;
+            WriteMeta(GetKey(url), url, entry.etag, entry.lastModified, fetchedUnixMs);
+        }
+
+        public void Discard(string temporaryPath)
+        {
+            try
+            {
+                if (File.Exists(temporaryPath)) File.Delete(temporaryPath);
+            }
+            catch (IOException)
+            {
+            }
+        }
+
+        private void WriteMeta(string key, string url, string etag, string lastModified, long fetchedUnixMs)
+        {
+            string metaPath = Path.Combine(directory, key + ".meta");
+            string temporary = metaPath + ".tmp";
+            File.WriteAllText(temporary, $"{url}\n{etag}\n{lastModified}\n{fetchedUnixMs}\n", Encoding.UTF8);
+            if (File.Exists(metaPath)) File.Delete(metaPath);
+            File.Move(temporary, metaPath);
+        }
+
+        // FNV-1a of the URL; the URL itself is kept in the metadata to rule out collisions
+        private static string GetKey(string url)
+        {
+            ulong hash = 14695981039346656037UL;
+            for (int i = 0; i < url.Length; i++)
+            {
+                hash ^= url[i];
+                hash *= 1099511628211UL;
+            }
+            return hash.ToString("x16");
+        }
+    }
+}
@@ -0,0 +1,49 @@
+using System;
+using UnityEngine;
+
+namespace UnitySim.RealWorldDataAdapters
+{
+    public enum DataSourceFormat
+    {
+        Json,   // an array of flat objects, at the top level or under recordsField
+        Csv     // header row of field names, then one record per line
+    }
+
+    // One REST endpoint. Every numeric field of a record becomes a column of the source's
+    // DataRecordBuffer; strings and nested values are skipped.
+    [Serializable]
+    public class DataSourceDefinition
+    {
+        public string name = "source";
+        public string url = "";
+        public DataSourceFormat format = DataSourceFormat.Json;
+        public bool enabled = true;
+
+        public string recordsField = "";        // JSON property holding the records; empty when the response is the array
+        public int pages = 1;                   // fetched per refresh, with {page} in the url replaced by 1..pages
+
+        [Header("Refresh")]
+        public float refreshInterval = 60f;     // seconds between refreshes
+        public float cacheTtl = 300f;           // seconds a cached response is used without asking the server
+        public int maxRecords = 100000;
+
+        [Header("Rate Limit")]
+        public float requestsPerSecond = 2f;
+        public int burst = 4;
+
+        public string GetPageUrl(int page)
+        {
+            return pages > 1 ? url.Replace("{page}", page.ToString()) : url;
+        }
+
+        public void Validate()
+        {
+            pages = Mathf.Max(1, pages);
+            refreshInterval = Mathf.Max(1f, refreshInterval);
+            cacheTtl = Mathf.Max(0f, cacheTtl);
+            maxRecords = Mathf.Max(1, maxRecords);
+            requestsPerSecond = Mathf.Max(0.01f, requestsPerSecond);
+            burst = Mathf.Max(1, burst);
+        }
+    }
+}
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.RealWorldDataAdapters
 {
@@ -13,32 +17,150 @@ namespace UnitySim.RealWorldDataAdapters
 
         public RealWorldDataAdaptersData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             realworlddataadapters = new RealWorldDataAdaptersInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (realworlddataadapters != null)
+                realworlddataadapters.WriteState(writer, "realworlddataadapters");
+            else
+                writer.Write("realworlddataadapters", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
     public class RealWorldDataAdaptersInfo
     {
-                public int apiConnections = 3;
-        public float dataFreshness = 95f;
-        public int recordsProcessed = 0;
+        public int apiConnections = 0;
+        public float dataFreshness = 0f;
+        public long recordsProcessed = 0;
         public bool realTimeSync = true;
-        public float latency = 150f;
+        public float latency = 0f;
         public string dataSource = "REST_API";
         public string systemHealth = "operational";
         public string framework = "unity-sim-real-world-data-adapters";
+        public int requestsInFlight = 0;
+        public long cacheHits = 0;
+        public long failedRequests = 0;
+        public long bytesDownloaded = 0;
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("apiConnections", apiConnections);
+            writer.Write("dataFreshness", dataFreshness);
+            writer.Write("recordsProcessed", recordsProcessed);
+            writer.Write("realTimeSync", realTimeSync);
+            writer.Write("latency", latency);
+            writer.Write("dataSource", dataSource);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.Write("requestsInFlight", requestsInFlight);
+            writer.Write("cacheHits", cacheHits);
+            writer.Write("failedRequests", failedRequests);
+            writer.Write("bytesDownloaded", bytesDownloaded);
+            writer.EndObject();
+        }
+
+        public RealWorldDataAdaptersField Diff(RealWorldDataAdaptersInfo other)
+        {
+            var changed = RealWorldDataAdaptersField.None;
+            if (apiConnections != other.apiConnections) changed |= RealWorldDataAdaptersField.ApiConnections;
+            if (dataFreshness != other.dataFreshness) changed |= RealWorldDataAdaptersField.DataFreshness;
+            if (recordsProcessed != other.recordsProcessed) changed |= RealWorldDataAdaptersField.RecordsProcessed;
+            if (realTimeSync != other.realTimeSync) changed |= RealWorldDataAdaptersField.RealTimeSync;
+            if (latency != other.latency) changed |= RealWorldDataAdaptersField.Latency;
+            if (dataSource != other.dataSource) changed |= RealWorldDataAdaptersField.DataSource;
+            if (systemHealth != other.systemHealth) changed |= RealWorldDataAdaptersField.SystemHealth;
+            if (framework != other.framework) changed |= RealWorldDataAdaptersField.Framework;
+            if (requestsInFlight != other.requestsInFlight) changed |= RealWorldDataAdaptersField.RequestsInFlight;
+            if (cacheHits != other.cacheHits) changed |= RealWorldDataAdaptersField.CacheHits;
+            if (failedRequests != other.failedRequests) changed |= RealWorldDataAdaptersField.FailedRequests;
+            if (bytesDownloaded != other.bytesDownloaded) changed |= RealWorldDataAdaptersField.BytesDownloaded;
+            return changed;
+        }
+
+        public void CopyTo(RealWorldDataAdaptersInfo target)
+        {
+            target.apiConnections = apiConnections;
+            target.dataFreshness = dataFreshness;
+            target.recordsProcessed = recordsProcessed;
+            target.realTimeSync = realTimeSync;
+            target.latency = latency;
+            target.dataSource = dataSource;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+            target.requestsInFlight = requestsInFlight;
+            target.cacheHits = cacheHits;
+            target.failedRequests = failedRequests;
+            target.bytesDownloaded = bytesDownloaded;
+        }
+    }
+
+    [System.Flags]
+    public enum RealWorldDataAdaptersField
+    {
+        None = 0,
+        ApiConnections = 1 << 0,
+        DataFreshness = 1 << 1,
+        RecordsProcessed = 1 << 2,
+        RealTimeSync = 1 << 3,
+        Latency = 1 << 4,
+        DataSource = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        RequestsInFlight = 1 << 8,
+        CacheHits = 1 << 9,
+        FailedRequests = 1 << 10,
+        BytesDownloaded = 1 << 11,
+        All = (1 << 12) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct RealWorldDataAdaptersDelta
+    {
+        public readonly long timestamp;
+        public readonly RealWorldDataAdaptersField changed;
+        public readonly RealWorldDataAdaptersInfo values;
+
+        public RealWorldDataAdaptersDelta(long timestamp, RealWorldDataAdaptersField changed, RealWorldDataAdaptersInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(RealWorldDataAdaptersField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class RealWorldDataAdaptersSystem : MonoBehaviour
+    public class RealWorldDataAdaptersSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("RealWorldDataAdapters Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Data Sources")]
+        public DataSourceDefinition[] sources = new DataSourceDefinition[0];
+
+        [Header("Connector")]
+        public string cacheFolder = "real-world-data-cache";   // under persistentDataPath
+        public int maxConcurrentRequests = 4;
+        public int maxConnectionsPerServer = 4;
+        public float requestTimeout = 30f;
+        [SerializeField] private int loadingSources = 0;
+        [SerializeField] private string lastError = "";
+
         [Header("Current Data")]
         [SerializeField] private RealWorldDataAdaptersData currentData;
 
@@ -48,12 +170,25 @@ namespace UnitySim.RealWorldDataAdapters
 
         // Events
         public System.Action<RealWorldDataAdaptersData> OnRealWorldDataAdaptersChanged;
+        public System.Action<RealWorldDataAdaptersDelta> OnRealWorldDataAdaptersDelta;
         public System.Action<string> OnDataExported;
+        public System.Action<string, DataRecordBuffer> OnSourceUpdated;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.RealWorldDataAdaptersSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly RealWorldDataAdaptersInfo publishedInfo = new RealWorldDataAdaptersInfo();
+        private bool publishFullDelta = true;
+
+        // Connector
+        private DataConnector connector;
+        private readonly DataConnectorSummary summary = new DataConnectorSummary();
+        private readonly DataSourceStatus sourceStatus = new DataSourceStatus();
+        private bool sourcesChanged = false;
 
         #region Unity Lifecycle
 
@@ -62,18 +197,22 @@ namespace UnitySim.RealWorldDataAdapters
             InitializeRealWorldDataAdapters();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            connector?.Dispose();
+            connector = null;
         }
 
         #endregion
@@ -83,33 +222,93 @@ namespace UnitySim.RealWorldDataAdapters
         private void InitializeRealWorldDataAdapters()
         {
             currentData = new RealWorldDataAdaptersData();
+            CreateConnector();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
                 Debug.Log($"RealWorldDataAdaptersSystem initialized successfully");
         }
 
+        // Cached responses make a new connector cheap: fresh pages are parsed from disk, not downloaded
+        private void CreateConnector()
+        {
+            connector?.Dispose();
+            sourcesChanged = false;
+
+            connector = new DataConnector(new DataConnectorSettings
+            {
+                cacheDirectory = System.IO.Path.Combine(Application.persistentDataPath, cacheFolder),
+                maxConcurrentRequests = maxConcurrentRequests,
+                maxConnectionsPerServer = maxConnectionsPerServer,
+                requestTimeout = requestTimeout
+            });
+            connector.SourceUpdated += HandleSourceUpdated;
+
+            for (int i = 0; sources != null && i < sources.Length; i++)
+            {
+                if (sources[i] != null) connector.AddSource(sources[i]);
+            }
+        }
+
+        private void HandleSourceUpdated(int index, DataRecordBuffer records)
+        {
+            connector.GetStatus(index, sourceStatus);
+            if (enableLogging)
+                Debug.Log($"RealWorldDataAdaptersSystem: {sourceStatus.name} updated - {records.Count} records, {records.FieldCount} fields");
+
+            if (enableEvents) OnSourceUpdated?.Invoke(sourceStatus.name, records);
+        }
+
         #endregion
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        // Freshness and cache ages are wall-clock, since they refer to the servers' data
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.realworlddataadapters.recordsProcessed += UnityEngine.Random.Range(10, 100);
-            currentData.realworlddataadapters.dataFreshness = Mathf.Clamp(currentData.realworlddataadapters.dataFreshness + UnityEngine.Random.Range(-2f, 1f), 70f, 100f);
-            currentData.realworlddataadapters.latency += UnityEngine.Random.Range(-10f, 20f);
+            if (connector == null) return;
+
+            // Edited sources apply once nothing is downloading, so a tweak never cancels a transfer
+            if (sourcesChanged && loadingSources == 0) CreateConnector();
+
+            long now = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+            connector.Update(now);
+            connector.GetSummary(now, summary);
+
+            var info = currentData.realworlddataadapters;
+            info.apiConnections = summary.enabledSources;
+            info.recordsProcessed = summary.recordsParsed;
+            info.dataFreshness = summary.freshness;
+            info.latency = summary.latencyMs;
+            info.realTimeSync = summary.enabledSources > 0 && summary.freshness >= 99.9f;
+            info.systemHealth = summary.failingSources > 0 ? "degraded" : "operational";
+            info.requestsInFlight = summary.requestsInFlight;
+            info.cacheHits = summary.cacheHits + summary.notModified;
+            info.failedRequests = summary.failures;
+            info.bytesDownloaded = summary.bytesDownloaded;
+            loadingSources = summary.loadingSources;
+
+            lastError = "";
+            for (int i = 0; i < connector.SourceCount; i++)
+            {
+                connector.GetStatus(i, sourceStatus);
+                if (sourceStatus.lastError == null) continue;
+                lastError = $"{sourceStatus.name}: {sourceStatus.lastError}";
+                break;
+            }
         }
 
         private void ProcessUpdate()
@@ -122,6 +321,12 @@ namespace UnitySim.RealWorldDataAdapters
                 OnRealWorldDataAdaptersChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +334,67 @@ namespace UnitySim.RealWorldDataAdapters
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.realworlddataadapters;
+            var changed = publishFullDelta ? RealWorldDataAdaptersField.All : info.Diff(publishedInfo);
+            if (changed == RealWorldDataAdaptersField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnRealWorldDataAdaptersDelta?.Invoke(new RealWorldDataAdaptersDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(RealWorldDataAdaptersSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("RealWorldDataAdaptersSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +405,9 @@ namespace UnitySim.RealWorldDataAdapters
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +428,33 @@ namespace UnitySim.RealWorldDataAdapters
             return currentData;
         }
 
+        // Latest parsed records of a source, or null before its first load. The buffer is
+        // recycled when the next refresh lands, so copy what must outlive OnSourceUpdated.
+        public DataRecordBuffer GetRecords(string sourceName)
+        {
+            return connector?.GetRecords(connector.FindSource(sourceName));
+        }
+
+        public bool GetSourceStatus(string sourceName, DataSourceStatus target)
+        {
+            int index = connector != null ? connector.FindSource(sourceName) : -1;
+            if (index < 0) return false;
+
+            connector.GetStatus(index, target);
+            return true;
+        }
+
+        // Revalidates on the next update; pages still inside cacheTtl come from disk
+        public void RefreshSource(string sourceName)
+        {
+            connector?.RequestRefresh(connector.FindSource(sourceName));
+        }
+
+        public DataConnector GetConnector()
+        {
+            return connector;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -192,10 +483,17 @@ namespace UnitySim.RealWorldDataAdapters
             ResetData();
         }
 
+        [ContextMenu("Refresh All Sources")]
+        public void RefreshAllSources()
+        {
+            if (connector == null) return;
+            for (int i = 0; i < connector.SourceCount; i++) connector.RequestRefresh(i);
+        }
+
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +505,15 @@ namespace UnitySim.RealWorldDataAdapters
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            maxConcurrentRequests = Mathf.Max(1, maxConcurrentRequests);
+            maxConnectionsPerServer = Mathf.Max(1, maxConnectionsPerServer);
+            requestTimeout = Mathf.Max(1f, requestTimeout);
+            if (sources != null)
+            {
+                for (int i = 0; i < sources.Length; i++) sources[i]?.Validate();
+            }
+
+            sourcesChanged = true;
         }
 
         #endregion
@@ -218,7 +525,11 @@ namespace UnitySim.RealWorldDataAdapters
             Debug.Log($"RealWorldDataAdaptersSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Sources: {summary.enabledSources}/{sources?.Length ?? 0} enabled, {summary.loadingSources} loading, {summary.records} records, freshness {summary.freshness:F1}%");
+            Debug.Log($"- Requests: {summary.requests} sent, {summary.requestsInFlight} in flight, {summary.latencyMs:F0}ms latency, {summary.failures} failed");
+            Debug.Log($"- Cache: {summary.cacheHits} hits, {summary.notModified} not modified, {summary.bytesDownloaded / (1024 * 1024)} MB downloaded");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
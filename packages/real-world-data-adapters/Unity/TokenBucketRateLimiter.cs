@@ -0,0 +1,50 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace UnitySim.RealWorldDataAdapters
+{
+    // Allows burst requests at once and then ratePerSecond on average. Waiters reserve their
+    // token up front, so concurrent callers are spaced out instead of all waking together.
+    public class TokenBucketRateLimiter
+    {
+        private readonly object gate = new object();
+        private readonly double ticksPerToken;
+        private readonly double capacity;
+        private double tokens;
+        private long lastRefill;
+
+        public TokenBucketRateLimiter(float ratePerSecond, int burst)
+        {
+            ticksPerToken = Stopwatch.Frequency / Math.Max(0.01, ratePerSecond);
+            capacity = Math.Max(1, burst);
+            tokens = capacity;
+            lastRefill = Stopwatch.GetTimestamp();
+        }
+
+        // Requests that had to wait for a token, for stats
+        public long Throttled { get; private set; }
+
+        public Task WaitAsync(CancellationToken cancellation)
+        {
+            long delayTicks;
+            lock (gate)
+            {
+                long now = Stopwatch.GetTimestamp();
+                tokens = Math.Min(capacity, tokens + (now - lastRefill) / ticksPerToken);
+                lastRefill = now;
+
+                // Going negative is the reservation; the wait pays it back
+                tokens -= 1.0;
+                if (tokens >= 0.0) return Task.CompletedTask;
+
+                Throttled++;
+                delayTicks = (long)(-tokens * ticksPerToken);
+            }
+
+            int delayMs = (int)Math.Ceiling(delayTicks * 1000.0 / Stopwatch.Frequency);
+            return Task.Delay(Math.Max(1, delayMs), cancellation);
+        }
+    }
+}
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Resources
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Resources
 
         public ResourcesData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             resources = new ResourcesInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (resources != null)
+                resources.WriteState(writer, "resources");
+            else
+                writer.Write("resources", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,9 +46,84 @@ namespace UnitySim.Resources
         public float efficiency = 88f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-resources";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("totalResources", totalResources);
+            writer.Write("availableResources", availableResources);
+            writer.Write("utilizationRate", utilizationRate);
+            writer.Write("resourceTypes", resourceTypes);
+            writer.Write("autoBalance", autoBalance);
+            writer.Write("efficiency", efficiency);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public ResourcesField Diff(ResourcesInfo other)
+        {
+            var changed = ResourcesField.None;
+            if (totalResources != other.totalResources) changed |= ResourcesField.TotalResources;
+            if (availableResources != other.availableResources) changed |= ResourcesField.AvailableResources;
+            if (utilizationRate != other.utilizationRate) changed |= ResourcesField.UtilizationRate;
+            if (resourceTypes != other.resourceTypes) changed |= ResourcesField.ResourceTypes;
+            if (autoBalance != other.autoBalance) changed |= ResourcesField.AutoBalance;
+            if (efficiency != other.efficiency) changed |= ResourcesField.Efficiency;
+            if (systemHealth != other.systemHealth) changed |= ResourcesField.SystemHealth;
+            if (framework != other.framework) changed |= ResourcesField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(ResourcesInfo target)
+        {
+            target.totalResources = totalResources;
+            target.availableResources = availableResources;
+            target.utilizationRate = utilizationRate;
+            target.resourceTypes = resourceTypes;
+            target.autoBalance = autoBalance;
+            target.efficiency = efficiency;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum ResourcesField
+    {
+        None = 0,
+        TotalResources = 1 << 0,
+        AvailableResources = 1 << 1,
+        UtilizationRate = 1 << 2,
+        ResourceTypes = 1 << 3,
+        AutoBalance = 1 << 4,
+        Efficiency = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
     }
 
-    public class ResourcesSystem : MonoBehaviour
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct ResourcesDelta
+    {
+        public readonly long timestamp;
+        public readonly ResourcesField changed;
+        public readonly ResourcesInfo values;
+
+        public ResourcesDelta(long timestamp, ResourcesField changed, ResourcesInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(ResourcesField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class ResourcesSystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem
     {
         [Header("Resources Settings")]
         public float updateInterval = 1f;
@@ -48,12 +139,19 @@ namespace UnitySim.Resources
 
         // Events
         public System.Action<ResourcesData> OnResourcesChanged;
+        public System.Action<ResourcesDelta> OnResourcesDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.ResourcesSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly ResourcesInfo publishedInfo = new ResourcesInfo();
+        private bool publishFullDelta = true;
+        private int stateVersion = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +160,16 @@ namespace UnitySim.Resources
             InitializeResources();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +179,8 @@ namespace UnitySim.Resources
         private void InitializeResources()
         {
             currentData = new ResourcesData();
+            stateVersion++;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,19 +191,19 @@ namespace UnitySim.Resources
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
                         currentData.resources.availableResources = Mathf.Max(0, currentData.resources.availableResources + UnityEngine.Random.Range(-20, 10));
             currentData.resources.utilizationRate = (currentData.resources.totalResources - currentData.resources.availableResources) * 100f / currentData.resources.totalResources;
@@ -122,6 +220,12 @@ namespace UnitySim.Resources
                 OnResourcesChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +233,96 @@ namespace UnitySim.Resources
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.resources;
+            var changed = publishFullDelta ? ResourcesField.All : info.Diff(publishedInfo);
+            if (changed == ResourcesField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnResourcesDelta?.Invoke(new ResourcesDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(ResourcesSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.AddInt(-20, 10).WithMin(0f));
+            channels.Add(SimulationChannel.Add(-1f, 2f).Clamp(60f, 100f));
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.resources.availableResources;
+            values[1] = currentData.resources.efficiency;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.resources.availableResources = (int)values[0];
+            currentData.resources.efficiency = (float)values[1];
+
+            // Utilization is derived rather than stepped
+            currentData.resources.utilizationRate = (currentData.resources.totalResources - currentData.resources.availableResources) * 100f / currentData.resources.totalResources;
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("ResourcesSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +333,9 @@ namespace UnitySim.Resources
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -195,7 +387,7 @@ namespace UnitySim.Resources
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -218,6 +410,7 @@ namespace UnitySim.Resources
             Debug.Log($"ResourcesSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
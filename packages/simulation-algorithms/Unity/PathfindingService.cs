@@ -0,0 +1,537 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using UnityEngine;
+using UnitySim.Core;
+using Debug = UnityEngine.Debug;
+
+namespace UnitySim.SimulationAlgorithms
+{
+    // Queues path requests and solves them in batches with a Burst A* job. The grid is a
+    // flat byte array of entry costs. Each worker owns a slice of pooled search state
+    // (g scores, parents, an indexed binary heap) that is reused across searches; stamps
+    // mark which entries belong to the current search, so nothing is cleared per search.
+    public class PathfindingService : IDisposable
+    {
+        private struct PathQuery
+        {
+            public int start;
+            public int goal;
+        }
+
+        private struct PathOutput
+        {
+            public int length;
+            public int expanded;
+            public PathStatus status;
+        }
+
+        private struct PendingRequest
+        {
+            public int id;
+            public int start;
+            public int goal;
+            public long queuedTicks;
+            public Action<PathResult> callback;
+        }
+
+        private const float Diagonal = 1.41421356f;
+
+        private readonly int width;
+        private readonly int height;
+        private readonly int cells;
+        private readonly int workerCount;
+        private readonly int batchSize;
+        private readonly int maxPathLength;
+
+        private NativeArray<byte> costs;
+        private NativeArray<PathQuery> queries;
+        private NativeArray<PathOutput> outputs;
+        private NativeArray<int> paths;
+
+        // Per-worker pooled search state, workerCount * cells entries each
+        private NativeArray<float> gScore;
+        private NativeArray<int> parent;
+        private NativeArray<int> stamp;
+        private NativeArray<int> heapPosition;
+        private NativeArray<int> heap;
+        private NativeArray<float> heapKey;
+        private NativeArray<int> generation;
+
+        private readonly Queue<PendingRequest> pending = new Queue<PendingRequest>();
+        private readonly List<PendingRequest> inFlight = new List<PendingRequest>();
+        private readonly List<KeyValuePair<int, byte>> deferredCosts = new List<KeyValuePair<int, byte>>();
+        private readonly List<Vector2Int> pathScratch = new List<Vector2Int>(256);
+        private JobHandle handle;
+        private bool jobScheduled = false;
+        private int nextRequestId = 1;
+        private bool disposed = false;
+
+        public int Width => width;
+        public int Height => height;
+        public int WorkerCount => workerCount;
+        public int PendingRequests => pending.Count + inFlight.Count;
+        public int MaxExpansions { get; set; } = 0;
+
+        // Running totals for reporting
+        public long CompletedRequests { get; private set; }
+        public long FoundPaths { get; private set; }
+        public long NodesExpanded { get; private set; }
+        public long PathCellsReturned { get; private set; }
+        public double TotalLatencyMs { get; private set; }
+        public float LastBatchMs { get; private set; }
+
+        public PathfindingService(int width, int height, int workers = 0, int batchSize = 256, int maxPathLength = 1024)
+        {
+            this.width = Math.Max(1, width);
+            this.height = Math.Max(1, height);
+            cells = this.width * this.height;
+            workerCount = Math.Max(1, workers > 0 ? workers : Environment.ProcessorCount);
+            this.batchSize = Math.Max(1, batchSize);
+            this.maxPathLength = Math.Max(2, maxPathLength);
+
+            costs = new NativeArray<byte>(cells, Allocator.Persistent, NativeArrayOptions.UninitializedMemory);
+            for (int i = 0; i < cells; i++) costs[i] = 1;
+
+            queries = new NativeArray<PathQuery>(this.batchSize, Allocator.Persistent);
+            outputs = new NativeArray<PathOutput>(this.batchSize, Allocator.Persistent);
+            paths = new NativeArray<int>(this.batchSize * this.maxPathLength, Allocator.Persistent);
+
+            int scratch = workerCount * cells;
+            gScore = new NativeArray<float>(scratch, Allocator.Persistent);
+            parent = new NativeArray<int>(scratch, Allocator.Persistent);
+            stamp = new NativeArray<int>(scratch, Allocator.Persistent);
+            heapPosition = new NativeArray<int>(scratch, Allocator.Persistent);
+            heap = new NativeArray<int>(scratch, Allocator.Persistent);
+            heapKey = new NativeArray<float>(scratch, Allocator.Persistent);
+            generation = new NativeArray<int>(workerCount, Allocator.Persistent);
+        }
+
+        #region Grid
+
+        public bool InBounds(Vector2Int cell)
+        {
+            return cell.x >= 0 && cell.y >= 0 && cell.x < width && cell.y < height;
+        }
+
+        public byte GetCost(Vector2Int cell)
+        {
+            return InBounds(cell) ? costs[cell.x + cell.y * width] : (byte)0;
+        }
+
+        // Edits made while a batch is running apply once it completes
+        public void SetCost(Vector2Int cell, byte cost)
+        {
+            if (!InBounds(cell)) return;
+
+            int index = cell.x + cell.y * width;
+            if (jobScheduled)
+                deferredCosts.Add(new KeyValuePair<int, byte>(index, cost));
+            else
+                costs[index] = cost;
+        }
+
+        #endregion
+
+        #region Requests
+
+        // -1 once the service is disposed, without a callback
+        public int RequestPath(Vector2Int start, Vector2Int goal, Action<PathResult> onComplete)
+        {
+            if (disposed) return -1;
+
+            int id = nextRequestId++;
+            pending.Enqueue(new PendingRequest
+            {
+                id = id,
+                start = InBounds(start) ? start.x + start.y * width : -1,
+                goal = InBounds(goal) ? goal.x + goal.y * width : -1,
+                queuedTicks = Stopwatch.GetTimestamp(),
+                callback = onComplete
+            });
+            return id;
+        }
+
+        // Starts the next batch if none is running; call early in the frame
+        public void Schedule()
+        {
+            if (disposed || jobScheduled || pending.Count == 0) return;
+
+            int count = Math.Min(batchSize, pending.Count);
+            for (int i = 0; i < count; i++)
+            {
+                var request = pending.Dequeue();
+                inFlight.Add(request);
+                queries[i] = new PathQuery { start = request.start, goal = request.goal };
+            }
+
+            handle = new AStarJob
+            {
+                width = width,
+                height = height,
+                cells = cells,
+                requestCount = count,
+                workerCount = Math.Min(workerCount, count),
+                maxPathLength = maxPathLength,
+                maxExpansions = MaxExpansions > 0 ? MaxExpansions : cells,
+                costs = costs,
+                queries = queries,
+                outputs = outputs,
+                paths = paths,
+                gScore = gScore,
+                parent = parent,
+                stamp = stamp,
+                heapPosition = heapPosition,
+                heap = heap,
+                heapKey = heapKey,
+                generation = generation
+            }.Schedule(Math.Min(workerCount, count), 1);
+
+            jobScheduled = true;
+            JobHandle.ScheduleBatchedJobs();
+        }
+
+        // Completes the running batch and invokes its callbacks; call late in the frame
+        public int Complete()
+        {
+            if (!jobScheduled) return 0;
+
+            var stopwatch = Stopwatch.StartNew();
+            handle.Complete();
+            jobScheduled = false;
+
+            for (int i = 0; i < deferredCosts.Count; i++)
+            {
+                costs[deferredCosts[i].Key] = deferredCosts[i].Value;
+            }
+            deferredCosts.Clear();
+
+            long now = Stopwatch.GetTimestamp();
+            int completed = inFlight.Count;
+            for (int i = 0; i < completed; i++)
+            {
+                var request = inFlight[i];
+                var output = outputs[i];
+
+                pathScratch.Clear();
+                if (output.status == PathStatus.Found)
+                {
+                    int offset = i * maxPathLength;
+                    for (int p = 0; p < output.length; p++)
+                    {
+                        int cell = paths[offset + p];
+                        pathScratch.Add(new Vector2Int(cell % width, cell / width));
+                    }
+                    FoundPaths++;
+                    PathCellsReturned += output.length;
+                }
+
+                float latencyMs = (float)((now - request.queuedTicks) * 1000.0 / Stopwatch.Frequency);
+                CompletedRequests++;
+                NodesExpanded += output.expanded;
+                TotalLatencyMs += latencyMs;
+
+                try
+                {
+                    request.callback?.Invoke(new PathResult(request.id, output.status, output.expanded, latencyMs, pathScratch));
+                }
+                catch (Exception e)
+                {
+                    Debug.LogError($"PathfindingService: Callback for request {request.id} failed - {e.Message}");
+                }
+            }
+            inFlight.Clear();
+
+            stopwatch.Stop();
+            LastBatchMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+            return completed;
+        }
+
+        // In-flight requests finish with their results and queued ones are cancelled, so every
+        // caller gets exactly one callback
+        public void Dispose()
+        {
+            if (disposed) return;
+
+            Complete();
+            disposed = true;
+            CancelPending();
+
+            costs.Dispose();
+            queries.Dispose();
+            outputs.Dispose();
+            paths.Dispose();
+            gScore.Dispose();
+            parent.Dispose();
+            stamp.Dispose();
+            heapPosition.Dispose();
+            heap.Dispose();
+            heapKey.Dispose();
+            generation.Dispose();
+        }
+
+        private void CancelPending()
+        {
+            long now = Stopwatch.GetTimestamp();
+            pathScratch.Clear();
+            while (pending.Count > 0)
+            {
+                var request = pending.Dequeue();
+                float latencyMs = (float)((now - request.queuedTicks) * 1000.0 / Stopwatch.Frequency);
+
+                try
+                {
+                    request.callback?.Invoke(new PathResult(request.id, PathStatus.Cancelled, 0, latencyMs, pathScratch));
+                }
+                catch (Exception e)
+                {
+                    Debug.LogError($"PathfindingService: Callback for request {request.id} failed - {e.Message}");
+                }
+            }
+        }
+
+        #endregion
+
+        #region Job
+
+        // One job index per worker; worker w solves requests w, w + workerCount, ...
+        [BurstCompile]
+        private struct AStarJob : IJobParallelFor
+        {
+            public int width;
+            public int height;
+            public int cells;
+            public int requestCount;
+            public int workerCount;
+            public int maxPathLength;
+            public int maxExpansions;
+
+            [ReadOnly] public NativeArray<byte> costs;
+            [ReadOnly] public NativeArray<PathQuery> queries;
+            [NativeDisableParallelForRestriction] public NativeArray<PathOutput> outputs;
+            [NativeDisableParallelForRestriction] public NativeArray<int> paths;
+
+            [NativeDisableParallelForRestriction] public NativeArray<float> gScore;
+            [NativeDisableParallelForRestriction] public NativeArray<int> parent;
+            [NativeDisableParallelForRestriction] public NativeArray<int> stamp;
+            [NativeDisableParallelForRestriction] public NativeArray<int> heapPosition;
+            [NativeDisableParallelForRestriction] public NativeArray<int> heap;
+            [NativeDisableParallelForRestriction] public NativeArray<float> heapKey;
+            public NativeArray<int> generation;
+
+            public void Execute(int worker)
+            {
+                int baseIndex = worker * cells;
+                for (int r = worker; r < requestCount; r += workerCount)
+                {
+                    // Stamps: 2g = open this search, 2g + 1 = closed; anything else is untouched
+                    int gen = generation[worker] + 1;
+                    if (gen >= int.MaxValue / 2)
+                    {
+                        for (int i = 0; i < cells; i++) stamp[baseIndex + i] = 0;
+                        gen = 1;
+                    }
+                    generation[worker] = gen;
+
+                    outputs[r] = Search(queries[r], baseIndex, gen * 2, gen * 2 + 1, r * maxPathLength);
+                }
+            }
+
+            private PathOutput Search(PathQuery query, int baseIndex, int open, int closed, int pathOffset)
+            {
+                var result = new PathOutput { status = PathStatus.Invalid };
+                if (query.start < 0 || query.goal < 0 || costs[query.start] == 0 || costs[query.goal] == 0)
+                    return result;
+
+                int goalX = query.goal % width;
+                int goalY = query.goal / width;
+                int heapCount = 0;
+
+                stamp[baseIndex + query.start] = open;
+                gScore[baseIndex + query.start] = 0f;
+                parent[baseIndex + query.start] = -1;
+                Push(baseIndex, ref heapCount, query.start, Heuristic(query.start, goalX, goalY));
+
+                while (heapCount > 0)
+                {
+                    int current = Pop(baseIndex, ref heapCount);
+                    stamp[baseIndex + current] = closed;
+                    result.expanded++;
+
+                    if (current == query.goal)
+                        return Reconstruct(result, baseIndex, query.goal, pathOffset);
+
+                    if (result.expanded >= maxExpansions)
+                        break;
+
+                    int cx = current % width;
+                    int cy = current / width;
+                    float currentG = gScore[baseIndex + current];
+
+                    for (int dy = -1; dy <= 1; dy++)
+                    {
+                        for (int dx = -1; dx <= 1; dx++)
+                        {
+                            if (dx == 0 && dy == 0) continue;
+
+                            int nx = cx + dx;
+                            int ny = cy + dy;
+                            if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+
+                            int neighbour = nx + ny * width;
+                            byte cost = costs[neighbour];
+                            if (cost == 0) continue;
+
+                            // No corner cutting: both orthogonal cells of a diagonal move must be open
+                            bool diagonal = dx != 0 && dy != 0;
+                            if (diagonal && (costs[cx + dx + cy * width] == 0 || costs[cx + (cy + dy) * width] == 0))
+                                continue;
+
+                            int slot = baseIndex + neighbour;
+                            int state = stamp[slot];
+                            if (state == closed) continue;
+
+                            float g = currentG + cost * (diagonal ? Diagonal : 1f);
+                            if (state == open && g >= gScore[slot]) continue;
+
+                            gScore[slot] = g;
+                            parent[slot] = current;
+                            float f = g + Heuristic(neighbour, goalX, goalY);
+
+                            if (state == open)
+                            {
+                                DecreaseKey(baseIndex, heapPosition[slot], f);
+                            }
+                            else
+                            {
+                                stamp[slot] = open;
+                                Push(baseIndex, ref heapCount, neighbour, f);
+                            }
+                        }
+                    }
+                }
+
+                result.status = PathStatus.NotFound;
+                return result;
+            }
+
+            private PathOutput Reconstruct(PathOutput result, int baseIndex, int goal, int pathOffset)
+            {
+                int length = 0;
+                for (int cell = goal; cell != -1; cell = parent[baseIndex + cell])
+                {
+                    if (length == maxPathLength)
+                    {
+                        result.status = PathStatus.TooLong;
+                        return result;
+                    }
+                    paths[pathOffset + length++] = cell;
+                }
+
+                // Walked goal to start; flip so callers get start first
+                for (int i = 0, j = length - 1; i < j; i++, j--)
+                {
+                    int temp = paths[pathOffset + i];
+                    paths[pathOffset + i] = paths[pathOffset + j];
+                    paths[pathOffset + j] = temp;
+                }
+
+                result.length = length;
+                result.status = PathStatus.Found;
+                return result;
+            }
+
+            // Octile distance: admissible for 8-connected moves with cost >= 1
+            private float Heuristic(int cell, int goalX, int goalY)
+            {
+                int dx = Math.Abs(cell % width - goalX);
+                int dy = Math.Abs(cell / width - goalY);
+                return (dx + dy) + (Diagonal - 2f) * Math.Min(dx, dy);
+            }
+
+            #region Indexed Heap
+
+            private void Push(int baseIndex, ref int count, int cell, float key)
+            {
+                int index = count++;
+                heap[baseIndex + index] = cell;
+                heapKey[baseIndex + index] = key;
+                heapPosition[baseIndex + cell] = index;
+                SiftUp(baseIndex, index);
+            }
+
+            private int Pop(int baseIndex, ref int count)
+            {
+                int top = heap[baseIndex];
+                count--;
+                if (count > 0)
+                {
+                    Move(baseIndex, count, 0);
+                    SiftDown(baseIndex, 0, count);
+                }
+                return top;
+            }
+
+            private void DecreaseKey(int baseIndex, int index, float key)
+            {
+                heapKey[baseIndex + index] = key;
+                SiftUp(baseIndex, index);
+            }
+
+            private void SiftUp(int baseIndex, int index)
+            {
+                int cell = heap[baseIndex + index];
+                float key = heapKey[baseIndex + index];
+
+                while (index > 0)
+                {
+                    int up = (index - 1) >> 1;
+                    if (heapKey[baseIndex + up] <= key) break;
+
+                    Move(baseIndex, up, index);
+                    index = up;
+                }
+
+                Place(baseIndex, index, cell, key);
+            }
+
+            private void SiftDown(int baseIndex, int index, int count)
+            {
+                int cell = heap[baseIndex + index];
+                float key = heapKey[baseIndex + index];
+
+                while (true)
+                {
+                    int child = index * 2 + 1;
+                    if (child >= count) break;
+                    if (child + 1 < count && heapKey[baseIndex + child + 1] < heapKey[baseIndex + child]) child++;
+                    if (heapKey[baseIndex + child] >= key) break;
+
+                    Move(baseIndex, child, index);
+                    index = child;
+                }
+
+                Place(baseIndex, index, cell, key);
+            }
+
+            private void Move(int baseIndex, int from, int to)
+            {
+                Place(baseIndex, to, heap[baseIndex + from], heapKey[baseIndex + from]);
+            }
+
+            private void Place(int baseIndex, int index, int cell, float key)
+            {
+                heap[baseIndex + index] = cell;
+                heapKey[baseIndex + index] = key;
+                heapPosition[baseIndex + cell] = index;
+            }
+
+            #endregion
+        }
+
+        #endregion
+    }
+}
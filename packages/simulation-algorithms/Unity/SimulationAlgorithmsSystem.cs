@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.SimulationAlgorithms
 {
@@ -13,32 +17,131 @@ namespace UnitySim.SimulationAlgorithms
 
         public SimulationAlgorithmsData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             simulationalgorithms = new SimulationAlgorithmsInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (simulationalgorithms != null)
+                simulationalgorithms.WriteState(writer, "simulationalgorithms");
+            else
+                writer.Write("simulationalgorithms", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
     public class SimulationAlgorithmsInfo
     {
                 public int pathfindingRequests = 0;
-        public float algorithmEfficiency = 92f;
+        public float algorithmEfficiency = 0f;
         public string currentAlgorithm = "A*";
         public int nodesProcessed = 0;
-        public float computationTime = 0.15f;
+        public float computationTime = 0f;
         public bool optimized = true;
         public string systemHealth = "operational";
         public string framework = "unity-sim-simulation-algorithms";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("pathfindingRequests", pathfindingRequests);
+            writer.Write("algorithmEfficiency", algorithmEfficiency);
+            writer.Write("currentAlgorithm", currentAlgorithm);
+            writer.Write("nodesProcessed", nodesProcessed);
+            writer.Write("computationTime", computationTime);
+            writer.Write("optimized", optimized);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public SimulationAlgorithmsField Diff(SimulationAlgorithmsInfo other)
+        {
+            var changed = SimulationAlgorithmsField.None;
+            if (pathfindingRequests != other.pathfindingRequests) changed |= SimulationAlgorithmsField.PathfindingRequests;
+            if (algorithmEfficiency != other.algorithmEfficiency) changed |= SimulationAlgorithmsField.AlgorithmEfficiency;
+            if (currentAlgorithm != other.currentAlgorithm) changed |= SimulationAlgorithmsField.CurrentAlgorithm;
+            if (nodesProcessed != other.nodesProcessed) changed |= SimulationAlgorithmsField.NodesProcessed;
+            if (computationTime != other.computationTime) changed |= SimulationAlgorithmsField.ComputationTime;
+            if (optimized != other.optimized) changed |= SimulationAlgorithmsField.Optimized;
+            if (systemHealth != other.systemHealth) changed |= SimulationAlgorithmsField.SystemHealth;
+            if (framework != other.framework) changed |= SimulationAlgorithmsField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(SimulationAlgorithmsInfo target)
+        {
+            target.pathfindingRequests = pathfindingRequests;
+            target.algorithmEfficiency = algorithmEfficiency;
+            target.currentAlgorithm = currentAlgorithm;
+            target.nodesProcessed = nodesProcessed;
+            target.computationTime = computationTime;
+            target.optimized = optimized;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum SimulationAlgorithmsField
+    {
+        None = 0,
+        PathfindingRequests = 1 << 0,
+        AlgorithmEfficiency = 1 << 1,
+        CurrentAlgorithm = 1 << 2,
+        NodesProcessed = 1 << 3,
+        ComputationTime = 1 << 4,
+        Optimized = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct SimulationAlgorithmsDelta
+    {
+        public readonly long timestamp;
+        public readonly SimulationAlgorithmsField changed;
+        public readonly SimulationAlgorithmsInfo values;
+
+        public SimulationAlgorithmsDelta(long timestamp, SimulationAlgorithmsField changed, SimulationAlgorithmsInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(SimulationAlgorithmsField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class SimulationAlgorithmsSystem : MonoBehaviour
+    public class SimulationAlgorithmsSystem : MonoBehaviour, ISimulationSystem, IPathfindingService
     {
         [Header("SimulationAlgorithms Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Pathfinding Grid")]
+        public Vector2Int gridSize = new Vector2Int(256, 256);
+        public Vector2 gridOrigin = new Vector2(-128f, -128f);
+        public float cellSize = 1f;
+
+        [Header("Pathfinding Batches")]
+        public int maxRequestsPerBatch = 512;
+        public int maxParallelSearches = 8;
+        public int maxPathLength = 1024;
+        public int maxExpansionsPerSearch = 0;
+        [SerializeField] private float requestsPerSecond = 0f;
+
         [Header("Current Data")]
         [SerializeField] private SimulationAlgorithmsData currentData;
 
@@ -48,12 +151,24 @@ namespace UnitySim.SimulationAlgorithms
 
         // Events
         public System.Action<SimulationAlgorithmsData> OnSimulationAlgorithmsChanged;
+        public System.Action<SimulationAlgorithmsDelta> OnSimulationAlgorithmsDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.SimulationAlgorithmsSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly SimulationAlgorithmsInfo publishedInfo = new SimulationAlgorithmsInfo();
+        private bool publishFullDelta = true;
+        private PathfindingService pathfinding;
+        private long publishedRequests = 0;
+        private long publishedFound = 0;
+        private long publishedExpanded = 0;
+        private long publishedPathCells = 0;
+        private double publishedLatencyMs = 0.0;
 
         #region Unity Lifecycle
 
@@ -62,18 +177,34 @@ namespace UnitySim.SimulationAlgorithms
             InitializeSimulationAlgorithms();
         }
 
+        void OnEnable()
+        {
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
+
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
+
+        // Batches start early in the frame and finish in LateUpdate, so searches overlap
+        // with the rest of the frame's work
         void Update()
         {
-            if (!isInitialized) return;
+            pathfinding?.Schedule();
+        }
 
-            UpdateSystem();
+        void LateUpdate()
+        {
+            pathfinding?.Complete();
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            pathfinding?.Dispose();
+            pathfinding = null;
         }
 
         #endregion
@@ -83,6 +214,20 @@ namespace UnitySim.SimulationAlgorithms
         private void InitializeSimulationAlgorithms()
         {
             currentData = new SimulationAlgorithmsData();
+
+            // The old service is disposed after the swap, so callers that re-request from a
+            // cancelled callback reach the new one
+            var previous = pathfinding;
+            int workers = Mathf.Max(1, Mathf.Min(SystemInfo.processorCount, maxParallelSearches));
+            pathfinding = new PathfindingService(gridSize.x, gridSize.y, workers, maxRequestsPerBatch, maxPathLength);
+            pathfinding.MaxExpansions = maxExpansionsPerSearch;
+            previous?.Dispose();
+            publishedRequests = 0;
+            publishedFound = 0;
+            publishedExpanded = 0;
+            publishedPathCells = 0;
+            publishedLatencyMs = 0.0;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +238,51 @@ namespace UnitySim.SimulationAlgorithms
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.simulationalgorithms.pathfindingRequests += UnityEngine.Random.Range(5, 15);
-            currentData.simulationalgorithms.nodesProcessed += UnityEngine.Random.Range(100, 500);
-            currentData.simulationalgorithms.computationTime += UnityEngine.Random.Range(-0.02f, 0.05f);
+            if (pathfinding == null) return;
+
+            var info = currentData.simulationalgorithms;
+            long requests = pathfinding.CompletedRequests - publishedRequests;
+            long found = pathfinding.FoundPaths - publishedFound;
+            long expanded = pathfinding.NodesExpanded - publishedExpanded;
+            long pathCells = pathfinding.PathCellsReturned - publishedPathCells;
+            double latencyMs = pathfinding.TotalLatencyMs - publishedLatencyMs;
+
+            info.pathfindingRequests = (int)Math.Min(pathfinding.CompletedRequests, int.MaxValue);
+            info.nodesProcessed = (int)Math.Min(pathfinding.NodesExpanded, int.MaxValue);
+
+            // Interval figures: mean request latency and path cells per expanded node
+            if (requests > 0)
+            {
+                info.computationTime = (float)(latencyMs / requests);
+                requestsPerSecond = deltaTime > 0f ? requests / deltaTime : 0f;
+            }
+            else
+            {
+                requestsPerSecond = 0f;
+            }
+
+            if (found > 0 && expanded > 0)
+                info.algorithmEfficiency = Mathf.Min(100f, 100f * pathCells / expanded);
+
+            publishedRequests = pathfinding.CompletedRequests;
+            publishedFound = pathfinding.FoundPaths;
+            publishedExpanded = pathfinding.NodesExpanded;
+            publishedPathCells = pathfinding.PathCellsReturned;
+            publishedLatencyMs = pathfinding.TotalLatencyMs;
         }
 
         private void ProcessUpdate()
@@ -122,6 +295,12 @@ namespace UnitySim.SimulationAlgorithms
                 OnSimulationAlgorithmsChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +308,67 @@ namespace UnitySim.SimulationAlgorithms
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.simulationalgorithms;
+            var changed = publishFullDelta ? SimulationAlgorithmsField.All : info.Diff(publishedInfo);
+            if (changed == SimulationAlgorithmsField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnSimulationAlgorithmsDelta?.Invoke(new SimulationAlgorithmsDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(SimulationAlgorithmsSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("SimulationAlgorithmsSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +379,9 @@ namespace UnitySim.SimulationAlgorithms
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +402,42 @@ namespace UnitySim.SimulationAlgorithms
             return currentData;
         }
 
+        public PathfindingService GetPathfinding()
+        {
+            return pathfinding;
+        }
+
+        public Vector2Int GridSize => gridSize;
+        public int PendingRequests => pathfinding != null ? pathfinding.PendingRequests : 0;
+
+        public Vector2Int WorldToCell(Vector3 position)
+        {
+            return new Vector2Int(
+                Mathf.FloorToInt((position.x - gridOrigin.x) / cellSize),
+                Mathf.FloorToInt((position.z - gridOrigin.y) / cellSize));
+        }
+
+        public Vector3 CellToWorld(Vector2Int cell)
+        {
+            return new Vector3(gridOrigin.x + (cell.x + 0.5f) * cellSize, 0f, gridOrigin.y + (cell.y + 0.5f) * cellSize);
+        }
+
+        public void SetCost(Vector2Int cell, byte cost)
+        {
+            pathfinding?.SetCost(cell, cost);
+        }
+
+        public int RequestPath(Vector2Int start, Vector2Int goal, Action<PathResult> onComplete)
+        {
+            if (pathfinding == null)
+            {
+                Debug.LogWarning("SimulationAlgorithmsSystem: Pathfinding requested before initialization");
+                return 0;
+            }
+
+            return pathfinding.RequestPath(start, goal, onComplete);
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +469,7 @@ namespace UnitySim.SimulationAlgorithms
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +481,12 @@ namespace UnitySim.SimulationAlgorithms
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            gridSize = Vector2Int.Max(gridSize, Vector2Int.one);
+            cellSize = Mathf.Max(0.01f, cellSize);
+            maxRequestsPerBatch = Mathf.Max(1, maxRequestsPerBatch);
+            maxParallelSearches = Mathf.Max(1, maxParallelSearches);
+            maxPathLength = Mathf.Max(2, maxPathLength);
+            maxExpansionsPerSearch = Mathf.Max(0, maxExpansionsPerSearch);
         }
 
         #endregion
@@ -218,7 +498,9 @@ namespace UnitySim.SimulationAlgorithms
             Debug.Log($"SimulationAlgorithmsSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            Debug.Log($"- Pathfinding: {gridSize.x}x{gridSize.y} grid, {PendingRequests} pending, {requestsPerSecond:F0} req/s");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
@@ -0,0 +1,309 @@
+using System;
+using System.Collections.Generic;
+using UnitySim.Core;
+
+namespace UnitySim.SupplyChain
+{
+    [System.Serializable]
+    public class LogisticsSettings
+    {
+        public int suppliers = 12;
+        public int warehouses = 5;
+        public int productsPerWarehouse = 8;
+        public int vehicles = 25;
+        public int vehicleCapacity = 400;
+
+        // Mean minutes between customer orders at each warehouse, and the largest order
+        public float demandIntervalMinutes = 2f;
+        public int maxDemandUnits = 12;
+
+        // Continuous-review (s, S) policy per stocked product
+        public int reorderPoint = 250;
+        public int orderUpTo = 600;
+
+        // Means in hours; actual times vary uniformly from half to one and a half times the mean.
+        // Each supplier works through its orders one at a time.
+        public float supplierProcessingHours = 3f;
+        public float transitHours = 4f;
+        public float deliverySlackHours = 3f;
+    }
+
+    // Warehouses, suppliers and a truck fleet driven entirely by discrete events: customer
+    // demand, supplier order completion, truck arrival and truck return. Suppliers and trucks
+    // are queued resources, so lateness comes from contention rather than noise. Nothing runs
+    // between events, so a quiet network costs nothing and long horizons can be skipped
+    // through with SimulationScheduler.SkipAhead.
+    public class LogisticsNetwork : ISimulationEventHandler
+    {
+        private const int DemandEvent = 0;
+        private const int OrderReadyEvent = 1;
+        private const int ArrivalEvent = 2;
+        private const int ReturnEvent = 3;
+
+        // Weight of the latest delivery in the recent on-time and load averages
+        private const float RecentWeight = 0.05f;
+
+        private readonly LogisticsSettings settings;
+        private Unity.Mathematics.Random random;
+        private SimulationEventQueue queue;
+
+        // Per stocked product, indexed warehouse * productsPerWarehouse + product
+        private readonly int[] inventory;
+        private readonly int[] onOrder;
+
+        // Order slots, reused through a free list
+        private int[] orderStock = new int[64];
+        private int[] orderQuantity = new int[64];
+        private double[] orderDue = new double[64];
+        private readonly Stack<int> freeOrders = new Stack<int>();
+        private int orderSlots = 0;
+
+        private readonly Queue<int>[] supplierBacklog;
+        private readonly bool[] supplierBusy;
+        private readonly Queue<int> awaitingVehicle = new Queue<int>();
+        private int idleVehicles;
+
+        public int Suppliers => settings.suppliers;
+        public int Warehouses => settings.warehouses;
+        public int Vehicles => settings.vehicles;
+        public int IdleVehicles => idleVehicles;
+        public int ActiveOrders { get; private set; }
+        public int OrdersAwaitingVehicle => awaitingVehicle.Count;
+
+        public int BusySuppliers
+        {
+            get
+            {
+                int busy = 0;
+                for (int i = 0; i < supplierBusy.Length; i++) if (supplierBusy[i]) busy++;
+                return busy;
+            }
+        }
+
+        public long Deliveries { get; private set; }
+        public long OnTimeDeliveries { get; private set; }
+        public long UnitsDemanded { get; private set; }
+        public long UnitsShort { get; private set; }
+
+        // Recent share of deliveries inside their promised window, and mean truck load, both 0-1
+        public float RecentOnTimeRate { get; private set; } = 1f;
+        public float RecentLoadFactor { get; private set; } = 0f;
+
+        public float FillRate => UnitsDemanded > 0 ? 1f - UnitsShort / (float)UnitsDemanded : 1f;
+
+        public long TotalInventory
+        {
+            get
+            {
+                long total = 0;
+                for (int i = 0; i < inventory.Length; i++) total += inventory[i];
+                return total;
+            }
+        }
+
+        public LogisticsNetwork(LogisticsSettings settings, uint seed)
+        {
+            this.settings = settings ?? new LogisticsSettings();
+            this.settings.suppliers = Math.Max(1, this.settings.suppliers);
+            this.settings.warehouses = Math.Max(1, this.settings.warehouses);
+            this.settings.productsPerWarehouse = Math.Max(1, this.settings.productsPerWarehouse);
+            this.settings.vehicles = Math.Max(1, this.settings.vehicles);
+            this.settings.vehicleCapacity = Math.Max(1, this.settings.vehicleCapacity);
+            this.settings.orderUpTo = Math.Max(this.settings.reorderPoint + 1, this.settings.orderUpTo);
+
+            random = new Unity.Mathematics.Random(seed != 0 ? seed : 1u);
+            int stocks = this.settings.warehouses * this.settings.productsPerWarehouse;
+            inventory = new int[stocks];
+            onOrder = new int[stocks];
+            idleVehicles = this.settings.vehicles;
+
+            supplierBacklog = new Queue<int>[this.settings.suppliers];
+            supplierBusy = new bool[this.settings.suppliers];
+            for (int i = 0; i < supplierBacklog.Length; i++) supplierBacklog[i] = new Queue<int>();
+
+            // Staggered opening stock so the first reorders don't all land at once
+            for (int i = 0; i < stocks; i++)
+            {
+                inventory[i] = random.NextInt(this.settings.reorderPoint, this.settings.orderUpTo + 1);
+            }
+        }
+
+        #region Lifetime
+
+        public bool IsRunning => queue != null;
+
+        public void Start(SimulationEventQueue events)
+        {
+            if (queue != null) return;
+            queue = events ?? throw new ArgumentNullException(nameof(events));
+            queue.Rebased += OnRebased;
+
+            for (int w = 0; w < settings.warehouses; w++)
+            {
+                queue.Schedule(NextDemandDelay(), this, DemandEvent, w);
+            }
+        }
+
+        // Cancels every pending event; the network keeps its state
+        public void Stop()
+        {
+            if (queue == null) return;
+
+            queue.CancelAll(this);
+            queue.Rebased -= OnRebased;
+            queue = null;
+        }
+
+        // Due times are absolute, so they move with the calendar
+        private void OnRebased(double shift)
+        {
+            for (int i = 0; i < orderSlots; i++) orderDue[i] += shift;
+        }
+
+        #endregion
+
+        #region Events
+
+        void ISimulationEventHandler.HandleEvent(SimulationEventQueue events, SimulationEvent e)
+        {
+            switch (e.kind)
+            {
+                case DemandEvent: OnDemand(e.a); break;
+                case OrderReadyEvent: OnOrderReady(e.a); break;
+                case ArrivalEvent: OnArrival(e.a); break;
+                case ReturnEvent: OnVehicleReturn(); break;
+            }
+        }
+
+        private void OnDemand(int warehouse)
+        {
+            int stock = warehouse * settings.productsPerWarehouse + random.NextInt(settings.productsPerWarehouse);
+            int units = random.NextInt(1, settings.maxDemandUnits + 1);
+            int served = Math.Min(units, inventory[stock]);
+
+            inventory[stock] -= served;
+            UnitsDemanded += units;
+            UnitsShort += units - served;
+
+            if (inventory[stock] + onOrder[stock] <= settings.reorderPoint)
+                PlaceOrder(stock);
+
+            queue.Schedule(NextDemandDelay(), this, DemandEvent, warehouse);
+        }
+
+        private void PlaceOrder(int stock)
+        {
+            // One truckload at most; a larger shortfall reorders again on the next demand
+            int quantity = Math.Min(settings.vehicleCapacity, settings.orderUpTo - inventory[stock] - onOrder[stock]);
+            if (quantity <= 0) return;
+
+            int order = AllocateOrder();
+            orderStock[order] = stock;
+            orderQuantity[order] = quantity;
+            orderDue[order] = queue.Now + (settings.supplierProcessingHours + settings.transitHours + settings.deliverySlackHours) * 3600.0;
+
+            onOrder[stock] += quantity;
+            ActiveOrders++;
+
+            int supplier = SupplierFor(stock);
+            if (supplierBusy[supplier])
+            {
+                supplierBacklog[supplier].Enqueue(order);
+                return;
+            }
+
+            supplierBusy[supplier] = true;
+            queue.Schedule(Vary(settings.supplierProcessingHours), this, OrderReadyEvent, order);
+        }
+
+        private void OnOrderReady(int order)
+        {
+            int supplier = SupplierFor(orderStock[order]);
+            if (supplierBacklog[supplier].Count > 0)
+                queue.Schedule(Vary(settings.supplierProcessingHours), this, OrderReadyEvent, supplierBacklog[supplier].Dequeue());
+            else
+                supplierBusy[supplier] = false;
+
+            if (idleVehicles > 0)
+                Dispatch(order);
+            else
+                awaitingVehicle.Enqueue(order);
+        }
+
+        private void Dispatch(int order)
+        {
+            idleVehicles--;
+            float load = orderQuantity[order] / (float)settings.vehicleCapacity;
+            RecentLoadFactor += (load - RecentLoadFactor) * RecentWeight;
+
+            queue.Schedule(Vary(settings.transitHours), this, ArrivalEvent, order);
+        }
+
+        private void OnArrival(int order)
+        {
+            int stock = orderStock[order];
+            int quantity = orderQuantity[order];
+
+            inventory[stock] += quantity;
+            onOrder[stock] -= quantity;
+            ActiveOrders--;
+            Deliveries++;
+
+            bool onTime = queue.Now <= orderDue[order];
+            if (onTime) OnTimeDeliveries++;
+            RecentOnTimeRate += ((onTime ? 1f : 0f) - RecentOnTimeRate) * RecentWeight;
+
+            freeOrders.Push(order);
+            queue.Schedule(Vary(settings.transitHours), this, ReturnEvent);
+        }
+
+        private void OnVehicleReturn()
+        {
+            idleVehicles++;
+            if (awaitingVehicle.Count > 0)
+                Dispatch(awaitingVehicle.Dequeue());
+        }
+
+        #endregion
+
+        #region Helpers
+
+        // Supplier serving a stocked product; each product has one fixed source
+        public int SupplierFor(int stock)
+        {
+            return stock % settings.suppliers;
+        }
+
+        public int GetInventory(int warehouse, int product)
+        {
+            return inventory[warehouse * settings.productsPerWarehouse + product];
+        }
+
+        private double NextDemandDelay()
+        {
+            // Poisson arrivals
+            return -settings.demandIntervalMinutes * 60.0 * Math.Log(1.0 - random.NextDouble());
+        }
+
+        private double Vary(float meanHours)
+        {
+            return meanHours * 3600.0 * (0.5 + random.NextDouble());
+        }
+
+        private int AllocateOrder()
+        {
+            if (freeOrders.Count > 0) return freeOrders.Pop();
+
+            if (orderSlots == orderStock.Length)
+            {
+                int size = orderSlots * 2;
+                Array.Resize(ref orderStock, size);
+                Array.Resize(ref orderQuantity, size);
+                Array.Resize(ref orderDue, size);
+            }
+            return orderSlots++;
+        }
+
+        #endregion
+    }
+}
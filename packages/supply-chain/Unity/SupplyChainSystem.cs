@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.SupplyChain
 {
@@ -13,10 +17,22 @@ namespace UnitySim.SupplyChain
 
         public SupplyChainData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             supplychain = new SupplyChainInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (supplychain != null)
+                supplychain.WriteState(writer, "supplychain");
+            else
+                writer.Write("supplychain", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,96 @@ namespace UnitySim.SupplyChain
         public int transportVehicles = 25;
         public string systemHealth = "operational";
         public string framework = "unity-sim-supply-chain";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("suppliers", suppliers);
+            writer.Write("warehouses", warehouses);
+            writer.Write("deliveryEfficiency", deliveryEfficiency);
+            writer.Write("activeOrders", activeOrders);
+            writer.Write("costOptimization", costOptimization);
+            writer.Write("transportVehicles", transportVehicles);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public SupplyChainField Diff(SupplyChainInfo other)
+        {
+            var changed = SupplyChainField.None;
+            if (suppliers != other.suppliers) changed |= SupplyChainField.Suppliers;
+            if (warehouses != other.warehouses) changed |= SupplyChainField.Warehouses;
+            if (deliveryEfficiency != other.deliveryEfficiency) changed |= SupplyChainField.DeliveryEfficiency;
+            if (activeOrders != other.activeOrders) changed |= SupplyChainField.ActiveOrders;
+            if (costOptimization != other.costOptimization) changed |= SupplyChainField.CostOptimization;
+            if (transportVehicles != other.transportVehicles) changed |= SupplyChainField.TransportVehicles;
+            if (systemHealth != other.systemHealth) changed |= SupplyChainField.SystemHealth;
+            if (framework != other.framework) changed |= SupplyChainField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(SupplyChainInfo target)
+        {
+            target.suppliers = suppliers;
+            target.warehouses = warehouses;
+            target.deliveryEfficiency = deliveryEfficiency;
+            target.activeOrders = activeOrders;
+            target.costOptimization = costOptimization;
+            target.transportVehicles = transportVehicles;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum SupplyChainField
+    {
+        None = 0,
+        Suppliers = 1 << 0,
+        Warehouses = 1 << 1,
+        DeliveryEfficiency = 1 << 2,
+        ActiveOrders = 1 << 3,
+        CostOptimization = 1 << 4,
+        TransportVehicles = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct SupplyChainDelta
+    {
+        public readonly long timestamp;
+        public readonly SupplyChainField changed;
+        public readonly SupplyChainInfo values;
+
+        public SupplyChainDelta(long timestamp, SupplyChainField changed, SupplyChainInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(SupplyChainField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class SupplyChainSystem : MonoBehaviour
+    public class SupplyChainSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("SupplyChain Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Logistics")]
+        public LogisticsSettings logistics = new LogisticsSettings();
+        public int randomSeed = 0;
+        [SerializeField] private long deliveries = 0;
+        [SerializeField] private float fillRate = 1f;
+
         [Header("Current Data")]
         [SerializeField] private SupplyChainData currentData;
 
@@ -48,12 +145,19 @@ namespace UnitySim.SupplyChain
 
         // Events
         public System.Action<SupplyChainData> OnSupplyChainChanged;
+        public System.Action<SupplyChainDelta> OnSupplyChainDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.SupplyChainSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly SupplyChainInfo publishedInfo = new SupplyChainInfo();
+        private bool publishFullDelta = true;
+        private LogisticsNetwork network;
 
         #region Unity Lifecycle
 
@@ -62,18 +166,22 @@ namespace UnitySim.SupplyChain
             InitializeSupplyChain();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            network?.Stop();
+            network = null;
         }
 
         #endregion
@@ -83,6 +191,13 @@ namespace UnitySim.SupplyChain
         private void InitializeSupplyChain()
         {
             currentData = new SupplyChainData();
+
+            // Orders, shipments and truck returns live on the scheduler's event calendar
+            network?.Stop();
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            network = new LogisticsNetwork(logistics, seed);
+            network.Start(SimulationScheduler.Instance.Events);
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +208,35 @@ namespace UnitySim.SupplyChain
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.supplychain.activeOrders += UnityEngine.Random.Range(-5, 10);
-            currentData.supplychain.deliveryEfficiency = Mathf.Clamp(currentData.supplychain.deliveryEfficiency + UnityEngine.Random.Range(-2f, 2f), 70f, 100f);
-            currentData.supplychain.costOptimization += UnityEngine.Random.Range(-1f, 1f);
+            if (network == null) return;
+
+            // The network advanced as its events fired; publishing only reads its counters
+            var info = currentData.supplychain;
+            info.suppliers = network.Suppliers;
+            info.warehouses = network.Warehouses;
+            info.activeOrders = network.ActiveOrders;
+            info.transportVehicles = network.Vehicles;
+            info.deliveryEfficiency = network.RecentOnTimeRate * 100f;
+
+            // Full trucks spread the fixed cost of a trip over more units
+            info.costOptimization = network.RecentLoadFactor * 100f;
+
+            deliveries = network.Deliveries;
+            fillRate = network.FillRate;
         }
 
         private void ProcessUpdate()
@@ -122,6 +249,12 @@ namespace UnitySim.SupplyChain
                 OnSupplyChainChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +262,67 @@ namespace UnitySim.SupplyChain
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.supplychain;
+            var changed = publishFullDelta ? SupplyChainField.All : info.Diff(publishedInfo);
+            if (changed == SupplyChainField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnSupplyChainDelta?.Invoke(new SupplyChainDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(SupplyChainSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("SupplyChainSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +333,9 @@ namespace UnitySim.SupplyChain
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +356,11 @@ namespace UnitySim.SupplyChain
             return currentData;
         }
 
+        public LogisticsNetwork GetNetwork()
+        {
+            return network;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +392,7 @@ namespace UnitySim.SupplyChain
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +404,14 @@ namespace UnitySim.SupplyChain
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            logistics.suppliers = Mathf.Max(1, logistics.suppliers);
+            logistics.warehouses = Mathf.Max(1, logistics.warehouses);
+            logistics.productsPerWarehouse = Mathf.Max(1, logistics.productsPerWarehouse);
+            logistics.vehicles = Mathf.Max(1, logistics.vehicles);
+            logistics.vehicleCapacity = Mathf.Max(1, logistics.vehicleCapacity);
+            logistics.maxDemandUnits = Mathf.Max(1, logistics.maxDemandUnits);
+            logistics.demandIntervalMinutes = Mathf.Max(0.01f, logistics.demandIntervalMinutes);
+            logistics.orderUpTo = Mathf.Max(logistics.reorderPoint + 1, logistics.orderUpTo);
         }
 
         #endregion
@@ -218,7 +423,10 @@ namespace UnitySim.SupplyChain
             Debug.Log($"SupplyChainSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (network != null)
+                Debug.Log($"- Logistics: {network.ActiveOrders} open orders, {network.OrdersAwaitingVehicle} awaiting a truck, {network.IdleVehicles}/{network.Vehicles} trucks idle, {network.Deliveries} delivered");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
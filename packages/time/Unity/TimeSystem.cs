@@ -1,6 +1,9 @@
 using System;
+using System.Buffers;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Time
 {
@@ -13,10 +16,22 @@ namespace UnitySim.Time
 
         public TimeData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             time = new TimeInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (time != null)
+                time.WriteState(writer, "time");
+            else
+                writer.Write("time", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +45,105 @@ namespace UnitySim.Time
         public string timeFormat = "24h";
         public string systemHealth = "operational";
         public string framework = "unity-sim-time";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("timeScale", timeScale);
+            writer.Write("paused", paused);
+            writer.Write("simulationTime", simulationTime);
+            writer.Write("scheduledEvents", scheduledEvents);
+            writer.Write("deltaTime", deltaTime);
+            writer.Write("timeFormat", timeFormat);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public TimeField Diff(TimeInfo other)
+        {
+            var changed = TimeField.None;
+            if (timeScale != other.timeScale) changed |= TimeField.TimeScale;
+            if (paused != other.paused) changed |= TimeField.Paused;
+            if (simulationTime != other.simulationTime) changed |= TimeField.SimulationTime;
+            if (scheduledEvents != other.scheduledEvents) changed |= TimeField.ScheduledEvents;
+            if (deltaTime != other.deltaTime) changed |= TimeField.DeltaTime;
+            if (timeFormat != other.timeFormat) changed |= TimeField.TimeFormat;
+            if (systemHealth != other.systemHealth) changed |= TimeField.SystemHealth;
+            if (framework != other.framework) changed |= TimeField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(TimeInfo target)
+        {
+            target.timeScale = timeScale;
+            target.paused = paused;
+            target.simulationTime = simulationTime;
+            target.scheduledEvents = scheduledEvents;
+            target.deltaTime = deltaTime;
+            target.timeFormat = timeFormat;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
     }
 
-    public class TimeSystem : MonoBehaviour
+    [System.Flags]
+    public enum TimeField
+    {
+        None = 0,
+        TimeScale = 1 << 0,
+        Paused = 1 << 1,
+        SimulationTime = 1 << 2,
+        ScheduledEvents = 1 << 3,
+        DeltaTime = 1 << 4,
+        TimeFormat = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct TimeDelta
+    {
+        public readonly long timestamp;
+        public readonly TimeField changed;
+        public readonly TimeInfo values;
+
+        public TimeDelta(long timestamp, TimeField changed, TimeInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(TimeField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class TimeSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("Time Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Clock Settings")]
+        public float fixedStep = 0.02f;
+        public int maxStepsPerFrame = 8;
+        public float timeScale = 1f;
+        public bool paused = false;
+        public bool deterministic = false;
+        public int randomSeed = 12345;
+        public bool useFixedEpoch = false;
+        public long epochTimestamp = SimulationClock.DefaultEpochMs;
+
+        [Header("Headless")]
+        public bool runHeadlessOnStart = false;
+        public double headlessHours = 24.0;
+        public bool quitWhenDone = false;
+
         [Header("Current Data")]
         [SerializeField] private TimeData currentData;
 
@@ -48,32 +153,45 @@ namespace UnitySim.Time
 
         // Events
         public System.Action<TimeData> OnTimeChanged;
+        public System.Action<TimeDelta> OnTimeDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.TimeSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly TimeInfo publishedInfo = new TimeInfo();
+        private bool publishFullDelta = true;
 
         #region Unity Lifecycle
 
         void Start()
         {
             InitializeTime();
+
+            if (runHeadlessOnStart)
+            {
+                AdvanceHours(headlessHours);
+
+                if (quitWhenDone)
+                    Application.Quit();
+            }
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+            ApplyClockSettings();
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -82,7 +200,9 @@ namespace UnitySim.Time
 
         private void InitializeTime()
         {
+            ResetClock();
             currentData = new TimeData();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,22 +213,34 @@ namespace UnitySim.Time
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.time.simulationTime += UnityEngine.Time.deltaTime * currentData.time.timeScale;
-            currentData.time.deltaTime = UnityEngine.Time.deltaTime;
+            // Mirror the authoritative clock rather than integrating a second copy of time
+            var clock = Clock;
+            if (clock != null)
+            {
+                currentData.time.simulationTime = (float)clock.SimulatedSeconds;
+                currentData.time.deltaTime = clock.FixedStep;
+                currentData.time.timeScale = clock.TimeScale;
+                currentData.time.paused = clock.Paused;
+            }
+            else
+            {
+                currentData.time.simulationTime += deltaTime * currentData.time.timeScale;
+                currentData.time.deltaTime = deltaTime;
+            }
             currentData.time.scheduledEvents += UnityEngine.Random.Range(0, 2);
         }
 
@@ -122,6 +254,12 @@ namespace UnitySim.Time
                 OnTimeChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +267,99 @@ namespace UnitySim.Time
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.time;
+            var changed = publishFullDelta ? TimeField.All : info.Diff(publishedInfo);
+            if (changed == TimeField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnTimeDelta?.Invoke(new TimeDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Clock
+
+        private SimulationClock Clock => SimulationScheduler.Instance != null ? SimulationScheduler.Instance.Clock : null;
+
+        private void ApplyClockSettings()
+        {
+            var clock = Clock;
+            if (clock == null) return;
+
+            clock.Configure(fixedStep, maxStepsPerFrame);
+            clock.TimeScale = timeScale;
+            clock.Paused = paused;
+            clock.Deterministic = deterministic;
+        }
+
+        private void ResetClock()
+        {
+            var clock = Clock;
+            if (clock == null) return;
+
+            ApplyClockSettings();
+            clock.Reset(useFixedEpoch || deterministic ? epochTimestamp : 0);
+
+            // Pending events keep their delays across the restart
+            SimulationScheduler.Instance.Events.Rebase(clock.SimulatedSeconds);
+
+            if (deterministic)
+                UnityEngine.Random.InitState(randomSeed);
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(TimeSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("TimeSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +370,9 @@ namespace UnitySim.Time
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -169,6 +398,53 @@ namespace UnitySim.Time
             updateInterval = Mathf.Max(0.1f, interval);
         }
 
+        public void SetTimeScale(float scale)
+        {
+            timeScale = Mathf.Max(0f, scale);
+            ApplyClockSettings();
+        }
+
+        public void Pause()
+        {
+            paused = true;
+            ApplyClockSettings();
+        }
+
+        public void Resume()
+        {
+            paused = false;
+            ApplyClockSettings();
+        }
+
+        // Runs the whole simulation forward without rendering; returns the number of steps taken
+        public long AdvanceHours(double hours)
+        {
+            var scheduler = SimulationScheduler.Instance;
+            if (scheduler == null || hours <= 0.0) return 0;
+
+            long steps = scheduler.RunHeadless(hours * 3600.0);
+
+            if (enableLogging)
+                Debug.Log($"TimeSystem: Advanced {hours:F1}h ({steps} steps)");
+
+            return steps;
+        }
+
+        // Fast-forwards the clock firing only discrete events (orders, shipments, machine
+        // cycles); returns the number of events fired
+        public int SkipHours(double hours)
+        {
+            var scheduler = SimulationScheduler.Instance;
+            if (scheduler == null || hours <= 0.0) return 0;
+
+            int fired = scheduler.SkipAhead(hours * 3600.0);
+
+            if (enableLogging)
+                Debug.Log($"TimeSystem: Skipped {hours:F1}h ({fired} events)");
+
+            return fired;
+        }
+
         public void ResetData()
         {
             InitializeTime();
@@ -195,7 +471,7 @@ namespace UnitySim.Time
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +483,12 @@ namespace UnitySim.Time
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            fixedStep = Mathf.Max(0.001f, fixedStep);
+            maxStepsPerFrame = Mathf.Max(1, maxStepsPerFrame);
+            timeScale = Mathf.Max(0f, timeScale);
+
+            if (Application.isPlaying)
+                ApplyClockSettings();
         }
 
         #endregion
@@ -218,6 +500,8 @@ namespace UnitySim.Time
             Debug.Log($"TimeSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
+            Debug.Log($"- Clock: {fixedStep}s fixed step, x{timeScale}{(paused ? " (paused)" : "")}{(deterministic ? $", deterministic (seed {randomSeed})" : "")}");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
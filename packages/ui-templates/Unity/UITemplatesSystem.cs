@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.UITemplates
 {
@@ -13,10 +17,22 @@ namespace UnitySim.UITemplates
 
         public UITemplatesData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             uitemplates = new UITemplatesInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (uitemplates != null)
+                uitemplates.WriteState(writer, "uitemplates");
+            else
+                writer.Write("uitemplates", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,9 +46,84 @@ namespace UnitySim.UITemplates
         public int customizations = 5;
         public string systemHealth = "operational";
         public string framework = "unity-sim-ui-templates";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("templatesLoaded", templatesLoaded);
+            writer.Write("currentTheme", currentTheme);
+            writer.Write("responsiveDesign", responsiveDesign);
+            writer.Write("componentsRendered", componentsRendered);
+            writer.Write("loadTime", loadTime);
+            writer.Write("customizations", customizations);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public UITemplatesField Diff(UITemplatesInfo other)
+        {
+            var changed = UITemplatesField.None;
+            if (templatesLoaded != other.templatesLoaded) changed |= UITemplatesField.TemplatesLoaded;
+            if (currentTheme != other.currentTheme) changed |= UITemplatesField.CurrentTheme;
+            if (responsiveDesign != other.responsiveDesign) changed |= UITemplatesField.ResponsiveDesign;
+            if (componentsRendered != other.componentsRendered) changed |= UITemplatesField.ComponentsRendered;
+            if (loadTime != other.loadTime) changed |= UITemplatesField.LoadTime;
+            if (customizations != other.customizations) changed |= UITemplatesField.Customizations;
+            if (systemHealth != other.systemHealth) changed |= UITemplatesField.SystemHealth;
+            if (framework != other.framework) changed |= UITemplatesField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(UITemplatesInfo target)
+        {
+            target.templatesLoaded = templatesLoaded;
+            target.currentTheme = currentTheme;
+            target.responsiveDesign = responsiveDesign;
+            target.componentsRendered = componentsRendered;
+            target.loadTime = loadTime;
+            target.customizations = customizations;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum UITemplatesField
+    {
+        None = 0,
+        TemplatesLoaded = 1 << 0,
+        CurrentTheme = 1 << 1,
+        ResponsiveDesign = 1 << 2,
+        ComponentsRendered = 1 << 3,
+        LoadTime = 1 << 4,
+        Customizations = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct UITemplatesDelta
+    {
+        public readonly long timestamp;
+        public readonly UITemplatesField changed;
+        public readonly UITemplatesInfo values;
+
+        public UITemplatesDelta(long timestamp, UITemplatesField changed, UITemplatesInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(UITemplatesField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class UITemplatesSystem : MonoBehaviour
+    public class UITemplatesSystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem
     {
         [Header("UITemplates Settings")]
         public float updateInterval = 1f;
@@ -48,12 +139,19 @@ namespace UnitySim.UITemplates
 
         // Events
         public System.Action<UITemplatesData> OnUITemplatesChanged;
+        public System.Action<UITemplatesDelta> OnUITemplatesDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.UITemplatesSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly UITemplatesInfo publishedInfo = new UITemplatesInfo();
+        private bool publishFullDelta = true;
+        private int stateVersion = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +160,16 @@ namespace UnitySim.UITemplates
             InitializeUITemplates();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +179,8 @@ namespace UnitySim.UITemplates
         private void InitializeUITemplates()
         {
             currentData = new UITemplatesData();
+            stateVersion++;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,19 +191,19 @@ namespace UnitySim.UITemplates
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
                         currentData.uitemplates.componentsRendered += UnityEngine.Random.Range(1, 5);
             currentData.uitemplates.customizations += UnityEngine.Random.Range(0, 1);
@@ -121,6 +219,12 @@ namespace UnitySim.UITemplates
                 OnUITemplatesChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -128,10 +232,93 @@ namespace UnitySim.UITemplates
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.uitemplates;
+            var changed = publishFullDelta ? UITemplatesField.All : info.Diff(publishedInfo);
+            if (changed == UITemplatesField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnUITemplatesDelta?.Invoke(new UITemplatesDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(UITemplatesSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.AddInt(1, 5));
+            channels.Add(SimulationChannel.AddInt(0, 1));
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.uitemplates.componentsRendered;
+            values[1] = currentData.uitemplates.customizations;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.uitemplates.componentsRendered = (int)values[0];
+            currentData.uitemplates.customizations = (int)values[1];
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("UITemplatesSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -142,7 +329,9 @@ namespace UnitySim.UITemplates
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -194,7 +383,7 @@ namespace UnitySim.UITemplates
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -217,6 +406,7 @@ namespace UnitySim.UITemplates
             Debug.Log($"UITemplatesSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
@@ -0,0 +1,481 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.UrbanPlanning
+{
+    // Uniform grid over a fixed rectangle. Every item sits on one layer and in one cell, and each
+    // (layer, cell) pair keeps a packed bucket of positions, so a query for one kind of feature
+    // never walks past the others and reads each bucket front to back. Insert, remove and move
+    // are O(1): removal swaps the last entry into the gap. Buckets and item storage grow by
+    // doubling and are reused; queries write into caller-owned lists and never allocate.
+    public class SpatialGrid
+    {
+        private struct Entry
+        {
+            public float x;
+            public float y;
+            public int item;
+        }
+
+        private readonly float cellSize;
+        private readonly float inverseCellSize;
+        private readonly int columns;
+        private readonly int rows;
+        private readonly int layers;
+
+        // One bucket per (layer * cells + cell), allocated on first use
+        private readonly Entry[][] buckets;
+        private readonly int[] bucketCounts;
+
+        private float[] x;
+        private float[] y;
+        private int[] bucketOf;
+        private int[] slotOf;
+        private byte[] layerOf;
+        private bool[] alive;
+
+        private readonly Stack<int> free = new Stack<int>();
+        private int slots = 0;
+
+        // Bounded max-heap on distance for k-nearest queries
+        private int[] nearestItems = new int[16];
+        private float[] nearestDistances = new float[16];
+
+        public float CellSize => cellSize;
+        public int Columns => columns;
+        public int Rows => rows;
+        public int Layers => layers;
+        public int Count { get; private set; }
+        public int Capacity => x.Length;
+        public Vector2 Size => new Vector2(columns * cellSize, rows * cellSize);
+
+        public SpatialGrid(Vector2 size, float cellSize, int layers, int capacity = 1024)
+        {
+            this.cellSize = Math.Max(0.01f, cellSize);
+            inverseCellSize = 1f / this.cellSize;
+            columns = Math.Max(1, (int)Math.Ceiling(size.x * inverseCellSize));
+            rows = Math.Max(1, (int)Math.Ceiling(size.y * inverseCellSize));
+            this.layers = Math.Max(1, Math.Min(32, layers));
+
+            buckets = new Entry[this.layers * columns * rows][];
+            bucketCounts = new int[buckets.Length];
+
+            Allocate(Math.Max(16, capacity));
+        }
+
+        #region Items
+
+        public bool Contains(int item)
+        {
+            return item >= 0 && item < slots && alive[item];
+        }
+
+        public Vector2 GetPosition(int item)
+        {
+            return new Vector2(x[item], y[item]);
+        }
+
+        public int GetLayer(int item)
+        {
+            return layerOf[item];
+        }
+
+        // Positions outside the bounds are kept as given and filed under the nearest edge cell
+        public int Insert(Vector2 position, int layer)
+        {
+            if ((uint)layer >= (uint)layers) throw new ArgumentOutOfRangeException(nameof(layer));
+
+            int item = AllocateItem();
+            x[item] = position.x;
+            y[item] = position.y;
+            layerOf[item] = (byte)layer;
+            alive[item] = true;
+            Link(item, layer * columns * rows + CellIndex(position.x, position.y));
+            Count++;
+            return item;
+        }
+
+        public void InsertBatch(ReadOnlySpan<Vector2> positions, int layer, Span<int> items)
+        {
+            if (items.Length < positions.Length) throw new ArgumentException("Item span is shorter than the batch", nameof(items));
+
+            Reserve(Count + positions.Length);
+            for (int i = 0; i < positions.Length; i++)
+            {
+                items[i] = Insert(positions[i], layer);
+            }
+        }
+
+        public bool Remove(int item)
+        {
+            if (!Contains(item)) return false;
+
+            Unlink(item);
+            alive[item] = false;
+            free.Push(item);
+            Count--;
+            return true;
+        }
+
+        public int RemoveBatch(ReadOnlySpan<int> items)
+        {
+            int removed = 0;
+            for (int i = 0; i < items.Length; i++)
+            {
+                if (Remove(items[i])) removed++;
+            }
+            return removed;
+        }
+
+        public void Move(int item, Vector2 position)
+        {
+            if (!Contains(item)) throw new ArgumentOutOfRangeException(nameof(item));
+
+            x[item] = position.x;
+            y[item] = position.y;
+
+            int bucket = layerOf[item] * columns * rows + CellIndex(position.x, position.y);
+            if (bucket == bucketOf[item])
+            {
+                ref var entry = ref buckets[bucket][slotOf[item]];
+                entry.x = position.x;
+                entry.y = position.y;
+                return;
+            }
+
+            Unlink(item);
+            Link(item, bucket);
+        }
+
+        public void Clear()
+        {
+            Array.Clear(bucketCounts, 0, bucketCounts.Length);
+            Array.Clear(alive, 0, slots);
+            free.Clear();
+            slots = 0;
+            Count = 0;
+        }
+
+        // Grows item storage ahead of a large batch so it is resized once
+        public void Reserve(int capacity)
+        {
+            if (capacity > x.Length) Allocate(Math.Max(capacity, x.Length * 2));
+        }
+
+        #endregion
+
+        #region Queries
+
+        // Appends every item on the masked layers within radius of center; returns how many were added
+        public int QueryRadius(Vector2 center, float radius, uint layerMask, List<int> results)
+        {
+            int added = 0;
+            float radiusSq = radius * radius;
+            GetCellRange(center, radius, out int minX, out int minY, out int maxX, out int maxY);
+
+            for (int layer = 0; layer < layers; layer++)
+            {
+                if ((layerMask & (1u << layer)) == 0) continue;
+                int layerBase = layer * columns * rows;
+
+                for (int cy = minY; cy <= maxY; cy++)
+                {
+                    for (int cx = minX; cx <= maxX; cx++)
+                    {
+                        if (CellDistanceSq(center, cx, cy) > radiusSq) continue;
+
+                        int bucket = layerBase + cy * columns + cx;
+                        var entries = buckets[bucket];
+                        for (int i = 0, count = bucketCounts[bucket]; i < count; i++)
+                        {
+                            float dx = entries[i].x - center.x;
+                            float dy = entries[i].y - center.y;
+                            if (dx * dx + dy * dy > radiusSq) continue;
+
+                            results.Add(entries[i].item);
+                            added++;
+                        }
+                    }
+                }
+            }
+            return added;
+        }
+
+        public int CountRadius(Vector2 center, float radius, uint layerMask)
+        {
+            int count = 0;
+            float radiusSq = radius * radius;
+            GetCellRange(center, radius, out int minX, out int minY, out int maxX, out int maxY);
+
+            for (int layer = 0; layer < layers; layer++)
+            {
+                if ((layerMask & (1u << layer)) == 0) continue;
+                int layerBase = layer * columns * rows;
+
+                for (int cy = minY; cy <= maxY; cy++)
+                {
+                    for (int cx = minX; cx <= maxX; cx++)
+                    {
+                        if (CellDistanceSq(center, cx, cy) > radiusSq) continue;
+
+                        // Cells wholly inside the circle are counted without reading their entries
+                        int bucket = layerBase + cy * columns + cx;
+                        if (CellFarDistanceSq(center, cx, cy) <= radiusSq)
+                        {
+                            count += bucketCounts[bucket];
+                            continue;
+                        }
+
+                        var entries = buckets[bucket];
+                        for (int i = 0, n = bucketCounts[bucket]; i < n; i++)
+                        {
+                            float dx = entries[i].x - center.x;
+                            float dy = entries[i].y - center.y;
+                            if (dx * dx + dy * dy <= radiusSq) count++;
+                        }
+                    }
+                }
+            }
+            return count;
+        }
+
+        // Closest item on the masked layers within maxDistance, or -1
+        public int Nearest(Vector2 center, uint layerMask, float maxDistance, out float distance)
+        {
+            int found = SearchNearest(center, 1, layerMask, maxDistance);
+            distance = found > 0 ? (float)Math.Sqrt(nearestDistances[0]) : float.PositiveInfinity;
+            return found > 0 ? nearestItems[0] : -1;
+        }
+
+        // Appends up to k items ordered nearest first; returns how many were added
+        public int FindNearest(Vector2 center, int k, uint layerMask, float maxDistance, List<int> results)
+        {
+            if (k <= 0) return 0;
+
+            int found = SearchNearest(center, k, layerMask, maxDistance);
+
+            // Popping the max-heap yields farthest first, so fill the tail of the result range backwards
+            int start = results.Count;
+            for (int i = 0; i < found; i++) results.Add(-1);
+            for (int i = found - 1; i >= 0; i--)
+            {
+                results[start + i] = nearestItems[0];
+                PopNearest(i + 1);
+            }
+            return found;
+        }
+
+        // Visits rings of cells outward from the center cell until no unvisited cell can beat the
+        // current k-th distance. Leaves the heap in nearestItems/nearestDistances.
+        private int SearchNearest(Vector2 center, int k, uint layerMask, float maxDistance)
+        {
+            if (nearestItems.Length < k)
+            {
+                Array.Resize(ref nearestItems, k);
+                Array.Resize(ref nearestDistances, k);
+            }
+
+            float maxSq = float.IsPositiveInfinity(maxDistance) ? float.PositiveInfinity : maxDistance * maxDistance;
+            int originX = ClampColumn(center.x);
+            int originY = ClampRow(center.y);
+            int maxRing = Math.Max(Math.Max(originX, columns - 1 - originX), Math.Max(originY, rows - 1 - originY));
+            int found = 0;
+
+            for (int ring = 0; ring <= maxRing; ring++)
+            {
+                // Every cell on this ring is at least (ring - 1) cells away from the center
+                float boundSq = ring > 1 ? (ring - 1) * cellSize * (ring - 1) * cellSize : 0f;
+                if (boundSq > maxSq) break;
+                if (found == k && boundSq >= nearestDistances[0]) break;
+
+                int minX = originX - ring, maxX = originX + ring;
+                int minY = originY - ring, maxY = originY + ring;
+                for (int cy = Math.Max(0, minY); cy <= Math.Min(rows - 1, maxY); cy++)
+                {
+                    bool edgeRow = cy == minY || cy == maxY;
+                    int step = edgeRow ? 1 : maxX - minX;
+                    for (int cx = minX; cx <= maxX; cx += Math.Max(1, step))
+                    {
+                        if (cx < 0 || cx >= columns) continue;
+                        found = ScanCell(center, cx, cy, k, layerMask, maxSq, found);
+                    }
+                }
+            }
+            return found;
+        }
+
+        private int ScanCell(Vector2 center, int cx, int cy, int k, uint layerMask, float maxSq, int found)
+        {
+            int cell = cy * columns + cx;
+            for (int layer = 0; layer < layers; layer++)
+            {
+                if ((layerMask & (1u << layer)) == 0) continue;
+
+                int bucket = layer * columns * rows + cell;
+                var entries = buckets[bucket];
+                for (int i = 0, count = bucketCounts[bucket]; i < count; i++)
+                {
+                    float dx = entries[i].x - center.x;
+                    float dy = entries[i].y - center.y;
+                    float d = dx * dx + dy * dy;
+                    if (d > maxSq) continue;
+
+                    if (found < k)
+                    {
+                        PushNearest(found++, entries[i].item, d);
+                    }
+                    else if (d < nearestDistances[0])
+                    {
+                        nearestItems[0] = entries[i].item;
+                        nearestDistances[0] = d;
+                        SiftDownNearest(0, found);
+                    }
+                }
+            }
+            return found;
+        }
+
+        #endregion
+
+        #region Helpers
+
+        private void PushNearest(int count, int item, float distance)
+        {
+            int i = count;
+            while (i > 0)
+            {
+                int parent = (i - 1) >> 1;
+                if (nearestDistances[parent] >= distance) break;
+                nearestItems[i] = nearestItems[parent];
+                nearestDistances[i] = nearestDistances[parent];
+                i = parent;
+            }
+            nearestItems[i] = item;
+            nearestDistances[i] = distance;
+        }
+
+        private void PopNearest(int count)
+        {
+            count--;
+            nearestItems[0] = nearestItems[count];
+            nearestDistances[0] = nearestDistances[count];
+            SiftDownNearest(0, count);
+        }
+
+        private void SiftDownNearest(int i, int count)
+        {
+            int item = nearestItems[i];
+            float distance = nearestDistances[i];
+            while (true)
+            {
+                int child = 2 * i + 1;
+                if (child >= count) break;
+                if (child + 1 < count && nearestDistances[child + 1] > nearestDistances[child]) child++;
+                if (nearestDistances[child] <= distance) break;
+
+                nearestItems[i] = nearestItems[child];
+                nearestDistances[i] = nearestDistances[child];
+                i = child;
+            }
+            nearestItems[i] = item;
+            nearestDistances[i] = distance;
+        }
+
+        private void Link(int item, int bucket)
+        {
+            var entries = buckets[bucket];
+            int count = bucketCounts[bucket];
+            if (entries == null || count == entries.Length)
+            {
+                Array.Resize(ref entries, Math.Max(4, count * 2));
+                buckets[bucket] = entries;
+            }
+
+            entries[count] = new Entry { x = x[item], y = y[item], item = item };
+            bucketCounts[bucket] = count + 1;
+            bucketOf[item] = bucket;
+            slotOf[item] = count;
+        }
+
+        private void Unlink(int item)
+        {
+            int bucket = bucketOf[item];
+            int slot = slotOf[item];
+            int last = --bucketCounts[bucket];
+
+            var entries = buckets[bucket];
+            if (slot != last)
+            {
+                entries[slot] = entries[last];
+                slotOf[entries[slot].item] = slot;
+            }
+        }
+
+        private int AllocateItem()
+        {
+            if (free.Count > 0) return free.Pop();
+            if (slots == x.Length) Allocate(x.Length * 2);
+            return slots++;
+        }
+
+        private void Allocate(int capacity)
+        {
+            Array.Resize(ref x, capacity);
+            Array.Resize(ref y, capacity);
+            Array.Resize(ref bucketOf, capacity);
+            Array.Resize(ref slotOf, capacity);
+            Array.Resize(ref layerOf, capacity);
+            Array.Resize(ref alive, capacity);
+        }
+
+        private int ClampColumn(float px)
+        {
+            return Math.Min(columns - 1, Math.Max(0, (int)Math.Floor(px * inverseCellSize)));
+        }
+
+        private int ClampRow(float py)
+        {
+            return Math.Min(rows - 1, Math.Max(0, (int)Math.Floor(py * inverseCellSize)));
+        }
+
+        private int CellIndex(float px, float py)
+        {
+            return ClampRow(py) * columns + ClampColumn(px);
+        }
+
+        private void GetCellRange(Vector2 center, float radius, out int minX, out int minY, out int maxX, out int maxY)
+        {
+            minX = ClampColumn(center.x - radius);
+            maxX = ClampColumn(center.x + radius);
+            minY = ClampRow(center.y - radius);
+            maxY = ClampRow(center.y + radius);
+        }
+
+        // Squared distance from a point to the nearest point of a cell; edge cells reach outward
+        // without limit because out-of-bounds items are filed under them
+        private float CellDistanceSq(Vector2 p, int cx, int cy)
+        {
+            float left = cx == 0 ? float.NegativeInfinity : cx * cellSize;
+            float right = cx == columns - 1 ? float.PositiveInfinity : (cx + 1) * cellSize;
+            float bottom = cy == 0 ? float.NegativeInfinity : cy * cellSize;
+            float top = cy == rows - 1 ? float.PositiveInfinity : (cy + 1) * cellSize;
+
+            float dx = p.x < left ? left - p.x : (p.x > right ? p.x - right : 0f);
+            float dy = p.y < bottom ? bottom - p.y : (p.y > top ? p.y - top : 0f);
+            return dx * dx + dy * dy;
+        }
+
+        // Squared distance to the farthest point of a cell; unbounded for edge cells
+        private float CellFarDistanceSq(Vector2 p, int cx, int cy)
+        {
+            if (cx == 0 || cy == 0 || cx == columns - 1 || cy == rows - 1) return float.PositiveInfinity;
+
+            float dx = Math.Max(Math.Abs(p.x - cx * cellSize), Math.Abs(p.x - (cx + 1) * cellSize));
+            float dy = Math.Max(Math.Abs(p.y - cy * cellSize), Math.Abs(p.y - (cy + 1) * cellSize));
+            return dx * dx + dy * dy;
+        }
+
+        #endregion
+    }
+}
@@ -0,0 +1,332 @@
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace UnitySim.UrbanPlanning
+{
+    public enum UrbanFeature : byte
+    {
+        Residential,
+        Commercial,
+        Industrial,
+        Civic,
+        GreenSpace
+    }
+
+    [System.Serializable]
+    public class UrbanLayoutSettings
+    {
+        // Extent of the city in metres; cells of cellSize metres make up the index grid
+        public Vector2 size = new Vector2(10000f, 10000f);
+        public float cellSize = 100f;
+
+        // A green space inside greenRadius lifts a home's score, more the closer it is
+        public float greenRadius = 400f;
+        public float greenWeight = 0.25f;
+
+        // Shops and civic buildings inside serviceRadius, up to servicesForFullScore of them
+        public float serviceRadius = 300f;
+        public int servicesForFullScore = 6;
+        public float serviceWeight = 0.2f;
+
+        // Each industrial site inside industryRadius costs industryPenalty, capped at industryWeight
+        public float industryRadius = 250f;
+        public float industryPenalty = 0.08f;
+        public float industryWeight = 0.35f;
+
+        public float baseline = 0.6f;
+    }
+
+    // Buildings and zones in a SpatialGrid, with citizen happiness as a resident-weighted mean of
+    // per-home scores. A home's score only depends on features within the largest influence
+    // radius, so each change marks just the homes around it and they are rescored on the next
+    // Refresh. Batches large enough to touch most homes rescore everything once instead.
+    public class UrbanLayout
+    {
+        private const int FeatureCount = 5;
+
+        private readonly UrbanLayoutSettings settings;
+        private readonly SpatialGrid grid;
+
+        // Per grid item; score is -1 until a home has been scored into the aggregate
+        private int[] residents = new int[0];
+        private float[] score = new float[0];
+        private bool[] dirty = new bool[0];
+
+        private readonly List<int> dirtyHomes = new List<int>();
+        private readonly List<int> scratch = new List<int>();
+        private readonly int[] counts = new int[FeatureCount];
+        private bool rescoreAll = false;
+
+        private double scoreSum = 0.0;
+        private long scoredResidents = 0;
+
+        public SpatialGrid Grid => grid;
+        public UrbanLayoutSettings Settings => settings;
+        public long Population { get; private set; }
+        public int PendingRescores => rescoreAll ? counts[(int)UrbanFeature.Residential] : dirtyHomes.Count;
+
+        public int Buildings => grid.Count - counts[(int)UrbanFeature.GreenSpace];
+
+        // Resident-weighted mean home score on a 0-100 scale
+        public float CitizenHappiness
+        {
+            get
+            {
+                Refresh();
+                return scoredResidents > 0 ? (float)(100.0 * scoreSum / scoredResidents) : 100f * Mathf.Clamp01(settings.baseline);
+            }
+        }
+
+        public UrbanLayout(UrbanLayoutSettings settings, int capacity = 1024)
+        {
+            this.settings = settings ?? new UrbanLayoutSettings();
+            grid = new SpatialGrid(this.settings.size, this.settings.cellSize, FeatureCount, capacity);
+            EnsureStorage();
+        }
+
+        public static uint Mask(UrbanFeature feature)
+        {
+            return 1u << (int)feature;
+        }
+
+        public int CountOf(UrbanFeature feature)
+        {
+            return counts[(int)feature];
+        }
+
+        #region Editing
+
+        // residents only applies to homes
+        public int Add(Vector2 position, UrbanFeature feature, int residentCount = 0)
+        {
+            int item = grid.Insert(position, (int)feature);
+            EnsureStorage();
+            Track(item, feature, residentCount);
+            if (!rescoreAll) MarkAround(position, feature, item);
+            return item;
+        }
+
+        public void AddBatch(ReadOnlySpan<Vector2> positions, UrbanFeature feature, int residentCount, Span<int> items)
+        {
+            grid.InsertBatch(positions, (int)feature, items);
+            EnsureStorage();
+
+            if (TouchesMost(positions.Length, feature)) rescoreAll = true;
+            for (int i = 0; i < positions.Length; i++)
+            {
+                Track(items[i], feature, residentCount);
+                if (!rescoreAll) MarkAround(positions[i], feature, items[i]);
+            }
+        }
+
+        public bool Remove(int item)
+        {
+            if (!grid.Contains(item)) return false;
+
+            var feature = (UrbanFeature)grid.GetLayer(item);
+            var position = grid.GetPosition(item);
+            Untrack(item, feature);
+            grid.Remove(item);
+            if (!rescoreAll) MarkAround(position, feature, -1);
+            return true;
+        }
+
+        public int RemoveBatch(ReadOnlySpan<int> items)
+        {
+            if (items.Length > counts[(int)UrbanFeature.Residential] / 8) rescoreAll = true;
+
+            int removed = 0;
+            for (int i = 0; i < items.Length; i++)
+            {
+                if (Remove(items[i])) removed++;
+            }
+            return removed;
+        }
+
+        public void Move(int item, Vector2 position)
+        {
+            var feature = (UrbanFeature)grid.GetLayer(item);
+            var from = grid.GetPosition(item);
+            grid.Move(item, position);
+
+            if (rescoreAll) return;
+            MarkAround(from, feature, item);
+            MarkAround(position, feature, item);
+        }
+
+        public void Clear()
+        {
+            grid.Clear();
+            Array.Clear(counts, 0, counts.Length);
+            dirtyHomes.Clear();
+            rescoreAll = false;
+            scoreSum = 0.0;
+            scoredResidents = 0;
+            Population = 0;
+        }
+
+        #endregion
+
+        #region Scoring
+
+        // Rescores every home marked since the last refresh
+        public void Refresh()
+        {
+            if (rescoreAll)
+            {
+                rescoreAll = false;
+                dirtyHomes.Clear();
+                RescoreAll();
+                return;
+            }
+
+            for (int i = 0; i < dirtyHomes.Count; i++)
+            {
+                int home = dirtyHomes[i];
+                if (!dirty[home]) continue;
+
+                dirty[home] = false;
+                Rescore(home);
+            }
+            dirtyHomes.Clear();
+        }
+
+        public float GetScore(int home)
+        {
+            Refresh();
+            return grid.Contains(home) ? score[home] : -1f;
+        }
+
+        public float ScoreAt(Vector2 position)
+        {
+            float green = 0f;
+            if (grid.Nearest(position, Mask(UrbanFeature.GreenSpace), settings.greenRadius, out float distance) >= 0)
+                green = 1f - distance / Math.Max(1f, settings.greenRadius);
+
+            int services = grid.CountRadius(position, settings.serviceRadius, Mask(UrbanFeature.Commercial) | Mask(UrbanFeature.Civic));
+            int industry = grid.CountRadius(position, settings.industryRadius, Mask(UrbanFeature.Industrial));
+
+            float value = settings.baseline
+                + settings.greenWeight * green
+                + settings.serviceWeight * Math.Min(1f, services / (float)Math.Max(1, settings.servicesForFullScore))
+                - Math.Min(settings.industryWeight, industry * settings.industryPenalty);
+            return Mathf.Clamp01(value);
+        }
+
+        private void RescoreAll()
+        {
+            scoreSum = 0.0;
+            scoredResidents = 0;
+            for (int item = 0; item < residents.Length; item++)
+            {
+                dirty[item] = false;
+                score[item] = -1f;
+                if (grid.Contains(item) && grid.GetLayer(item) == (int)UrbanFeature.Residential)
+                    Rescore(item);
+            }
+        }
+
+        private void Rescore(int home)
+        {
+            if (score[home] >= 0f)
+            {
+                scoreSum -= score[home] * (double)residents[home];
+                scoredResidents -= residents[home];
+            }
+
+            score[home] = ScoreAt(grid.GetPosition(home));
+            scoreSum += score[home] * (double)residents[home];
+            scoredResidents += residents[home];
+        }
+
+        private float RadiusFor(UrbanFeature feature)
+        {
+            switch (feature)
+            {
+                case UrbanFeature.GreenSpace: return settings.greenRadius;
+                case UrbanFeature.Commercial:
+                case UrbanFeature.Civic: return settings.serviceRadius;
+                case UrbanFeature.Industrial: return settings.industryRadius;
+                default: return 0f;
+            }
+        }
+
+        // A change to a home only moves that home's score; any other feature moves every home
+        // within its influence radius
+        private void MarkAround(Vector2 position, UrbanFeature feature, int item)
+        {
+            if (feature == UrbanFeature.Residential)
+            {
+                if (item >= 0) MarkDirty(item);
+                return;
+            }
+
+            scratch.Clear();
+            grid.QueryRadius(position, RadiusFor(feature), Mask(UrbanFeature.Residential), scratch);
+            for (int i = 0; i < scratch.Count; i++)
+            {
+                MarkDirty(scratch[i]);
+            }
+        }
+
+        private void MarkDirty(int home)
+        {
+            if (dirty[home]) return;
+
+            dirty[home] = true;
+            dirtyHomes.Add(home);
+        }
+
+        private bool TouchesMost(int batch, UrbanFeature feature)
+        {
+            int homes = counts[(int)UrbanFeature.Residential];
+            if (feature == UrbanFeature.Residential) return batch > homes / 4;
+
+            // Expected homes touched per feature, from the share of the city its radius covers
+            float radius = RadiusFor(feature);
+            double share = Math.PI * radius * radius / Math.Max(1.0, settings.size.x * (double)settings.size.y);
+            return batch * share > 0.5;
+        }
+
+        #endregion
+
+        #region Helpers
+
+        private void Track(int item, UrbanFeature feature, int residentCount)
+        {
+            counts[(int)feature]++;
+            residents[item] = feature == UrbanFeature.Residential ? Math.Max(0, residentCount) : 0;
+            score[item] = -1f;
+            dirty[item] = false;
+            Population += residents[item];
+        }
+
+        private void Untrack(int item, UrbanFeature feature)
+        {
+            counts[(int)feature]--;
+            if (score[item] >= 0f)
+            {
+                scoreSum -= score[item] * (double)residents[item];
+                scoredResidents -= residents[item];
+            }
+
+            Population -= residents[item];
+            residents[item] = 0;
+            score[item] = -1f;
+            dirty[item] = false;
+        }
+
+        private void EnsureStorage()
+        {
+            int capacity = grid.Capacity;
+            if (residents.Length >= capacity) return;
+
+            Array.Resize(ref residents, capacity);
+            Array.Resize(ref score, capacity);
+            Array.Resize(ref dirty, capacity);
+        }
+
+        #endregion
+    }
+}
@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.UrbanPlanning
 {
@@ -13,10 +17,22 @@ namespace UnitySim.UrbanPlanning
 
         public UrbanPlanningData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             urbanplanning = new UrbanPlanningInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (urbanplanning != null)
+                urbanplanning.WriteState(writer, "urbanplanning");
+            else
+                writer.Write("urbanplanning", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,103 @@ namespace UnitySim.UrbanPlanning
         public int greenSpaces = 12;
         public string systemHealth = "operational";
         public string framework = "unity-sim-urban-planning";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("gridSize", gridSize);
+            writer.Write("buildings", buildings);
+            writer.Write("citizenHappiness", citizenHappiness);
+            writer.Write("population", population);
+            writer.Write("trafficFlow", trafficFlow);
+            writer.Write("greenSpaces", greenSpaces);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public UrbanPlanningField Diff(UrbanPlanningInfo other)
+        {
+            var changed = UrbanPlanningField.None;
+            if (gridSize != other.gridSize) changed |= UrbanPlanningField.GridSize;
+            if (buildings != other.buildings) changed |= UrbanPlanningField.Buildings;
+            if (citizenHappiness != other.citizenHappiness) changed |= UrbanPlanningField.CitizenHappiness;
+            if (population != other.population) changed |= UrbanPlanningField.Population;
+            if (trafficFlow != other.trafficFlow) changed |= UrbanPlanningField.TrafficFlow;
+            if (greenSpaces != other.greenSpaces) changed |= UrbanPlanningField.GreenSpaces;
+            if (systemHealth != other.systemHealth) changed |= UrbanPlanningField.SystemHealth;
+            if (framework != other.framework) changed |= UrbanPlanningField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(UrbanPlanningInfo target)
+        {
+            target.gridSize = gridSize;
+            target.buildings = buildings;
+            target.citizenHappiness = citizenHappiness;
+            target.population = population;
+            target.trafficFlow = trafficFlow;
+            target.greenSpaces = greenSpaces;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
     }
 
-    public class UrbanPlanningSystem : MonoBehaviour
+    [System.Flags]
+    public enum UrbanPlanningField
+    {
+        None = 0,
+        GridSize = 1 << 0,
+        Buildings = 1 << 1,
+        CitizenHappiness = 1 << 2,
+        Population = 1 << 3,
+        TrafficFlow = 1 << 4,
+        GreenSpaces = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct UrbanPlanningDelta
+    {
+        public readonly long timestamp;
+        public readonly UrbanPlanningField changed;
+        public readonly UrbanPlanningInfo values;
+
+        public UrbanPlanningDelta(long timestamp, UrbanPlanningField changed, UrbanPlanningInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(UrbanPlanningField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class UrbanPlanningSystem : MonoBehaviour, ISimulationSystem
     {
         [Header("UrbanPlanning Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Layout")]
+        public UrbanLayoutSettings layout = new UrbanLayoutSettings();
+        public int randomSeed = 0;
+        public int initialBuildings = 250;
+        public int initialGreenSpaces = 12;
+        public int districts = 4;
+        public float districtSpread = 1200f;
+        public int residentsPerHome = 80;
+
+        [Header("Growth")]
+        public int buildingsPerUpdate = 2;
+        [SerializeField] private int pendingRescores = 0;
+
         [Header("Current Data")]
         [SerializeField] private UrbanPlanningData currentData;
 
@@ -48,12 +152,21 @@ namespace UnitySim.UrbanPlanning
 
         // Events
         public System.Action<UrbanPlanningData> OnUrbanPlanningChanged;
+        public System.Action<UrbanPlanningDelta> OnUrbanPlanningDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.UrbanPlanningSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly UrbanPlanningInfo publishedInfo = new UrbanPlanningInfo();
+        private bool publishFullDelta = true;
+        private UrbanLayout city;
+        private Unity.Mathematics.Random random;
+        private Vector2[] districtCentres = new Vector2[0];
 
         #region Unity Lifecycle
 
@@ -62,18 +175,16 @@ namespace UnitySim.UrbanPlanning
             InitializeUrbanPlanning();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +194,12 @@ namespace UnitySim.UrbanPlanning
         private void InitializeUrbanPlanning()
         {
             currentData = new UrbanPlanningData();
+
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            random = new Unity.Mathematics.Random(seed);
+            city = new UrbanLayout(layout, Mathf.Max(1024, initialBuildings + initialGreenSpaces));
+            SeedLayout();
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +210,88 @@ namespace UnitySim.UrbanPlanning
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
+        }
+
+        private void UpdateSpecificData(float deltaTime)
+        {
+            if (city == null) return;
+
+            for (int i = 0; i < buildingsPerUpdate; i++)
+            {
+                AddBuilding(NextBuildingFeature());
+            }
+
+            // Only homes near this update's changes are rescored
+            var info = currentData.urbanplanning;
+            info.citizenHappiness = city.CitizenHappiness;
+            info.gridSize = new Vector2Int(city.Grid.Columns, city.Grid.Rows);
+            info.buildings = city.Buildings;
+            info.greenSpaces = city.CountOf(UrbanFeature.GreenSpace);
+            info.population = (int)Math.Min(int.MaxValue, city.Population);
+            pendingRescores = city.PendingRescores;
+        }
+
+        #endregion
+
+        #region Layout
+
+        // Buildings scatter around a few district centres; green spaces are spread evenly
+        private void SeedLayout()
+        {
+            var size = layout.size;
+            districtCentres = new Vector2[Mathf.Max(1, districts)];
+            for (int i = 0; i < districtCentres.Length; i++)
+            {
+                districtCentres[i] = new Vector2(size.x * random.NextFloat(0.2f, 0.8f), size.y * random.NextFloat(0.2f, 0.8f));
+            }
+
+            var positions = new Vector2[Mathf.Max(0, initialGreenSpaces)];
+            var items = new int[positions.Length];
+            for (int i = 0; i < positions.Length; i++)
+            {
+                positions[i] = new Vector2(random.NextFloat(size.x), random.NextFloat(size.y));
+            }
+            city.AddBatch(positions, UrbanFeature.GreenSpace, 0, items);
+
+            for (int i = 0; i < initialBuildings; i++)
+            {
+                AddBuilding(NextBuildingFeature());
+            }
+            city.Refresh();
         }
 
-        private void UpdateSpecificData()
+        private int AddBuilding(UrbanFeature feature)
         {
-                        currentData.urbanplanning.buildings += UnityEngine.Random.Range(0, 3);
-            currentData.urbanplanning.population += UnityEngine.Random.Range(-10, 50);
-            currentData.urbanplanning.citizenHappiness = Mathf.Clamp(currentData.urbanplanning.citizenHappiness + UnityEngine.Random.Range(-2f, 2f), 0f, 100f);
+            var centre = districtCentres[random.NextInt(districtCentres.Length)];
+
+            // Box-Muller scatter, clamped to the city
+            float radius = districtSpread * Mathf.Sqrt(-2f * Mathf.Log(1f - random.NextFloat()));
+            float angle = random.NextFloat(2f * Mathf.PI);
+            var position = new Vector2(
+                Mathf.Clamp(centre.x + radius * Mathf.Cos(angle), 0f, layout.size.x),
+                Mathf.Clamp(centre.y + radius * Mathf.Sin(angle), 0f, layout.size.y));
+
+            int residents = feature == UrbanFeature.Residential ? random.NextInt(residentsPerHome / 2, residentsPerHome * 3 / 2 + 1) : 0;
+            return city.Add(position, feature, residents);
+        }
+
+        private UrbanFeature NextBuildingFeature()
+        {
+            float roll = random.NextFloat();
+            if (roll < 0.7f) return UrbanFeature.Residential;
+            if (roll < 0.85f) return UrbanFeature.Commercial;
+            if (roll < 0.95f) return UrbanFeature.Industrial;
+            return UrbanFeature.Civic;
         }
 
         private void ProcessUpdate()
@@ -122,6 +304,12 @@ namespace UnitySim.UrbanPlanning
                 OnUrbanPlanningChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +317,67 @@ namespace UnitySim.UrbanPlanning
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.urbanplanning;
+            var changed = publishFullDelta ? UrbanPlanningField.All : info.Diff(publishedInfo);
+            if (changed == UrbanPlanningField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnUrbanPlanningDelta?.Invoke(new UrbanPlanningDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(UrbanPlanningSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("UrbanPlanningSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +388,9 @@ namespace UnitySim.UrbanPlanning
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +411,11 @@ namespace UnitySim.UrbanPlanning
             return currentData;
         }
 
+        public UrbanLayout GetLayout()
+        {
+            return city;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +447,7 @@ namespace UnitySim.UrbanPlanning
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +459,16 @@ namespace UnitySim.UrbanPlanning
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            layout.cellSize = Mathf.Max(1f, layout.cellSize);
+            layout.greenRadius = Mathf.Max(0f, layout.greenRadius);
+            layout.serviceRadius = Mathf.Max(0f, layout.serviceRadius);
+            layout.industryRadius = Mathf.Max(0f, layout.industryRadius);
+            layout.servicesForFullScore = Mathf.Max(1, layout.servicesForFullScore);
+            initialBuildings = Mathf.Max(0, initialBuildings);
+            initialGreenSpaces = Mathf.Max(0, initialGreenSpaces);
+            districts = Mathf.Max(1, districts);
+            residentsPerHome = Mathf.Max(1, residentsPerHome);
+            buildingsPerUpdate = Mathf.Max(0, buildingsPerUpdate);
         }
 
         #endregion
@@ -218,7 +480,10 @@ namespace UnitySim.UrbanPlanning
             Debug.Log($"UrbanPlanningSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (city != null)
+                Debug.Log($"- Layout: {city.Buildings} buildings, {city.CountOf(UrbanFeature.GreenSpace)} green spaces on a {city.Grid.Columns}x{city.Grid.Rows} grid, {city.PendingRescores} homes awaiting rescore");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
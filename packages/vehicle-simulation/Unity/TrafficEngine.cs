@@ -0,0 +1,639 @@
+using System;
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using Unity.Mathematics;
+
+namespace UnitySim.VehicleSimulation
+{
+    // Microscopic traffic on a signalised grid road network using the Intelligent Driver
+    // Model. Vehicle state is structure-of-arrays, kept sorted by lane and then by position
+    // from the front of the lane back, so each lane is a contiguous run whose leader is
+    // always the previous element. Lanes update in parallel from a read-only snapshot.
+    public class TrafficEngine : IDisposable
+    {
+        private const int LaneBatchCount = 16;
+
+        private readonly int gridSize;
+        private readonly int nodeCount;
+        private readonly int laneCount;
+        private readonly int vehicleCount;
+        private readonly float blockLength;
+        private double time = 0.0;
+        private JobHandle pending;
+        private bool scheduled = false;
+        private bool disposed = false;
+
+        // Road graph: one lane per direction between neighbouring intersections
+        private NativeArray<float> laneLength;
+        private NativeArray<float> laneSpeedLimit;
+        private NativeArray<int> laneStartNode;
+        private NativeArray<int> laneEndNode;
+        private NativeArray<byte> laneAxis;
+        private NativeArray<int> successorStart;
+        private NativeArray<int> successorCount;
+        private NativeArray<int> successors;
+        private NativeArray<byte> nodeSignalised;
+        private NativeArray<float> nodeOffset;
+
+        // Vehicles, sorted by lane; laneStart/laneVehicles index into them
+        private NativeArray<float> position;
+        private NativeArray<float> speed;
+        private NativeArray<int> lane;
+        private NativeArray<int> nextLane;
+        private NativeArray<uint> id;
+        private NativeArray<int> laneStart;
+        private NativeArray<int> laneVehicles;
+
+        // Step output before it is re-sorted
+        private NativeArray<float> newPosition;
+        private NativeArray<float> newSpeed;
+        private NativeArray<int> newLane;
+        private NativeArray<int> newNextLane;
+        private NativeArray<uint> newId;
+
+        // Per-lane partial sums, reduced into stats
+        private NativeArray<float4> lanePartials;
+        private NativeArray<float> stats;
+
+        public int VehicleCount => vehicleCount;
+        public int LaneCount => laneCount;
+        public int IntersectionCount => nodeCount;
+        public double Time => time;
+        public bool IsStepping => scheduled && !pending.IsCompleted;
+
+        // IDM parameters (metres, seconds)
+        public float MaxAcceleration { get; set; } = 1.5f;
+        public float ComfortDeceleration { get; set; } = 2f;
+        public float MaxBraking { get; set; } = 8f;
+        public float MinimumGap { get; set; } = 2f;
+        public float TimeHeadway { get; set; } = 1.5f;
+        public float VehicleLength { get; set; } = 4.5f;
+        public float SignalCycle { get; set; } = 60f;
+
+        // Aggregates of the last completed step
+        public float MeanSpeed { get { Complete(); return stats[0]; } }
+        public float MeanFreeFlowSpeed { get { Complete(); return stats[1]; } }
+        public float StoppedFraction { get { Complete(); return stats[2]; } }
+        public int SignalisedIntersections { get; private set; }
+
+        // Reading the vehicle arrays completes scheduled steps
+        public NativeArray<float> Positions { get { Complete(); return position; } }
+        public NativeArray<float> Speeds { get { Complete(); return speed; } }
+        public NativeArray<int> Lanes { get { Complete(); return lane; } }
+        public NativeArray<float> LaneLengths => laneLength;
+
+        public TrafficEngine(int gridSize, float blockLength, float speedLimit, int vehicleCount, uint seed)
+        {
+            this.gridSize = Math.Max(2, gridSize);
+            nodeCount = this.gridSize * this.gridSize;
+            laneCount = 4 * this.gridSize * (this.gridSize - 1);
+            this.vehicleCount = Math.Max(0, vehicleCount);
+            this.blockLength = Math.Max(10f, blockLength);
+
+            BuildNetwork(this.blockLength, Math.Max(1f, speedLimit), seed);
+            PlaceVehicles(seed);
+        }
+
+        #region Setup
+
+        private void BuildNetwork(float blockLength, float speedLimit, uint seed)
+        {
+            laneLength = new NativeArray<float>(laneCount, Allocator.Persistent);
+            laneSpeedLimit = new NativeArray<float>(laneCount, Allocator.Persistent);
+            laneStartNode = new NativeArray<int>(laneCount, Allocator.Persistent);
+            laneEndNode = new NativeArray<int>(laneCount, Allocator.Persistent);
+            laneAxis = new NativeArray<byte>(laneCount, Allocator.Persistent);
+            successorStart = new NativeArray<int>(laneCount, Allocator.Persistent);
+            successorCount = new NativeArray<int>(laneCount, Allocator.Persistent);
+            successors = new NativeArray<int>(laneCount * 3, Allocator.Persistent);
+            nodeSignalised = new NativeArray<byte>(nodeCount, Allocator.Persistent);
+            nodeOffset = new NativeArray<float>(nodeCount, Allocator.Persistent);
+            laneStart = new NativeArray<int>(laneCount, Allocator.Persistent);
+            laneVehicles = new NativeArray<int>(laneCount, Allocator.Persistent);
+            lanePartials = new NativeArray<float4>(laneCount, Allocator.Persistent);
+            stats = new NativeArray<float>(3, Allocator.Persistent);
+
+            var outgoing = new int[nodeCount * 4];
+            var outgoingCount = new int[nodeCount];
+            var random = new Unity.Mathematics.Random(seed != 0 ? seed : 1u);
+
+            int next = 0;
+            for (int y = 0; y < gridSize; y++)
+            {
+                for (int x = 0; x < gridSize; x++)
+                {
+                    int node = x + y * gridSize;
+                    if (x + 1 < gridSize) next = AddRoad(next, node, node + 1, 0, blockLength, speedLimit, outgoing, outgoingCount, ref random);
+                    if (y + 1 < gridSize) next = AddRoad(next, node, node + gridSize, 1, blockLength, speedLimit, outgoing, outgoingCount, ref random);
+                }
+            }
+
+            // Every exit from the end node except the U-turn back along the same road
+            int offset = 0;
+            for (int l = 0; l < laneCount; l++)
+            {
+                int end = laneEndNode[l];
+                successorStart[l] = offset;
+                for (int k = 0; k < outgoingCount[end]; k++)
+                {
+                    int candidate = outgoing[end * 4 + k];
+                    if (laneEndNode[candidate] == laneStartNode[l]) continue;
+                    successors[offset++] = candidate;
+                }
+                successorCount[l] = offset - successorStart[l];
+            }
+
+            // Junctions with three or more roads get lights with staggered phases
+            int signalised = 0;
+            for (int n = 0; n < nodeCount; n++)
+            {
+                bool junction = outgoingCount[n] >= 3;
+                nodeSignalised[n] = junction ? (byte)1 : (byte)0;
+                nodeOffset[n] = random.NextFloat(0f, SignalCycle);
+                if (junction) signalised++;
+            }
+            SignalisedIntersections = signalised;
+        }
+
+        private int AddRoad(int next, int a, int b, byte axis, float blockLength, float speedLimit,
+            int[] outgoing, int[] outgoingCount, ref Unity.Mathematics.Random random)
+        {
+            // Blocks vary a little so signal waves do not line up across the whole grid
+            float length = blockLength * random.NextFloat(0.8f, 1.2f);
+
+            for (int direction = 0; direction < 2; direction++)
+            {
+                int from = direction == 0 ? a : b;
+                int to = direction == 0 ? b : a;
+
+                laneLength[next] = length;
+                laneSpeedLimit[next] = speedLimit;
+                laneEndNode[next] = to;
+                laneAxis[next] = axis;
+                laneStartNode[next] = from;
+                outgoing[from * 4 + outgoingCount[from]++] = next;
+                next++;
+            }
+            return next;
+        }
+
+        private void PlaceVehicles(uint seed)
+        {
+            position = new NativeArray<float>(vehicleCount, Allocator.Persistent);
+            speed = new NativeArray<float>(vehicleCount, Allocator.Persistent);
+            lane = new NativeArray<int>(vehicleCount, Allocator.Persistent);
+            nextLane = new NativeArray<int>(vehicleCount, Allocator.Persistent);
+            id = new NativeArray<uint>(vehicleCount, Allocator.Persistent);
+            newPosition = new NativeArray<float>(vehicleCount, Allocator.Persistent);
+            newSpeed = new NativeArray<float>(vehicleCount, Allocator.Persistent);
+            newLane = new NativeArray<int>(vehicleCount, Allocator.Persistent);
+            newNextLane = new NativeArray<int>(vehicleCount, Allocator.Persistent);
+            newId = new NativeArray<uint>(vehicleCount, Allocator.Persistent);
+
+            // Spread vehicles evenly over lanes, front of each lane first, at rest
+            int index = 0;
+            for (int l = 0; l < laneCount; l++)
+            {
+                int count = vehicleCount / laneCount + (l < vehicleCount % laneCount ? 1 : 0);
+                laneStart[l] = index;
+                laneVehicles[l] = count;
+
+                for (int k = 0; k < count; k++)
+                {
+                    uint vehicleId = TrafficMath.Hash((uint)index, seed);
+                    position[index] = laneLength[l] * (1f - (k + 0.5f) / count);
+                    speed[index] = 0f;
+                    lane[index] = l;
+                    id[index] = vehicleId;
+                    nextLane[index] = TrafficMath.Route(vehicleId, l, successorStart, successorCount, successors);
+                    index++;
+                }
+            }
+        }
+
+        #endregion
+
+        #region Step
+
+        // Schedules one step after any step already scheduled, so substeps chain without
+        // waiting; vehicle arrays must not be touched until Complete
+        public JobHandle Schedule(float deltaTime, JobHandle dependency = default)
+        {
+            if (disposed) throw new ObjectDisposedException(nameof(TrafficEngine));
+
+            dependency = JobHandle.CombineDependencies(dependency, pending);
+            var handle = new LaneUpdateJob
+            {
+                deltaTime = deltaTime,
+                time = (float)(time % Math.Max(1f, SignalCycle)),
+                signalCycle = Math.Max(1f, SignalCycle),
+                maxAcceleration = MaxAcceleration,
+                comfortDeceleration = ComfortDeceleration,
+                maxBraking = MaxBraking,
+                minimumGap = MinimumGap,
+                timeHeadway = TimeHeadway,
+                vehicleLength = VehicleLength,
+                laneLength = laneLength,
+                laneSpeedLimit = laneSpeedLimit,
+                laneEndNode = laneEndNode,
+                laneAxis = laneAxis,
+                successorStart = successorStart,
+                successorCount = successorCount,
+                successors = successors,
+                nodeSignalised = nodeSignalised,
+                nodeOffset = nodeOffset,
+                laneStart = laneStart,
+                laneVehicles = laneVehicles,
+                position = position,
+                speed = speed,
+                nextLane = nextLane,
+                id = id,
+                newPosition = newPosition,
+                newSpeed = newSpeed,
+                newLane = newLane,
+                newNextLane = newNextLane,
+                newId = newId,
+                lanePartials = lanePartials
+            }.Schedule(laneCount, LaneBatchCount, dependency);
+
+            var reduce = new ReduceJob
+            {
+                lanePartials = lanePartials,
+                stats = stats
+            }.Schedule(handle);
+
+            // Counting sort by lane; vehicles that crossed a junction land out of order
+            handle = new RebucketJob
+            {
+                laneVehicles = laneVehicles,
+                laneStart = laneStart,
+                newPosition = newPosition,
+                newSpeed = newSpeed,
+                newLane = newLane,
+                newNextLane = newNextLane,
+                newId = newId,
+                position = position,
+                speed = speed,
+                lane = lane,
+                nextLane = nextLane,
+                id = id
+            }.Schedule(handle);
+
+            handle = new LaneSortJob
+            {
+                laneStart = laneStart,
+                laneVehicles = laneVehicles,
+                position = position,
+                speed = speed,
+                nextLane = nextLane,
+                id = id
+            }.Schedule(laneCount, LaneBatchCount, handle);
+
+            time += deltaTime;
+            pending = JobHandle.CombineDependencies(handle, reduce);
+            scheduled = true;
+            return pending;
+        }
+
+        // Waits for every scheduled step
+        public void Complete()
+        {
+            if (!scheduled) return;
+
+            pending.Complete();
+            scheduled = false;
+        }
+
+        public void Step(float deltaTime)
+        {
+            Schedule(deltaTime);
+            Complete();
+        }
+
+        // Where a vehicle is on the ground plane, with intersections blockLength apart on a
+        // square grid; roads longer or shorter than a block are scaled onto it. heading is
+        // in degrees clockwise from +z. Only valid while no step is running.
+        public float3 GetVehiclePosition(int index, out float heading)
+        {
+            Complete();
+            int l = lane[index];
+            int from = laneStartNode[l];
+            int to = laneEndNode[l];
+            float2 a = new float2(from % gridSize, from / gridSize) * blockLength;
+            float2 b = new float2(to % gridSize, to / gridSize) * blockLength;
+            float2 p = math.lerp(a, b, math.saturate(position[index] / math.max(1e-3f, laneLength[l])));
+
+            float2 direction = b - a;
+            heading = math.degrees(math.atan2(direction.x, direction.y));
+            return new float3(p.x, 0f, p.y);
+        }
+
+        public uint GetVehicleId(int index)
+        {
+            Complete();
+            return id[index];
+        }
+
+        public void Dispose()
+        {
+            if (disposed) return;
+            Complete();
+            disposed = true;
+
+            laneLength.Dispose();
+            laneSpeedLimit.Dispose();
+            laneStartNode.Dispose();
+            laneEndNode.Dispose();
+            laneAxis.Dispose();
+            successorStart.Dispose();
+            successorCount.Dispose();
+            successors.Dispose();
+            nodeSignalised.Dispose();
+            nodeOffset.Dispose();
+            position.Dispose();
+            speed.Dispose();
+            lane.Dispose();
+            nextLane.Dispose();
+            id.Dispose();
+            laneStart.Dispose();
+            laneVehicles.Dispose();
+            newPosition.Dispose();
+            newSpeed.Dispose();
+            newLane.Dispose();
+            newNextLane.Dispose();
+            newId.Dispose();
+            lanePartials.Dispose();
+            stats.Dispose();
+        }
+
+        #endregion
+
+        #region Jobs
+
+        [BurstCompile]
+        private struct LaneUpdateJob : IJobParallelFor
+        {
+            public float deltaTime;
+            public float time;          // seconds into the signal cycle
+            public float signalCycle;
+            public float maxAcceleration;
+            public float comfortDeceleration;
+            public float maxBraking;
+            public float minimumGap;
+            public float timeHeadway;
+            public float vehicleLength;
+
+            [ReadOnly] public NativeArray<float> laneLength;
+            [ReadOnly] public NativeArray<float> laneSpeedLimit;
+            [ReadOnly] public NativeArray<int> laneEndNode;
+            [ReadOnly] public NativeArray<byte> laneAxis;
+            [ReadOnly] public NativeArray<int> successorStart;
+            [ReadOnly] public NativeArray<int> successorCount;
+            [ReadOnly] public NativeArray<int> successors;
+            [ReadOnly] public NativeArray<byte> nodeSignalised;
+            [ReadOnly] public NativeArray<float> nodeOffset;
+            [ReadOnly] public NativeArray<int> laneStart;
+            [ReadOnly] public NativeArray<int> laneVehicles;
+            [ReadOnly] public NativeArray<float> position;
+            [ReadOnly] public NativeArray<float> speed;
+            [ReadOnly] public NativeArray<int> nextLane;
+            [ReadOnly] public NativeArray<uint> id;
+
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<float> newPosition;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<float> newSpeed;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<int> newLane;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<int> newNextLane;
+            [NativeDisableParallelForRestriction, WriteOnly] public NativeArray<uint> newId;
+            [WriteOnly] public NativeArray<float4> lanePartials;
+
+            public void Execute(int l)
+            {
+                int start = laneStart[l];
+                int count = laneVehicles[l];
+                float length = laneLength[l];
+                bool green = IsGreen(l);
+                float speedSum = 0f, freeSum = 0f, stopped = 0f;
+                float sqrtAB = math.sqrt(maxAcceleration * comfortDeceleration);
+
+                for (int k = 0; k < count; k++)
+                {
+                    int i = start + k;
+                    float x = position[i];
+                    float v = speed[i];
+                    uint vehicleId = id[i];
+                    float desired = laneSpeedLimit[l] * TrafficMath.DesiredFactor(vehicleId);
+
+                    // Nearest obstacle ahead: leader in lane, red stop line, or tail of the next lane
+                    float gap = float.MaxValue;
+                    float closing = 0f;
+                    if (k > 0)
+                    {
+                        gap = position[i - 1] - x - vehicleLength;
+                        closing = v - speed[i - 1];
+                    }
+                    else if (!green && length - x > v * v / (2f * maxBraking))
+                    {
+                        gap = length - x;
+                        closing = v;
+                    }
+                    else
+                    {
+                        int target = nextLane[i];
+                        int tailCount = laneVehicles[target];
+                        if (tailCount > 0)
+                        {
+                            int tail = laneStart[target] + tailCount - 1;
+                            gap = length - x + position[tail] - vehicleLength;
+                            closing = v - speed[tail];
+                        }
+                    }
+
+                    float free = 1f - math.pow(v / math.max(0.1f, desired), 4f);
+                    float interaction = 0f;
+                    if (gap < float.MaxValue)
+                    {
+                        float desiredGap = minimumGap + math.max(0f, v * timeHeadway + v * closing / (2f * sqrtAB));
+                        float ratio = desiredGap / math.max(0.1f, gap);
+                        interaction = ratio * ratio;
+                    }
+                    float acceleration = math.max(-maxBraking, maxAcceleration * (free - interaction));
+
+                    float v1 = math.max(0f, v + acceleration * deltaTime);
+                    float dx = 0.5f * (v + v1) * deltaTime;
+                    if (gap < float.MaxValue) dx = math.min(dx, math.max(0f, gap));
+
+                    float x1 = x + dx;
+                    int laneOut = l;
+                    int route = nextLane[i];
+                    if (x1 >= length)
+                    {
+                        x1 -= length;
+                        laneOut = route;
+                        route = TrafficMath.Route(vehicleId, laneOut, successorStart, successorCount, successors);
+                    }
+
+                    newPosition[i] = x1;
+                    newSpeed[i] = v1;
+                    newLane[i] = laneOut;
+                    newNextLane[i] = route;
+                    newId[i] = vehicleId;
+
+                    speedSum += v1;
+                    freeSum += desired;
+                    if (v1 < 0.5f) stopped += 1f;
+                }
+
+                lanePartials[l] = new float4(speedSum, freeSum, stopped, count);
+            }
+
+            private bool IsGreen(int l)
+            {
+                int node = laneEndNode[l];
+                if (nodeSignalised[node] == 0) return true;
+
+                // Two phases per cycle: east-west roads, then north-south
+                int phase = (int)math.floor((time + nodeOffset[node]) / (signalCycle * 0.5f)) & 1;
+                return phase == laneAxis[l];
+            }
+        }
+
+        [BurstCompile]
+        private struct ReduceJob : IJob
+        {
+            [ReadOnly] public NativeArray<float4> lanePartials;
+            public NativeArray<float> stats;
+
+            public void Execute()
+            {
+                float4 total = default;
+                for (int l = 0; l < lanePartials.Length; l++)
+                {
+                    total += lanePartials[l];
+                }
+
+                float count = math.max(1f, total.w);
+                stats[0] = total.x / count;
+                stats[1] = total.y / count;
+                stats[2] = total.z / count;
+            }
+        }
+
+        [BurstCompile]
+        private struct RebucketJob : IJob
+        {
+            public NativeArray<int> laneVehicles;
+            public NativeArray<int> laneStart;
+            [ReadOnly] public NativeArray<float> newPosition;
+            [ReadOnly] public NativeArray<float> newSpeed;
+            [ReadOnly] public NativeArray<int> newLane;
+            [ReadOnly] public NativeArray<int> newNextLane;
+            [ReadOnly] public NativeArray<uint> newId;
+            [WriteOnly] public NativeArray<float> position;
+            [WriteOnly] public NativeArray<float> speed;
+            [WriteOnly] public NativeArray<int> lane;
+            [WriteOnly] public NativeArray<int> nextLane;
+            [WriteOnly] public NativeArray<uint> id;
+
+            public void Execute()
+            {
+                int lanes = laneVehicles.Length;
+                for (int l = 0; l < lanes; l++) laneVehicles[l] = 0;
+                for (int i = 0; i < newLane.Length; i++) laneVehicles[newLane[i]]++;
+
+                int offset = 0;
+                for (int l = 0; l < lanes; l++)
+                {
+                    laneStart[l] = offset;
+                    offset += laneVehicles[l];
+                    laneVehicles[l] = 0;
+                }
+
+                for (int i = 0; i < newLane.Length; i++)
+                {
+                    int l = newLane[i];
+                    int target = laneStart[l] + laneVehicles[l]++;
+                    position[target] = newPosition[i];
+                    speed[target] = newSpeed[i];
+                    lane[target] = l;
+                    nextLane[target] = newNextLane[i];
+                    id[target] = newId[i];
+                }
+            }
+        }
+
+        // Lanes are already ordered apart from the few vehicles that just entered, so
+        // insertion sort is close to a single pass
+        [BurstCompile]
+        private struct LaneSortJob : IJobParallelFor
+        {
+            [ReadOnly] public NativeArray<int> laneStart;
+            [ReadOnly] public NativeArray<int> laneVehicles;
+            [NativeDisableParallelForRestriction] public NativeArray<float> position;
+            [NativeDisableParallelForRestriction] public NativeArray<float> speed;
+            [NativeDisableParallelForRestriction] public NativeArray<int> nextLane;
+            [NativeDisableParallelForRestriction] public NativeArray<uint> id;
+
+            public void Execute(int l)
+            {
+                int start = laneStart[l];
+                int end = start + laneVehicles[l];
+
+                for (int i = start + 1; i < end; i++)
+                {
+                    float x = position[i];
+                    if (x <= position[i - 1]) continue;
+
+                    float v = speed[i];
+                    int route = nextLane[i];
+                    uint vehicleId = id[i];
+
+                    int j = i - 1;
+                    while (j >= start && position[j] < x)
+                    {
+                        position[j + 1] = position[j];
+                        speed[j + 1] = speed[j];
+                        nextLane[j + 1] = nextLane[j];
+                        id[j + 1] = id[j];
+                        j--;
+                    }
+
+                    position[j + 1] = x;
+                    speed[j + 1] = v;
+                    nextLane[j + 1] = route;
+                    id[j + 1] = vehicleId;
+                }
+            }
+        }
+
+        #endregion
+    }
+
+    internal static class TrafficMath
+    {
+        public static uint Hash(uint value, uint seed)
+        {
+            uint h = value * 0x9E3779B1u ^ seed * 0x85EBCA77u;
+            h ^= h >> 15;
+            h *= 0x2C1B3C6Du;
+            h ^= h >> 12;
+            h *= 0x297A2D39u;
+            h ^= h >> 15;
+            return h;
+        }
+
+        // 85-115% of the limit, fixed per driver
+        public static float DesiredFactor(uint vehicleId)
+        {
+            return 0.85f + 0.3f * ((vehicleId & 0xFFFFu) / 65535f);
+        }
+
+        // Turn choice depends on the driver and the lane, so routes differ but replay identically
+        public static int Route(uint vehicleId, int fromLane, NativeArray<int> successorStart, NativeArray<int> successorCount, NativeArray<int> successors)
+        {
+            int count = successorCount[fromLane];
+            uint pick = Hash(vehicleId, (uint)fromLane) % (uint)count;
+            return successors[successorStart[fromLane] + (int)pick];
+        }
+    }
+}
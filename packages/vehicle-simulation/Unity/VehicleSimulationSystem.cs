@@ -1,6 +1,11 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Jobs;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.VehicleSimulation
 {
@@ -13,10 +18,22 @@ namespace UnitySim.VehicleSimulation
 
         public VehicleSimulationData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             vehiclesimulation = new VehicleSimulationInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (vehiclesimulation != null)
+                vehiclesimulation.WriteState(writer, "vehiclesimulation");
+            else
+                writer.Write("vehiclesimulation", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +47,102 @@ namespace UnitySim.VehicleSimulation
         public float fuelConsumption = 8.5f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-vehicle-simulation";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("vehicles", vehicles);
+            writer.Write("averageSpeed", averageSpeed);
+            writer.Write("trafficLights", trafficLights);
+            writer.Write("congestionLevel", congestionLevel);
+            writer.Write("accidents", accidents);
+            writer.Write("fuelConsumption", fuelConsumption);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public VehicleSimulationField Diff(VehicleSimulationInfo other)
+        {
+            var changed = VehicleSimulationField.None;
+            if (vehicles != other.vehicles) changed |= VehicleSimulationField.Vehicles;
+            if (averageSpeed != other.averageSpeed) changed |= VehicleSimulationField.AverageSpeed;
+            if (trafficLights != other.trafficLights) changed |= VehicleSimulationField.TrafficLights;
+            if (congestionLevel != other.congestionLevel) changed |= VehicleSimulationField.CongestionLevel;
+            if (accidents != other.accidents) changed |= VehicleSimulationField.Accidents;
+            if (fuelConsumption != other.fuelConsumption) changed |= VehicleSimulationField.FuelConsumption;
+            if (systemHealth != other.systemHealth) changed |= VehicleSimulationField.SystemHealth;
+            if (framework != other.framework) changed |= VehicleSimulationField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(VehicleSimulationInfo target)
+        {
+            target.vehicles = vehicles;
+            target.averageSpeed = averageSpeed;
+            target.trafficLights = trafficLights;
+            target.congestionLevel = congestionLevel;
+            target.accidents = accidents;
+            target.fuelConsumption = fuelConsumption;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum VehicleSimulationField
+    {
+        None = 0,
+        Vehicles = 1 << 0,
+        AverageSpeed = 1 << 1,
+        TrafficLights = 1 << 2,
+        CongestionLevel = 1 << 3,
+        Accidents = 1 << 4,
+        FuelConsumption = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
     }
 
-    public class VehicleSimulationSystem : MonoBehaviour
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct VehicleSimulationDelta
+    {
+        public readonly long timestamp;
+        public readonly VehicleSimulationField changed;
+        public readonly VehicleSimulationInfo values;
+
+        public VehicleSimulationDelta(long timestamp, VehicleSimulationField changed, VehicleSimulationInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(VehicleSimulationField fields)
+        {
+            return (changed & fields) != 0;
+        }
+    }
+
+    public class VehicleSimulationSystem : MonoBehaviour, ISimulationSystem, IReplicatedEntitySource
     {
         [Header("VehicleSimulation Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Road Network")]
+        public int gridSize = 32;
+        public float blockLength = 200f;
+        public float speedLimitKmh = 50f;
+        public float signalCycle = 60f;
+
+        [Header("Traffic")]
+        public int vehicleCount = 50000;
+        public float maxTrafficStep = 0.25f;
+        public int randomSeed = 0;
+        [SerializeField] private float lastWaitMs = 0f;
+
         [Header("Current Data")]
         [SerializeField] private VehicleSimulationData currentData;
 
@@ -48,12 +152,19 @@ namespace UnitySim.VehicleSimulation
 
         // Events
         public System.Action<VehicleSimulationData> OnVehicleSimulationChanged;
+        public System.Action<VehicleSimulationDelta> OnVehicleSimulationDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.VehicleSimulationSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly VehicleSimulationInfo publishedInfo = new VehicleSimulationInfo();
+        private bool publishFullDelta = true;
+        private TrafficEngine traffic;
 
         #region Unity Lifecycle
 
@@ -62,18 +173,22 @@ namespace UnitySim.VehicleSimulation
             InitializeVehicleSimulation();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            UpdateSystem();
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDestroy()
+        {
+            traffic?.Dispose();
+            traffic = null;
         }
 
         #endregion
@@ -83,6 +198,12 @@ namespace UnitySim.VehicleSimulation
         private void InitializeVehicleSimulation()
         {
             currentData = new VehicleSimulationData();
+
+            traffic?.Dispose();
+            uint seed = randomSeed != 0 ? (uint)randomSeed : (uint)UnityEngine.Random.Range(1, int.MaxValue);
+            traffic = new TrafficEngine(gridSize, blockLength, speedLimitKmh / 3.6f, vehicleCount, seed);
+            traffic.SignalCycle = signalCycle;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,23 +214,50 @@ namespace UnitySim.VehicleSimulation
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
-                        currentData.vehiclesimulation.vehicles += UnityEngine.Random.Range(-2, 5);
-            currentData.vehiclesimulation.averageSpeed = Mathf.Clamp(currentData.vehiclesimulation.averageSpeed + UnityEngine.Random.Range(-5f, 5f), 15f, 80f);
-            currentData.vehiclesimulation.congestionLevel = Mathf.Clamp(currentData.vehiclesimulation.congestionLevel + UnityEngine.Random.Range(-0.1f, 0.1f), 0f, 1f);
+            if (traffic == null) return;
+
+            // The previous tick's steps ran on the workers since; only the wait for them is timed
+            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+            traffic.Complete();
+            lastWaitMs = (float)stopwatch.Elapsed.TotalMilliseconds;
+            UpdateAggregates();
+
+            // Substeps keep the car-following integration stable over long scheduler intervals;
+            // they are one job chain, completed at the start of the next tick
+            int substeps = Mathf.Max(1, Mathf.CeilToInt(deltaTime / Mathf.Max(0.01f, maxTrafficStep)));
+            float step = deltaTime / substeps;
+            var handle = default(JobHandle);
+            for (int i = 0; i < substeps; i++)
+            {
+                handle = traffic.Schedule(step, handle);
+            }
+            JobHandle.ScheduleBatchedJobs();
+        }
+
+        private void UpdateAggregates()
+        {
+            var info = currentData.vehiclesimulation;
+            info.vehicles = traffic.VehicleCount;
+            info.trafficLights = traffic.SignalisedIntersections;
+            info.averageSpeed = traffic.MeanSpeed * 3.6f;
+            info.congestionLevel = traffic.MeanFreeFlowSpeed > 0f ? Mathf.Clamp01(1f - traffic.MeanSpeed / traffic.MeanFreeFlowSpeed) : 0f;
+
+            // Cruising baseline plus idling in queues, in L/100km
+            info.fuelConsumption = 6f + 8f * traffic.StoppedFraction;
         }
 
         private void ProcessUpdate()
@@ -122,6 +270,12 @@ namespace UnitySim.VehicleSimulation
                 OnVehicleSimulationChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -129,10 +283,85 @@ namespace UnitySim.VehicleSimulation
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.vehiclesimulation;
+            var changed = publishFullDelta ? VehicleSimulationField.All : info.Diff(publishedInfo);
+            if (changed == VehicleSimulationField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnVehicleSimulationDelta?.Invoke(new VehicleSimulationDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(VehicleSimulationSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Replication
+
+        public int EntityCount => traffic != null ? traffic.VehicleCount : 0;
+
+        // Speed in km/h and heading in degrees
+        public int EntityValueCount => 2;
+
+        public void GetEntity(int index, out uint id, out Vector3 position, Span<float> values)
+        {
+            var world = traffic.GetVehiclePosition(index, out float heading);
+            id = traffic.GetVehicleId(index);
+            position = new Vector3(world.x, world.y, world.z);
+            values[0] = traffic.Speeds[index] * 3.6f;
+            values[1] = heading;
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("VehicleSimulationSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -143,7 +372,9 @@ namespace UnitySim.VehicleSimulation
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -164,6 +395,11 @@ namespace UnitySim.VehicleSimulation
             return currentData;
         }
 
+        public TrafficEngine GetTraffic()
+        {
+            return traffic;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -195,7 +431,7 @@ namespace UnitySim.VehicleSimulation
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -207,6 +443,14 @@ namespace UnitySim.VehicleSimulation
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            gridSize = Mathf.Max(2, gridSize);
+            blockLength = Mathf.Max(10f, blockLength);
+            speedLimitKmh = Mathf.Max(5f, speedLimitKmh);
+            signalCycle = Mathf.Max(10f, signalCycle);
+            vehicleCount = Mathf.Max(0, vehicleCount);
+            maxTrafficStep = Mathf.Max(0.01f, maxTrafficStep);
+
+            if (traffic != null) traffic.SignalCycle = signalCycle;
         }
 
         #endregion
@@ -218,7 +462,10 @@ namespace UnitySim.VehicleSimulation
             Debug.Log($"VehicleSimulationSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
             Debug.Log($"- Updates Count: {updateCounter}");
+            if (traffic != null)
+                Debug.Log($"- Traffic: {traffic.VehicleCount} vehicles on {traffic.LaneCount} lanes, last wait {lastWaitMs:F2}ms");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");
         }
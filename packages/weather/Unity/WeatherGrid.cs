@@ -0,0 +1,179 @@
+using System;
+using UnityEngine;
+using UnitySim.Core;
+
+namespace UnitySim.Weather
+{
+    // Tiled weather over the XZ plane. Rows run south to north like latitude bands, and
+    // each field is a flat array indexed by tile. Tiles only change when they are updated,
+    // so a tick costs the number of active + dirty + background tiles, not the map size.
+    public class WeatherGrid
+    {
+        public readonly int columns;
+        public readonly int rows;
+        public readonly Vector2 origin;
+        public readonly float tileSize;
+
+        public readonly float[] temperature;
+        public readonly float[] humidity;
+        public readonly float[] pressure;
+        public readonly float[] windSpeed;
+        public readonly float[] windDirection;
+        public readonly float[] precipitation;
+
+        // Offset from the global temperature per row: warmest in the middle band
+        private readonly float[] latitudeOffset;
+        private readonly double[] lastUpdate;
+        private readonly int[] queue;
+        private readonly bool[] queued;
+        private int queueCount = 0;
+        private int backgroundCursor = 0;
+        private double time = 0.0;
+
+        public int TileCount => columns * rows;
+        public int PendingTiles => queueCount;
+        public double Time => time;
+
+        // Seconds for a tile to close ~63% of the gap to the regional target
+        public float RelaxationTime { get; set; } = 600f;
+
+        public WeatherGrid(int columns, int rows, Vector2 origin, float tileSize, float latitudeGradient, WeatherInfo initial)
+        {
+            this.columns = Math.Max(1, columns);
+            this.rows = Math.Max(1, rows);
+            this.origin = origin;
+            this.tileSize = Math.Max(0.01f, tileSize);
+
+            int count = this.columns * this.rows;
+            temperature = new float[count];
+            humidity = new float[count];
+            pressure = new float[count];
+            windSpeed = new float[count];
+            windDirection = new float[count];
+            precipitation = new float[count];
+            lastUpdate = new double[count];
+            queue = new int[count];
+            queued = new bool[count];
+
+            latitudeOffset = new float[this.rows];
+            for (int r = 0; r < this.rows; r++)
+            {
+                float latitude = this.rows == 1 ? 0f : (r / (float)(this.rows - 1)) * 2f - 1f;
+                latitudeOffset[r] = -latitudeGradient * latitude * latitude;
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                temperature[i] = initial.temperature + latitudeOffset[i / this.columns];
+                humidity[i] = initial.humidity;
+                pressure[i] = initial.pressure;
+                windSpeed[i] = initial.windSpeed;
+                precipitation[i] = PrecipitationFor(initial.humidity);
+            }
+        }
+
+        #region Queries
+
+        public int TileAt(Vector3 position)
+        {
+            int column = Mathf.Clamp((int)((position.x - origin.x) / tileSize), 0, columns - 1);
+            int row = Mathf.Clamp((int)((position.z - origin.y) / tileSize), 0, rows - 1);
+            return column + row * columns;
+        }
+
+        public WeatherSample Sample(Vector3 position)
+        {
+            return Sample(TileAt(position));
+        }
+
+        public WeatherSample Sample(int tile)
+        {
+            return new WeatherSample(temperature[tile], humidity[tile], pressure[tile], windSpeed[tile], windDirection[tile], precipitation[tile]);
+        }
+
+        #endregion
+
+        #region Dirty Tracking
+
+        public void MarkDirty(int tile)
+        {
+            if (tile < 0 || tile >= queue.Length || queued[tile]) return;
+
+            queued[tile] = true;
+            queue[queueCount++] = tile;
+        }
+
+        // Queues every tile whose cell lies within radius of position
+        public void MarkDirty(Vector3 position, float radius)
+        {
+            int minColumn = Mathf.Clamp((int)((position.x - radius - origin.x) / tileSize), 0, columns - 1);
+            int maxColumn = Mathf.Clamp((int)((position.x + radius - origin.x) / tileSize), 0, columns - 1);
+            int minRow = Mathf.Clamp((int)((position.z - radius - origin.y) / tileSize), 0, rows - 1);
+            int maxRow = Mathf.Clamp((int)((position.z + radius - origin.y) / tileSize), 0, rows - 1);
+
+            for (int row = minRow; row <= maxRow; row++)
+            {
+                for (int column = minColumn; column <= maxColumn; column++)
+                {
+                    MarkDirty(column + row * columns);
+                }
+            }
+        }
+
+        #endregion
+
+        #region Update
+
+        // Advances grid time, then brings queued tiles plus up to backgroundBudget others
+        // up to date with the global state. Returns the number of tiles updated.
+        public int Update(float deltaTime, WeatherInfo global, int backgroundBudget)
+        {
+            time += deltaTime;
+
+            int budget = Math.Min(Math.Max(0, backgroundBudget), TileCount);
+            for (int i = 0; i < budget; i++)
+            {
+                MarkDirty(backgroundCursor);
+                backgroundCursor = (backgroundCursor + 1) % TileCount;
+            }
+
+            int updated = queueCount;
+            for (int i = 0; i < queueCount; i++)
+            {
+                int tile = queue[i];
+                queued[tile] = false;
+                UpdateTile(tile, global);
+            }
+            queueCount = 0;
+
+            return updated;
+        }
+
+        private void UpdateTile(int tile, WeatherInfo global)
+        {
+            // Tiles left idle catch up in one step; the exponential keeps large gaps stable
+            float elapsed = (float)(time - lastUpdate[tile]);
+            lastUpdate[tile] = time;
+            if (elapsed <= 0f) return;
+
+            float blend = 1f - Mathf.Exp(-elapsed / Mathf.Max(1f, RelaxationTime));
+            float noise = Mathf.Min(1f, Mathf.Sqrt(elapsed / Mathf.Max(1f, RelaxationTime)));
+
+            float targetTemperature = global.temperature + latitudeOffset[tile / columns];
+            temperature[tile] += (targetTemperature - temperature[tile]) * blend + UnityEngine.Random.Range(-1f, 1f) * noise;
+            humidity[tile] = Mathf.Clamp(humidity[tile] + (global.humidity - humidity[tile]) * blend + UnityEngine.Random.Range(-5f, 5f) * noise, 0f, 100f);
+            pressure[tile] += (global.pressure - pressure[tile]) * blend + UnityEngine.Random.Range(-2f, 2f) * noise;
+            windSpeed[tile] = Mathf.Max(0f, windSpeed[tile] + (global.windSpeed - windSpeed[tile]) * blend + UnityEngine.Random.Range(-1f, 1f) * noise);
+            windDirection[tile] = Mathf.Repeat(windDirection[tile] + UnityEngine.Random.Range(-20f, 20f) * noise, 360f);
+            precipitation[tile] = PrecipitationFor(humidity[tile]);
+        }
+
+        // Rain starts above 80% humidity and grows linearly, in mm/h
+        private static float PrecipitationFor(float humidity)
+        {
+            return humidity > 80f ? (humidity - 80f) * 0.05f : 0f;
+        }
+
+        #endregion
+    }
+}
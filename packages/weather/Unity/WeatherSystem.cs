@@ -1,6 +1,10 @@
 using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.Text;
+using Unity.Profiling;
 using UnityEngine;
-using Newtonsoft.Json;
+using UnitySim.Core;
 
 namespace UnitySim.Weather
 {
@@ -13,10 +17,22 @@ namespace UnitySim.Weather
 
         public WeatherData()
         {
-            timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
-            currentTime = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            timestamp = SimulationClock.Now;
+            currentTime = SimulationClock.Now;
             weather = new WeatherInfo();
         }
+
+        public void WriteState(IStateWriter writer)
+        {
+            writer.BeginObject(null);
+            writer.Write("timestamp", timestamp);
+            writer.Write("currentTime", currentTime);
+            if (weather != null)
+                weather.WriteState(writer, "weather");
+            else
+                writer.Write("weather", (string)null);
+            writer.EndObject();
+        }
     }
 
     [System.Serializable]
@@ -30,15 +46,102 @@ namespace UnitySim.Weather
         public float precipitation = 0f;
         public string systemHealth = "operational";
         public string framework = "unity-sim-weather";
+
+        public void WriteState(IStateWriter writer, string name)
+        {
+            writer.BeginObject(name);
+            writer.Write("temperature", temperature);
+            writer.Write("humidity", humidity);
+            writer.Write("pressure", pressure);
+            writer.Write("windSpeed", windSpeed);
+            writer.Write("conditions", conditions);
+            writer.Write("precipitation", precipitation);
+            writer.Write("systemHealth", systemHealth);
+            writer.Write("framework", framework);
+            writer.EndObject();
+        }
+
+        public WeatherField Diff(WeatherInfo other)
+        {
+            var changed = WeatherField.None;
+            if (temperature != other.temperature) changed |= WeatherField.Temperature;
+            if (humidity != other.humidity) changed |= WeatherField.Humidity;
+            if (pressure != other.pressure) changed |= WeatherField.Pressure;
+            if (windSpeed != other.windSpeed) changed |= WeatherField.WindSpeed;
+            if (conditions != other.conditions) changed |= WeatherField.Conditions;
+            if (precipitation != other.precipitation) changed |= WeatherField.Precipitation;
+            if (systemHealth != other.systemHealth) changed |= WeatherField.SystemHealth;
+            if (framework != other.framework) changed |= WeatherField.Framework;
+            return changed;
+        }
+
+        public void CopyTo(WeatherInfo target)
+        {
+            target.temperature = temperature;
+            target.humidity = humidity;
+            target.pressure = pressure;
+            target.windSpeed = windSpeed;
+            target.conditions = conditions;
+            target.precipitation = precipitation;
+            target.systemHealth = systemHealth;
+            target.framework = framework;
+        }
+    }
+
+    [System.Flags]
+    public enum WeatherField
+    {
+        None = 0,
+        Temperature = 1 << 0,
+        Humidity = 1 << 1,
+        Pressure = 1 << 2,
+        WindSpeed = 1 << 3,
+        Conditions = 1 << 4,
+        Precipitation = 1 << 5,
+        SystemHealth = 1 << 6,
+        Framework = 1 << 7,
+        All = (1 << 8) - 1
+    }
+
+    // Fields changed since the previous publish; values is the snapshot taken at that publish
+    public readonly struct WeatherDelta
+    {
+        public readonly long timestamp;
+        public readonly WeatherField changed;
+        public readonly WeatherInfo values;
+
+        public WeatherDelta(long timestamp, WeatherField changed, WeatherInfo values)
+        {
+            this.timestamp = timestamp;
+            this.changed = changed;
+            this.values = values;
+        }
+
+        public bool Has(WeatherField fields)
+        {
+            return (changed & fields) != 0;
+        }
     }
 
-    public class WeatherSystem : MonoBehaviour
+    public class WeatherSystem : MonoBehaviour, IJobSimulatedSystem, ISimulationSystem, IWeatherProvider
     {
         [Header("Weather Settings")]
         public float updateInterval = 1f;
         public bool enableLogging = false;
         public bool enableEvents = true;
 
+        [Header("Weather Field")]
+        public bool enableWeatherField = true;
+        public Vector2 fieldOrigin = new Vector2(-5000f, -5000f);
+        public Vector2Int fieldTiles = new Vector2Int(64, 64);
+        public float tileSize = 156.25f;
+        public float latitudeGradient = 15f;
+        public float relaxationTime = 600f;
+        public Transform[] focusPoints;
+        public float activeRadius = 1500f;
+        public int backgroundTilesPerTick = 64;
+        [SerializeField] private int lastTilesUpdated = 0;
+
         [Header("Current Data")]
         [SerializeField] private WeatherData currentData;
 
@@ -48,12 +151,21 @@ namespace UnitySim.Weather
 
         // Events
         public System.Action<WeatherData> OnWeatherChanged;
+        public System.Action<WeatherDelta> OnWeatherDelta;
         public System.Action<string> OnDataExported;
+        public event System.Action<ISimulationSystem> SystemUpdated;
 
         // Private fields
-        private float updateTimer = 0f;
         private bool isInitialized = false;
         private int updateCounter = 0;
+        private readonly SimulationJsonWriter jsonWriter = new SimulationJsonWriter();
+        private static readonly ProfilerMarker ExportMarker = new ProfilerMarker("UnitySim.WeatherSystem.Export");
+        private readonly PooledBufferWriter exportBuffer = new PooledBufferWriter(512);
+        private readonly WeatherInfo publishedInfo = new WeatherInfo();
+        private bool publishFullDelta = true;
+        private int stateVersion = 0;
+        private WeatherGrid grid;
+        private long lastGridTimestamp = 0;
 
         #region Unity Lifecycle
 
@@ -62,18 +174,16 @@ namespace UnitySim.Weather
             InitializeWeather();
         }
 
-        void Update()
+        void OnEnable()
         {
-            if (!isInitialized) return;
-
-            UpdateSystem();
+            SimulationScheduler.Register(this);
+            SimulationRegistry.Register(this);
+        }
 
-            updateTimer += Time.deltaTime;
-            if (updateTimer >= updateInterval)
-            {
-                ProcessUpdate();
-                updateTimer = 0f;
-            }
+        void OnDisable()
+        {
+            SimulationRegistry.Unregister(this);
+            SimulationScheduler.Unregister(this);
         }
 
         #endregion
@@ -83,6 +193,13 @@ namespace UnitySim.Weather
         private void InitializeWeather()
         {
             currentData = new WeatherData();
+            stateVersion++;
+
+            grid = enableWeatherField
+                ? new WeatherGrid(fieldTiles.x, fieldTiles.y, fieldOrigin, tileSize, latitudeGradient, currentData.weather) { RelaxationTime = relaxationTime }
+                : null;
+            lastGridTimestamp = currentData.timestamp;
+            publishFullDelta = true;
             isInitialized = true;
 
             if (enableLogging)
@@ -93,19 +210,19 @@ namespace UnitySim.Weather
 
         #region Update Logic
 
-        private void UpdateSystem()
+        private void UpdateSystem(float deltaTime, long timestamp)
         {
             if (currentData == null) return;
 
             // Update timestamps
-            currentData.timestamp = DateTimeOffset.Now.ToUnixTimeMilliseconds();
+            currentData.timestamp = timestamp;
             currentData.currentTime = currentData.timestamp;
 
             // Package-specific updates
-            UpdateSpecificData();
+            UpdateSpecificData(deltaTime);
         }
 
-        private void UpdateSpecificData()
+        private void UpdateSpecificData(float deltaTime)
         {
                         currentData.weather.temperature += UnityEngine.Random.Range(-2f, 2f);
             currentData.weather.windSpeed = Mathf.Max(0f, currentData.weather.windSpeed + UnityEngine.Random.Range(-1f, 1f));
@@ -117,12 +234,21 @@ namespace UnitySim.Weather
         {
             updateCounter++;
 
+            // Runs at publish so main-thread and job modes both see the latest global state
+            UpdateWeatherField();
+
             // Trigger events
             if (enableEvents && OnWeatherChanged != null)
             {
                 OnWeatherChanged.Invoke(currentData);
             }
 
+            if (enableEvents)
+            {
+                PublishDelta();
+                SystemUpdated?.Invoke(this);
+            }
+
             // Optional logging
             if (enableLogging && updateCounter % 10 == 0)
             {
@@ -130,10 +256,118 @@ namespace UnitySim.Weather
             }
         }
 
+        private void PublishDelta()
+        {
+            var info = currentData.weather;
+            var changed = publishFullDelta ? WeatherField.All : info.Diff(publishedInfo);
+            if (changed == WeatherField.None) return;
+
+            info.CopyTo(publishedInfo);
+            publishFullDelta = false;
+            OnWeatherDelta?.Invoke(new WeatherDelta(currentData.timestamp, changed, publishedInfo));
+        }
+
+        private void UpdateWeatherField()
+        {
+            if (grid == null) return;
+
+            float elapsed = Mathf.Max(0f, (currentData.timestamp - lastGridTimestamp) / 1000f);
+            lastGridTimestamp = currentData.timestamp;
+
+            if (focusPoints != null)
+            {
+                for (int i = 0; i < focusPoints.Length; i++)
+                {
+                    if (focusPoints[i] != null)
+                        grid.MarkDirty(focusPoints[i].position, activeRadius);
+                }
+            }
+
+            lastTilesUpdated = grid.Update(elapsed, currentData.weather, backgroundTilesPerTick);
+        }
+
+        #endregion
+
+        #region Scheduling
+
+        public string SystemName => nameof(WeatherSystem);
+        public float UpdateInterval => updateInterval;
+        public int MaxUpdatesPerFrame => maxUpdatesPerFrame;
+        public bool EnableOptimization => enableOptimization;
+        public bool IsInitialized => isInitialized;
+
+        void IScheduledSystem.Tick(float deltaTime, long timestamp)
+        {
+            UpdateSystem(deltaTime, timestamp);
+        }
+
+        void IScheduledSystem.ProcessScheduledUpdate()
+        {
+            ProcessUpdate();
+        }
+
+        #endregion
+
+        #region Job Backend
+
+        public int StateVersion => stateVersion;
+
+        public void DescribeChannels(List<SimulationChannel> channels)
+        {
+            channels.Add(SimulationChannel.Add(-2f, 2f));
+            channels.Add(SimulationChannel.Add(-1f, 1f).WithMin(0f));
+            channels.Add(SimulationChannel.SetInt(30, 95));
+            channels.Add(SimulationChannel.Add(-5f, 5f));
+        }
+
+        public void WriteChannels(double[] values)
+        {
+            values[0] = currentData.weather.temperature;
+            values[1] = currentData.weather.windSpeed;
+            values[2] = currentData.weather.humidity;
+            values[3] = currentData.weather.pressure;
+        }
+
+        public void ReadChannels(double[] values, long timestamp)
+        {
+            currentData.timestamp = timestamp;
+            currentData.currentTime = timestamp;
+            currentData.weather.temperature = (float)values[0];
+            currentData.weather.windSpeed = (float)values[1];
+            currentData.weather.humidity = (int)values[2];
+            currentData.weather.pressure = (float)values[3];
+        }
+
         #endregion
 
         #region Public API
 
+        public void ExportState(IBufferWriter<byte> output)
+        {
+            using (ExportMarker.Auto())
+            {
+                jsonWriter.Reset(output);
+
+                if (currentData == null)
+                {
+                    Debug.LogWarning("WeatherSystem: Cannot export - no data available");
+                    jsonWriter.BeginObject(null);
+                    jsonWriter.EndObject();
+                    return;
+                }
+
+                currentData.WriteState(jsonWriter);
+            }
+        }
+
+        public bool WriteState(IStateWriter writer)
+        {
+            if (currentData == null) return false;
+
+            currentData.WriteState(writer);
+            return true;
+        }
+
         public string ExportState()
         {
             if (currentData == null)
@@ -144,7 +378,9 @@ namespace UnitySim.Weather
 
             try
             {
-                string jsonData = JsonConvert.SerializeObject(currentData, Formatting.Indented);
+                exportBuffer.Clear();
+                ExportState(exportBuffer);
+                string jsonData = Encoding.UTF8.GetString(exportBuffer.WrittenSpan);
 
                 OnDataExported?.Invoke(jsonData);
 
@@ -165,6 +401,26 @@ namespace UnitySim.Weather
             return currentData;
         }
 
+        public WeatherSample SampleWeather(Vector3 position)
+        {
+            if (grid != null)
+                return grid.Sample(position);
+
+            var weather = currentData != null ? currentData.weather : publishedInfo;
+            return new WeatherSample(weather.temperature, weather.humidity, weather.pressure, weather.windSpeed, 0f, weather.precipitation);
+        }
+
+        // Forces tiles around position to refresh on the next publish, e.g. after a disaster
+        public void MarkWeatherDirty(Vector3 position, float radius)
+        {
+            grid?.MarkDirty(position, radius);
+        }
+
+        public WeatherGrid GetWeatherGrid()
+        {
+            return grid;
+        }
+
         public void SetUpdateInterval(float interval)
         {
             updateInterval = Mathf.Max(0.1f, interval);
@@ -196,7 +452,7 @@ namespace UnitySim.Weather
         [ContextMenu("Force Update")]
         public void ForceUpdate()
         {
-            UpdateSystem();
+            UpdateSystem(UnityEngine.Time.deltaTime, SimulationClock.Now);
             ProcessUpdate();
         }
 
@@ -208,6 +464,13 @@ namespace UnitySim.Weather
         {
             updateInterval = Mathf.Max(0.1f, updateInterval);
             maxUpdatesPerFrame = Mathf.Max(1, maxUpdatesPerFrame);
+            fieldTiles = new Vector2Int(Mathf.Max(1, fieldTiles.x), Mathf.Max(1, fieldTiles.y));
+            tileSize = Mathf.Max(1f, tileSize);
+            relaxationTime = Mathf.Max(1f, relaxationTime);
+            backgroundTilesPerTick = Mathf.Max(0, backgroundTilesPerTick);
+
+            if (grid != null)
+                grid.RelaxationTime = relaxationTime;
         }
 
         #endregion
@@ -219,6 +482,8 @@ namespace UnitySim.Weather
             Debug.Log($"WeatherSystem Info:");
             Debug.Log($"- Initialized: {isInitialized}");
             Debug.Log($"- Update Interval: {updateInterval}s");
+            Debug.Log($"- Optimization: {enableOptimization} (max {maxUpdatesPerFrame} updates/frame)");
+            Debug.Log($"- Weather Field: {(grid != null ? $"{grid.columns}x{grid.rows} tiles, {lastTilesUpdated} updated last tick" : "disabled")}");
             Debug.Log($"- Updates Count: {updateCounter}");
             Debug.Log($"- Events Enabled: {enableEvents}");
             Debug.Log($"- Logging Enabled: {enableLogging}");